@@ -0,0 +1,63 @@
+#!/usr/bin/env bash
+# v0.14.0: インタプリタの実行時間とピークRSS（最大常駐メモリ）の計測
+#
+# 使い方: scripts/benchmark_memory.sh [比較用バイナリ] [対象ファイル...]
+#   比較用バイナリ（例: 以前のmain）を指定すると同じファイルでの
+#   実行時間とピークRSSを並べて表示する。"-" なら比較しない。
+#   対象ファイル省略時は sample/async/benchmark_many_tasks.cb を計測する
+#   ピークRSSは子プロセスのgetrusage(ru_maxrss)から取得する（python3が必要）
+
+set -u
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+MAIN="$ROOT_DIR/main"
+BASELINE="${1:--}"
+shift || true
+
+if [ ! -x "$MAIN" ]; then
+    echo "Error: $MAIN not found (run 'make' first)" >&2
+    exit 1
+fi
+if ! command -v python3 >/dev/null 2>&1; then
+    echo "Error: python3 is required to read the peak RSS" >&2
+    exit 1
+fi
+
+if [ "$#" -gt 0 ]; then
+    FILES=("$@")
+else
+    FILES=("$ROOT_DIR/sample/async/benchmark_many_tasks.cb")
+fi
+
+# 指定バイナリで1回実行し "ミリ秒 ピークRSS(KB)" を出力する
+measure() {
+    python3 - "$1" "$2" <<'EOF'
+import resource
+import subprocess
+import sys
+import time
+
+start = time.time()
+subprocess.run(sys.argv[1:], stdout=subprocess.DEVNULL,
+               stderr=subprocess.DEVNULL)
+elapsed_ms = int((time.time() - start) * 1000)
+max_rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+if sys.platform == "darwin":
+    max_rss //= 1024  # macOSはバイト単位
+print(elapsed_ms, max_rss)
+EOF
+}
+
+printf "%-32s %10s %12s %14s %14s\n" "file" "main(ms)" "main(KB)" \
+    "baseline(ms)" "baseline(KB)"
+for file in "${FILES[@]}"; do
+    name="$(basename "$file")"
+    read -r main_ms main_kb < <(measure "$MAIN" "$file")
+    base_ms="-"
+    base_kb="-"
+    if [ "$BASELINE" != "-" ]; then
+        read -r base_ms base_kb < <(measure "$BASELINE" "$file")
+    fi
+    printf "%-32s %10s %12s %14s %14s\n" "$name" "$main_ms" "$main_kb" \
+        "$base_ms" "$base_kb"
+done
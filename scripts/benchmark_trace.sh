@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+# v0.14.0: トレース無効時のインタプリタ実行時間の計測
+#
+# 使い方: scripts/benchmark_trace.sh [反復回数] [比較用バイナリ] [対象ファイル...]
+#   比較用バイナリ（例: 以前のmainや TRACE=0 でビルドしたmain）を指定すると
+#   同じファイルでの実行時間を並べて表示する。"-" なら比較しない。
+#   対象ファイル省略時は sample/algorithm/*.cb を計測する
+
+set -u
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+MAIN="$ROOT_DIR/main"
+ITERATIONS="${1:-5}"
+BASELINE="${2:--}"
+shift 2 || shift $#
+
+if [ ! -x "$MAIN" ]; then
+    echo "Error: $MAIN not found (run 'make' first)" >&2
+    exit 1
+fi
+
+if [ "$#" -gt 0 ]; then
+    FILES=("$@")
+else
+    FILES=("$ROOT_DIR"/sample/algorithm/*.cb)
+fi
+
+# 指定バイナリで ITERATIONS 回実行した平均ミリ秒
+measure() {
+    local binary="$1"
+    local file="$2"
+    local start end
+    start=$(date +%s%N)
+    for ((i = 0; i < ITERATIONS; i++)); do
+        "$binary" "$file" >/dev/null 2>&1
+    done
+    end=$(date +%s%N)
+    echo $(((end - start) / ITERATIONS / 1000000))
+}
+
+printf "%-32s %10s %12s %8s\n" "file" "main(ms)" "baseline(ms)" "speedup"
+for file in "${FILES[@]}"; do
+    name="$(basename "$file")"
+    main_ms=$(measure "$MAIN" "$file")
+    base_ms="-"
+    speedup="-"
+    if [ "$BASELINE" != "-" ]; then
+        base_ms=$(measure "$BASELINE" "$file")
+        if [ "$main_ms" -gt 0 ]; then
+            speedup=$(awk "BEGIN { printf \"%.2fx\", $base_ms / $main_ms }")
+        fi
+    fi
+    printf "%-32s %10s %12s %8s\n" "$name" "$main_ms" "$base_ms" "$speedup"
+done
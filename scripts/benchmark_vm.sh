@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# v0.14.0: ツリーウォーカーとバイトコードVM（--engine=vm）の実行時間比較
+#
+# 使い方: scripts/benchmark_vm.sh [反復回数] [対象ファイル...]
+#   対象ファイル省略時は sample/algorithm/*.cb を計測する
+#   VMのサブセット外のファイルはツリーウォーカーにフォールバックするため
+#   "fallback" と表示される
+
+set -u
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+MAIN="$ROOT_DIR/main"
+ITERATIONS="${1:-10}"
+shift || true
+
+if [ ! -x "$MAIN" ]; then
+    echo "Error: $MAIN not found (run 'make' first)" >&2
+    exit 1
+fi
+
+if [ "$#" -gt 0 ]; then
+    FILES=("$@")
+else
+    FILES=("$ROOT_DIR"/sample/algorithm/*.cb)
+fi
+
+# 指定エンジンで ITERATIONS 回実行した平均ミリ秒
+measure() {
+    local engine="$1"
+    local file="$2"
+    local start end
+    start=$(date +%s%N)
+    for ((i = 0; i < ITERATIONS; i++)); do
+        "$MAIN" --engine="$engine" "$file" >/dev/null 2>&1
+    done
+    end=$(date +%s%N)
+    echo $(((end - start) / ITERATIONS / 1000000))
+}
+
+printf "%-32s %10s %10s %8s  %s\n" "file" "tree(ms)" "vm(ms)" "speedup" "status"
+for file in "${FILES[@]}"; do
+    name="$(basename "$file")"
+    status="vm"
+    if "$MAIN" --engine=vm --debug "$file" 2>&1 >/dev/null |
+        grep -q "falling back to tree-walker"; then
+        status="fallback"
+    fi
+    if ! diff <("$MAIN" --engine=tree "$file" 2>&1) \
+        <("$MAIN" --engine=vm "$file" 2>&1) >/dev/null; then
+        status="$status, OUTPUT MISMATCH"
+    fi
+
+    tree_ms=$(measure tree "$file")
+    vm_ms=$(measure vm "$file")
+    speedup="-"
+    if [ "$vm_ms" -gt 0 ]; then
+        speedup=$(awk "BEGIN { printf \"%.1fx\", $tree_ms / $vm_ms }")
+    fi
+    printf "%-32s %10s %10s %8s  %s\n" "$name" "$tree_ms" "$vm_ms" "$speedup" "$status"
+done
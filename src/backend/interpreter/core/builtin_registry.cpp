@@ -0,0 +1,150 @@
+#include "builtin_registry.h"
+#include "../evaluator/builtins/builtins.h"
+#include "../ffi_manager.h"
+#include "interpreter.h"
+
+namespace {
+
+struct BuiltinEntry {
+    const char *name;
+    BuiltinId id;
+    BuiltinRegistry::Handler handler;
+};
+
+// 組み込み関数の一覧（名前・ID・ハンドラ）
+// 新しい組み込み関数はBuiltinIdに追加し、evaluator/builtins/に
+// ハンドラを実装してここに1行登録する
+const BuiltinEntry kBuiltins[] = {
+    {"hex", BuiltinId::HEX, builtin_hex},
+    {"memcpy", BuiltinId::MEMCPY, builtin_memcpy},
+    {"sizeof_type", BuiltinId::SIZEOF_TYPE, builtin_sizeof_type},
+    {"array_get", BuiltinId::ARRAY_GET, builtin_array_get},
+    {"array_set", BuiltinId::ARRAY_SET, builtin_array_set},
+    {"default", BuiltinId::DEFAULT, builtin_default},
+    {"call_function_pointer", BuiltinId::CALL_FUNCTION_POINTER,
+     builtin_call_function_pointer},
+    {"array_get_int", BuiltinId::ARRAY_GET_INT, builtin_array_get_int},
+    {"array_set_int", BuiltinId::ARRAY_SET_INT, builtin_array_set_int},
+    {"array_get_long", BuiltinId::ARRAY_GET_LONG, builtin_array_get_long},
+    {"array_set_long", BuiltinId::ARRAY_SET_LONG, builtin_array_set_long},
+    {"array_get_char", BuiltinId::ARRAY_GET_CHAR, builtin_array_get_char},
+    {"array_set_char", BuiltinId::ARRAY_SET_CHAR, builtin_array_set_char},
+    {"array_get_bool", BuiltinId::ARRAY_GET_BOOL, builtin_array_get_bool},
+    {"array_set_bool", BuiltinId::ARRAY_SET_BOOL, builtin_array_set_bool},
+    {"sizeof", BuiltinId::SIZEOF, builtin_sizeof},
+    {"malloc", BuiltinId::MALLOC, builtin_malloc},
+    {"free", BuiltinId::FREE, builtin_free},
+    {"array_get_double", BuiltinId::ARRAY_GET_DOUBLE, builtin_array_get_double},
+    {"array_set_double", BuiltinId::ARRAY_SET_DOUBLE, builtin_array_set_double},
+    {"array_get_string", BuiltinId::ARRAY_GET_STRING, builtin_array_get_string},
+    {"array_set_string", BuiltinId::ARRAY_SET_STRING, builtin_array_set_string},
+    {"array_get_struct", BuiltinId::ARRAY_GET_STRUCT, builtin_array_get_struct},
+    {"array_set_struct", BuiltinId::ARRAY_SET_STRUCT, builtin_array_set_struct},
+    {"run_event_loop", BuiltinId::RUN_EVENT_LOOP, builtin_run_event_loop},
+    {"concurrent_await", BuiltinId::CONCURRENT_AWAIT, builtin_concurrent_await},
+    {"race", BuiltinId::RACE, builtin_race},
+    {"now", BuiltinId::NOW, builtin_now},
+    {"timeout", BuiltinId::TIMEOUT, builtin_timeout},
+    {"sleep", BuiltinId::SLEEP, builtin_sleep},
+    {"sleep_ms", BuiltinId::SLEEP_MS, builtin_sleep_ms},
+    {"set_async_quantum", BuiltinId::SET_ASYNC_QUANTUM,
+     builtin_set_async_quantum},
+    {"set_async_time_slice", BuiltinId::SET_ASYNC_TIME_SLICE,
+     builtin_set_async_time_slice},
+    {"with_priority", BuiltinId::WITH_PRIORITY, builtin_with_priority},
+    {"with_deadline", BuiltinId::WITH_DEADLINE, builtin_with_deadline},
+    {"priority_queue_create", BuiltinId::PRIORITY_QUEUE_CREATE,
+     builtin_priority_queue_create},
+    {"priority_queue_push", BuiltinId::PRIORITY_QUEUE_PUSH,
+     builtin_priority_queue_push},
+    {"priority_queue_pop", BuiltinId::PRIORITY_QUEUE_POP,
+     builtin_priority_queue_pop},
+    {"priority_queue_size", BuiltinId::PRIORITY_QUEUE_SIZE,
+     builtin_priority_queue_size},
+    {"priority_queue_clear", BuiltinId::PRIORITY_QUEUE_CLEAR,
+     builtin_priority_queue_clear},
+    {"channel_create", BuiltinId::CHANNEL_CREATE, builtin_channel_create},
+    {"channel_send", BuiltinId::CHANNEL_SEND, builtin_channel_send},
+    {"channel_recv", BuiltinId::CHANNEL_RECV, builtin_channel_recv},
+    {"channel_wait", BuiltinId::CHANNEL_WAIT, builtin_channel_wait},
+    {"channel_close", BuiltinId::CHANNEL_CLOSE, builtin_channel_close},
+    {"channel_len", BuiltinId::CHANNEL_LEN, builtin_channel_len},
+    {"io_pipe", BuiltinId::IO_PIPE, builtin_io_pipe},
+    {"io_socketpair", BuiltinId::IO_SOCKETPAIR, builtin_io_socketpair},
+    {"tcp_listen", BuiltinId::TCP_LISTEN, builtin_tcp_listen},
+    {"tcp_connect", BuiltinId::TCP_CONNECT, builtin_tcp_connect},
+    {"unix_listen", BuiltinId::UNIX_LISTEN, builtin_unix_listen},
+    {"unix_connect", BuiltinId::UNIX_CONNECT, builtin_unix_connect},
+    {"socket_port", BuiltinId::SOCKET_PORT, builtin_socket_port},
+    {"io_read", BuiltinId::IO_READ, builtin_io_read},
+    {"io_write", BuiltinId::IO_WRITE, builtin_io_write},
+    {"io_accept", BuiltinId::IO_ACCEPT, builtin_io_accept},
+    {"io_close", BuiltinId::IO_CLOSE, builtin_io_close},
+};
+
+} // namespace
+
+BuiltinRegistry::BuiltinRegistry()
+    : handlers_(static_cast<size_t>(BuiltinId::FOREIGN) + 1, nullptr) {
+    for (const auto &entry : kBuiltins) {
+        ids_[entry.name] = entry.id;
+        handlers_[static_cast<size_t>(entry.id)] = entry.handler;
+    }
+    // FFI関数は名前ではなくFFIManagerへの問い合わせで解決する
+    handlers_[static_cast<size_t>(BuiltinId::FOREIGN)] = builtin_foreign;
+}
+
+BuiltinId BuiltinRegistry::register_native(const std::string &name,
+                                           NativeFunction function) {
+    BuiltinId id = static_cast<BuiltinId>(
+        static_cast<int>(BuiltinId::NATIVE_BASE) + natives_.size());
+    natives_.push_back(std::move(function));
+    ids_[name] = id;
+    return id;
+}
+
+BuiltinId BuiltinRegistry::lookup(const std::string &name) const {
+    auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : BuiltinId::NONE;
+}
+
+BuiltinId BuiltinRegistry::resolve_call(const ASTNode *node,
+                                        Interpreter &interpreter) const {
+    if (node->builtin_id >= 0) {
+        return static_cast<BuiltinId>(node->builtin_id);
+    }
+
+    // メソッド・修飾呼び出しとユーザー定義関数は組み込み関数ではない
+    if (node->left || node->is_lambda_call ||
+        interpreter.find_function(node->name)) {
+        node->builtin_id = static_cast<int16_t>(BuiltinId::NONE);
+        return BuiltinId::NONE;
+    }
+
+    // 同名の関数ポインタがある間は解決を保留する（キャッシュしない）
+    auto &local_ptrs = interpreter.current_scope().function_pointers;
+    auto &global_ptrs = interpreter.get_global_scope().function_pointers;
+    Variable *var = interpreter.find_variable(node->name);
+    if (local_ptrs.count(node->name) || global_ptrs.count(node->name) ||
+        (var && var->is_function_pointer)) {
+        return BuiltinId::NONE;
+    }
+
+    BuiltinId id = lookup(node->name);
+    if (id == BuiltinId::NONE && interpreter.get_ffi_manager() &&
+        interpreter.get_ffi_manager()->isForeignFunction(node->name)) {
+        id = BuiltinId::FOREIGN;
+    }
+    node->builtin_id = static_cast<int16_t>(id);
+    return id;
+}
+
+const BuiltinRegistry::NativeFunction *
+BuiltinRegistry::native_function(BuiltinId id) const {
+    if (!is_native(id)) {
+        return nullptr;
+    }
+    size_t index = static_cast<size_t>(static_cast<int>(id) -
+                                       static_cast<int>(BuiltinId::NATIVE_BASE));
+    return index < natives_.size() ? &natives_[index] : nullptr;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "../../../common/ast.h"
+#include "type_inference.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ExpressionEvaluator;
+class Interpreter;
+
+// v0.14.0: 組み込み関数のID
+// AST_FUNC_CALLノードのbuiltin_idに保存され、呼び出し時はIDで引いた
+// ハンドラを直接呼ぶ。NATIVE_BASE以降は埋め込み側が登録した関数。
+enum class BuiltinId : int16_t {
+    NONE = 0,
+    HEX,
+    MEMCPY,
+    SIZEOF_TYPE,
+    ARRAY_GET,
+    ARRAY_SET,
+    DEFAULT,
+    CALL_FUNCTION_POINTER,
+    ARRAY_GET_INT,
+    ARRAY_SET_INT,
+    ARRAY_GET_LONG,
+    ARRAY_SET_LONG,
+    ARRAY_GET_CHAR,
+    ARRAY_SET_CHAR,
+    ARRAY_GET_BOOL,
+    ARRAY_SET_BOOL,
+    SIZEOF,
+    MALLOC,
+    FREE,
+    ARRAY_GET_DOUBLE,
+    ARRAY_SET_DOUBLE,
+    ARRAY_GET_STRING,
+    ARRAY_SET_STRING,
+    ARRAY_GET_STRUCT,
+    ARRAY_SET_STRUCT,
+    RUN_EVENT_LOOP,
+    CONCURRENT_AWAIT,
+    RACE,
+    NOW,
+    TIMEOUT,
+    SLEEP,
+    SLEEP_MS,
+    SET_ASYNC_QUANTUM,
+    SET_ASYNC_TIME_SLICE,
+    WITH_PRIORITY,
+    WITH_DEADLINE,
+    PRIORITY_QUEUE_CREATE,
+    PRIORITY_QUEUE_PUSH,
+    PRIORITY_QUEUE_POP,
+    PRIORITY_QUEUE_SIZE,
+    PRIORITY_QUEUE_CLEAR,
+    CHANNEL_CREATE,
+    CHANNEL_SEND,
+    CHANNEL_RECV,
+    CHANNEL_WAIT,
+    CHANNEL_CLOSE,
+    CHANNEL_LEN,
+    IO_PIPE,
+    IO_SOCKETPAIR,
+    TCP_LISTEN,
+    TCP_CONNECT,
+    UNIX_LISTEN,
+    UNIX_CONNECT,
+    SOCKET_PORT,
+    IO_READ,
+    IO_WRITE,
+    IO_ACCEPT,
+    IO_CLOSE,
+    FOREIGN, // FFIManagerに登録された外部関数
+    NATIVE_BASE = 1000,
+};
+
+// v0.14.0: 組み込み関数の名前→ID→ハンドラのテーブル
+// 呼び出しノードは初回評価時に一度だけ解決され、以後は文字列比較なしで
+// ハンドラに到達する。組み込み関数の実装はevaluator/builtins/の
+// ハンドラ関数にあり、埋め込み側はregister_native()でcall_impl.cppを
+// 変更せずにネイティブ関数を追加できる。
+class BuiltinRegistry {
+  public:
+    // 組み込み関数のハンドラ（引数は未評価のまま呼び出しノードで受け取る）
+    using Handler = int64_t (*)(ExpressionEvaluator &, const ASTNode *);
+
+
+    // 評価済みの引数を受け取るネイティブ組み込み関数
+    // 戻り値が文字列ならstring、浮動小数点ならdouble、それ以外は整数として扱う
+    using NativeFunction = std::function<TypedValue(
+        Interpreter &, const std::vector<TypedValue> &)>;
+
+    BuiltinRegistry();
+
+    // ネイティブ組み込み関数を登録する（同名の組み込み関数は上書きされる）
+    BuiltinId register_native(const std::string &name, NativeFunction function);
+
+    BuiltinId lookup(const std::string &name) const;
+
+    // 呼び出しノードを解決し、結果をnode->builtin_idにキャッシュする
+    // ユーザー定義関数・関数ポインタ・メソッド呼び出しはNONE
+    BuiltinId resolve_call(const ASTNode *node, Interpreter &interpreter) const;
+
+    // 組み込み関数のハンドラ（ネイティブ関数・未登録のIDはnullptr）
+    Handler handler(BuiltinId id) const {
+        size_t index = static_cast<size_t>(id);
+        return index < handlers_.size() ? handlers_[index] : nullptr;
+    }
+
+    const NativeFunction *native_function(BuiltinId id) const;
+
+    static bool is_native(BuiltinId id) { return id >= BuiltinId::NATIVE_BASE; }
+
+  private:
+    std::unordered_map<std::string, BuiltinId> ids_;
+    std::vector<Handler> handlers_; // BuiltinIdで添字付け
+    std::vector<NativeFunction> natives_;
+};
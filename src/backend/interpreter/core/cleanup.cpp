@@ -13,7 +13,7 @@
 // ========================================================================
 void Interpreter::push_scope() {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "push_scope: destructor_stacks_ size before: %zu",
@@ -23,16 +23,16 @@ void Interpreter::push_scope() {
     }
 
     variable_manager_->push_scope();
-    statement_position_stack_.emplace_back(
-        std::make_shared<std::map<const ASTNode *, size_t>>());
-    current_scope().statement_positions = statement_position_stack_.back();
+    // v0.14.0: 再開位置マップはcurrent_statement_positions()で遅延確保
+    statement_position_stack_.emplace_back();
+    current_scope().statement_positions.reset();
     push_defer_scope();
     // v0.10.0: デストラクタスタックも追加
     destructor_stacks_.push_back(
         std::vector<std::pair<std::string, std::string>>());
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "push_scope: destructor_stacks_ size after: %zu",
@@ -44,7 +44,7 @@ void Interpreter::push_scope() {
 
 void Interpreter::push_scope(const std::string &scope_id) {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "push_scope(scope_id='%s'): destructor_stacks_ size "
@@ -55,9 +55,9 @@ void Interpreter::push_scope(const std::string &scope_id) {
     }
 
     variable_manager_->push_scope();
-    statement_position_stack_.emplace_back(
-        std::make_shared<std::map<const ASTNode *, size_t>>());
-    current_scope().statement_positions = statement_position_stack_.back();
+    // v0.14.0: 再開位置マップはcurrent_statement_positions()で遅延確保
+    statement_position_stack_.emplace_back();
+    current_scope().statement_positions.reset();
     push_defer_scope();
     // v0.10.0: デストラクタスタックも追加
     destructor_stacks_.push_back(
@@ -68,7 +68,7 @@ void Interpreter::push_scope(const std::string &scope_id) {
     // 現在は未実装
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -79,7 +79,11 @@ void Interpreter::push_scope(const std::string &scope_id) {
     }
 }
 
-void Interpreter::pop_scope() {
+void Interpreter::pop_scope() { pop_scope_impl(nullptr); }
+
+void Interpreter::pop_scope_into(VariableMap &frame) { pop_scope_impl(&frame); }
+
+void Interpreter::pop_scope_impl(VariableMap *retained_frame) {
     if (debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "[SCOPE] pop_scope: destructor_stacks_ size before: %zu");
@@ -98,7 +102,7 @@ void Interpreter::pop_scope() {
             destructor_stacks_.pop_back();
 
             if (debug_mode && !destroy_list.empty()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[SCOPE] pop_scope: calling %zu destructors",
@@ -107,13 +111,15 @@ void Interpreter::pop_scope() {
                 }
             }
 
+            // v0.14.0: return/break中でもデストラクタ本体は通常どおり実行する
+            Completion pending = suspend_completion();
             for (auto it = destroy_list.rbegin(); it != destroy_list.rend();
                  ++it) {
                 const std::string &var_name = it->first;
                 const std::string &struct_type_name = it->second;
 
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -126,13 +132,14 @@ void Interpreter::pop_scope() {
                 // デストラクタを呼び出す
                 call_destructor(var_name, struct_type_name);
             }
+            resume_completion(std::move(pending));
         } else {
             // デストラクタ呼び出し中：スタックだけpop（デストラクタは呼ばない）
             destructor_stacks_.pop_back();
         }
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -187,6 +194,12 @@ void Interpreter::pop_scope() {
         }
     }
 
+    // デストラクタ・defer・コピーバックの後で変数をフレームへ移す
+    // （std::mapのノードは移動しないため、変数へのポインタも有効なまま）
+    if (retained_frame) {
+        *retained_frame = std::move(scope_to_pop.variables);
+    }
+
     if (!statement_position_stack_.empty()) {
         statement_position_stack_.pop_back();
     }
@@ -202,7 +215,7 @@ void Interpreter::pop_scope() {
 // ========================================================================
 void Interpreter::push_destructor_scope() {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DESTRUCTOR] push_destructor_scope: destructor_stacks_ "
@@ -219,7 +232,7 @@ void Interpreter::push_destructor_scope() {
         std::vector<std::pair<std::string, std::string>>());
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DESTRUCTOR] push_destructor_scope: destructor_stacks_ "
@@ -247,7 +260,7 @@ void Interpreter::pop_destructor_scope() {
             destructor_stacks_.pop_back();
 
             if (debug_mode && !destroy_list.empty()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[DESTRUCTOR] pop_destructor_scope: calling %zu "
@@ -257,13 +270,15 @@ void Interpreter::pop_destructor_scope() {
                 }
             }
 
+            // v0.14.0: return/break中でもデストラクタ本体は通常どおり実行する
+            Completion pending = suspend_completion();
             for (auto it = destroy_list.rbegin(); it != destroy_list.rend();
                  ++it) {
                 const std::string &var_name = it->first;
                 const std::string &struct_type_name = it->second;
 
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -275,6 +290,7 @@ void Interpreter::pop_destructor_scope() {
 
                 call_destructor(var_name, struct_type_name);
             }
+            resume_completion(std::move(pending));
         } else {
             // デストラクタ呼び出し中：スタックだけpop（デストラクタは呼ばない）
             destructor_stacks_.pop_back();
@@ -302,7 +318,7 @@ Scope &Interpreter::current_scope() {
 // ========================================================================
 void Interpreter::push_defer_scope() {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEFER] push_defer_scope: defer_stacks_ size before: %zu",
@@ -312,7 +328,7 @@ void Interpreter::push_defer_scope() {
     }
     defer_stacks_.push_back(std::vector<const ASTNode *>());
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEFER] push_defer_scope: defer_stacks_ size after: %zu",
@@ -324,7 +340,7 @@ void Interpreter::push_defer_scope() {
 
 void Interpreter::pop_defer_scope() {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEFER] pop_defer_scope: defer_stacks_ size before: %zu",
@@ -347,7 +363,7 @@ void Interpreter::pop_defer_scope() {
     defer_stacks_.pop_back();
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEFER] pop_defer_scope: executing %zu defers",
@@ -356,6 +372,8 @@ void Interpreter::pop_defer_scope() {
         }
     }
 
+    // v0.14.0: ループ/関数からのreturn中でもdefer本体は最後まで実行する
+    Completion pending = suspend_completion();
     for (auto it = defers_to_execute.rbegin(); it != defers_to_execute.rend();
          ++it) {
         try {
@@ -365,6 +383,7 @@ void Interpreter::pop_defer_scope() {
             // (Goの仕様と同様)
         }
     }
+    resume_completion(std::move(pending));
 }
 
 void Interpreter::add_defer(const ASTNode *stmt) {
@@ -3,7 +3,9 @@
 #include "../../../common/debug.h"
 #include "../../../frontend/recursive_parser/recursive_parser.h"
 #include "../ffi_manager.h" // v0.13.0: FFI Manager
+#include "builtin_registry.h"
 #include "evaluator/core/evaluator.h"
+#include "evaluator/functions/generic_instantiation.h"
 #include "event_loop/event_loop.h"
 #include "event_loop/simple_event_loop.h" // v0.13.0 Phase 2.0
 #include "executors/control_flow_executor.h"
@@ -133,6 +135,13 @@ Interpreter::Interpreter(bool debug)
     // v0.13.0: FFI Manager を初期化
     ffi_manager_ = std::make_unique<cb::FFIManager>();
 
+    // v0.14.0: 組み込み関数テーブルを初期化
+    builtin_registry_ = std::make_unique<BuiltinRegistry>();
+
+    // v0.14.0: ジェネリック関数のインスタンス化キャッシュを初期化
+    generic_instances_ =
+        std::make_unique<GenericInstantiation::InstanceCache>();
+
     // v0.13.0 Phase 2.0: SimpleEventLoop を初期化
     simple_event_loop_ = std::make_unique<cb::SimpleEventLoop>(*this);
 
@@ -211,7 +220,7 @@ void Interpreter::sync_impl_definitions_from_parser(RecursiveParser *parser) {
 
         // 所有権を移動
         for (auto &node : parser_impl_nodes) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[SYNC_IMPL] Transferring impl_node=%p, "
@@ -223,7 +232,7 @@ void Interpreter::sync_impl_definitions_from_parser(RecursiveParser *parser) {
         }
         parser_impl_nodes.clear();
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -237,7 +246,7 @@ void Interpreter::sync_impl_definitions_from_parser(RecursiveParser *parser) {
     // Parserのimpl_definitions_をクリア（Parser破棄時のuse-after-free対策）
     // これらはInterpreterに転送されるので、Parser側では不要
     auto &parser_impl_defs = parser->get_impl_definitions_for_clear();
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[SYNC_IMPL] Clearing %zu impl_definitions from parser",
@@ -6,9 +6,11 @@
 #include "../../../common/utf8_utils.h"
 #include "../../../frontend/recursive_parser/recursive_parser.h"
 #include "../ffi_manager.h" // v0.13.0: FFI Manager
+#include "core/builtin_registry.h"
 #include "core/error_handler.h"
 #include "core/pointer_metadata.h"
 #include "core/type_inference.h"
+#include "core/variable_resolver.h"
 #include "evaluator/core/evaluator.h"
 #include "evaluator/functions/generic_instantiation.h"
 #include "executors/control_flow_executor.h" // 制御フロー実行サービス
@@ -46,6 +48,7 @@
 #include "utility.h"
 
 // v0.12.0: Event Loop
+#include "event_loop/clock.h" // v0.14.0: steady_now_us
 #include "event_loop/event_loop.h"
 #include "event_loop/simple_event_loop.h" // v0.13.0 Phase 2.0
 
@@ -56,6 +59,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -89,7 +93,13 @@
 // ========================================================================
 
 // デストラクタ（unique_ptrの完全な型定義が必要なため、ここに残す）
-Interpreter::~Interpreter() = default;
+Interpreter::~Interpreter() {
+    // v0.14.0: ジェネリック関数のインスタンスを解放する
+    // （呼び出し箇所に残った記録はキャッシュの世代が変わるため使われない）
+    if (generic_instances_) {
+        generic_instances_->clear_cache();
+    }
+}
 
 const ASTNode *Interpreter::find_function(const std::string &name) {
     // グローバルスコープの関数を検索
@@ -391,7 +401,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
             enum_manager_->register_enum(node->name, enum_def);
 
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Successfully registered enum: %s",
@@ -574,14 +584,14 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
         {
             std::string struct_name = node->struct_name;
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Processing impl for struct: %s",
                              struct_name.c_str());
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Number of arguments: %zu",
@@ -594,7 +604,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
                 const auto &arg = node->arguments[i];
                 if (!arg) {
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "Warning: null argument %zu in impl block",
@@ -606,7 +616,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
                 }
 
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Processing argument %zu, node_type: %d", i,
@@ -619,7 +629,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
                     struct_constructors_[struct_name].push_back(arg.get());
                     if (debug_mode) {
                         size_t param_count = arg->parameters.size();
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -631,7 +641,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
                 } else if (arg->node_type == ASTNodeType::AST_DESTRUCTOR_DECL) {
                     struct_destructors_[struct_name] = arg.get();
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "Registered destructor for %s",
@@ -648,7 +658,7 @@ void Interpreter::register_global_declarations(const ASTNode *node) {
             }
 
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Finished processing impl for %s",
@@ -675,6 +685,9 @@ void Interpreter::process(const ASTNode *ast) {
         return;
     }
 
+    // v0.14.0: 変数参照をフレームスロット/グローバルインデックスに解決
+    VariableResolver().resolve(ast);
+
     debug_msg(DebugMsgId::GLOBAL_DECL_START);
     // まずグローバル宣言を登録
     register_global_declarations(ast);
@@ -708,8 +721,16 @@ void Interpreter::process(const ASTNode *ast) {
             debug_msg(DebugMsgId::MAIN_FUNC_BODY_NULL);
         }
 
-        execute_statement(main_func->body.get());
+        {
+            // v0.14.0: main本体のreturnは完了レコードで受け取る
+            auto return_frame = enter_return_frame();
+            execute_statement(main_func->body.get());
+        }
+        auto completed = take_return_completion();
         pop_scope();
+        if (completed) {
+            debug_msg(DebugMsgId::MAIN_FUNC_EXIT, completed->value);
+        }
     } catch (const ReturnException &e) {
         pop_scope(); // return時もスコープをクリーンアップ
         debug_msg(DebugMsgId::MAIN_FUNC_EXIT, e.value);
@@ -812,6 +833,9 @@ void Interpreter::execute_statement(const ASTNode *node) {
     if (!node)
         return;
 
+    // v0.14.0: タイムスライスを1文分消費
+    consume_time_slice();
+
     // ASTNodeTypeが異常な値でないことを確認
     int node_type_int = static_cast<int>(node->node_type);
     if (node_type_int < 0 || node_type_int > 100) {
@@ -1188,7 +1212,7 @@ void Interpreter::assign_union_variable(const std::string &name,
         throw std::runtime_error("Variable is not a union type: " + name);
     }
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -1644,6 +1668,68 @@ void Interpreter::assign_array_parameter(const std::string &name,
     variable_manager_->assign_array_parameter(name, source_array, type);
 }
 
+bool Interpreter::bind_value_parameter(const ASTNode *param,
+                                       const ParamLayout &layout,
+                                       const TypedValue &value) {
+    return variable_manager_->bind_value_parameter(param, layout, value);
+}
+
+const CallLayout &Interpreter::call_layout(const ASTNode *func) {
+    if (func->call_layout && func->call_layout->epoch == method_cache_epoch_) {
+        return *func->call_layout;
+    }
+    if (!func->call_layout) {
+        func->call_layout = std::make_unique<CallLayout>();
+    }
+    CallLayout &layout = *func->call_layout;
+    layout.epoch = method_cache_epoch_;
+    layout.required_args = func->first_default_param_index >= 0
+                               ? func->first_default_param_index
+                               : func->parameters.size();
+    layout.params.assign(func->parameters.size(), ParamLayout());
+
+    // スロット番号はVariableResolver::resolve_functionと同じく、
+    // 名前の重複しない引数に先頭から割り当てる
+    std::unordered_set<std::string> seen;
+    for (size_t i = 0; i < func->parameters.size(); ++i) {
+        const ASTNode *param = func->parameters[i].get();
+        ParamLayout &entry = layout.params[i];
+        if (!param->name.empty() && seen.insert(param->name).second) {
+            entry.slot = static_cast<int>(seen.size()) - 1;
+        }
+
+        // T&&はローカル変数と同じく構造体型のみ参照として扱う
+        if (param->is_reference || (param->is_rvalue_reference &&
+                                    param->type_info == TYPE_STRUCT)) {
+            entry.passing = ParamPassing::REFERENCE;
+        } else if (param->is_array) {
+            entry.passing = ParamPassing::ARRAY;
+        } else if (param->type_info == TYPE_INTERFACE ||
+                   (!param->type_name.empty() &&
+                    find_interface_definition(param->type_name))) {
+            entry.passing = ParamPassing::INTERFACE;
+        } else if (!param->is_pointer &&
+                   param->type_name.find('*') == std::string::npos) {
+            switch (param->type_info) {
+            case TYPE_TINY:
+            case TYPE_SHORT:
+            case TYPE_INT:
+            case TYPE_LONG:
+            case TYPE_CHAR:
+            case TYPE_BOOL:
+            case TYPE_FLOAT:
+            case TYPE_DOUBLE:
+            case TYPE_QUAD:
+                entry.passing = ParamPassing::VALUE;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return layout;
+}
+
 void Interpreter::assign_interface_view(const std::string &dest_name,
                                         Variable interface_var,
                                         const Variable &source_var,
@@ -2296,7 +2382,7 @@ void Interpreter::setMultidimensionalStringArrayElement(
 void Interpreter::assign_array_literal(const std::string &name,
                                        const ASTNode *literal_node) {
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "assign_array_literal called for variable: %s",
@@ -2319,7 +2405,7 @@ void Interpreter::assign_array_literal(const std::string &name,
 
     if (!result.success) {
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "ArrayProcessingService failed for '%s': %s",
@@ -2812,6 +2898,12 @@ void Interpreter::sync_struct_members_from_direct_access(
     struct_sync_manager_->sync_struct_members_from_direct_access(var_name);
 }
 
+void Interpreter::sync_struct_member_from_direct_access(
+    const std::string &var_name, const std::string &member_name) {
+    struct_sync_manager_->sync_struct_member_from_direct_access(var_name,
+                                                                member_name);
+}
+
 void Interpreter::sync_direct_access_from_struct_value(
     const std::string &var_name, const Variable &struct_value) {
     struct_sync_manager_->sync_direct_access_from_struct_value(var_name,
@@ -2832,7 +2924,7 @@ void Interpreter::call_default_constructor(
         // Queue<int> 形式で判定（マングリングしない）
         if (struct_type_name.find('<') != std::string::npos) {
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[GENERIC_CTOR] Looking for impl for %s",
@@ -2882,7 +2974,7 @@ void Interpreter::call_default_constructor(
                 }
             } else {
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[GENERIC_CTOR] No impl found for %s",
@@ -2894,7 +2986,7 @@ void Interpreter::call_default_constructor(
                 // struct定義からメンバー変数を作成
                 Variable *struct_var = find_variable(var_name);
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -2912,7 +3004,7 @@ void Interpreter::call_default_constructor(
                                   "[GENERIC_CTOR] Created struct member ");
                     }
                 } else if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[GENERIC_CTOR] ERROR: Variable %s not found",
@@ -2925,7 +3017,7 @@ void Interpreter::call_default_constructor(
         } else {
             // コンストラクタが定義されていない場合、構造体のメンバーを初期化
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "No constructor defined for struct: %s",
@@ -2939,7 +3031,7 @@ void Interpreter::call_default_constructor(
                 create_struct_member_variables_recursively(
                     var_name, struct_type_name, *struct_var);
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Created struct member variables for %s",
@@ -2964,7 +3056,7 @@ void Interpreter::call_default_constructor(
     if (!default_ctor) {
         // デフォルトコンストラクタが見つからない場合は何もしない
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "No default constructor (0 params) for struct: %s",
@@ -2976,7 +3068,7 @@ void Interpreter::call_default_constructor(
     }
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Calling default constructor for %s.%s",
@@ -2989,7 +3081,7 @@ void Interpreter::call_default_constructor(
     Variable *struct_var = find_variable(var_name);
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: find_variable(%s) returned: %p", var_name.c_str(),
@@ -3008,7 +3100,7 @@ void Interpreter::call_default_constructor(
         current_scope().variables["self"] = self_var;
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Created self variable with %zu struct_members",
@@ -3016,7 +3108,7 @@ void Interpreter::call_default_constructor(
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
             for (const auto &[name, member] : self_var.struct_members) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "  self.%s (type: %d)",
                              name.c_str(), static_cast<int>(member.type));
@@ -3228,7 +3320,7 @@ void Interpreter::call_constructor(const std::string &var_name,
     }
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Calling constructor for %s.%s with %zu arguments",
@@ -3284,21 +3376,21 @@ void Interpreter::call_constructor(const std::string &var_name,
         current_scope().variables[param->name] = param_var;
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "  Parameter %s = ", param->name.c_str());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
             if (arg.type.type_info == TYPE_STRING) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "\"%s\"",
                              arg.string_value.c_str());
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
             } else {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "%lld",
                              (long long)arg.value);
@@ -3433,7 +3525,7 @@ void Interpreter::call_copy_constructor(const std::string &var_name,
     }
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Calling copy constructor for %s from %s",
@@ -3461,7 +3553,7 @@ void Interpreter::call_copy_constructor(const std::string &var_name,
     current_scope().variables[param->name] = *source_var;
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "  Copy parameter %s set to source variable",
@@ -3500,7 +3592,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     Variable *var = find_variable(var_name);
     if (var && var->destructor_called) {
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Destructor already called for %s, skipping",
@@ -3564,7 +3656,7 @@ void Interpreter::call_destructor(const std::string &var_name,
                 std::string generic_name = base_name + "<T>";
 
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Looking for generic destructor: %s -> %s",
@@ -3582,7 +3674,7 @@ void Interpreter::call_destructor(const std::string &var_name,
                     it = struct_destructors_.find(struct_type_name);
 
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "Registered generic destructor %s for %s",
@@ -3609,7 +3701,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     const ASTNode *destructor = it->second;
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Calling destructor for %s (type: %s, unmangled: %s)",
@@ -3658,7 +3750,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     // デストラクタ本体を実行
     if (destructor->body) {
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[DESTRUCTOR] Executing destructor body for %s",
@@ -3708,7 +3800,7 @@ void Interpreter::call_destructor(const std::string &var_name,
                     type_ctx.type_map[param_names[i]] = params[i];
 
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[DESTRUCTOR] TypeContext: %s = %s",
@@ -3734,7 +3826,7 @@ void Interpreter::call_destructor(const std::string &var_name,
         }
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -3759,7 +3851,7 @@ void Interpreter::call_destructor(const std::string &var_name,
             // 参照が使われていない場合のみwriteback
             struct_var->struct_members = self_after->struct_members;
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Wrote back self changes to %s after destructor",
@@ -3773,7 +3865,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     pop_scope(); // デストラクタスコープを終了
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DESTRUCTOR] pop_scope completed for %s",
@@ -3788,7 +3880,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     if (var_after) {
         var_after->destructor_called = true;
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Marked destructor_called for %s", var_name.c_str());
@@ -3798,7 +3890,7 @@ void Interpreter::call_destructor(const std::string &var_name,
     }
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DESTRUCTOR] Completed call_destructor for %s",
@@ -3876,7 +3968,7 @@ void Interpreter::register_destructor_call(
         std::make_pair(var_name, struct_type_name));
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -3924,6 +4016,12 @@ Interpreter::find_impl_for_struct(const std::string &struct_name,
                                                        interface_name);
 }
 
+const InterfaceVTable *
+Interpreter::find_interface_vtable(const std::string &interface_name,
+                                   const std::string &struct_name) {
+    return interface_operations_->find_vtable(interface_name, struct_name);
+}
+
 void Interpreter::create_interface_variable(const std::string &var_name,
                                             const std::string &interface_name) {
     interface_operations_->create_interface_variable(var_name, interface_name);
@@ -4018,7 +4116,7 @@ void Interpreter::register_constructor(const std::string &struct_name,
     struct_constructors_[struct_name].push_back(ctor_node);
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -4038,7 +4136,7 @@ void Interpreter::register_destructor(const std::string &struct_name,
     struct_destructors_[struct_name] = dtor_node;
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[REGISTER_DTOR] Registered destructor for %s",
@@ -4056,17 +4154,184 @@ cb::SimpleEventLoop &Interpreter::get_simple_event_loop() {
     return *simple_event_loop_;
 }
 
+MethodCacheEntry *
+Interpreter::find_method_cache_entry(const ASTNode *node,
+                                     const std::string &receiver_type) {
+    MethodInlineCache *cache = node->method_cache.get();
+    if (cache && cache->epoch != method_cache_epoch_) {
+        // 関数・implが登録された後の最初の呼び出しで作り直す
+        *cache = MethodInlineCache();
+        cache->epoch = method_cache_epoch_;
+        ++method_cache_stats_.invalidations;
+    }
+    if (cache) {
+        for (uint8_t i = 0; i < cache->size; ++i) {
+            if (cache->entries[i].receiver_type == receiver_type) {
+                ++method_cache_stats_.hits;
+                return &cache->entries[i];
+            }
+        }
+    }
+    ++method_cache_stats_.misses;
+    return nullptr;
+}
+
+MethodCacheEntry *
+Interpreter::record_method_cache_entry(const ASTNode *node,
+                                       const std::string &receiver_type,
+                                       const ASTNode *func) {
+    if (!node->method_cache) {
+        node->method_cache = std::make_unique<MethodInlineCache>();
+        node->method_cache->epoch = method_cache_epoch_;
+    }
+    MethodInlineCache &cache = *node->method_cache;
+    // 解決中に関数・implが登録された場合は次の呼び出しで作り直す
+    if (cache.epoch != method_cache_epoch_ || cache.megamorphic) {
+        return nullptr;
+    }
+    if (cache.size == MethodInlineCache::kMaxEntries) {
+        cache.megamorphic = true;
+        ++method_cache_stats_.megamorphic_sites;
+        return nullptr;
+    }
+    if (cache.size == 1) {
+        ++method_cache_stats_.polymorphic_sites;
+    }
+    MethodCacheEntry &entry = cache.entries[cache.size++];
+    entry.receiver_type = receiver_type;
+    entry.func = func;
+    return &entry;
+}
+
+const ASTNode *Interpreter::lookup_vtable_method(const ASTNode *node,
+                                                 const InterfaceVTable &vtable) {
+    if (!node->method_cache) {
+        node->method_cache = std::make_unique<MethodInlineCache>();
+        node->method_cache->epoch = method_cache_epoch_;
+    }
+    MethodInlineCache &cache = *node->method_cache;
+    if (cache.epoch != method_cache_epoch_) {
+        cache = MethodInlineCache();
+        cache.epoch = method_cache_epoch_;
+        ++method_cache_stats_.invalidations;
+    }
+    // 同じinterfaceの値ならメソッド名からスロットを探し直さない
+    if (cache.vtable_interface != vtable.interface_def) {
+        cache.vtable_interface = vtable.interface_def;
+        cache.vtable_slot = -1;
+        if (vtable.interface_def) {
+            const auto &methods = vtable.interface_def->methods;
+            for (size_t i = 0; i < methods.size(); ++i) {
+                if (methods[i].name == node->name) {
+                    cache.vtable_slot = static_cast<int>(i);
+                    break;
+                }
+            }
+        }
+    }
+    if (cache.vtable_slot < 0 ||
+        static_cast<size_t>(cache.vtable_slot) >= vtable.methods.size()) {
+        return nullptr;
+    }
+    const ASTNode *func = vtable.methods[cache.vtable_slot];
+    if (func) {
+        ++method_cache_stats_.vtable_calls;
+    }
+    return func;
+}
+
+MethodCacheEntry *
+Interpreter::vtable_context_entry(const InterfaceVTable &vtable) {
+    if (vtable.context_epoch != method_cache_epoch_) {
+        vtable.context = MethodCacheEntry();
+        vtable.context.receiver_type = vtable.struct_name;
+        vtable.context_epoch = method_cache_epoch_;
+    }
+    return &vtable.context;
+}
+
+void Interpreter::print_method_cache_stats(std::FILE *out) const {
+    uint64_t calls = method_cache_stats_.hits + method_cache_stats_.misses;
+    double hit_rate =
+        calls ? 100.0 * static_cast<double>(method_cache_stats_.hits) / calls
+              : 0.0;
+    std::fprintf(out,
+                 "[dispatch-stats] vtable_calls=%llu method_calls=%llu "
+                 "hits=%llu misses=%llu hit_rate=%.1f%%\n",
+                 static_cast<unsigned long long>(
+                     method_cache_stats_.vtable_calls),
+                 static_cast<unsigned long long>(calls),
+                 static_cast<unsigned long long>(method_cache_stats_.hits),
+                 static_cast<unsigned long long>(method_cache_stats_.misses),
+                 hit_rate);
+    std::fprintf(
+        out,
+        "[dispatch-stats] invalidations=%llu polymorphic_sites=%llu "
+        "megamorphic_sites=%llu\n",
+        static_cast<unsigned long long>(method_cache_stats_.invalidations),
+        static_cast<unsigned long long>(method_cache_stats_.polymorphic_sites),
+        static_cast<unsigned long long>(method_cache_stats_.megamorphic_sites));
+}
+
+void Interpreter::set_async_quantum(int64_t statements) {
+    async_quantum_ = statements > 0 ? statements : 0;
+    reset_time_slice();
+}
+
+void Interpreter::set_async_time_slice_us(int64_t microseconds) {
+    async_time_slice_us_ = microseconds > 0 ? microseconds : 0;
+    reset_time_slice();
+}
+
+TimeSlice Interpreter::begin_time_slice(int64_t statements,
+                                        int64_t microseconds) {
+    TimeSlice previous = time_slice_;
+    if (statements <= 0) {
+        statements =
+            microseconds > 0 ? std::numeric_limits<int64_t>::max() : 1;
+    }
+    time_slice_.statements_left = statements;
+    time_slice_.deadline_us =
+        microseconds > 0 ? cb::steady_now_us() + microseconds : 0;
+    return previous;
+}
+
+bool Interpreter::time_slice_deadline_passed() const {
+    return cb::steady_now_us() >= time_slice_.deadline_us;
+}
+
+// v0.14.0: 文の実行後、スライスを使い切っていれば他のタスクを1サイクル進める
+// mainのスライスはここで開始し直す（タスクのスライスはステップごとに
+// SimpleEventLoopが開始するため、タスク内ではスライス切れのまま）
+void Interpreter::run_queued_tasks_if_slice_expired() {
+    if (!has_queued_async_tasks_ || !time_slice_expired()) {
+        return;
+    }
+    simple_event_loop_->run_one_cycle();
+    if (!is_executing_async_task()) {
+        reset_time_slice();
+    }
+}
+
 // v0.13.0 Phase 2.0: バックグラウンドタスクを1サイクル実行
 // 非async関数のループからバックグラウンドタスクを進めるために使用
 // すべてのバックグラウンドタスクが最低1回実行されるまで継続
+// v0.14.0: 実行中のコンテキストのタイムスライスが残っている間は実行しない
 void Interpreter::run_background_tasks_one_cycle() {
-    if (!simple_event_loop_ || simple_event_loop_->is_empty()) {
+    if (!simple_event_loop_ || simple_event_loop_->is_empty() ||
+        !time_slice_expired()) {
         return;
     }
 
     // すべてのタスクが1ステップ実行されるまで継続
     size_t task_count = simple_event_loop_->task_count();
-    for (size_t i = 0; i < task_count && !simple_event_loop_->is_empty(); i++) {
-        simple_event_loop_->run_one_cycle();
+    for (size_t i = 0; i < task_count; i++) {
+        // 実行可能なタスクがなければ終了（sleep中のタスクは待たない）
+        if (!simple_event_loop_->run_one_cycle()) {
+            break;
+        }
+    }
+    if (!is_executing_async_task()) {
+        reset_time_slice();
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
 #include "../../../common/ast.h"
 #include "../../../common/debug.h"
+#include "packed_array.h"
 #include "type_inference.h"
+#include "value.h"
 #include <cstdio>
 #include <deque>
 #include <iostream>
@@ -20,9 +22,15 @@ namespace cb {
 class EventLoop;
 class SimpleEventLoop;
 class FFIManager;
+struct ChannelWaiter;
 } // namespace cb
 
+namespace GenericInstantiation {
+class InstanceCache;
+} // namespace GenericInstantiation
+
 // 前方宣言
+struct InterfaceVTable;
 class OutputManager;
 class StatementExecutor;
 class VariableManager;
@@ -54,6 +62,7 @@ class InterfaceDeclarationHandler; // インターフェース宣言処理サー
 class ImplDeclarationHandler;     // impl宣言処理サービス
 class ExpressionStatementHandler; // 式文処理サービス
 class RecursiveParser;            // enum定義同期用
+class BuiltinRegistry; // v0.14.0: 組み込み関数テーブル
 
 // 変数・関数の格納構造
 struct Variable {
@@ -105,7 +114,8 @@ struct Variable {
 
     // 配列用
     int array_size = 0;
-    std::vector<int64_t> array_values;
+    // v0.14.0: 整数系の要素は宣言された幅で詰めて保持する
+    PackedIntArray array_values;
     std::vector<float> array_float_values;
     std::vector<double> array_double_values;
     std::vector<long double> array_quad_values;
@@ -121,6 +131,8 @@ struct Variable {
     // interface用
     std::string interface_name;      // interface型の場合のinterface名
     std::string implementing_struct; // interfaceを実装しているstruct名
+    // v0.14.0: implementing_structのメソッド表（assign_interface_viewが設定）
+    const InterfaceVTable *vtable = nullptr;
 
     // 関数ポインタ用
     bool is_function_pointer = false;  // 関数ポインタかどうか
@@ -129,7 +141,7 @@ struct Variable {
     // 多次元配列用
     ArrayTypeInfo array_type_info;     // 多次元配列の型情報
     std::vector<int> array_dimensions; // 各次元のサイズ
-    std::vector<int64_t>
+    PackedIntArray
         multidim_array_values; // 多次元配列データ（フラット化、整数系）
     std::vector<float> multidim_array_float_values;
     std::vector<double> multidim_array_double_values;
@@ -150,8 +162,8 @@ struct Variable {
     Variable(Variable &&) = default;
     Variable &operator=(Variable &&) = default;
 
-    // コピーコンストラクタをデバッグ出力付きで定義
-    __attribute__((noinline)) Variable(const Variable &other) {
+    // コピーコンストラクタ（デバッグ出力は--debug時のみ）
+    Variable(const Variable &other) {
         // すべてのメンバをコピー
         type = other.type;
         is_const = other.is_const;
@@ -186,7 +198,7 @@ struct Variable {
             associated_value = nullptr;
         }
 
-        {
+        if (debug_mode) {
             char dbg_buf[128];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[VAR_COPY_CTOR] Copying Variable: is_enum %d -> %d",
@@ -212,6 +224,7 @@ struct Variable {
         struct_members = other.struct_members;
         interface_name = other.interface_name;
         implementing_struct = other.implementing_struct;
+        vtable = other.vtable;
         is_function_pointer = other.is_function_pointer;
         function_pointer_name = other.function_pointer_name;
         array_type_info = other.array_type_info;
@@ -226,10 +239,10 @@ struct Variable {
         struct_members_ref = other.struct_members_ref;
     }
 
-    // 代入演算子をデバッグ出力付きで定義
+    // 代入演算子（デバッグ出力は--debug時のみ）
     Variable &operator=(const Variable &other) {
         if (this != &other) {
-            {
+            if (debug_mode) {
                 char dbg_buf[128];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -293,6 +306,7 @@ struct Variable {
             struct_members = other.struct_members;
             interface_name = other.interface_name;
             implementing_struct = other.implementing_struct;
+            vtable = other.vtable;
             is_function_pointer = other.is_function_pointer;
             function_pointer_name = other.function_pointer_name;
             array_type_info = other.array_type_info;
@@ -306,7 +320,7 @@ struct Variable {
             // v0.13.1: 参照もコピーする（デストラクタでselfが使用）
             struct_members_ref = other.struct_members_ref;
 
-            {
+            if (debug_mode) {
                 char dbg_buf[256];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[VAR_ASSIGN_OP] After copy: this.is_enum=%d, "
@@ -434,6 +448,37 @@ struct Variable {
 // 前方宣言
 struct Scope;
 
+// v0.14.0: 実行中のコンテキストに残っているタイムスライス
+// 文を実行するたびに statements_left を減らし、0以下になるか期限を過ぎると
+// ループの自動yieldや他タスクの実行で切り替える
+struct TimeSlice {
+    int64_t statements_left = 0;
+    int64_t deadline_us = 0; // steady_clockのマイクロ秒（0=時間制限なし）
+};
+
+// v0.14.0: (interface, 構造体)ごとのメソッド表
+// implを登録したときに作り、interface型の値が指す。スロットは
+// InterfaceDefinition::methodsの順（implにないメソッドはnullptr）
+struct InterfaceVTable {
+    std::string interface_name;
+    std::string struct_name;
+    const InterfaceDefinition *interface_def = nullptr;
+    std::vector<const ASTNode *> methods;
+    // ジェネリックな型コンテキストの検索結果（エポックが変わったら捨てる）
+    mutable MethodCacheEntry context;
+    mutable uint64_t context_epoch = 0;
+};
+
+// v0.14.0: メソッド呼び出しのインラインキャッシュの統計（--dispatch-stats）
+struct MethodCacheStats {
+    uint64_t vtable_calls = 0; // interface型の値のメソッド表から呼んだ呼び出し
+    uint64_t hits = 0;   // キャッシュしたメソッドを使った呼び出し
+    uint64_t misses = 0; // 従来どおり解決した呼び出し
+    uint64_t invalidations = 0; // エポックが変わって捨てた呼び出し箇所
+    uint64_t polymorphic_sites = 0; // 2つ目の型を観測した呼び出し箇所
+    uint64_t megamorphic_sites = 0; // キャッシュをあきらめた呼び出し箇所
+};
+
 // v0.12.0: 非同期タスク情報（Future実行に使用）
 // v0.12.1: EventLoopベースのバックグラウンド実行サポート
 struct AsyncTask {
@@ -449,7 +494,9 @@ struct AsyncTask {
 
     // v0.12.1 Phase 2.0: メソッド呼び出し対応
     bool has_self = false;          // selfが存在するか
-    Variable self_value;            // selfの値
+    // v0.14.0: selfの値（タスクスコープ初期化までの受け渡し用。
+    // タスク記録を小さく保つため実体は別に確保する）
+    std::shared_ptr<Variable> self_value;
     bool has_self_receiver = false; // selfの書き戻し先があるか
     std::string self_receiver_name; // selfの書き戻し先変数名
 
@@ -460,12 +507,8 @@ struct AsyncTask {
         0; // 現在実行中のステートメントインデックス
     std::shared_ptr<Scope> task_scope; // タスク専用スコープ
 
-    // 戻り値
+    // 戻り値（値そのものはFuture.valueに保持する）
     bool has_return_value = false;    // 戻り値があるか
-    int64_t return_value = 0;         // 戻り値（int型の場合）
-    double return_double_value = 0.0; // 戻り値（浮動小数点の場合）
-    std::string return_string_value;  // 戻り値（string型の場合）
-    Variable return_struct_value;     // 戻り値（構造体の場合）
     TypeInfo return_type = TYPE_VOID; // 戻り値の型
     bool return_is_struct = false;    // 戻り値が構造体か
 
@@ -474,6 +517,12 @@ struct AsyncTask {
     bool is_statement_first_time = true; // 現在のステートメントが初回実行か
     std::shared_ptr<std::map<const ASTNode *, size_t>>
         statement_positions; // ステートメント再開位置
+    // v0.14.0: タスク固有のタイムスライス（set_async_quantum等で設定）
+    int64_t quantum = 0;        // 1ステップで実行する文の数（0=全体設定）
+    int64_t time_slice_us = -1; // 1ステップの上限マイクロ秒（負=全体設定）
+    // v0.14.0: 優先度（値が小さいほど先に実行）とデッドライン
+    int priority = 0;
+    int64_t deadline_ms = 0; // エポックからのミリ秒（0=なし）
 
     // v0.12.0: 非同期sleep対応
     bool is_sleeping = false; // sleep中か
@@ -482,6 +531,27 @@ struct AsyncTask {
     // v0.12.1: await対応 - 待機中のタスク管理
     bool is_waiting = false;      // 別のタスクの完了を待機中か
     int waiting_for_task_id = -1; // 待機中のタスクID (-1=待機なし)
+    // v0.14.0: このタスクの完了を待って停止中のタスクID
+    // （完了時に実行キューへ戻す）
+    std::vector<int> waiters;
+
+    // v0.14.0: チャネル待ち（channel_send/channel_recv/channel_wait）
+    // 受信待ちの要素（値が受け渡されたら文を再実行して受け取る）
+    std::shared_ptr<cb::ChannelWaiter> channel_receiver;
+    int pending_channel_sends = 0; // 受信されていない送信待ちの値の数
+    bool is_channel_parked = false; // チャネル待ちで実行キューから外れている
+    // v0.14.0: 非同期I/Oで読み書きを待っているfd（-1 = なし）
+    int io_wait_fd = -1;
+    bool is_io_parked = false; // I/O待ちで実行キューから外れている
+    // v0.14.0: 接続中のソケット（文の再実行で同じ接続を続ける、-1 = なし）
+    int connecting_fd = -1;
+
+    // v0.14.0: concurrent_await/race対応
+    bool is_cancelled = false; // 取り消されたか（完了扱い、Future.valueは既定値）
+    int group_id = -1;         // 所属するタスクグループ (-1=なし)
+
+    // v0.14.0: Futureが捨てられたか（完了時にすぐ解放する）
+    bool is_detached = false;
 
     // v0.12.1: タイムアウト対応
     bool has_timeout = false; // タイムアウトが設定されているか
@@ -492,8 +562,7 @@ struct AsyncTask {
           future_var(nullptr), use_internal_future(true), has_self(false),
           has_self_receiver(false), is_started(false), is_executed(false),
           current_statement_index(0), task_scope(nullptr),
-          has_return_value(false), return_value(0), return_double_value(0.0),
-          return_string_value(""), return_type(TYPE_VOID),
+          has_return_value(false), return_type(TYPE_VOID),
           return_is_struct(false), auto_yield(true),
           is_statement_first_time(true), is_sleeping(false), wake_up_time_ms(0),
           is_waiting(false), waiting_for_task_id(-1), has_timeout(false),
@@ -505,8 +574,7 @@ struct AsyncTask {
           args(std::move(arguments)), future_var(future),
           use_internal_future(true), has_self(false), has_self_receiver(false),
           is_started(false), is_executed(false), current_statement_index(0),
-          task_scope(nullptr), has_return_value(false), return_value(0),
-          return_double_value(0.0), return_string_value(""),
+          task_scope(nullptr), has_return_value(false),
           return_type(TYPE_VOID), return_is_struct(false), auto_yield(true),
           is_statement_first_time(true), is_sleeping(false), wake_up_time_ms(0),
           is_waiting(false), waiting_for_task_id(-1) {}
@@ -527,9 +595,166 @@ struct FunctionPointer {
         : function_node(node), function_name(name), return_type(ret_type) {}
 };
 
+// v0.14.0: VariableResolverのスロット番号で要素を引けるようにした変数マップ
+// スロットは要素へのポインタのキャッシュで、要素が削除されうる操作
+// (erase/clear/コピー代入) で破棄する。コピーはキャッシュを引き継がない。
+// 構造体配列の要素メンバーも同様に、配列ごとの検索キャッシュに覚えておく。
+// std::mapは非公開で継承し、キャッシュを破棄しない変更操作
+// （extract/swap/merge、基底クラス経由のclear）には触れられないようにする
+class VariableMap : private std::map<std::string, Variable> {
+  public:
+    using Base = std::map<std::string, Variable>;
+    using Base::const_iterator;
+    using Base::const_reverse_iterator;
+    using Base::iterator;
+    using Base::key_type;
+    using Base::mapped_type;
+    using Base::reverse_iterator;
+    using Base::size_type;
+    using Base::value_type;
+
+    // 要素を削除しない操作はそのまま公開する
+    using Base::at;
+    using Base::begin;
+    using Base::cbegin;
+    using Base::cend;
+    using Base::count;
+    using Base::crbegin;
+    using Base::crend;
+    using Base::emplace;
+    using Base::emplace_hint;
+    using Base::empty;
+    using Base::end;
+    using Base::equal_range;
+    using Base::find;
+    using Base::insert;
+    using Base::insert_or_assign;
+    using Base::lower_bound;
+    using Base::operator[];
+    using Base::rbegin;
+    using Base::rend;
+    using Base::size;
+    using Base::try_emplace;
+    using Base::upper_bound;
+
+    VariableMap() = default;
+    VariableMap(const VariableMap &other) : Base(other) {}
+    VariableMap(VariableMap &&other) = default;
+    VariableMap &operator=(const VariableMap &other) {
+        Base::operator=(other);
+        drop_caches();
+        return *this;
+    }
+    VariableMap &operator=(VariableMap &&other) = default;
+
+    iterator erase(const_iterator pos) {
+        drop_caches();
+        return Base::erase(pos);
+    }
+    iterator erase(iterator pos) {
+        drop_caches();
+        return Base::erase(pos);
+    }
+    size_type erase(const std::string &key) {
+        drop_caches();
+        return Base::erase(key);
+    }
+    iterator erase(const_iterator first, const_iterator last) {
+        drop_caches();
+        return Base::erase(first, last);
+    }
+    void clear() {
+        drop_caches();
+        Base::clear();
+    }
+
+    // スロットに結び付いた要素（名前が一致しなければnullptr）
+    Variable *slot(int index, const std::string &name) const {
+        if (index < 0 || static_cast<size_t>(index) >= slots_.size()) {
+            return nullptr;
+        }
+        value_type *entry = slots_[index];
+        if (!entry || entry->first != name) {
+            return nullptr;
+        }
+        return &entry->second;
+    }
+
+    // 名前で検索し、見つかればスロットに結び付ける
+    Variable *bind_slot(int index, const std::string &name) {
+        auto it = find(name);
+        if (it == end()) {
+            return nullptr;
+        }
+        if (index >= 0) {
+            if (static_cast<size_t>(index) >= slots_.size()) {
+                slots_.resize(index + 1, nullptr);
+            }
+            slots_[index] = &*it;
+        }
+        return &it->second;
+    }
+
+    // 名前で要素を作ってスロットに結び付ける（既にあれば作らずfalse）
+    std::pair<Variable *, bool> emplace_slot(int index,
+                                             const std::string &name) {
+        auto result = try_emplace(name);
+        if (result.second && index >= 0) {
+            if (static_cast<size_t>(index) >= slots_.size()) {
+                slots_.resize(index + 1, nullptr);
+            }
+            slots_[index] = &*result.first;
+        }
+        return {&result.first->second, result.second};
+    }
+
+    // 構造体配列の要素メンバー "array[index].member" を添字計算で引く
+    // これは検索キャッシュであり、値の格納場所は従来通り要素ごとの
+    // "array[index].member" 変数のまま（SoAの連続バッファではない）。
+    // キャッシュは index * field_count + field の位置にその変数のノードへの
+    // ポインタを持ち、未解決の位置だけを名前で検索して埋める
+    Variable *cached_struct_array_member(const std::string &array_name,
+                                         size_t index, size_t field,
+                                         size_t field_count, size_t array_size,
+                                         const std::string &member_name) {
+        std::vector<value_type *> &table = member_lookup_cache_[array_name];
+        if (table.size() != array_size * field_count) {
+            table.assign(array_size * field_count, nullptr);
+        }
+        value_type *&entry = table[index * field_count + field];
+        if (!entry || !has_member_suffix(entry->first, member_name)) {
+            auto it = find(array_name + "[" + std::to_string(index) + "]." +
+                           member_name);
+            if (it == end()) {
+                entry = nullptr;
+                return nullptr;
+            }
+            entry = &*it;
+        }
+        return &entry->second;
+    }
+
+  private:
+    void drop_caches() {
+        slots_.clear();
+        member_lookup_cache_.clear();
+    }
+
+    static bool has_member_suffix(const std::string &key,
+                                  const std::string &member_name) {
+        size_t n = member_name.size();
+        return key.size() > n && key[key.size() - n - 1] == '.' &&
+               key.compare(key.size() - n, n, member_name) == 0;
+    }
+
+    std::vector<value_type *> slots_;
+    std::unordered_map<std::string, std::vector<value_type *>>
+        member_lookup_cache_;
+};
+
 // スコープ管理
 struct Scope {
-    std::map<std::string, Variable> variables;
+    VariableMap variables;
     std::map<std::string, const ASTNode *> functions;
     std::map<std::string, FunctionPointer>
         function_pointers; // 関数ポインタ変数
@@ -545,12 +770,29 @@ struct Scope {
     }
 };
 
+// v0.14.0: TaskCancelledException - 取り消されたタスクのステップを巻き戻す例外
+// await中（入れ子のrun_until_complete内）に取り消されたタスクで送出され、
+// execute_one_stepで捕捉される
+class TaskCancelledException {
+  public:
+    int task_id;
+
+    TaskCancelledException(int id) : task_id(id) {}
+};
+
 // v0.12.1 Phase 2: YieldException - async関数内でyieldした際の例外
 class YieldException {
   public:
     bool is_from_loop; // ループ内の自動yieldかどうか
-
-    YieldException(bool from_loop = false) : is_from_loop(from_loop) {}
+    // v0.14.0: 中断した文を最初から実行し直す（チャネルの受信待ち）
+    // forループはupdate式を実行せずに再スローする
+    bool retry_statement;
+    // v0.14.0: 再実行の検査で最後に通った文の再開位置マップ
+    // （nullptrならまだ待った文そのものを検査していない）
+    const std::map<const ASTNode *, size_t> *retry_frame = nullptr;
+
+    YieldException(bool from_loop = false, bool retry = false)
+        : is_from_loop(from_loop || retry), retry_statement(retry) {}
 };
 
 class ReturnException {
@@ -732,6 +974,39 @@ class ContinueException {
     ContinueException(int64_t cond = 1) : condition(cond) {}
 };
 
+// v0.14.0: return/break/continueの完了レコード
+// 関数本体・ループの実行中は例外を使わず、実行器の戻りで伝播させる
+enum class CompletionType : uint8_t {
+    NORMAL,   // 通常終了
+    RETURN,   // return文（valueに戻り値）
+    BREAK,    // break文
+    CONTINUE, // continue文
+};
+
+// スカラー/文字列の戻り値は16バイトのValueで保持し、
+// それ以外（配列/struct/参照/関数ポインタ等）のみReturnExceptionを確保する
+struct Completion {
+    CompletionType type = CompletionType::NORMAL;
+    Value scalar;
+    std::unique_ptr<ReturnException> value;
+};
+
+// 完了レコードを受け取るフレーム（関数本体/ループ）を登録するRAII
+// スコープ深さが一致する場合のみ、return/break/continueを完了レコードで通知する
+class CompletionFrame {
+  public:
+    CompletionFrame(std::vector<size_t> &frames, size_t depth)
+        : frames_(frames) {
+        frames_.push_back(depth);
+    }
+    ~CompletionFrame() { frames_.pop_back(); }
+    CompletionFrame(const CompletionFrame &) = delete;
+    CompletionFrame &operator=(const CompletionFrame &) = delete;
+
+  private:
+    std::vector<size_t> &frames_;
+};
+
 // インタープリター実装
 class Interpreter : public EvaluatorInterface {
   private:
@@ -783,26 +1058,40 @@ class Interpreter : public EvaluatorInterface {
     // v0.13.0: Foreign Function Interface manager
     std::unique_ptr<class cb::FFIManager> ffi_manager_;
 
-    // v0.12.0: async関数のタスクカウンター（一意なFuture識別用）
-    int async_task_counter_ = 0;
-
-    // v0.12.0: 非同期タスク管理（task_id -> AsyncTask）
-    std::map<int, AsyncTask> async_tasks_;
+    // v0.14.0: 組み込み関数テーブル（埋め込み側がネイティブ関数を追加できる）
+    std::unique_ptr<BuiltinRegistry> builtin_registry_;
 
-    // v0.12.0: Future変数名からタスクIDへのマッピング
-    std::map<std::string, int> future_to_task_;
+    // v0.14.0: ジェネリック関数のインスタンス化キャッシュ
+    // （インスタンスはこのInterpreterの破棄時に解放する）
+    std::unique_ptr<GenericInstantiation::InstanceCache> generic_instances_;
 
-    // v0.12.0 Phase 8: ヒープに確保されたFuture変数の管理（task_id -> Future）
-    // イベントループからアクセス可能にするため
-    std::map<int, std::shared_ptr<Variable>> future_variables_;
+    // v0.12.0: async関数のタスクカウンター（一意なFuture識別用）
+    int async_task_counter_ = 0;
 
     // v0.12.0: auto_yieldタスク実行中フラグ
     // forループやwhileループの各イテレーション後に自動yieldするために使用
     bool is_in_auto_yield_task_ = false;
 
+    // v0.14.0: タイムスライスの全体設定（--async-quantum/--async-time-slice）
+    // 量子0は未設定（時間制限があれば文の数で区切らず、なければ1文ごと）
+    int64_t async_quantum_ = 0;
+    int64_t async_time_slice_us_ = 0;
+    // 実行中のコンテキスト（mainまたはタスクの1ステップ）のタイムスライス
+    TimeSlice time_slice_;
+    bool time_slice_deadline_passed() const;
+
     // v0.12.1: 現在実行中のタスクID（await時の親タスク特定用）
     int current_executing_task_id_ = -1;
 
+    // v0.14.0: 実行待ちのasyncタスクがあるか（SimpleEventLoopが更新する）
+    // 同期実行時の文ごとのイベントループ問い合わせを避けるためのキャッシュ
+    bool has_queued_async_tasks_ = false;
+
+    // v0.14.0: メソッド呼び出しのインラインキャッシュのエポックと統計
+    // （関数・implを登録するたびにエポックを進め、全キャッシュを無効にする）
+    uint64_t method_cache_epoch_ = 1;
+    MethodCacheStats method_cache_stats_;
+
     // Manager instances
     std::unique_ptr<VariableManager> variable_manager_;
     std::unique_ptr<ArrayManager> array_manager_;
@@ -886,6 +1175,9 @@ class Interpreter : public EvaluatorInterface {
     void push_scope();
     void push_scope(const std::string &scope_id); // スコープID付きpush
     void pop_scope();
+    // v0.14.0: スコープを終了し、変数を破棄せずframeへ移す
+    // （asyncタスクの実行フレームをステップ間で保持するために使用）
+    void pop_scope_into(VariableMap &frame);
     void push_interpreter_scope() { push_scope(); }
     void pop_interpreter_scope() { pop_scope(); }
     Scope &current_scope();
@@ -894,10 +1186,17 @@ class Interpreter : public EvaluatorInterface {
     std::shared_ptr<std::map<const ASTNode *, size_t>>
     current_statement_positions() {
         if (statement_position_stack_.empty()) {
-            statement_position_stack_.emplace_back(
-                std::make_shared<std::map<const ASTNode *, size_t>>());
+            statement_position_stack_.emplace_back();
         }
-        return statement_position_stack_.back();
+        // v0.14.0: 再開位置マップはasyncタスクが初めて必要とした時に確保する
+        auto &positions = statement_position_stack_.back();
+        if (!positions) {
+            positions = std::make_shared<std::map<const ASTNode *, size_t>>();
+            if (!scope_stack.empty()) {
+                scope_stack.back().statement_positions = positions;
+            }
+        }
+        return positions;
     }
     void set_current_statement_positions(
         std::shared_ptr<std::map<const ASTNode *, size_t>> positions) {
@@ -928,6 +1227,12 @@ class Interpreter : public EvaluatorInterface {
 
     // 変数・関数アクセス
     Variable *find_variable(const std::string &name);
+    // v0.14.0: VariableResolverのスロットを使って検索する
+    Variable *find_variable(const ASTNode *node);
+    // v0.14.0: 構造体配列の要素メンバーを検索キャッシュ経由で引く
+    Variable *find_struct_array_member(const ASTNode *array_node,
+                                       int64_t index,
+                                       const std::string &member_name);
     Variable *get_variable(const std::string &name) {
         return find_variable(name);
     }
@@ -1010,6 +1315,12 @@ class Interpreter : public EvaluatorInterface {
                                    bool is_unsigned);
     void assign_array_parameter(const std::string &name,
                                 const Variable &source_array, TypeInfo type);
+    // v0.14.0: 数値型の値渡し引数を呼び出し先のフレームのスロットへ直接書く
+    // （値が数値でない・同名の変数が既にあるときはfalseで何もしない）
+    bool bind_value_parameter(const ASTNode *param, const ParamLayout &layout,
+                              const TypedValue &value);
+    // v0.14.0: 関数宣言の呼び出しレイアウト（エポックが変わったら作り直す）
+    const CallLayout &call_layout(const ASTNode *func);
     void assign_interface_view(const std::string &dest_name,
                                Variable interface_var,
                                const Variable &source_var,
@@ -1098,6 +1409,9 @@ class Interpreter : public EvaluatorInterface {
     // (TypeManagerへの薄いラッパー、将来的にはインライン化予定)
     TypeInfo string_to_type_info(const std::string &type_str);
     void sync_struct_members_from_direct_access(const std::string &var_name);
+    // v0.14.0: 指定メンバーのみ同期（フィールド番号で定義を参照）
+    void sync_struct_member_from_direct_access(const std::string &var_name,
+                                               const std::string &member_name);
     void sync_direct_access_from_struct_value(const std::string &var_name,
                                               const Variable &struct_value);
     void sync_individual_member_from_struct(Variable *struct_var,
@@ -1153,6 +1467,10 @@ class Interpreter : public EvaluatorInterface {
     const ImplDefinition *
     find_impl_for_struct(const std::string &struct_name,
                          const std::string &interface_name);
+    // v0.14.0: (interface, 構造体)のメソッド表（implがなければnullptr）
+    const InterfaceVTable *
+    find_interface_vtable(const std::string &interface_name,
+                          const std::string &struct_name);
 
     // interface型変数管理 (InterfaceOperationsへ委譲)
     void create_interface_variable(const std::string &var_name,
@@ -1166,6 +1484,7 @@ class Interpreter : public EvaluatorInterface {
     std::string current_function_name; // 現在実行中の関数名
 
   private:
+    void pop_scope_impl(VariableMap *retained_frame);
     void print_value(const ASTNode *expr);
     void print_formatted(const ASTNode *format_str, const ASTNode *arg_list);
     void validate_struct_recursion_rules();
@@ -1173,6 +1492,11 @@ class Interpreter : public EvaluatorInterface {
     // v0.10.0: デストラクタ呼び出し中フラグ（無限再帰防止）
     bool is_calling_destructor_ = false;
 
+    // v0.14.0: 保留中の完了レコードと、それを受け取るフレームのスコープ深さ
+    Completion completion_;
+    std::vector<size_t> return_frames_;
+    std::vector<size_t> loop_frames_;
+
     // N次元配列リテラル処理の再帰関数
     void process_ndim_array_literal(const ASTNode *literal_node, Variable &var,
                                     TypeInfo elem_type, int &flat_index,
@@ -1196,6 +1520,73 @@ class Interpreter : public EvaluatorInterface {
     // v0.13.1: デストラクタ実行中かチェック
     bool is_calling_destructor() const { return is_calling_destructor_; }
 
+    // v0.14.0: 完了レコード（return/break/continue）
+    CompletionFrame enter_return_frame() {
+        return CompletionFrame(return_frames_, scope_stack.size());
+    }
+    CompletionFrame enter_loop_frame() {
+        return CompletionFrame(loop_frames_, scope_stack.size());
+    }
+    // 現在のスコープが完了レコードを受け取る関数本体/ループの中にあるか
+    bool can_complete_return() const {
+        return !return_frames_.empty() &&
+               return_frames_.back() == scope_stack.size();
+    }
+    bool can_complete_loop() const {
+        return !loop_frames_.empty() &&
+               loop_frames_.back() == scope_stack.size();
+    }
+    bool has_pending_completion() const {
+        return completion_.type != CompletionType::NORMAL;
+    }
+    CompletionType pending_completion() const { return completion_.type; }
+    void complete_return(ReturnException &&value) {
+        completion_.type = CompletionType::RETURN;
+        completion_.value.reset(new ReturnException(std::move(value)));
+    }
+    void complete_return_value(Value &&value) {
+        completion_.type = CompletionType::RETURN;
+        completion_.scalar = std::move(value);
+    }
+    void complete_loop(CompletionType type) { completion_.type = type; }
+    void clear_completion() {
+        completion_.type = CompletionType::NORMAL;
+        completion_.scalar = Value();
+        completion_.value.reset();
+    }
+    // スカラーのRETURN完了レコードを取り出す（該当しなければfalse）
+    bool take_return_value(Value &out) {
+        if (completion_.type != CompletionType::RETURN ||
+            completion_.value) {
+            return false;
+        }
+        completion_.type = CompletionType::NORMAL;
+        out = std::move(completion_.scalar);
+        return true;
+    }
+    // RETURNの完了レコードを取り出す（RETURNでなければnullptr）
+    std::unique_ptr<ReturnException> take_return_completion() {
+        if (completion_.type != CompletionType::RETURN) {
+            return nullptr;
+        }
+        completion_.type = CompletionType::NORMAL;
+        if (!completion_.value) {
+            Value scalar = std::move(completion_.scalar);
+            return std::unique_ptr<ReturnException>(
+                new ReturnException(scalar.to_return_exception()));
+        }
+        return std::move(completion_.value);
+    }
+    // defer/デストラクタ実行中は保留中の完了レコードを退避する
+    Completion suspend_completion() {
+        Completion saved = std::move(completion_);
+        clear_completion();
+        return saved;
+    }
+    void resume_completion(Completion &&saved) {
+        completion_ = std::move(saved);
+    }
+
     // エラー表示ヘルパー関数
     void throw_runtime_error_with_location(const std::string &message,
                                            const ASTNode *node = nullptr);
@@ -1218,36 +1609,54 @@ class Interpreter : public EvaluatorInterface {
     void set_auto_yield_mode(bool enabled) { is_in_auto_yield_task_ = enabled; }
     bool is_in_auto_yield_mode() const { return is_in_auto_yield_task_; }
 
-    // v0.12.0: 非同期タスク管理
-    void register_async_task(int task_id, const AsyncTask &task) {
-        async_tasks_[task_id] = task;
-    }
-
-    AsyncTask *get_async_task(int task_id) {
-        auto it = async_tasks_.find(task_id);
-        return (it != async_tasks_.end()) ? &it->second : nullptr;
-    }
-
-    void associate_future_with_task(const std::string &future_var_name,
-                                    int task_id) {
-        future_to_task_[future_var_name] = task_id;
+    // v0.14.0: タイムスライス（量子）によるタスク切り替え
+    // 実行中のコンテキストは文を quantum 個実行するか time_slice_us
+    // マイクロ秒経過するまで他のタスクに切り替えない（既定は1文ごと）
+    void set_async_quantum(int64_t statements);
+    int64_t async_quantum() const { return async_quantum_; }
+    void set_async_time_slice_us(int64_t microseconds);
+    int64_t async_time_slice_us() const { return async_time_slice_us_; }
+
+    // 新しいタイムスライスを開始し、それまでのスライスを返す
+    // statementsが0なら時間制限の有無に応じて無制限または1文とする
+    TimeSlice begin_time_slice(int64_t statements, int64_t microseconds);
+    void restore_time_slice(const TimeSlice &slice) { time_slice_ = slice; }
+    // mainのスライスを全体設定で開始し直す
+    void reset_time_slice() {
+        begin_time_slice(async_quantum_, async_time_slice_us_);
     }
-
-    int get_task_id_for_future(const std::string &future_var_name) {
-        auto it = future_to_task_.find(future_var_name);
-        return (it != future_to_task_.end()) ? it->second : -1;
+    const TimeSlice &current_time_slice() const { return time_slice_; }
+    void consume_time_slice() { --time_slice_.statements_left; }
+    // 次の切り替え点でタスクを切り替える（チャネルの送信待ち）
+    void expire_time_slice() { time_slice_.statements_left = 0; }
+    bool time_slice_expired() const {
+        return time_slice_.statements_left <= 0 ||
+               (time_slice_.deadline_us != 0 && time_slice_deadline_passed());
     }
-
-    // v0.12.0 Phase 8: Future変数のヒープ管理
-    void register_future_variable(int task_id,
-                                  std::shared_ptr<Variable> future_var) {
-        future_variables_[task_id] = future_var;
-    }
-
-    std::shared_ptr<Variable> get_future_variable(int task_id) {
-        auto it = future_variables_.find(task_id);
-        return (it != future_variables_.end()) ? it->second : nullptr;
+    // スライスを使い切っていれば実行待ちのタスクを1サイクル進める
+    void run_queued_tasks_if_slice_expired();
+
+    // v0.14.0: メソッド呼び出し箇所のインラインキャッシュ
+    // nodeでreceiver_typeのメソッドを解決済みならそのエントリ（ヒット）、
+    // 未解決ならnullptr（ミス）を返す
+    MethodCacheEntry *find_method_cache_entry(const ASTNode *node,
+                                              const std::string &receiver_type);
+    // 従来の解決結果をnodeのキャッシュへ追加する（メガモーフィックならnullptr）
+    MethodCacheEntry *record_method_cache_entry(const ASTNode *node,
+                                                const std::string &receiver_type,
+                                                const ASTNode *func);
+    void invalidate_method_caches() { ++method_cache_epoch_; }
+    // v0.14.0: interface型の値のメソッド表からnodeのメソッドを引く
+    // （スロットは呼び出し箇所ごとに覚える。implにないメソッドはnullptr）
+    const ASTNode *lookup_vtable_method(const ASTNode *node,
+                                        const InterfaceVTable &vtable);
+    // vtableの構造体の型コンテキスト用エントリ（現在のエポックのもの）
+    MethodCacheEntry *vtable_context_entry(const InterfaceVTable &vtable);
+    const MethodCacheStats &method_cache_stats() const {
+        return method_cache_stats_;
     }
+    // 統計を出力する（--dispatch-stats）
+    void print_method_cache_stats(std::FILE *out) const;
 
     // デバッグ機能
     void set_debug_mode(bool debug) { debug_mode = debug; }
@@ -1275,6 +1684,14 @@ class Interpreter : public EvaluatorInterface {
     // FFI managerへのアクセス
     cb::FFIManager *get_ffi_manager() { return ffi_manager_.get(); }
 
+    // v0.14.0: 組み込み関数テーブルへのアクセス
+    BuiltinRegistry &get_builtin_registry() { return *builtin_registry_; }
+
+    // v0.14.0: ジェネリック関数のインスタンス化キャッシュへのアクセス
+    GenericInstantiation::InstanceCache &generic_instances() {
+        return *generic_instances_;
+    }
+
     // TypeManagerへのアクセス
     TypeManager *get_type_manager() { return type_manager_.get(); }
 
@@ -1295,6 +1712,7 @@ class Interpreter : public EvaluatorInterface {
     void register_function_to_global(const std::string &key,
                                      const ASTNode *func) {
         global_scope.functions[key] = func;
+        invalidate_method_caches();
     }
 
     // 型推論付き三項演算子評価
@@ -1443,4 +1861,14 @@ class Interpreter : public EvaluatorInterface {
     int get_current_executing_task_id() const {
         return current_executing_task_id_;
     }
+    // v0.14.0: asyncタスク内で実行中か（文の再開位置の記録が必要か）
+    bool is_executing_async_task() const {
+        return current_executing_task_id_ >= 0;
+    }
+
+    // v0.14.0: 実行待ちasyncタスクの有無（文ごとのバックグラウンド実行判定用）
+    void set_has_queued_async_tasks(bool queued) {
+        has_queued_async_tasks_ = queued;
+    }
+    bool has_queued_async_tasks() const { return has_queued_async_tasks_; }
 };
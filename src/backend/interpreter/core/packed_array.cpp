@@ -0,0 +1,98 @@
+#include "packed_array.h"
+#include <limits>
+
+PackedIntArray &
+PackedIntArray::operator=(const std::vector<int64_t> &values) {
+    clear();
+    size_ = values.size();
+    storage_.assign(words_for(size_, width_), 0);
+    for (size_t i = 0; i < values.size(); ++i) {
+        set(i, values[i]);
+    }
+    return *this;
+}
+
+PackedIntArray::operator std::vector<int64_t>() const {
+    std::vector<int64_t> values(size_);
+    for (size_t i = 0; i < size_; ++i) {
+        values[i] = get(i);
+    }
+    return values;
+}
+
+PackedWidth PackedIntArray::width_for(TypeInfo type, bool is_unsigned) {
+    switch (type) {
+    case TYPE_TINY:
+    case TYPE_CHAR:
+        return is_unsigned ? PackedWidth::U8 : PackedWidth::I8;
+    case TYPE_BOOL:
+        return PackedWidth::U8;
+    case TYPE_SHORT:
+        return is_unsigned ? PackedWidth::U16 : PackedWidth::I16;
+    case TYPE_INT:
+        return is_unsigned ? PackedWidth::U32 : PackedWidth::I32;
+    default:
+        // long/enum/ポインタ/アドレスを保持する配列は64ビット幅
+        return PackedWidth::I64;
+    }
+}
+
+void PackedIntArray::set_element_type(TypeInfo type, bool is_unsigned) {
+    if (addressable_) {
+        return;
+    }
+    PackedWidth width = width_for(type, is_unsigned);
+    for (size_t i = 0; i < size_ && width != PackedWidth::I64; ++i) {
+        if (!fits(width, get(i))) {
+            width = PackedWidth::I64;
+        }
+    }
+    repack(width);
+}
+
+bool PackedIntArray::fits(PackedWidth width, int64_t value) {
+    switch (width) {
+    case PackedWidth::I8:
+        return value >= std::numeric_limits<int8_t>::min() &&
+               value <= std::numeric_limits<int8_t>::max();
+    case PackedWidth::U8:
+        return value >= 0 && value <= std::numeric_limits<uint8_t>::max();
+    case PackedWidth::I16:
+        return value >= std::numeric_limits<int16_t>::min() &&
+               value <= std::numeric_limits<int16_t>::max();
+    case PackedWidth::U16:
+        return value >= 0 && value <= std::numeric_limits<uint16_t>::max();
+    case PackedWidth::I32:
+        return value >= std::numeric_limits<int32_t>::min() &&
+               value <= std::numeric_limits<int32_t>::max();
+    case PackedWidth::U32:
+        return value >= 0 && value <= std::numeric_limits<uint32_t>::max();
+    case PackedWidth::I64:
+        return true;
+    }
+    return true;
+}
+
+void PackedIntArray::resize(size_t count, int64_t value) {
+    size_t old_size = size_;
+    if (count < old_size) {
+        // 縮小時は末尾の余りバイトを0に戻しておく
+        for (size_t i = count; i < old_size; ++i) {
+            set(i, 0);
+        }
+    }
+    size_ = count;
+    storage_.resize(words_for(count, width_), 0);
+    for (size_t i = old_size; i < count; ++i) {
+        set(i, value);
+    }
+}
+
+void PackedIntArray::repack(PackedWidth width) {
+    if (width == width_) {
+        return;
+    }
+    std::vector<int64_t> values(*this);
+    width_ = width;
+    *this = values;
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include "../../../common/ast.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// v0.14.0: 整数系配列要素の格納幅
+enum class PackedWidth : uint8_t {
+    I8 = 0,
+    U8,
+    I16,
+    U16,
+    I32,
+    U32,
+    I64,
+};
+
+// v0.14.0: 宣言された要素型の幅で詰めて保持する整数配列
+// tiny/char/bool は1バイト、short は2バイト、int は4バイトで格納する。
+// 範囲外の値が書き込まれた場合は64ビット幅に詰め直すため、値が
+// 格納で切り詰められることはない（範囲検査はcheck_type_rangeの責務）。
+// std::vector<int64_t> と同じ操作（size/resize/push_back/[] 等）を持つ。
+class PackedIntArray {
+  public:
+    // 要素への書き込み可能な参照（int64_tとして読み書きする）
+    class reference {
+      public:
+        reference(PackedIntArray *array, size_t index)
+            : array_(array), index_(index) {}
+
+        operator int64_t() const { return array_->get(index_); }
+
+        reference &operator=(int64_t value) {
+            array_->set(index_, value);
+            return *this;
+        }
+        reference &operator=(const reference &other) {
+            return *this = static_cast<int64_t>(other);
+        }
+        reference &operator+=(int64_t v) { return *this = get() + v; }
+        reference &operator-=(int64_t v) { return *this = get() - v; }
+        reference &operator*=(int64_t v) { return *this = get() * v; }
+        reference &operator/=(int64_t v) { return *this = get() / v; }
+        reference &operator%=(int64_t v) { return *this = get() % v; }
+        reference &operator&=(int64_t v) { return *this = get() & v; }
+        reference &operator|=(int64_t v) { return *this = get() | v; }
+        reference &operator^=(int64_t v) { return *this = get() ^ v; }
+        reference &operator<<=(int64_t v) { return *this = get() << v; }
+        reference &operator>>=(int64_t v) { return *this = get() >> v; }
+        reference &operator++() { return *this = get() + 1; }
+        reference &operator--() { return *this = get() - 1; }
+        int64_t operator++(int) {
+            int64_t old = get();
+            *this = old + 1;
+            return old;
+        }
+        int64_t operator--(int) {
+            int64_t old = get();
+            *this = old - 1;
+            return old;
+        }
+
+      private:
+        int64_t get() const { return array_->get(index_); }
+
+        PackedIntArray *array_;
+        size_t index_;
+    };
+
+    PackedIntArray() = default;
+    PackedIntArray(const std::vector<int64_t> &values) { *this = values; }
+
+    // 現在の格納幅を保ったまま値を置き換える
+    PackedIntArray &operator=(const std::vector<int64_t> &values);
+    // 全要素を展開したコピーを作るため、暗黙には変換しない
+    explicit operator std::vector<int64_t>() const;
+
+    // 宣言された要素型から格納幅を決める（既存の要素は詰め直す）
+    void set_element_type(TypeInfo type, bool is_unsigned);
+
+    // 要素のアドレスがポインタとして保持される配列は64ビット幅に固定し、
+    // 以後は詰め直さない（詰め直すとPointerMetadataのアドレスが無効になる）
+    void make_addressable() {
+        repack(PackedWidth::I64);
+        addressable_ = true;
+    }
+    bool addressable() const { return addressable_; }
+    static PackedWidth width_for(TypeInfo type, bool is_unsigned);
+
+    PackedWidth width() const { return width_; }
+    size_t element_size() const { return element_size(width_); }
+    static size_t element_size(PackedWidth width) {
+        static const size_t sizes[] = {1, 1, 2, 2, 4, 4, 8};
+        return sizes[static_cast<int>(width)];
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    // 確保済みのバイト数（メモリ使用量の確認用）
+    size_t byte_size() const { return storage_.size() * sizeof(int64_t); }
+
+    void clear() {
+        storage_.clear();
+        size_ = 0;
+    }
+    void resize(size_t count, int64_t value = 0);
+    void assign(size_t count, int64_t value) {
+        clear();
+        resize(count, value);
+    }
+    void push_back(int64_t value) { resize(size_ + 1, value); }
+
+    int64_t get(size_t index) const {
+        const void *base = storage_.data();
+        switch (width_) {
+        case PackedWidth::I8:
+            return static_cast<const int8_t *>(base)[index];
+        case PackedWidth::U8:
+            return static_cast<const uint8_t *>(base)[index];
+        case PackedWidth::I16:
+            return static_cast<const int16_t *>(base)[index];
+        case PackedWidth::U16:
+            return static_cast<const uint16_t *>(base)[index];
+        case PackedWidth::I32:
+            return static_cast<const int32_t *>(base)[index];
+        case PackedWidth::U32:
+            return static_cast<const uint32_t *>(base)[index];
+        case PackedWidth::I64:
+            break;
+        }
+        return storage_[index];
+    }
+
+    void set(size_t index, int64_t value) {
+        if (!fits(width_, value)) {
+            repack(PackedWidth::I64);
+        }
+        void *base = storage_.data();
+        switch (width_) {
+        case PackedWidth::I8:
+            static_cast<int8_t *>(base)[index] = static_cast<int8_t>(value);
+            return;
+        case PackedWidth::U8:
+            static_cast<uint8_t *>(base)[index] = static_cast<uint8_t>(value);
+            return;
+        case PackedWidth::I16:
+            static_cast<int16_t *>(base)[index] = static_cast<int16_t>(value);
+            return;
+        case PackedWidth::U16:
+            static_cast<uint16_t *>(base)[index] =
+                static_cast<uint16_t>(value);
+            return;
+        case PackedWidth::I32:
+            static_cast<int32_t *>(base)[index] = static_cast<int32_t>(value);
+            return;
+        case PackedWidth::U32:
+            static_cast<uint32_t *>(base)[index] =
+                static_cast<uint32_t>(value);
+            return;
+        case PackedWidth::I64:
+            break;
+        }
+        storage_[index] = value;
+    }
+
+    reference operator[](size_t index) { return reference(this, index); }
+    int64_t operator[](size_t index) const { return get(index); }
+
+    // 先頭要素のアドレス（要素は element_size() バイト間隔で並ぶ）
+    void *data() { return storage_.data(); }
+    const void *data() const { return storage_.data(); }
+    void *address_of(size_t index) {
+        return static_cast<char *>(data()) + index * element_size();
+    }
+
+    static bool fits(PackedWidth width, int64_t value);
+
+  private:
+    // 要素を保ったまま格納幅を変更する
+    void repack(PackedWidth width);
+    static size_t words_for(size_t count, PackedWidth width) {
+        return (count * element_size(width) + sizeof(int64_t) - 1) /
+               sizeof(int64_t);
+    }
+
+    // 8バイト境界に揃えるため int64_t 単位で確保する
+    std::vector<int64_t> storage_;
+    size_t size_ = 0;
+    PackedWidth width_ = PackedWidth::I64;
+    bool addressable_ = false;
+};
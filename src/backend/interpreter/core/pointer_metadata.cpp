@@ -33,15 +33,20 @@ PointerMetadata::create_array_element_pointer(Variable *array_var_param,
 
     // 真のポインタシステム：配列要素の実際のメモリアドレスを取得
     // array_values[index]のアドレスを取得
+    // v0.14.0: アドレスを保持するので以後は格納幅を詰め直さない
+    if (array_var_param) {
+        array_var_param->array_values.make_addressable();
+        array_var_param->multidim_array_values.make_addressable();
+    }
     if (array_var_param && !array_var_param->array_values.empty() &&
         index < array_var_param->array_values.size()) {
-        meta.address =
-            reinterpret_cast<uintptr_t>(&array_var_param->array_values[index]);
+        meta.address = reinterpret_cast<uintptr_t>(
+            array_var_param->array_values.address_of(index));
     } else if (array_var_param &&
                !array_var_param->multidim_array_values.empty() &&
                index < array_var_param->multidim_array_values.size()) {
         meta.address = reinterpret_cast<uintptr_t>(
-            &array_var_param->multidim_array_values[index]);
+            array_var_param->multidim_array_values.address_of(index));
     } else {
         // 配列がまだ初期化されていない場合、仮想アドレスを使用
         uintptr_t base_addr = reinterpret_cast<uintptr_t>(array_var_param);
@@ -51,15 +56,19 @@ PointerMetadata::create_array_element_pointer(Variable *array_var_param,
     // 範囲チェック用の情報を設定
     if (array_var_param && !array_var_param->array_values.empty()) {
         meta.array_start_addr =
-            reinterpret_cast<uintptr_t>(&array_var_param->array_values[0]);
-        meta.array_end_addr = meta.array_start_addr +
-                              (array_var_param->array_size * sizeof(int64_t));
+            reinterpret_cast<uintptr_t>(array_var_param->array_values.data());
+        meta.array_end_addr =
+            meta.array_start_addr +
+            (array_var_param->array_size *
+             array_var_param->array_values.element_size());
     } else if (array_var_param &&
                !array_var_param->multidim_array_values.empty()) {
         meta.array_start_addr = reinterpret_cast<uintptr_t>(
-            &array_var_param->multidim_array_values[0]);
-        meta.array_end_addr = meta.array_start_addr +
-                              (array_var_param->array_size * sizeof(int64_t));
+            array_var_param->multidim_array_values.data());
+        meta.array_end_addr =
+            meta.array_start_addr +
+            (array_var_param->array_size *
+             array_var_param->multidim_array_values.element_size());
     } else {
         // フォールバック：仮想アドレス
         uintptr_t base_addr = reinterpret_cast<uintptr_t>(array_var_param);
@@ -70,6 +70,17 @@ Variable *Interpreter::find_variable(const std::string &name) {
     return variable_manager_->find_variable(name);
 }
 
+Variable *Interpreter::find_variable(const ASTNode *node) {
+    return variable_manager_->find_variable(node);
+}
+
+Variable *
+Interpreter::find_struct_array_member(const ASTNode *array_node, int64_t index,
+                                      const std::string &member_name) {
+    return variable_manager_->find_struct_array_member(array_node, index,
+                                                       member_name);
+}
+
 std::string
 Interpreter::find_variable_name_by_address(const Variable *target_var) {
     if (!target_var) {
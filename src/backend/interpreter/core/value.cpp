@@ -0,0 +1,47 @@
+#include "value.h"
+#include "interpreter.h"
+#include <stdexcept>
+
+// 文字列を保持する参照カウント付きボックス
+struct Value::Box {
+    uint32_t refs = 1;
+    std::string str;
+};
+
+void Value::retain_box() const { ++payload_.box->refs; }
+
+void Value::release_box() {
+    if (--payload_.box->refs == 0) {
+        delete payload_.box;
+    }
+    tag_ = ValueTag::NONE;
+    payload_.i = 0;
+}
+
+Value Value::string(std::string s) {
+    Value result(ValueTag::STRING, TYPE_STRING);
+    result.payload_.box = new Box();
+    result.payload_.box->str = std::move(s);
+    return result;
+}
+
+const std::string &Value::as_string() const {
+    if (tag_ != ValueTag::STRING) {
+        throw std::runtime_error("Value is not a string");
+    }
+    return payload_.box->str;
+}
+
+ReturnException Value::to_return_exception() const {
+    switch (tag_) {
+    case ValueTag::DOUBLE:
+        return ReturnException(payload_.d, type());
+    case ValueTag::STRING:
+        return ReturnException(payload_.box->str);
+    case ValueTag::INT:
+        return ReturnException(payload_.i, type());
+    case ValueTag::NONE:
+        break;
+    }
+    return ReturnException(static_cast<int64_t>(0));
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "../../../common/ast.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+
+class ReturnException;
+
+// v0.14.0: 値のタグ
+enum class ValueTag : uint8_t {
+    NONE = 0, // 値なし（void）
+    INT,      // 整数系（bool/char/enumを含む）
+    DOUBLE,   // float/double/quad
+    STRING,   // 文字列（ヒープボックス）
+};
+
+// v0.14.0: 16バイトのタグ付き値（return文の完了レコードが戻り値を保持する）
+// スカラーはインラインで保持し、文字列は参照カウント付きのヒープボックスに
+// 置く。コピーは参照カウントの増減のみ。
+class Value {
+  public:
+    Value() : tag_(ValueTag::NONE), type_(TYPE_UNKNOWN) { payload_.i = 0; }
+    ~Value() { release(); }
+
+    Value(const Value &other) : tag_(other.tag_), type_(other.type_) {
+        payload_ = other.payload_;
+        retain();
+    }
+    Value(Value &&other) noexcept : tag_(other.tag_), type_(other.type_) {
+        payload_ = other.payload_;
+        other.tag_ = ValueTag::NONE;
+        other.payload_.i = 0;
+    }
+    Value &operator=(const Value &other) {
+        if (this != &other) {
+            Value copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    Value &operator=(Value &&other) noexcept {
+        if (this != &other) {
+            release();
+            tag_ = other.tag_;
+            type_ = other.type_;
+            payload_ = other.payload_;
+            other.tag_ = ValueTag::NONE;
+            other.payload_.i = 0;
+        }
+        return *this;
+    }
+
+    static Value integer(int64_t v, TypeInfo type = TYPE_INT) {
+        Value result(ValueTag::INT, type);
+        result.payload_.i = v;
+        return result;
+    }
+    static Value floating(double v, TypeInfo type = TYPE_DOUBLE) {
+        Value result(ValueTag::DOUBLE, type);
+        result.payload_.d = v;
+        return result;
+    }
+    static Value string(std::string s);
+
+    ValueTag tag() const { return tag_; }
+    TypeInfo type() const { return static_cast<TypeInfo>(type_); }
+    bool is_none() const { return tag_ == ValueTag::NONE; }
+    bool is_inline() const {
+        return tag_ == ValueTag::INT || tag_ == ValueTag::DOUBLE;
+    }
+    bool is_boxed() const { return tag_ == ValueTag::STRING; }
+
+    int64_t as_int() const {
+        return tag_ == ValueTag::DOUBLE ? static_cast<int64_t>(payload_.d)
+                                        : payload_.i;
+    }
+    double as_double() const {
+        return tag_ == ValueTag::DOUBLE ? payload_.d
+                                        : static_cast<double>(payload_.i);
+    }
+    const std::string &as_string() const;
+
+    // 関数の戻り値としてReturnExceptionを復元（スカラー/文字列のみ）
+    ReturnException to_return_exception() const;
+
+    void swap(Value &other) noexcept {
+        std::swap(tag_, other.tag_);
+        std::swap(type_, other.type_);
+        std::swap(payload_, other.payload_);
+    }
+
+  private:
+    struct Box;
+
+    Value(ValueTag tag, TypeInfo type)
+        : tag_(tag), type_(static_cast<int32_t>(type)) {}
+
+    void retain() const {
+        if (is_boxed()) {
+            retain_box();
+        }
+    }
+    void release() {
+        if (is_boxed()) {
+            release_box();
+        }
+    }
+    void retain_box() const;
+    void release_box();
+
+    ValueTag tag_;
+    int32_t type_;
+    union Payload {
+        int64_t i;
+        double d;
+        Box *box;
+    } payload_;
+};
+
+static_assert(sizeof(Value) == 16, "Value must stay 16 bytes");
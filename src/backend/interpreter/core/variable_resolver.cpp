@@ -0,0 +1,215 @@
+#include "variable_resolver.h"
+
+namespace {
+
+bool is_function_like(const ASTNode *node) {
+    switch (node->node_type) {
+    case ASTNodeType::AST_FUNC_DECL:
+    case ASTNodeType::AST_CONSTRUCTOR_DECL:
+    case ASTNodeType::AST_DESTRUCTOR_DECL:
+    case ASTNodeType::AST_LAMBDA_EXPR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool is_declaration(const ASTNode *node) {
+    return node->node_type == ASTNodeType::AST_VAR_DECL ||
+           node->node_type == ASTNodeType::AST_ARRAY_DECL ||
+           node->node_type == ASTNodeType::AST_PARAM_DECL;
+}
+
+// 子ノードをすべて列挙する（関数本体への入り方は呼び出し側で制御する）
+template <typename Visitor>
+void for_each_child(const ASTNode *node, Visitor &&visit) {
+    auto one = [&](const std::unique_ptr<ASTNode> &child) {
+        if (child) {
+            visit(child.get());
+        }
+    };
+    auto many = [&](const std::vector<std::unique_ptr<ASTNode>> &list) {
+        for (const auto &child : list) {
+            one(child);
+        }
+    };
+
+    one(node->left);
+    one(node->right);
+    one(node->third);
+    one(node->condition);
+    one(node->init_expr);
+    one(node->update_expr);
+    one(node->body);
+    many(node->children);
+    many(node->parameters);
+    many(node->arguments);
+    many(node->statements);
+    one(node->array_index);
+    one(node->array_size_expr);
+    many(node->array_dimensions);
+    many(node->array_indices);
+    one(node->try_body);
+    one(node->catch_body);
+    one(node->finally_body);
+    one(node->throw_expr);
+    many(node->impl_static_variables);
+    one(node->switch_expr);
+    many(node->cases);
+    one(node->else_body);
+    many(node->case_values);
+    one(node->case_body);
+    one(node->match_expr);
+    for (const auto &arm : node->match_arms) {
+        one(arm.body);
+    }
+    one(node->range_start);
+    one(node->range_end);
+    one(node->default_value);
+    one(node->lambda_body);
+    many(node->lambda_params);
+    many(node->interpolation_segments);
+    one(node->cast_expr);
+    one(node->new_array_size);
+    one(node->delete_expr);
+    one(node->sizeof_expr);
+}
+
+} // namespace
+
+void VariableResolver::resolve(const ASTNode *root) {
+    if (!root) {
+        return;
+    }
+    collect_globals(root);
+    collect_local_names(root);
+    resolve_node(root, nullptr);
+}
+
+void VariableResolver::collect_globals(const ASTNode *root) {
+    auto add = [this](const ASTNode *decl) {
+        if (is_declaration(decl) && !decl->name.empty()) {
+            globals_.emplace(decl->name, static_cast<int>(globals_.size()));
+            global_decls_.insert(decl);
+        }
+    };
+    for (const auto &stmt : root->statements) {
+        if (!stmt) {
+            continue;
+        }
+        if (stmt->node_type == ASTNodeType::AST_MULTIPLE_VAR_DECL) {
+            for (const auto &child : stmt->children) {
+                if (child) {
+                    add(child.get());
+                }
+            }
+        } else {
+            add(stmt.get());
+        }
+    }
+}
+
+// プログラム中でローカルとして束縛されうる名前をすべて集める
+// （動的スコープのため、どこかで宣言された名前はグローバルに解決できない）
+void VariableResolver::collect_local_names(const ASTNode *node) {
+    if (node->node_type == ASTNodeType::AST_IMPORT_STMT ||
+        node->node_type == ASTNodeType::AST_USE_STMT) {
+        has_imports_ = true;
+    }
+    if (is_declaration(node) && !node->name.empty() &&
+        !global_decls_.count(node)) {
+        local_names_.insert(node->name);
+    }
+    if (!node->exception_var.empty()) {
+        local_names_.insert(node->exception_var);
+    }
+    for (const auto &arm : node->match_arms) {
+        local_names_.insert(arm.bindings.begin(), arm.bindings.end());
+    }
+    for_each_child(node,
+                   [this](const ASTNode *child) { collect_local_names(child); });
+}
+
+void VariableResolver::resolve_node(const ASTNode *node,
+                                    const SlotMap *frame) {
+    if (is_function_like(node)) {
+        resolve_function(node);
+        return;
+    }
+    if (node->node_type == ASTNodeType::AST_VARIABLE ||
+        node->node_type == ASTNodeType::AST_IDENTIFIER) {
+        bind(node, frame);
+    }
+    for_each_child(node, [this, frame](const ASTNode *child) {
+        resolve_node(child, frame);
+    });
+}
+
+void VariableResolver::resolve_function(const ASTNode *function) {
+    // 引数が先頭のスロットを使い、続いて本体で宣言される名前を割り当てる
+    SlotMap frame;
+    for (const auto &param : function->parameters) {
+        if (param && !param->name.empty()) {
+            frame.emplace(param->name, static_cast<int>(frame.size()));
+        }
+    }
+    for (const auto &param : function->lambda_params) {
+        if (param && !param->name.empty()) {
+            frame.emplace(param->name, static_cast<int>(frame.size()));
+        }
+    }
+    for_each_child(function, [this, &frame](const ASTNode *child) {
+        declare_slots(child, frame);
+    });
+
+    for_each_child(function, [this, &frame](const ASTNode *child) {
+        resolve_node(child, &frame);
+    });
+}
+
+void VariableResolver::declare_slots(const ASTNode *node, SlotMap &frame) {
+    // 入れ子の関数（無名関数）は独自のフレームを持つ
+    if (is_function_like(node)) {
+        return;
+    }
+    if ((node->node_type == ASTNodeType::AST_VAR_DECL ||
+         node->node_type == ASTNodeType::AST_ARRAY_DECL) &&
+        !node->name.empty()) {
+        frame.emplace(node->name, static_cast<int>(frame.size()));
+    }
+    if (!node->exception_var.empty()) {
+        frame.emplace(node->exception_var, static_cast<int>(frame.size()));
+    }
+    for (const auto &arm : node->match_arms) {
+        for (const auto &binding : arm.bindings) {
+            frame.emplace(binding, static_cast<int>(frame.size()));
+        }
+    }
+    for_each_child(node, [this, &frame](const ASTNode *child) {
+        declare_slots(child, frame);
+    });
+}
+
+void VariableResolver::bind(const ASTNode *node, const SlotMap *frame) {
+    if (node->name.empty() || node->name == "self") {
+        return;
+    }
+    if (frame) {
+        auto it = frame->find(node->name);
+        if (it != frame->end()) {
+            node->binding = VariableBinding::LOCAL;
+            node->binding_slot = it->second;
+            ++local_bindings_;
+            return;
+        }
+    }
+    if (has_imports_ || local_names_.count(node->name)) {
+        return;
+    }
+    auto it = globals_.find(node->name);
+    if (it != globals_.end()) {
+        node->binding = VariableBinding::GLOBAL;
+        node->binding_slot = it->second;
+        ++global_bindings_;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "../../../common/ast.h"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+// v0.14.0: 変数参照の静的解決パス
+// AST_VARIABLE/AST_IDENTIFIERに (種類, スロット) を書き込み、
+// 実行時の名前検索をスロット参照に置き換えられるようにする。
+//
+// - LOCAL:  関数フレーム内のスロット番号（ブロックはスコープを作らないため
+//           フレームは関数単位で、深さは常に0）
+// - GLOBAL: グローバル変数のインデックス。動的スコープでも結果が変わらない
+//           （どの関数でも同名のローカルが宣言されない）場合のみ割り当てる
+// - UNRESOLVED: self・キャプチャ変数・import先の名前など、名前検索が必要なもの
+class VariableResolver {
+  public:
+    void resolve(const ASTNode *root);
+
+    int local_binding_count() const { return local_bindings_; }
+    int global_binding_count() const { return global_bindings_; }
+
+  private:
+    using SlotMap = std::unordered_map<std::string, int>;
+
+    void collect_globals(const ASTNode *root);
+    void collect_local_names(const ASTNode *node);
+    void resolve_node(const ASTNode *node, const SlotMap *frame);
+    void resolve_function(const ASTNode *function);
+    void declare_slots(const ASTNode *node, SlotMap &frame);
+    void bind(const ASTNode *node, const SlotMap *frame);
+
+    SlotMap globals_;
+    std::unordered_set<const ASTNode *> global_decls_;
+    std::unordered_set<std::string> local_names_;
+    bool has_imports_ = false;
+    int local_bindings_ = 0;
+    int global_bindings_ = 0;
+};
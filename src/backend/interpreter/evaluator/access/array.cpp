@@ -25,21 +25,21 @@ int64_t evaluate_array_ref(
     if (debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "AST_ARRAY_REF: Processing array access");
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "  node->left exists: %s",
                      node->left ? "true" : "false");
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
         if (node->left) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "  node->left->node_type: %d",
                          static_cast<int>(node->left->node_type));
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  node->left has name: %s",
                          !node->left->name.empty() ? node->left->name.c_str()
@@ -47,14 +47,14 @@ int64_t evaluate_array_ref(
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
             if (node->left->left) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "  node->left->left->node_type: %d",
                              static_cast<int>(node->left->left->node_type));
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "  node->left->left has name: %s",
@@ -95,7 +95,7 @@ int64_t evaluate_array_ref(
         }
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Collected %zu indices for multidimensional access",
@@ -103,7 +103,7 @@ int64_t evaluate_array_ref(
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
             for (size_t i = 0; i < indices.size(); i++) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "  index[%zu] = %lld", i,
                              indices[i]);
@@ -120,27 +120,27 @@ int64_t evaluate_array_ref(
         }
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Member variable found: %s.%s", obj_name.c_str(),
                          member_name.c_str());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  is_multidimensional: %s",
                          member_var->is_multidimensional ? "true" : "false");
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "  array_dimensions.size(): %zu",
                          member_var->array_dimensions.size());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  indices.size(): %zu",
                          indices.size());
@@ -235,7 +235,7 @@ int64_t evaluate_array_ref(
 
     // 関数呼び出しの戻り値に対する配列アクセス: func()[index]
     if (node->left && node->left->node_type == ASTNodeType::AST_FUNC_CALL) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Processing function call array access: %s",
@@ -327,7 +327,7 @@ int64_t evaluate_array_ref(
         int64_t ptr_value = var->value;
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Pointer array access: ptr=%lld, index=%lld",
@@ -477,7 +477,7 @@ int64_t evaluate_array_ref(
             if (!looks_like_valid_variable) {
                 // 無効なポインタの場合、エラーをスローする
                 if (debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Invalid Variable pointer: type=%d",
@@ -687,7 +687,7 @@ int64_t evaluate_array_ref(
         int64_t result =
             interpreter.getMultidimensionalArrayElement(*var, indices);
         if (interpreter.is_debug_mode()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[DBG multidim] %s dims=%zu value=%lld",
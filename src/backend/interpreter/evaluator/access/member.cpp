@@ -31,7 +31,7 @@ int64_t ExpressionEvaluator::evaluate_member_access_impl(const ASTNode *node) {
     // Option<int> x = Some(42); の後、x.variantやx.valueへアクセス
     if (node->left && node->left->node_type == ASTNodeType::AST_VARIABLE) {
         Variable *base_var = interpreter_.find_variable(node->left->name);
-        {
+        if (interpreter_.is_debug_mode()) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[MEMBER_EVAL_IMPL] Checking variable '%s': found=%d, "
@@ -53,7 +53,7 @@ int64_t ExpressionEvaluator::evaluate_member_access_impl(const ASTNode *node) {
                 typed_result.string_value = base_var->enum_variant;
                 typed_result.is_numeric_result = false;
                 set_last_typed_result(typed_result);
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[MEMBER_EVAL_IMPL] Returning variant: '%s'",
@@ -291,7 +291,7 @@ int64_t ExpressionEvaluator::evaluate_member_access_impl(const ASTNode *node) {
                 }
             }
         } catch (const std::exception &e) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[EVAL_RESOLVER_ERROR] Exception: %s", e.what());
@@ -582,7 +582,7 @@ int64_t ExpressionEvaluator::evaluate_member_access_impl(const ASTNode *node) {
         // デリファレンスを型情報付きで評価
         TypedValue deref_result = evaluate_typed_expression(node->left.get());
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEREF_MEMBER] deref_result: type=%d, value=%lld",
@@ -737,7 +737,9 @@ int64_t ExpressionEvaluator::evaluate_member_access_impl(const ASTNode *node) {
     // 個別変数として直接アクセスを試す（構造体配列の場合）
     std::string full_member_path = actual_var_name + "." + member_name;
 
-    interpreter_.sync_struct_members_from_direct_access(actual_var_name);
+    // v0.14.0: アクセスするメンバーだけを同期する
+    interpreter_.sync_struct_member_from_direct_access(actual_var_name,
+                                                       member_name);
     interpreter_.ensure_struct_member_access_allowed(actual_var_name,
                                                      member_name);
     Variable *member_var = interpreter_.find_variable(full_member_path);
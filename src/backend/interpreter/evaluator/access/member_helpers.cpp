@@ -46,7 +46,7 @@ TypedValue consume_numeric_typed_value(
     // (evaluate_arrow_accessがset_last_typed_resultを呼び出している)
     if (node && node->node_type == ASTNodeType::AST_ARROW_ACCESS &&
         last_typed_result) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[consume_numeric] inferred=%d, last_result=%d",
@@ -127,26 +127,26 @@ Variable get_struct_member_from_variable(const Variable &struct_var,
                   "[DEBUG] get_struct_member_from_variable: resolving ");
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "[MEMBER_ACCESS_DEBUG] Reference resolved:");
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "  ref_var ptr=%p",
                      (void *)&struct_var);
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "  actual_var ptr=%p",
                      (void *)actual_var);
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "  actual_var->struct_type_name=%s",
                      actual_var->struct_type_name.c_str());
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "  actual_var->struct_members.size()=%zu",
@@ -168,7 +168,7 @@ Variable get_struct_member_from_variable(const Variable &struct_var,
     debug_msg(DebugMsgId::GENERIC_DEBUG,
               "[DEBUG] get_struct_member_from_variable: looking for '%s' in ");
     for (const auto &pair : *members_to_use) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[DEBUG]   - member: '%s' (type=%d, is_reference=%d)",
@@ -222,7 +222,7 @@ Variable get_struct_member_from_variable(const Variable &struct_var,
         }
 
         // v0.13.0: デバッグ情報
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[MEMBER_DEBUG] member='%s', type=%d, is_enum=%d, "
@@ -300,7 +300,7 @@ TypedValue evaluate_function_member_access(const ASTNode *func_node,
         } else {
             // 単一構造体の場合
             Variable struct_var = ret_ex.struct_value;
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "FUNC_MEMBER_ACCESS: Looking for member %s in struct",
@@ -485,7 +485,7 @@ evaluate_recursive_member_access(const Variable &base_var,
 void sync_self_changes_to_receiver(const std::string &receiver_name,
                                    Variable *receiver_var,
                                    Interpreter &interpreter) {
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "SELF_SYNC: Syncing self changes back to %s",
@@ -511,7 +511,7 @@ void sync_self_changes_to_receiver(const std::string &receiver_name,
             receiver_member->type = self_member->type;
             receiver_member->is_assigned = self_member->is_assigned;
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_SYNC: %s.%s = %lld (\"%s\")",
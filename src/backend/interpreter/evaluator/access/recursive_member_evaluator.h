@@ -23,7 +23,7 @@ inline Variable *resolve_nested_member_for_evaluation(
     // 最終メンバー名を取得
     std::string final_member = member_access_node->name;
 
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(
             dbg_buf, sizeof(dbg_buf),
@@ -48,7 +48,7 @@ inline Variable *resolve_nested_member_for_evaluation(
     // ケース1: 単純な変数アクセス (obj.member)
     if (member_access_node->left->node_type == ASTNodeType::AST_VARIABLE ||
         member_access_node->left->node_type == ASTNodeType::AST_IDENTIFIER) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Case 1: Simple variable access for '%s'",
@@ -78,7 +78,7 @@ inline Variable *resolve_nested_member_for_evaluation(
 
         auto it = var->struct_members.find(final_member);
         if (it == var->struct_members.end()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -90,7 +90,7 @@ inline Variable *resolve_nested_member_for_evaluation(
                                      " in " + var_name);
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Found member '%s'", final_member.c_str());
@@ -101,7 +101,7 @@ inline Variable *resolve_nested_member_for_evaluation(
 
     // ケース2: ネストされたメンバーアクセス (obj.mid.member)
     if (member_access_node->left->node_type == ASTNodeType::AST_MEMBER_ACCESS) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Case 2: Nested member access for '%s'",
@@ -136,7 +136,7 @@ inline Variable *resolve_nested_member_for_evaluation(
             return parent_var;
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Found member '%s'", final_member.c_str());
@@ -148,7 +148,7 @@ inline Variable *resolve_nested_member_for_evaluation(
     // ケース3: デリファレンス演算子を含むネスト ((*ptr).val.member)
     if (member_access_node->left->node_type == ASTNodeType::AST_UNARY_OP &&
         member_access_node->left->op == "DEREFERENCE") {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Case 3: Dereference access for '%s'",
@@ -337,7 +337,7 @@ inline Variable *resolve_nested_member_for_evaluation(
         // 構造体から最終メンバーを取得
         auto final_it = struct_var->struct_members.find(final_member);
         if (final_it != struct_var->struct_members.end()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -358,7 +358,7 @@ inline Variable *resolve_nested_member_for_evaluation(
 case_4_arrow_access:
     if (member_access_node->node_type == ASTNodeType::AST_ARROW_ACCESS ||
         member_access_node->left->node_type == ASTNodeType::AST_ARROW_ACCESS) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Case 4: Arrow access for '%s'",
@@ -509,7 +509,7 @@ case_4_arrow_access:
         // arrow_nodeのメンバー名を取得
         std::string arrow_member = arrow_node->name;
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Arrow: getting member '%s' from struct",
@@ -529,7 +529,7 @@ case_4_arrow_access:
                     "[EVAL_RESOLVER] Member '%s' not found in struct_members ");
                 return struct_var;
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[EVAL_RESOLVER] Found member '%s' via simple arrow",
@@ -564,7 +564,7 @@ case_4_arrow_access:
             // まずstruct_membersから探す
             auto final_it = intermediate_var->struct_members.find(final_member);
             if (final_it != intermediate_var->struct_members.end()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -617,7 +617,7 @@ case_4_arrow_access:
     // ケース5: 配列アクセスを含むネスト (obj.arr[0].member または
     // container.shapes[0].edges[0].start)
     if (member_access_node->left->node_type == ASTNodeType::AST_ARRAY_REF) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -630,7 +630,7 @@ case_4_arrow_access:
 
         // インデックスを評価
         int64_t index = evaluate_index(array_ref->array_index.get());
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_RESOLVER] Array index: %lld", index);
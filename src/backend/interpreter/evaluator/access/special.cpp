@@ -284,7 +284,7 @@ int64_t evaluate_arrow_access(
             // 型に応じて読み取り
             if (member_is_pointer || member_type == TYPE_POINTER) {
                 int64_t ptr_val = *reinterpret_cast<int64_t *>(member_addr);
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[ARROW_OP] Read pointer value: 0x%llx",
@@ -362,7 +362,7 @@ int64_t evaluate_arrow_access(
                 const char *str_ptr =
                     *reinterpret_cast<const char **>(member_addr);
                 std::string str_val = (str_ptr != nullptr) ? str_ptr : "";
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[ARROW_OP] Read string value: ptr=%p, str='%s'",
@@ -390,7 +390,7 @@ int64_t evaluate_arrow_access(
     } catch (const ReturnException &ret) {
         // 構造体が返された場合（ptr[index]からの構造体）
         if (ret.is_struct) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[ARROW_OP] Caught struct from ptr[index], type='%s'",
@@ -424,7 +424,7 @@ int64_t evaluate_arrow_access(
         }
     }
 
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[ARROW_OP] ptr_value=0x%llx has_meta=%s",
@@ -704,7 +704,7 @@ int64_t evaluate_arrow_access(
                         struct_var->struct_type_name == struct_type_name &&
                         !struct_var->struct_members.empty()) {
                         is_variable_ptr = true;
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[ARROW_OP] Treating as Variable* to "
@@ -880,7 +880,7 @@ int64_t evaluate_arrow_access(
                 if (member_is_pointer || member_type == TYPE_POINTER) {
                     void **ptr_ptr = static_cast<void **>(member_ptr);
                     int64_t ptr_val = reinterpret_cast<int64_t>(*ptr_ptr);
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -893,7 +893,7 @@ int64_t evaluate_arrow_access(
                 } else if (member_type == TYPE_INT) {
                     int32_t *int_ptr = static_cast<int32_t *>(member_ptr);
                     int64_t value = static_cast<int64_t>(*int_ptr);
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -905,7 +905,7 @@ int64_t evaluate_arrow_access(
                 } else if (member_type == TYPE_LONG) {
                     int64_t *int_ptr = static_cast<int64_t *>(member_ptr);
                     int64_t value = *int_ptr;
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -922,7 +922,7 @@ int64_t evaluate_arrow_access(
                     typed_result.is_numeric_result = true;
                     typed_result.is_float_result = true;
                     evaluator.set_last_typed_result(typed_result);
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[ARROW_OP] Read float value: %f from 0x%lx",
@@ -940,7 +940,7 @@ int64_t evaluate_arrow_access(
                     typed_result.double_value = double_value;
                     typed_result.is_numeric_result = true;
                     evaluator.set_last_typed_result(typed_result);
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[ARROW_OP] Read double value: %f from 0x%lx",
@@ -956,7 +956,7 @@ int64_t evaluate_arrow_access(
                     TypedValue typed_result(
                         str_val, InferredType(TYPE_STRING, "string"));
                     evaluator.set_last_typed_result(typed_result);
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -984,7 +984,7 @@ variable_access:
 
     auto member_it = struct_var->struct_members.find(member_name);
     if (member_it != struct_var->struct_members.end()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[ARROW_OP] struct_var=%p member='%s' value=%lld "
@@ -995,7 +995,7 @@ variable_access:
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
     } else {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[ARROW_OP] struct_var=%p member='%s' not found",
@@ -1017,7 +1017,7 @@ variable_access:
               "[ARROW_OP] member_var retrieved: type=%d, value=%lld, ");
 
     if (member_var.type == TYPE_STRING) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[ARROW_OP] STRING member found: str_value='%s'",
@@ -1032,7 +1032,7 @@ variable_access:
         // last_typed_result_に設定
         evaluator.set_last_typed_result(typed_result);
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -1065,7 +1065,7 @@ variable_access:
         return 0; // dummy value
     } else if (member_var.type == TYPE_DOUBLE) {
         // double の場合
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
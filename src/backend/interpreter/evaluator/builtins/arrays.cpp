@@ -0,0 +1,1570 @@
+// v0.14.0: ポインタ経由の配列要素アクセス組み込み関数
+// array_get/array_set（型推論版）とarray_get_T/array_set_T
+// call_impl.cppのswitchから分離し、BuiltinRegistryに登録して呼び出す
+
+#include "../../../../common/ast.h"
+#include "../../../../common/debug.h"
+#include "../../../../common/debug_messages.h"
+#include "../../../../common/type_helpers.h"
+#include "../../core/interpreter.h"
+#include "../../managers/types/manager.h"
+#include "builtins.h"
+#include "evaluator/core/evaluator.h"
+#include <cstdlib>
+#include <cstring>
+
+// array_get(ptr, index) - 汎用配列要素取得（型推論版）
+// ジェネリクス対応: 型パラメータTから適切なarray_get_Tを呼び出す
+int64_t builtin_array_get(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error(
+            "array_get() requires 2 arguments: array_get(ptr, index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (interpreter.is_debug_mode()) {
+        std::cerr << "[array_get] Called with ptr=0x" << std::hex
+                  << ptr_value << std::dec << ", index=" << index
+                  << "\n";
+    }
+
+    if (ptr_value == 0 || index < 0)
+        return 0;
+
+    // v0.13.1: 型コンテキストからTの実際の型を取得
+    const TypeContext *type_ctx =
+        interpreter.get_current_type_context();
+    if (type_ctx && type_ctx->has_mapping_for("T")) {
+        std::string actual_type = type_ctx->resolve_type("T");
+
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[array_get] Resolved T to: " << actual_type
+                      << "\n";
+        }
+
+        // 構造体型の場合、構造体定義を基にメモリから再構築
+        // ネストしたジェネリック構造体（Vector<Queue<T>>など）のサポート
+        auto struct_def =
+            interpreter.find_struct_definition(actual_type);
+
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[array_get] struct_def for " << actual_type
+                      << ": " << (struct_def ? "found" : "NOT FOUND")
+                      << "\n";
+        }
+        if (struct_def != nullptr) {
+            // 構造体の実際のメモリサイズを取得
+            // 各メンバーの実際のサイズの合計を計算
+            size_t total_size = 0;
+            for (const auto &member : struct_def->members) {
+                if (member.is_pointer) {
+                    total_size += sizeof(void *); // 8 bytes
+                } else if (member.type == TYPE_LONG) {
+                    total_size += sizeof(long); // 8 bytes
+                } else if (member.type == TYPE_INT) {
+                    total_size += sizeof(int); // 4 bytes
+                } else if (member.type == TYPE_FLOAT) {
+                    total_size += sizeof(float); // 4 bytes
+                } else if (member.type == TYPE_DOUBLE) {
+                    total_size += sizeof(double); // 8 bytes
+                } else if (member.type == TYPE_CHAR) {
+                    total_size += sizeof(char); // 1 byte
+                } else {
+                    total_size += sizeof(long); // 8 bytes デフォルト
+                }
+            }
+
+            // 配列内の要素へのポインタを計算
+            char *arr = reinterpret_cast<char *>(ptr_value);
+            char *element_ptr = arr + (index * total_size);
+
+            // メモリから構造体を再構築
+            Variable result;
+            result.is_struct = true;
+            result.struct_type_name = actual_type;
+            result.type_name = actual_type;
+            result.is_assigned = true;
+
+            // メンバーを再構築（8バイトアライメントで読み取り）
+            size_t offset = 0;
+            if (interpreter.is_debug_mode()) {
+                std::cerr << "[array_get] Reconstructing struct "
+                          << actual_type << " from memory at "
+                          << (void *)element_ptr << ", "
+                          << struct_def->members.size() << " members\n";
+            }
+
+            for (const auto &member_def : struct_def->members) {
+                Variable member_var;
+                member_var.type = member_def.type;
+                member_var.is_pointer = member_def.is_pointer;
+
+                // 型に応じた実際のサイズで読み取り
+                if (member_def.is_pointer) {
+                    member_var.value = *reinterpret_cast<int64_t *>(
+                        element_ptr + offset);
+                    offset += sizeof(void *);
+                } else if (member_def.type == TYPE_LONG) {
+                    member_var.value = *reinterpret_cast<int64_t *>(
+                        element_ptr + offset);
+                    offset += sizeof(long);
+                } else if (member_def.type == TYPE_INT) {
+                    member_var.value = *reinterpret_cast<int32_t *>(
+                        element_ptr + offset);
+                    offset += sizeof(int);
+                } else if (member_def.type == TYPE_FLOAT) {
+                    float f_val = *reinterpret_cast<float *>(
+                        element_ptr + offset);
+                    member_var.float_value = f_val;
+                    member_var.value = static_cast<int64_t>(f_val);
+                    offset += sizeof(float);
+                } else if (member_def.type == TYPE_DOUBLE) {
+                    double d_val = *reinterpret_cast<double *>(
+                        element_ptr + offset);
+                    member_var.double_value = d_val;
+                    member_var.value = static_cast<int64_t>(d_val);
+                    offset += sizeof(double);
+                } else if (member_def.type == TYPE_CHAR) {
+                    member_var.value =
+                        *reinterpret_cast<char *>(element_ptr + offset);
+                    offset += sizeof(char);
+                } else {
+                    member_var.value = *reinterpret_cast<int64_t *>(
+                        element_ptr + offset);
+                    offset += sizeof(long);
+                }
+
+                member_var.is_assigned = true;
+                result.struct_members[member_def.name] = member_var;
+
+                if (interpreter.is_debug_mode()) {
+                    size_t member_size = 0;
+                    if (member_def.is_pointer) {
+                        member_size = sizeof(void *);
+                    } else if (member_def.type == TYPE_LONG) {
+                        member_size = sizeof(long);
+                    } else if (member_def.type == TYPE_INT) {
+                        member_size = sizeof(int);
+                    } else if (member_def.type == TYPE_FLOAT) {
+                        member_size = sizeof(float);
+                    } else if (member_def.type == TYPE_DOUBLE) {
+                        member_size = sizeof(double);
+                    } else if (member_def.type == TYPE_CHAR) {
+                        member_size = sizeof(char);
+                    } else {
+                        member_size = sizeof(long);
+                    }
+                    std::cerr
+                        << "[array_get]   Member " << member_def.name
+                        << " at offset " << (offset - member_size)
+                        << ": type="
+                        << static_cast<int>(member_def.type)
+                        << ", is_pointer=" << member_def.is_pointer
+                        << ", value=" << member_var.value << " (0x"
+                        << std::hex << member_var.value << std::dec
+                        << ")\n";
+                }
+            }
+
+            // Deep copy for nested generic structs
+            // Vector<T>とQueue<T>のポインタメンバーをdeep copy
+            if (actual_type.find("Vector<") == 0) {
+                // Vector<T>のdeep copy: data配列をコピー
+                auto data_it = result.struct_members.find("data");
+                auto length_it = result.struct_members.find("length");
+                auto capacity_it =
+                    result.struct_members.find("capacity");
+
+                if (data_it != result.struct_members.end() &&
+                    length_it != result.struct_members.end() &&
+                    capacity_it != result.struct_members.end()) {
+
+                    void *original_data =
+                        reinterpret_cast<void *>(data_it->second.value);
+                    int length =
+                        static_cast<int>(length_it->second.value);
+                    int capacity =
+                        static_cast<int>(capacity_it->second.value);
+
+                    if (interpreter.is_debug_mode()) {
+                        std::cerr
+                            << "[array_get] Vector deep copy check: "
+                            << "data=" << original_data
+                            << ", length=" << length
+                            << ", capacity=" << capacity << "\n";
+                    }
+
+                    if (original_data != nullptr && capacity > 0) {
+                        // 要素の型を取得（Vector<T>のT）
+                        size_t start = actual_type.find('<') + 1;
+                        size_t end = actual_type.find_last_of('>');
+                        std::string element_type =
+                            actual_type.substr(start, end - start);
+
+                        // 要素のサイズを計算
+                        size_t element_size = 0;
+                        auto element_struct_def =
+                            interpreter.find_struct_definition(
+                                element_type);
+                        if (element_struct_def != nullptr) {
+                            // 構造体の場合、8バイトアライメントで計算
+                            for (size_t i = 0;
+                                 i < element_struct_def->members.size();
+                                 ++i) {
+                                element_size += sizeof(long);
+                            }
+                        } else {
+                            // プリミティブ型の場合
+                            element_size = sizeof(long);
+                        }
+
+                        // 新しいdata配列を割り当て
+                        size_t total_bytes = capacity * element_size;
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr
+                                << "[array_get] About to malloc: "
+                                   "capacity="
+                                << capacity
+                                << ", element_size=" << element_size
+                                << ", total_bytes=" << total_bytes
+                                << "\n";
+                        }
+
+                        void *new_data = malloc(total_bytes);
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr
+                                << "[array_get] malloc returned: 0x"
+                                << std::hex << new_data << std::dec
+                                << "\n";
+                        }
+
+                        if (new_data == nullptr) {
+                            throw std::runtime_error(
+                                "malloc failed in deep copy");
+                        }
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr
+                                << "[array_get] About to memcpy: src=0x"
+                                << std::hex << original_data
+                                << ", dst=0x" << new_data << std::dec
+                                << ", bytes=" << total_bytes << "\n";
+                        }
+
+                        memcpy(new_data, original_data, total_bytes);
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr << "[array_get] memcpy completed "
+                                         "successfully\n";
+                        }
+
+                        // dataポインタを更新 + 要素型名を保存
+                        data_it->second.value =
+                            reinterpret_cast<int64_t>(new_data);
+                        data_it->second.type_name =
+                            element_type; // 要素型名を保存
+                        data_it->second.pointer_base_type_name =
+                            element_type; // 念のため両方設定
+                        result.struct_members["data"] = data_it->second;
+
+                        // ポインタ要素型をグローバルマップに登録
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr
+                                << "[array_get] Registering pointer 0x"
+                                << std::hex << new_data << std::dec
+                                << " with element type: "
+                                << element_type << "\n";
+                        }
+                        interpreter.register_pointer_element_type(
+                            new_data, element_type);
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr << "[array_get] Registration "
+                                         "completed\n";
+                        }
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr << "[array_get] Updated "
+                                         "result.struct_members["
+                                         "\"data\"] to 0x"
+                                      << std::hex << new_data
+                                      << std::dec << " (was 0x"
+                                      << std::hex << original_data
+                                      << std::dec << ")\n";
+                        }
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr << "[array_get] Deep copied "
+                                         "Vector data: "
+                                      << total_bytes << " bytes from 0x"
+                                      << std::hex << original_data
+                                      << " to 0x" << new_data
+                                      << std::dec << "\n";
+
+                            // メモリの内容を確認
+                            if (element_type == "long" &&
+                                capacity >= 3) {
+                                long *src = reinterpret_cast<long *>(
+                                    original_data);
+                                long *dst =
+                                    reinterpret_cast<long *>(new_data);
+                                std::cerr
+                                    << "[array_get]   Original data[0]="
+                                    << src[0] << ", [1]=" << src[1]
+                                    << ", [2]=" << src[2] << "\n";
+                                std::cerr
+                                    << "[array_get]   Copied data[0]="
+                                    << dst[0] << ", [1]=" << dst[1]
+                                    << ", [2]=" << dst[2] << "\n";
+                            }
+                        }
+                    }
+                }
+            } else if (actual_type.find("Queue<") == 0) {
+                // Queue<T>のdeep copy: リンクリストをコピー
+                if (interpreter.is_debug_mode()) {
+                    std::cerr << "[array_get] Starting Queue<T> deep "
+                                 "copy for type: "
+                              << actual_type << "\n";
+                }
+                auto front_it = result.struct_members.find("front");
+                auto rear_it = result.struct_members.find("rear");
+                auto length_it = result.struct_members.find("length");
+
+                if (front_it != result.struct_members.end() &&
+                    rear_it != result.struct_members.end() &&
+                    length_it != result.struct_members.end()) {
+
+                    void *original_front = reinterpret_cast<void *>(
+                        front_it->second.value);
+                    int length =
+                        static_cast<int>(length_it->second.value);
+
+                    if (original_front != nullptr && length > 0) {
+                        // 要素の型を取得（Queue<T>のT）
+                        size_t start = actual_type.find('<') + 1;
+                        size_t end = actual_type.find_last_of('>');
+                        std::string element_type =
+                            actual_type.substr(start, end - start);
+
+                        // ノードのサイズを計算（T data + void* next）
+                        // 注意:
+                        // Cbインタープリタは全ての型を8バイトアライメントで扱うため、
+                        // primitive型でも8バイトとして計算する
+                        size_t data_size = 0;
+                        auto element_struct_def =
+                            interpreter.find_struct_definition(
+                                element_type);
+                        if (element_struct_def != nullptr) {
+                            for (size_t i = 0;
+                                 i < element_struct_def->members.size();
+                                 ++i) {
+                                data_size += 8; // 常に8バイト
+                            }
+                        } else {
+                            data_size = 8; // primitive型も8バイト
+                        }
+                        size_t node_size =
+                            data_size +
+                            8; // data + next (両方8バイトアライメント)
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr << "[array_get] Queue node "
+                                         "calculation: element_type="
+                                      << element_type
+                                      << ", data_size=" << data_size
+                                      << ", node_size=" << node_size
+                                      << ", length=" << length << "\n";
+                            std::cerr << "[array_get] original_front=0x"
+                                      << std::hex << original_front
+                                      << std::dec << "\n";
+                        }
+
+                        // リンクリストをコピー
+                        void *new_front = nullptr;
+                        void *new_rear = nullptr;
+                        void *current_old = original_front;
+
+                        while (current_old != nullptr) {
+                            if (interpreter.is_debug_mode()) {
+                                std::cerr << "[array_get] Processing "
+                                             "node at 0x"
+                                          << std::hex << current_old
+                                          << std::dec << "\n";
+                                // ノードの内容をダンプ
+                                int64_t *node_data =
+                                    reinterpret_cast<int64_t *>(
+                                        current_old);
+                                std::cerr
+                                    << "[array_get]   Node data[0]="
+                                    << node_data[0] << ", data[1]=0x"
+                                    << std::hex << node_data[1]
+                                    << std::dec << "\n";
+                            }
+
+                            // 新しいノードを割り当て
+                            void *new_node = malloc(node_size);
+
+                            if (interpreter.is_debug_mode()) {
+                                std::cerr << "[array_get] Allocated "
+                                             "new_node at 0x"
+                                          << std::hex << new_node
+                                          << std::dec << "\n";
+                            }
+
+                            // Vectorの場合は構造体全体（24バイト）をコピー、それ以外は8バイト
+                            size_t copy_size = data_size;
+                            if (element_type.find("Vector<") == 0) {
+                                copy_size =
+                                    24; // Vector struct: data(8) +
+                                        // length(8) + capacity(8)
+                            }
+                            memcpy(new_node, current_old, copy_size);
+
+                            if (interpreter.is_debug_mode()) {
+                                std::cerr << "[array_get] Copied data ("
+                                          << copy_size << " bytes)\n";
+                            }
+
+                            // nextポインタを初期化（nullに設定）
+                            char *next_field_addr =
+                                reinterpret_cast<char *>(new_node) +
+                                data_size;
+                            *reinterpret_cast<void **>(
+                                next_field_addr) = nullptr;
+
+                            // ノード内の要素がVectorの場合、deep copy
+                            if (element_type.find("Vector<") == 0) {
+                                char *new_node_data =
+                                    reinterpret_cast<char *>(new_node);
+
+                                // Vectorのメンバーを読み取り
+                                void *vec_data =
+                                    *reinterpret_cast<void **>(
+                                        new_node_data + 0); // data
+                                int vec_length =
+                                    *reinterpret_cast<int *>(
+                                        new_node_data + 8); // length
+                                int vec_capacity =
+                                    *reinterpret_cast<int *>(
+                                        new_node_data + 16); // capacity
+
+                                if (interpreter.is_debug_mode()) {
+                                    std::cerr
+                                        << "[array_get] Vector in "
+                                           "Queue node: "
+                                        << "data=0x" << std::hex
+                                        << vec_data << std::dec
+                                        << ", length=" << vec_length
+                                        << ", capacity=" << vec_capacity
+                                        << "\n";
+                                }
+
+                                if (vec_data != nullptr &&
+                                    vec_capacity > 0) {
+                                    // Vector内の要素型を取得
+                                    size_t vec_start =
+                                        element_type.find('<') + 1;
+                                    size_t vec_end =
+                                        element_type.find_last_of('>');
+                                    std::string vec_element_type =
+                                        element_type.substr(
+                                            vec_start,
+                                            vec_end - vec_start);
+
+                                    // 要素サイズを計算
+                                    size_t vec_element_size = 0;
+                                    auto vec_element_struct_def =
+                                        interpreter
+                                            .find_struct_definition(
+                                                vec_element_type);
+                                    if (vec_element_struct_def !=
+                                        nullptr) {
+                                        for (size_t i = 0;
+                                             i < vec_element_struct_def
+                                                     ->members.size();
+                                             ++i) {
+                                            vec_element_size +=
+                                                sizeof(long);
+                                        }
+                                    } else {
+                                        vec_element_size = sizeof(long);
+                                    }
+
+                                    // Vector data配列をコピー
+                                    size_t vec_total_bytes =
+                                        vec_capacity * vec_element_size;
+                                    void *new_vec_data =
+                                        malloc(vec_total_bytes);
+                                    memcpy(new_vec_data, vec_data,
+                                           vec_total_bytes);
+
+                                    // 新しいdataポインタを設定
+                                    *reinterpret_cast<void **>(
+                                        new_node_data + 0) =
+                                        new_vec_data;
+
+                                    if (interpreter.is_debug_mode()) {
+                                        std::cerr
+                                            << "[array_get] Deep "
+                                               "copied "
+                                               "Vector in Queue node: "
+                                            << vec_total_bytes
+                                            << " bytes\n";
+                                    }
+                                }
+                            }
+
+                            // リンクリストを構築
+                            if (new_front == nullptr) {
+                                new_front = new_node;
+                            }
+                            if (new_rear != nullptr) {
+                                // 前のノードのnextを更新
+                                char *prev_next_field =
+                                    reinterpret_cast<char *>(new_rear) +
+                                    data_size;
+                                *reinterpret_cast<void **>(
+                                    prev_next_field) = new_node;
+                            }
+                            new_rear = new_node;
+
+                            // 次のノードへ
+                            char *old_next_field =
+                                reinterpret_cast<char *>(current_old) +
+                                data_size;
+                            current_old = *reinterpret_cast<void **>(
+                                old_next_field);
+                        }
+
+                        // frontとrearポインタを更新
+                        front_it->second.value =
+                            reinterpret_cast<int64_t>(new_front);
+                        rear_it->second.value =
+                            reinterpret_cast<int64_t>(new_rear);
+                        result.struct_members["front"] =
+                            front_it->second;
+                        result.struct_members["rear"] = rear_it->second;
+
+                        if (interpreter.is_debug_mode()) {
+                            std::cerr
+                                << "[array_get] Deep copied Queue: "
+                                << length << " nodes from 0x"
+                                << std::hex << original_front
+                                << " to 0x" << new_front << std::dec
+                                << "\n";
+                        }
+                    }
+                }
+            }
+
+            // ReturnExceptionで構造体を返す
+            throw ReturnException(result);
+        }
+
+        // 型に応じて適切にメモリから読み取る
+        if (actual_type == "short") {
+            short *arr = reinterpret_cast<short *>(ptr_value);
+            return static_cast<int64_t>(arr[index]);
+        } else if (actual_type == "long") {
+            long *arr = reinterpret_cast<long *>(ptr_value);
+            if (interpreter.is_debug_mode()) {
+                std::cerr << "[array_get] Reading long at ptr=0x"
+                          << std::hex << ptr_value << std::dec
+                          << ", index=" << index
+                          << ", offset=" << (index * sizeof(long))
+                          << ", value=" << arr[index] << "\n";
+                // メモリ内容も確認
+                std::cerr << "[array_get]   Memory: arr[0]=" << arr[0]
+                          << ", arr[1]=" << arr[1]
+                          << ", arr[2]=" << arr[2] << "\n";
+            }
+            return static_cast<int64_t>(arr[index]);
+        } else if (actual_type == "char") {
+            char *arr = reinterpret_cast<char *>(ptr_value);
+            return static_cast<int64_t>(arr[index]);
+        } else if (actual_type == "string") {
+            // v0.13.4: 文字列配列のサポート
+            // メモリレイアウト: char*ポインタの配列
+            char **arr = reinterpret_cast<char **>(ptr_value);
+            char *str = arr[index];
+            if (str == nullptr) {
+                // 空文字列を返す
+                throw ReturnException(std::string(""));
+            }
+            // char*をstd::stringに変換して返す
+            throw ReturnException(std::string(str));
+        }
+        // int, その他はデフォルトのint扱い
+    } else {
+        // 型コンテキストがない場合：ポインタ要素型マップから型名を取得
+        std::string element_type_name =
+            interpreter.get_pointer_element_type(
+                reinterpret_cast<void *>(ptr_value));
+
+        if (interpreter.is_debug_mode()) {
+            if (!element_type_name.empty()) {
+                std::cerr
+                    << "[array_get] Got element type from pointer map: "
+                    << element_type_name << " for ptr=0x" << std::hex
+                    << ptr_value << std::dec << "\n";
+            } else {
+                std::cerr
+                    << "[array_get] No element type in map for ptr=0x"
+                    << std::hex << ptr_value << std::dec << "\n";
+            }
+        }
+
+        // 型名が取得できた場合、その型で読み取り
+        if (!element_type_name.empty()) {
+            if (element_type_name == "long") {
+                long *arr = reinterpret_cast<long *>(ptr_value);
+                if (interpreter.is_debug_mode()) {
+                    std::cerr << "[array_get] Reading long (from "
+                                 "pointer map) at ptr=0x"
+                              << std::hex << ptr_value << std::dec
+                              << ", index=" << index
+                              << ", value=" << arr[index] << "\n";
+                }
+                return static_cast<int64_t>(arr[index]);
+            } else if (element_type_name == "int") {
+                int *arr = reinterpret_cast<int *>(ptr_value);
+                return static_cast<int64_t>(arr[index]);
+            } else if (element_type_name == "short") {
+                short *arr = reinterpret_cast<short *>(ptr_value);
+                return static_cast<int64_t>(arr[index]);
+            } else if (element_type_name == "char") {
+                char *arr = reinterpret_cast<char *>(ptr_value);
+                return static_cast<int64_t>(arr[index]);
+            }
+        }
+    }
+
+    // デフォルトはintとして扱う
+    if (interpreter.is_debug_mode()) {
+        std::cerr
+            << "[array_get] WARNING: Fallback to int type for ptr=0x"
+            << std::hex << ptr_value << std::dec << ", index=" << index
+            << "\n";
+    }
+    int *arr = reinterpret_cast<int *>(ptr_value);
+    return static_cast<int64_t>(arr[index]);
+}
+
+// array_set(ptr, index, value) - 汎用配列要素設定（型推論版）
+// ジェネリクス対応: 型パラメータTから適切なarray_set_Tを呼び出す
+int64_t builtin_array_set(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set() requires 3 arguments: "
+                                 "array_set(ptr, index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0 || index < 0)
+        return 0;
+
+    // v0.13.1: 型コンテキストからTの実際の型を取得
+    const TypeContext *type_ctx =
+        interpreter.get_current_type_context();
+    if (type_ctx && type_ctx->has_mapping_for("T")) {
+        std::string actual_type = type_ctx->resolve_type("T");
+
+        // 構造体型の場合、構造体全体をメモリにコピー
+        auto struct_def =
+            interpreter.find_struct_definition(actual_type);
+        if (struct_def != nullptr) {
+            // 第3引数は構造体変数
+            const ASTNode *value_node = node->arguments[2].get();
+
+            // 構造体変数を評価して取得
+            try {
+                (void)interpreter.eval_expression(value_node);
+                // 通常は数値が返るがエラー
+                throw std::runtime_error(
+                    "array_set: expected struct but got numeric value");
+            } catch (const ReturnException &ret) {
+                if (ret.is_struct) {
+                    // 構造体の実際のサイズを計算
+                    // NOTE:
+                    // sizeof(T)を使うのが正確だが、Cbインタプリタ内では
+                    //       Cbコードで計算されたsizeof(T)を使う必要がある
+                    //       ここではメンバーの実際の型サイズを使用
+                    size_t total_size = 0;
+                    for (const auto &member_def : struct_def->members) {
+                        size_t member_size =
+                            sizeof(long); // デフォルト8バイト
+
+                        // メンバーの型に応じてサイズを調整
+                        if (member_def.type == TYPE_INT ||
+                            member_def.type == TYPE_FLOAT) {
+                            member_size = sizeof(int); // 4バイト
+                        } else if (member_def.type == TYPE_SHORT) {
+                            member_size = sizeof(short); // 2バイト
+                        } else if (member_def.type == TYPE_CHAR ||
+                                   member_def.type == TYPE_TINY) {
+                            member_size = sizeof(char); // 1バイト
+                        } else if (member_def.type == TYPE_LONG ||
+                                   member_def.type == TYPE_DOUBLE ||
+                                   member_def.type == TYPE_POINTER ||
+                                   member_def.type == TYPE_STRING) {
+                            member_size = sizeof(long); // 8バイト
+                        }
+                        // TODO:
+                        // 構造体メンバーや配列の場合は再帰的にサイズ計算が必要
+
+                        total_size += member_size;
+                    }
+
+                    // 配列内の書き込み位置を計算
+                    char *arr = reinterpret_cast<char *>(ptr_value);
+                    char *element_ptr = arr + (index * total_size);
+
+                    // 構造体メンバーをメモリに書き込み
+                    // Vector<T>の場合はdataポインタをdeep copyする
+                    bool is_vector = (actual_type.find("Vector<") == 0);
+                    void *original_data_ptr = nullptr;
+                    size_t vec_capacity = 0;
+                    std::string vec_element_type;
+
+                    if (is_vector) {
+                        // Vector<T>の要素型を取得
+                        size_t start = actual_type.find('<') + 1;
+                        size_t end = actual_type.find_last_of('>');
+                        vec_element_type =
+                            actual_type.substr(start, end - start);
+
+                        // dataとcapacityを取得
+                        auto data_it =
+                            ret.struct_value.struct_members.find(
+                                "data");
+                        auto capacity_it =
+                            ret.struct_value.struct_members.find(
+                                "capacity");
+                        if (data_it !=
+                                ret.struct_value.struct_members.end() &&
+                            capacity_it !=
+                                ret.struct_value.struct_members.end()) {
+                            original_data_ptr =
+                                reinterpret_cast<void *>(
+                                    data_it->second.value);
+                            vec_capacity = static_cast<size_t>(
+                                capacity_it->second.value);
+                        }
+                    }
+
+                    size_t offset = 0;
+                    for (const auto &member_def : struct_def->members) {
+                        auto it = ret.struct_value.struct_members.find(
+                            member_def.name);
+                        if (it !=
+                            ret.struct_value.struct_members.end()) {
+                            int64_t value_to_write = it->second.value;
+
+                            // Vector<T>のdataメンバーの場合、deep
+                            // copyを行う
+                            if (is_vector &&
+                                member_def.name == "data" &&
+                                original_data_ptr != nullptr &&
+                                vec_capacity > 0) {
+                                // 要素サイズを計算
+                                size_t element_size = 0;
+                                auto element_struct_def =
+                                    interpreter.find_struct_definition(
+                                        vec_element_type);
+                                if (element_struct_def != nullptr) {
+                                    for (size_t i = 0;
+                                         i < element_struct_def->members
+                                                 .size();
+                                         ++i) {
+                                        element_size += sizeof(long);
+                                    }
+                                } else {
+                                    element_size = sizeof(long);
+                                }
+
+                                // 新しいdata配列を確保してコピー
+                                size_t total_bytes =
+                                    vec_capacity * element_size;
+                                void *new_data = malloc(total_bytes);
+                                memcpy(new_data, original_data_ptr,
+                                       total_bytes);
+
+                                // 新しいポインタを書き込む
+                                value_to_write =
+                                    reinterpret_cast<int64_t>(new_data);
+
+                                // ポインタ要素型を登録
+                                interpreter
+                                    .register_pointer_element_type(
+                                        new_data, vec_element_type);
+
+                                if (interpreter.is_debug_mode()) {
+                                    std::cerr
+                                        << "[array_set] Deep copied "
+                                           "Vector data: "
+                                        << total_bytes
+                                        << " bytes from 0x" << std::hex
+                                        << original_data_ptr << " to 0x"
+                                        << new_data << std::dec << "\n";
+                                }
+                            }
+
+                            // メンバーサイズに応じて書き込み
+                            size_t member_size =
+                                sizeof(long); // デフォルト8バイト
+
+                            if (member_def.type == TYPE_INT ||
+                                member_def.type == TYPE_FLOAT) {
+                                member_size = sizeof(int); // 4バイト
+                                *reinterpret_cast<int32_t *>(
+                                    element_ptr + offset) =
+                                    static_cast<int32_t>(
+                                        value_to_write);
+                            } else if (member_def.type == TYPE_SHORT) {
+                                member_size = sizeof(short); // 2バイト
+                                *reinterpret_cast<int16_t *>(
+                                    element_ptr + offset) =
+                                    static_cast<int16_t>(
+                                        value_to_write);
+                            } else if (member_def.type == TYPE_CHAR ||
+                                       member_def.type == TYPE_TINY) {
+                                member_size = sizeof(char); // 1バイト
+                                *reinterpret_cast<int8_t *>(
+                                    element_ptr + offset) =
+                                    static_cast<int8_t>(value_to_write);
+                            } else {
+                                member_size = sizeof(long); // 8バイト
+                                *reinterpret_cast<int64_t *>(
+                                    element_ptr + offset) =
+                                    value_to_write;
+                            }
+
+                            offset += member_size;
+                        } else {
+                            // デフォルト値を書き込み
+                            size_t member_size =
+                                sizeof(long); // デフォルト8バイト
+
+                            if (member_def.type == TYPE_INT ||
+                                member_def.type == TYPE_FLOAT) {
+                                member_size = sizeof(int); // 4バイト
+                                *reinterpret_cast<int32_t *>(
+                                    element_ptr + offset) = 0;
+                            } else if (member_def.type == TYPE_SHORT) {
+                                member_size = sizeof(short); // 2バイト
+                                *reinterpret_cast<int16_t *>(
+                                    element_ptr + offset) = 0;
+                            } else if (member_def.type == TYPE_CHAR ||
+                                       member_def.type == TYPE_TINY) {
+                                member_size = sizeof(char); // 1バイト
+                                *reinterpret_cast<int8_t *>(
+                                    element_ptr + offset) = 0;
+                            } else {
+                                member_size = sizeof(long); // 8バイト
+                                *reinterpret_cast<int64_t *>(
+                                    element_ptr + offset) = 0;
+                            }
+
+                            offset += member_size;
+                        }
+                    }
+
+                    if (interpreter.is_debug_mode()) {
+                        std::cerr << "[array_set] Wrote struct "
+                                  << actual_type
+                                  << " to array at index " << index
+                                  << ", total_size=" << total_size
+                                  << "\n";
+                        size_t debug_offset = 0;
+                        for (const auto &member_def :
+                             struct_def->members) {
+                            size_t member_size = sizeof(long);
+                            if (member_def.type == TYPE_INT ||
+                                member_def.type == TYPE_FLOAT) {
+                                member_size = sizeof(int);
+                            } else if (member_def.type == TYPE_SHORT) {
+                                member_size = sizeof(short);
+                            } else if (member_def.type == TYPE_CHAR ||
+                                       member_def.type == TYPE_TINY) {
+                                member_size = sizeof(char);
+                            }
+
+                            auto it =
+                                ret.struct_value.struct_members.find(
+                                    member_def.name);
+                            if (it !=
+                                ret.struct_value.struct_members.end()) {
+                                std::cerr << "[array_set]   Member "
+                                          << member_def.name
+                                          << " at offset "
+                                          << debug_offset << ": "
+                                          << it->second.value << "\n";
+                            }
+                            debug_offset += member_size;
+                        }
+                    }
+
+                    return 0;
+                }
+            }
+
+            // 構造体でなければ変数参照として処理
+            std::string var_name;
+            if (value_node->node_type == ASTNodeType::AST_VARIABLE) {
+                var_name = value_node->name;
+                Variable *struct_var =
+                    interpreter.find_variable(var_name);
+                if (struct_var && struct_var->is_struct) {
+                    // 構造体の実際のサイズを計算
+                    size_t total_size = 0;
+                    for (const auto &member_def : struct_def->members) {
+                        size_t member_size =
+                            sizeof(long); // デフォルト8バイト
+
+                        // メンバーの型に応じてサイズを調整
+                        if (member_def.type == TYPE_INT ||
+                            member_def.type == TYPE_FLOAT) {
+                            member_size = sizeof(int); // 4バイト
+                        } else if (member_def.type == TYPE_SHORT) {
+                            member_size = sizeof(short); // 2バイト
+                        } else if (member_def.type == TYPE_CHAR ||
+                                   member_def.type == TYPE_TINY) {
+                            member_size = sizeof(char); // 1バイト
+                        } else if (member_def.type == TYPE_LONG ||
+                                   member_def.type == TYPE_DOUBLE ||
+                                   member_def.type == TYPE_POINTER ||
+                                   member_def.type == TYPE_STRING) {
+                            member_size = sizeof(long); // 8バイト
+                        }
+
+                        total_size += member_size;
+                    }
+
+                    // 配列内の書き込み位置を計算
+                    char *arr = reinterpret_cast<char *>(ptr_value);
+                    char *element_ptr = arr + (index * total_size);
+
+                    // 構造体メンバーをメモリに書き込み
+                    size_t offset = 0;
+                    for (const auto &member_def : struct_def->members) {
+                        size_t member_size =
+                            sizeof(long); // デフォルト8バイト
+
+                        // メンバーの型に応じてサイズを調整
+                        if (member_def.type == TYPE_INT ||
+                            member_def.type == TYPE_FLOAT) {
+                            member_size = sizeof(int); // 4バイト
+                        } else if (member_def.type == TYPE_SHORT) {
+                            member_size = sizeof(short); // 2バイト
+                        } else if (member_def.type == TYPE_CHAR ||
+                                   member_def.type == TYPE_TINY) {
+                            member_size = sizeof(char); // 1バイト
+                        } else if (member_def.type == TYPE_LONG ||
+                                   member_def.type == TYPE_DOUBLE ||
+                                   member_def.type == TYPE_POINTER ||
+                                   member_def.type == TYPE_STRING) {
+                            member_size = sizeof(long); // 8バイト
+                        }
+
+                        auto it = struct_var->struct_members.find(
+                            member_def.name);
+                        if (it != struct_var->struct_members.end()) {
+                            // メンバーサイズに応じて書き込み
+                            if (member_size == 4) {
+                                *reinterpret_cast<int32_t *>(
+                                    element_ptr + offset) =
+                                    static_cast<int32_t>(
+                                        it->second.value);
+                            } else {
+                                *reinterpret_cast<int64_t *>(
+                                    element_ptr + offset) =
+                                    it->second.value;
+                            }
+                        } else {
+                            // デフォルト値を書き込み
+                            if (member_size == 4) {
+                                *reinterpret_cast<int32_t *>(
+                                    element_ptr + offset) = 0;
+                            } else {
+                                *reinterpret_cast<int64_t *>(
+                                    element_ptr + offset) = 0;
+                            }
+                        }
+                        offset += member_size;
+                    }
+
+                    if (interpreter.is_debug_mode()) {
+                        std::cerr << "[array_set] Wrote struct "
+                                  << actual_type << " (" << var_name
+                                  << ") to array at index " << index
+                                  << ", total_size=" << total_size
+                                  << "\n";
+                        for (const auto &m :
+                             struct_var->struct_members) {
+                            std::cerr << "[array_set]   " << m.first
+                                      << " = " << m.second.value
+                                      << "\n";
+                        }
+                    }
+
+                    return 0;
+                }
+            }
+        }
+
+        // プリミティブ型の処理
+        int64_t value =
+            interpreter.eval_expression(node->arguments[2].get());
+
+        // 型に応じて適切にメモリに書き込む
+        if (actual_type == "short") {
+            short *arr = reinterpret_cast<short *>(ptr_value);
+            arr[index] = static_cast<short>(value);
+            return 0;
+        } else if (actual_type == "long") {
+            long *arr = reinterpret_cast<long *>(ptr_value);
+            arr[index] = static_cast<long>(value);
+            return 0;
+        } else if (actual_type == "char") {
+            char *arr = reinterpret_cast<char *>(ptr_value);
+            arr[index] = static_cast<char>(value);
+            return 0;
+        } else if (actual_type == "string") {
+            // v0.13.4: 文字列配列のサポート
+            // 第3引数は文字列値
+            const ASTNode *value_node = node->arguments[2].get();
+
+            // 文字列リテラルまたは文字列変数を評価
+            std::string str_value;
+            if (value_node->node_type ==
+                ASTNodeType::AST_STRING_LITERAL) {
+                str_value = value_node->str_value;
+            } else if (value_node->node_type ==
+                       ASTNodeType::AST_VARIABLE) {
+                Variable *var =
+                    interpreter.find_variable(value_node->name);
+                if (var && var->type == TYPE_STRING) {
+                    str_value = var->str_value;
+                } else {
+                    throw std::runtime_error(
+                        "array_set: string variable not found or not a "
+                        "string");
+                }
+            } else {
+                throw std::runtime_error(
+                    "array_set: unsupported value type for string");
+            }
+
+            // メモリレイアウト: char*ポインタの配列
+            // 文字列のdeep copyを作成
+            char *str_copy = (char *)malloc(str_value.size() + 1);
+            strcpy(str_copy, str_value.c_str());
+
+            // 配列内のポインタを更新
+            char **arr = reinterpret_cast<char **>(ptr_value);
+
+            // 既存の文字列があれば解放
+            if (arr[index] != nullptr) {
+                free(arr[index]);
+            }
+
+            arr[index] = str_copy;
+
+            if (interpreter.is_debug_mode()) {
+                std::cerr << "[array_set] String set at index " << index
+                          << ": '" << str_value << "' at "
+                          << (void *)str_copy << "\n";
+            }
+
+            return 0;
+        }
+        // int, その他はデフォルトのint扱い
+    }
+
+    // デフォルトはintとして扱う
+    int64_t value =
+        interpreter.eval_expression(node->arguments[2].get());
+    int *arr = reinterpret_cast<int *>(ptr_value);
+    arr[index] = static_cast<int>(value);
+    return 0;
+}
+
+// array_get_int(ptr, index) - 配列要素を取得
+int64_t builtin_array_get_int(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error(
+            "array_get_int() requires 2 arguments: array_get_int(ptr, "
+            "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_int] Error: null pointer" << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_int] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    int *arr = reinterpret_cast<int *>(ptr_value);
+    return static_cast<int64_t>(arr[index]);
+}
+
+// array_set_int(ptr, index, value) - 配列要素を設定
+int64_t builtin_array_set_int(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error(
+            "array_set_int() requires 3 arguments: array_set_int(ptr, "
+            "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t value =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_int] Error: null pointer" << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_int] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    int *arr = reinterpret_cast<int *>(ptr_value);
+    arr[index] = static_cast<int>(value);
+    return 0;
+}
+
+// array_get_long(ptr, index) - long配列要素を取得
+int64_t builtin_array_get_long(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("array_get_long() requires 2 "
+                                 "arguments: array_get_long(ptr, "
+                                 "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_long] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_long] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    long *arr = reinterpret_cast<long *>(ptr_value);
+    return static_cast<int64_t>(arr[index]);
+}
+
+// array_set_long(ptr, index, value) - long配列要素を設定
+int64_t builtin_array_set_long(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set_long() requires 3 "
+                                 "arguments: array_set_long(ptr, "
+                                 "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t value =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_long] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_long] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    long *arr = reinterpret_cast<long *>(ptr_value);
+    arr[index] = static_cast<long>(value);
+    return 0;
+}
+
+// array_get_char(ptr, index) - char配列要素を取得
+int64_t builtin_array_get_char(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("array_get_char() requires 2 "
+                                 "arguments: array_get_char(ptr, "
+                                 "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_char] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_char] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    char *arr = reinterpret_cast<char *>(ptr_value);
+    return static_cast<int64_t>(arr[index]);
+}
+
+// array_set_char(ptr, index, value) - char配列要素を設定
+int64_t builtin_array_set_char(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set_char() requires 3 "
+                                 "arguments: array_set_char(ptr, "
+                                 "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t value =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_char] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_char] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    char *arr = reinterpret_cast<char *>(ptr_value);
+    arr[index] = static_cast<char>(value);
+    return 0;
+}
+
+// array_get_bool(ptr, index) - bool配列要素を取得
+int64_t builtin_array_get_bool(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("array_get_bool() requires 2 "
+                                 "arguments: array_get_bool(ptr, "
+                                 "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_bool] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_bool] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    bool *arr = reinterpret_cast<bool *>(ptr_value);
+    return static_cast<int64_t>(arr[index] ? 1 : 0);
+}
+
+// array_set_bool(ptr, index, value) - bool配列要素を設定
+int64_t builtin_array_set_bool(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set_bool() requires 3 "
+                                 "arguments: array_set_bool(ptr, "
+                                 "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t value =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_bool] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_bool] Error: negative index " << index
+                  << std::endl;
+        return 0;
+    }
+
+    bool *arr = reinterpret_cast<bool *>(ptr_value);
+    arr[index] = (value != 0);
+    return 0;
+}
+
+// array_get_double(ptr, index) - double配列要素を取得
+int64_t builtin_array_get_double(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("array_get_double() requires 2 "
+                                 "arguments: array_get_double(ptr, "
+                                 "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_double] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_double] Error: negative index "
+                  << index << std::endl;
+        return 0;
+    }
+
+    double *arr = reinterpret_cast<double *>(ptr_value);
+    double value = arr[index];
+
+    // doubleをint64_tのビット表現として返す
+    union {
+        double d;
+        int64_t i;
+    } converter;
+    converter.d = value;
+
+    return converter.i;
+}
+
+// array_set_double(ptr, index, value) - double配列要素を設定
+int64_t builtin_array_set_double(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set_double() requires 3 "
+                                 "arguments: array_set_double(ptr, "
+                                 "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    // doubleの値を取得するにはevaluate_typedを使用
+    TypedValue typed_val =
+        interpreter.evaluate_typed(node->arguments[2].get());
+    double value = typed_val.as_double();
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_double] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_double] Error: negative index "
+                  << index << std::endl;
+        return 0;
+    }
+
+    double *arr = reinterpret_cast<double *>(ptr_value);
+    arr[index] = value;
+    return 0;
+}
+
+// array_get_string(ptr, index) - string配列要素を取得
+int64_t builtin_array_get_string(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("array_get_string() requires 2 "
+                                 "arguments: array_get_string(ptr, "
+                                 "index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_string] Error: null pointer"
+                  << std::endl;
+        return 0; // 空文字列として0を返す
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_string] Error: negative index "
+                  << index << std::endl;
+        return 0; // 空文字列として0を返す
+    }
+
+    std::string **arr = reinterpret_cast<std::string **>(ptr_value);
+    return reinterpret_cast<int64_t>(arr[index]);
+}
+
+// array_set_string(ptr, index, value) - string配列要素を設定
+int64_t builtin_array_set_string(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("array_set_string() requires 3 "
+                                 "arguments: array_set_string(ptr, "
+                                 "index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t str_ptr =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_string] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_string] Error: negative index "
+                  << index << std::endl;
+        return 0;
+    }
+
+    std::string **arr = reinterpret_cast<std::string **>(ptr_value);
+    arr[index] = reinterpret_cast<std::string *>(str_ptr);
+    return 0;
+}
+
+// array_get_struct(ptr, index) -
+// 構造体配列要素を取得（memcpyで値をコピー）
+int64_t builtin_array_get_struct(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error(
+            "array_get_struct() requires 2 arguments: "
+            "array_get_struct(ptr, index)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_get_struct] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_get_struct] Error: negative index "
+                  << index << std::endl;
+        return 0;
+    }
+
+    // 構造体配列は連続したメモリとして扱う
+    // 戻り値は構造体のコピーのアドレス（インタプリタが管理）
+    return ptr_value +
+           index; // ポインタ演算は呼び出し側で型サイズを考慮する
+}
+
+// array_set_struct(ptr, index, value) -
+// 構造体配列要素を設定（memcpyで値をコピー）
+int64_t builtin_array_set_struct(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error(
+            "array_set_struct() requires 3 arguments: "
+            "array_set_struct(ptr, index, value)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t index =
+        interpreter.eval_expression(node->arguments[1].get());
+    // struct_ptrは呼び出し側で処理されるため、ここでは評価のみ
+    (void)interpreter.eval_expression(node->arguments[2].get());
+
+    if (ptr_value == 0) {
+        std::cerr << "[array_set_struct] Error: null pointer"
+                  << std::endl;
+        return 0;
+    }
+
+    if (index < 0) {
+        std::cerr << "[array_set_struct] Error: negative index "
+                  << index << std::endl;
+        return 0;
+    }
+
+    // 構造体のコピーは呼び出し側が適切に処理する
+    // ここでは単にポインタ演算の結果を返す
+    return ptr_value + index;
+}
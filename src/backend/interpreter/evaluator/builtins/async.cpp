@@ -0,0 +1,694 @@
+// v0.14.0: 非同期ランタイムの組み込み関数
+// イベントループ・タイマー（now/sleep/timeout）・スケジューリング設定・
+// 優先度キュー・チャネル
+// call_impl.cppのswitchから分離し、BuiltinRegistryに登録して呼び出す
+
+#include "../../../../common/ast.h"
+#include "../../../../common/debug.h"
+#include "../../../../common/debug_messages.h"
+#include "../../core/interpreter.h"
+#include "../../event_loop/channel.h"           // v0.14.0: Channel
+#include "../../event_loop/clock.h"             // v0.14.0: epoch_now_ms
+#include "../../event_loop/simple_event_loop.h" // v0.13.0: SimpleEventLoop
+#include "../../event_loop/user_queue.h"        // v0.14.0: UserPriorityQueue
+#include "builtins.h"
+#include "evaluator/core/evaluator.h"
+#include <string>
+#include <vector>
+
+// v0.14.0: 評価済みのFutureからタスクIDを取り出す
+static int future_task_id(const TypedValue &future_typed,
+                          const char *builtin_name) {
+    if (!future_typed.is_struct_result || !future_typed.struct_data ||
+        future_typed.struct_data->struct_type_name.find("Future") ==
+            std::string::npos) {
+        throw std::runtime_error(std::string(builtin_name) +
+                                 "() arguments must be Futures");
+    }
+    const auto &members = future_typed.struct_data->struct_members;
+    auto task_id_it = members.find("task_id");
+    if (task_id_it == members.end()) {
+        throw std::runtime_error(std::string(builtin_name) +
+                                 "() future does not have task_id");
+    }
+    return static_cast<int>(task_id_it->second.value);
+}
+
+// v0.14.0: concurrent_await/raceの引数（Future<T>）からタスクIDを集める
+static std::vector<int> collect_future_task_ids(Interpreter &interpreter,
+                                                const ASTNode *node,
+                                                const char *builtin_name) {
+    if (node->arguments.empty()) {
+        throw std::runtime_error(std::string(builtin_name) +
+                                 "() requires at least 1 Future argument");
+    }
+    std::vector<int> task_ids;
+    task_ids.reserve(node->arguments.size());
+    for (const auto &arg : node->arguments) {
+        task_ids.push_back(future_task_id(
+            interpreter.evaluate_typed(arg.get()), builtin_name));
+    }
+    return task_ids;
+}
+
+// v0.14.0: channel_sendの引数をチャネルに入れるVariableへ変換する
+// 構造体は評価結果を他から参照されていなければコピーせずにムーブする
+static Variable channel_value(TypedValue &&typed) {
+    if (typed.is_struct()) {
+        if (typed.struct_data.use_count() == 1) {
+            return std::move(*typed.struct_data);
+        }
+        return *typed.struct_data;
+    }
+    Variable value;
+    value.is_assigned = true;
+    if (typed.is_string()) {
+        value.type = TYPE_STRING;
+        value.str_value = std::move(typed.string_value);
+    } else if (typed.is_floating()) {
+        value.type = typed.numeric_type;
+        value.float_value = static_cast<float>(typed.double_value);
+        value.double_value = typed.double_value;
+        value.quad_value = typed.quad_value;
+    } else {
+        value.type = typed.numeric_type == TYPE_UNKNOWN ? TYPE_INT
+                                                        : typed.numeric_type;
+        value.value = typed.value;
+    }
+    return value;
+}
+
+// v0.14.0: チャネル・優先度キューから取り出した値を組み込み関数の戻り値にする
+// 構造体・文字列はReturnExceptionで返す
+static int64_t return_stored_value(ExpressionEvaluator &evaluator,
+                                   const ASTNode *node, Variable &&value) {
+    if (value.is_struct || value.is_enum || value.type == TYPE_STRUCT) {
+        ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
+        ret.type = value.type;
+        ret.is_struct = true;
+        ret.struct_value = std::move(value);
+        throw ret;
+    }
+    if (value.type == TYPE_STRING) {
+        ReturnException ret{std::string()};
+        ret.str_value = std::move(value.str_value);
+        throw ret;
+    }
+    if (value.type == TYPE_FLOAT || value.type == TYPE_DOUBLE ||
+        value.type == TYPE_QUAD) {
+        TypedValue typed_result(value.double_value,
+                                InferredType(value.type, ""));
+        evaluator.set_last_typed_result(typed_result);
+        evaluator.get_last_captured_function_value() =
+            std::make_pair(node, typed_result);
+        return *reinterpret_cast<int64_t *>(&value.double_value);
+    }
+    return value.value;
+}
+
+// v0.14.0: 完了したタスクのFuture.value（取り消されたタスクは既定値）
+static Variable future_result_value(cb::SimpleEventLoop &event_loop,
+                                    int task_id) {
+    AsyncTask *task = event_loop.get_task(task_id);
+    const Variable *future = nullptr;
+    if (task) {
+        future = task->use_internal_future ? &task->internal_future
+                                           : task->future_var;
+    }
+    if (future) {
+        auto value_it = future->struct_members.find("value");
+        if (value_it != future->struct_members.end()) {
+            return value_it->second;
+        }
+    }
+    Variable empty;
+    empty.type = TYPE_INT;
+    return empty;
+}
+
+// run_event_loop() - SimpleEventLoopを実行 (v0.13.0 Phase 2.0)
+int64_t builtin_run_event_loop(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 0) {
+        throw std::runtime_error("run_event_loop() takes no arguments");
+    }
+
+    // SimpleEventLoopを実行
+    interpreter.get_simple_event_loop().run();
+
+    return 0;
+}
+
+// concurrent_await(future1, future2, future3, ...) -
+// 複数のFutureを並行実行し、全完了後に結果を引数順の配列で返す
+// (v0.14.0) Result::Errで完了したFutureがあれば残りを取り消して
+// 打ち切る（取り消されたFutureの結果は既定値）
+int64_t builtin_concurrent_await(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    std::vector<int> task_ids =
+        collect_future_task_ids(interpreter, node, "concurrent_await");
+    auto &event_loop = interpreter.get_simple_event_loop();
+    event_loop.run_until_all_complete(task_ids);
+
+    std::vector<Variable> results;
+    results.reserve(task_ids.size());
+    for (int task_id : task_ids) {
+        results.push_back(future_result_value(event_loop, task_id));
+    }
+
+    // 要素型は最初の結果に合わせる
+    const Variable &first = results.front();
+    if (first.is_struct || first.is_enum ||
+        first.type == TYPE_STRUCT) {
+        std::vector<std::vector<std::vector<Variable>>> struct_3d = {
+            {results}};
+        throw ReturnException(struct_3d, first.struct_type_name);
+    }
+    if (first.type == TYPE_STRING) {
+        std::vector<std::string> values;
+        for (const auto &result : results) {
+            values.push_back(result.str_value);
+        }
+        std::vector<std::vector<std::vector<std::string>>> str_3d = {
+            {values}};
+        throw ReturnException(str_3d, "string[]", TYPE_STRING);
+    }
+    if (first.type == TYPE_FLOAT || first.type == TYPE_DOUBLE ||
+        first.type == TYPE_QUAD) {
+        std::vector<double> values;
+        for (const auto &result : results) {
+            values.push_back(result.double_value);
+        }
+        std::vector<std::vector<std::vector<double>>> double_3d = {
+            {values}};
+        throw ReturnException(double_3d, "double[]", first.type);
+    }
+    std::vector<int64_t> values;
+    for (const auto &result : results) {
+        values.push_back(result.value);
+    }
+    std::vector<std::vector<std::vector<int64_t>>> int_3d = {{values}};
+    throw ReturnException(int_3d, "int[]", TYPE_INT);
+}
+
+// race(future1, future2, ...) - 最初に完了したFutureの値を返し、
+// 残りのFutureを取り消す (v0.14.0)
+int64_t builtin_race(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    std::vector<int> task_ids =
+        collect_future_task_ids(interpreter, node, "race");
+    auto &event_loop = interpreter.get_simple_event_loop();
+    int winner = event_loop.run_until_any_complete(task_ids);
+    if (winner < 0) {
+        throw std::runtime_error("race() no future completed");
+    }
+
+    Variable result = future_result_value(event_loop, task_ids[winner]);
+    if (result.is_struct || result.is_enum ||
+        result.type == TYPE_STRUCT) {
+        throw ReturnException(result);
+    }
+    if (result.type == TYPE_STRING) {
+        throw ReturnException(result.str_value);
+    }
+    if (result.type == TYPE_FLOAT || result.type == TYPE_DOUBLE ||
+        result.type == TYPE_QUAD) {
+        TypedValue typed_result(result.double_value,
+                                InferredType(result.type, ""));
+        evaluator.set_last_typed_result(typed_result);
+        evaluator.get_last_captured_function_value() =
+            std::make_pair(node, typed_result);
+        return *reinterpret_cast<int64_t *>(&result.double_value);
+    }
+    return result.value;
+}
+
+// now() - 現在時刻をエポックからのミリ秒で取得 (v0.12.0)
+int64_t builtin_now(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    if (node->arguments.size() != 0) {
+        throw std::runtime_error("now() takes no arguments");
+    }
+
+    return cb::epoch_now_ms();
+}
+
+// timeout(future, milliseconds) - タイムアウト機能 (v0.12.1)
+// 指定時間内にFutureが完了しなければResult::Errを返す
+int64_t builtin_timeout(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 2) {
+        throw std::runtime_error("timeout() requires exactly 2 "
+                                 "arguments (future, timeout_ms)");
+    }
+
+    // 第1引数: Future<T>を評価（実際にはawait対象のFuture）
+    ASTNode *future_arg = node->arguments[0].get();
+    TypedValue future_typed = interpreter.evaluate_typed(future_arg);
+
+    if (!future_typed.is_struct_result || !future_typed.struct_data ||
+        future_typed.struct_data->struct_type_name.find("Future") ==
+            std::string::npos) {
+        throw std::runtime_error(
+            "timeout() first argument must be a Future");
+    }
+
+    // 第2引数: タイムアウト時間（ミリ秒）
+    ASTNode *timeout_arg = node->arguments[1].get();
+    int64_t timeout_ms_val = interpreter.evaluate(timeout_arg);
+    int timeout_ms = static_cast<int>(timeout_ms_val);
+
+    if (timeout_ms < 0) {
+        throw std::runtime_error(
+            "timeout() timeout value must be non-negative");
+    }
+
+    // Futureからtask_idを取得
+    auto task_id_it =
+        future_typed.struct_data->struct_members.find("task_id");
+    if (task_id_it == future_typed.struct_data->struct_members.end()) {
+        throw std::runtime_error(
+            "timeout() future does not have task_id");
+    }
+    int task_id = static_cast<int>(task_id_it->second.value);
+
+    // 現在時刻を取得
+    int64_t current_time_ms = cb::epoch_now_ms();
+
+    int64_t timeout_time_ms = current_time_ms + timeout_ms;
+
+    // 元のFutureにタイムアウト情報を追加
+    Variable timeout_field;
+    timeout_field.type = TYPE_INT;
+    timeout_field.value = timeout_time_ms;
+    timeout_field.is_assigned = true;
+    future_typed.struct_data->struct_members["timeout_ms"] =
+        timeout_field;
+
+    // タスクにタイムアウト情報を設定
+    AsyncTask *task =
+        interpreter.get_simple_event_loop().get_task(task_id);
+    if (task) {
+        task->timeout_ms = timeout_time_ms;
+        task->has_timeout = true;
+    }
+
+    // Result<T, string>を返すFutureを作成
+    // 元のFutureの型情報を保持しつつ、Result型でラップ
+    Variable result_future;
+    result_future.is_struct = true;
+    result_future.struct_type_name = "Future";
+    result_future.type = TYPE_STRUCT;
+
+    // Result Future用のtask_idは同じものを使用
+    Variable result_task_id_field;
+    result_task_id_field.type = TYPE_INT;
+    result_task_id_field.value = task_id;
+    result_task_id_field.is_assigned = true;
+    result_future.struct_members["task_id"] = result_task_id_field;
+
+    // is_ready = false (まだ完了していない)
+    Variable is_ready_field;
+    is_ready_field.type = TYPE_INT;
+    is_ready_field.value = 0;
+    is_ready_field.is_assigned = true;
+    result_future.struct_members["is_ready"] = is_ready_field;
+
+    // value フィールド（初期値はダミー）
+    Variable value_field;
+    value_field.type = TYPE_INT;
+    value_field.value = 0;
+    value_field.is_assigned = true;
+    result_future.struct_members["value"] = value_field;
+
+    // timeout_msフィールドを追加
+    result_future.struct_members["timeout_ms"] = timeout_field;
+
+    // タイムアウト付きFutureを返す
+    ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
+    ret.is_struct = true;
+    ret.struct_value = result_future;
+    ret.struct_value.type = TYPE_STRUCT;
+    ret.struct_value.is_struct = true;
+    throw ret;
+}
+
+// sleep/sleep_msの共通部分: 起床時刻を設定したsleepタスクを登録し、
+// そのFutureをReturnExceptionで返す
+[[noreturn]] static void start_sleep_task(Interpreter &interpreter,
+                                          const ASTNode *node,
+                                          const char *name) {
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            std::string(name) +
+                                 "() requires exactly 1 argument (milliseconds)");
+    }
+
+    // 引数を評価してミリ秒を取得
+    ASTNode *arg = node->arguments[0].get();
+    int64_t result = interpreter.evaluate(arg);
+    int milliseconds = static_cast<int>(result);
+
+    if (milliseconds < 0) {
+        throw std::runtime_error(
+            std::string(name) + "() argument must be non-negative");
+    }
+
+    // v0.13.0: 非ブロッキングsleep実装
+    // ダミーのasync関数を作成してイベントループに登録
+    AsyncTask sleep_task;
+    sleep_task.function_name = name;
+    sleep_task.function_node = nullptr; // sleepは特殊なタスク
+    sleep_task.is_started = true;
+    sleep_task.is_executed = false;
+    sleep_task.current_statement_index = 0;
+
+    // すぐにsleep状態にする
+    sleep_task.is_sleeping = true;
+
+    // 起床時刻を設定
+    int64_t current_time_ms = cb::epoch_now_ms();
+    sleep_task.wake_up_time_ms = current_time_ms + milliseconds;
+
+    // awaitをサポートするため、Future構造体を作成
+    Variable future_var;
+    future_var.is_struct = true;
+    future_var.struct_type_name = "Future";
+    future_var.type = TYPE_STRUCT;
+
+    // Future.is_ready = false (sleep中)
+    Variable is_ready_field;
+    is_ready_field.type = TYPE_INT;
+    is_ready_field.value = 0; // false
+    is_ready_field.is_assigned = true;
+    future_var.struct_members["is_ready"] = is_ready_field;
+
+    // Future.value = 0 (sleep()は値を返さない)
+    Variable value_field;
+    value_field.type = TYPE_INT;
+    value_field.value = 0;
+    value_field.is_assigned = true;
+    future_var.struct_members["value"] = value_field;
+
+    // internal_futureに設定（deep copy）
+    sleep_task.internal_future.is_struct = true;
+    sleep_task.internal_future.struct_type_name =
+        future_var.struct_type_name;
+    sleep_task.internal_future.type = TYPE_STRUCT;
+    for (const auto &[key, val] : future_var.struct_members) {
+        sleep_task.internal_future.struct_members[key] = val;
+    }
+    sleep_task.use_internal_future = true;
+
+    // タスクをイベントループに登録
+    int task_id =
+        interpreter.get_simple_event_loop().register_task(sleep_task);
+
+    debug_msg(DebugMsgId::SLEEP_TASK_REGISTER, task_id, milliseconds,
+              sleep_task.wake_up_time_ms);
+
+    // task_idフィールドを設定
+    Variable task_id_field;
+    task_id_field.type = TYPE_INT;
+    task_id_field.value = task_id;
+    task_id_field.is_assigned = true;
+    future_var.struct_members["task_id"] = task_id_field;
+
+    debug_msg(DebugMsgId::SLEEP_RETURN_FUTURE, task_id);
+
+    // ReturnExceptionでFutureを返す
+    ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
+    ret.is_struct = true;
+    ret.struct_value = future_var;
+    ret.struct_value.type = TYPE_STRUCT;
+    ret.struct_value.is_struct = true;
+    throw ret;
+}
+
+// sleep(milliseconds) - スリープ関数 (v0.12.0)
+// awaitをサポートするため、Futureを返す
+// v0.13.0: イベントループベースの非ブロッキング実装
+int64_t builtin_sleep(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    start_sleep_task(evaluator.get_interpreter(), node, "sleep");
+}
+
+// sleep_ms(milliseconds) - sleepのエイリアス（v0.12.0 互換性）
+// v0.13.0: 非ブロッキング実装（sleep()と同じ）
+int64_t builtin_sleep_ms(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    start_sleep_task(evaluator.get_interpreter(), node, "sleep_ms");
+}
+
+// v0.14.0: set_async_quantum/set_async_time_slice の共通部分
+// asyncタスク内では実行中のタスクのみ（次のステップから）、
+// タスク外では全体設定を変更する。0で既定に戻す。戻り値は変更前の値
+static int64_t set_async_slice(Interpreter &interpreter, const ASTNode *node,
+                               bool is_quantum) {
+    require_builtin_args(node, 1);
+    int64_t value = interpreter.evaluate(node->arguments[0].get());
+    if (value < 0) {
+        throw std::runtime_error(node->name +
+                                 "() argument must be non-negative");
+    }
+
+    AsyncTask *task = nullptr;
+    if (interpreter.is_executing_async_task()) {
+        task = interpreter.get_simple_event_loop().get_task(
+            interpreter.get_current_executing_task_id());
+    }
+    int64_t previous;
+    if (is_quantum) {
+        previous = task && task->quantum > 0 ? task->quantum
+                                             : interpreter.async_quantum();
+        if (task) {
+            task->quantum = value;
+        } else {
+            interpreter.set_async_quantum(value);
+        }
+    } else {
+        previous = task && task->time_slice_us >= 0
+                       ? task->time_slice_us
+                       : interpreter.async_time_slice_us();
+        if (task) {
+            task->time_slice_us = value;
+        } else {
+            interpreter.set_async_time_slice_us(value);
+        }
+    }
+    return previous;
+}
+
+// v0.14.0: タイムスライス（量子）の設定
+// set_async_quantum(文の数)
+int64_t builtin_set_async_quantum(ExpressionEvaluator &evaluator,
+                                  const ASTNode *node) {
+    return set_async_slice(evaluator.get_interpreter(), node, true);
+}
+
+// set_async_time_slice(マイクロ秒)
+int64_t builtin_set_async_time_slice(ExpressionEvaluator &evaluator,
+                                     const ASTNode *node) {
+    return set_async_slice(evaluator.get_interpreter(), node, false);
+}
+
+// with_priority/with_deadlineの戻り値（受け取ったFutureをそのまま返す）
+[[noreturn]] static void return_future(const TypedValue &future_typed) {
+    ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
+    ret.is_struct = true;
+    ret.struct_value = *future_typed.struct_data;
+    ret.struct_value.type = TYPE_STRUCT;
+    ret.struct_value.is_struct = true;
+    throw ret;
+}
+
+// v0.14.0: with_priority(future, 優先度)
+// 生成直後のタスクに優先度を設定し、同じFutureを返す
+// （例: Future<int> f = with_priority(compute(x), -1);）
+int64_t builtin_with_priority(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    require_builtin_args(node, 2);
+    TypedValue future_typed =
+        interpreter.evaluate_typed(node->arguments[0].get());
+    int task_id = future_task_id(future_typed, "with_priority");
+    int64_t priority = interpreter.evaluate(node->arguments[1].get());
+
+    interpreter.get_simple_event_loop().set_task_priority(
+        task_id, static_cast<int>(priority));
+    return_future(future_typed);
+}
+
+// v0.14.0: with_deadline(future, ms)
+// 生成直後のタスクに現在時刻からmsミリ秒後のデッドラインを設定する
+int64_t builtin_with_deadline(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    require_builtin_args(node, 2);
+    TypedValue future_typed =
+        interpreter.evaluate_typed(node->arguments[0].get());
+    int task_id = future_task_id(future_typed, "with_deadline");
+    int64_t deadline_ms = interpreter.evaluate(node->arguments[1].get());
+    if (deadline_ms < 0) {
+        throw std::runtime_error(
+            "with_deadline() deadline must be non-negative");
+    }
+
+    interpreter.get_simple_event_loop().set_task_deadline(
+        task_id, cb::epoch_now_ms() + deadline_ms);
+    return_future(future_typed);
+}
+
+// v0.14.0: Cb側のTaskQueueが使うネイティブ優先度キュー
+// 値（Task構造体など）はキューがムーブして保持する
+// priority_queue_create(容量) -> ハンドル（容量0は上限なし）
+int64_t builtin_priority_queue_create(ExpressionEvaluator &evaluator,
+                                      const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "priority_queue_create() requires exactly 1 argument");
+    }
+    int64_t capacity = interpreter.evaluate(node->arguments[0].get());
+    if (capacity < 0) {
+        throw std::runtime_error(
+            "priority_queue_create() capacity must not be negative");
+    }
+    return interpreter.get_simple_event_loop().create_user_queue(
+        static_cast<int>(capacity));
+}
+
+// priority_queue_*の第1引数（ハンドル）からキューを取り出す
+static cb::UserPriorityQueue &user_queue_arg(Interpreter &interpreter,
+                                             const ASTNode *node,
+                                             size_t arg_count) {
+    require_builtin_args(node, arg_count);
+    int64_t handle = interpreter.evaluate(node->arguments[0].get());
+    cb::UserPriorityQueue *queue =
+        interpreter.get_simple_event_loop().user_queue(
+            static_cast<int>(handle));
+    if (!queue) {
+        throw std::runtime_error(node->name + "() invalid queue handle");
+    }
+    return *queue;
+}
+
+// priority_queue_push(ハンドル, 優先度, 値) -> 入れられたか（満杯ならfalse）
+int64_t builtin_priority_queue_push(ExpressionEvaluator &evaluator,
+                                    const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    cb::UserPriorityQueue &queue = user_queue_arg(interpreter, node, 3);
+    int priority =
+        static_cast<int>(interpreter.evaluate(node->arguments[1].get()));
+    Variable value = channel_value(
+        interpreter.evaluate_typed(node->arguments[2].get()));
+    return queue.push(priority, value) ? 1 : 0;
+}
+
+// priority_queue_pop(ハンドル) -> 最も優先度の高い値（同じ優先度は入れた順）
+int64_t builtin_priority_queue_pop(ExpressionEvaluator &evaluator,
+                                   const ASTNode *node) {
+    cb::UserPriorityQueue &queue =
+        user_queue_arg(evaluator.get_interpreter(), node, 1);
+    Variable value;
+    if (!queue.pop(value)) {
+        throw std::runtime_error("priority_queue_pop() on an empty queue");
+    }
+    return return_stored_value(evaluator, node, std::move(value));
+}
+
+// priority_queue_size(ハンドル) -> 要素数
+int64_t builtin_priority_queue_size(ExpressionEvaluator &evaluator,
+                                    const ASTNode *node) {
+    return static_cast<int64_t>(
+        user_queue_arg(evaluator.get_interpreter(), node, 1).size());
+}
+
+// priority_queue_clear(ハンドル)
+int64_t builtin_priority_queue_clear(ExpressionEvaluator &evaluator,
+                                     const ASTNode *node) {
+    user_queue_arg(evaluator.get_interpreter(), node, 1).clear();
+    return 0;
+}
+
+// v0.14.0: 容量固定のチャネル（stdlib/std/channel.cbのChannel<T>）
+// channel_create(容量) -> ハンドル
+int64_t builtin_channel_create(ExpressionEvaluator &evaluator,
+                               const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "channel_create() requires exactly 1 argument");
+    }
+    int64_t capacity = interpreter.evaluate(node->arguments[0].get());
+    if (capacity <= 0) {
+        throw std::runtime_error(
+            "channel_create() capacity must be positive");
+    }
+    return interpreter.get_simple_event_loop().create_channel(
+        static_cast<size_t>(capacity));
+}
+
+// channel_*の第1引数（ハンドル）からチャネルを取り出す
+static cb::Channel &channel_arg(Interpreter &interpreter, const ASTNode *node,
+                                size_t arg_count) {
+    require_builtin_args(node, arg_count);
+    int64_t handle = interpreter.evaluate(node->arguments[0].get());
+    cb::Channel *channel =
+        interpreter.get_simple_event_loop().channel(static_cast<int>(handle));
+    if (!channel) {
+        throw std::runtime_error(node->name + "() invalid channel handle");
+    }
+    return *channel;
+}
+
+// channel_send(ハンドル, 値): 満杯なら受信されるまで待つ
+int64_t builtin_channel_send(ExpressionEvaluator &evaluator,
+                             const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    cb::Channel &channel = channel_arg(interpreter, node, 2);
+    Variable value = channel_value(
+        interpreter.evaluate_typed(node->arguments[1].get()));
+    if (!interpreter.get_simple_event_loop().channel_send(channel, value)) {
+        throw std::runtime_error("channel_send() on a closed channel");
+    }
+    return 0;
+}
+
+// channel_recv(ハンドル) -> 値: 空なら届くまで待つ
+//   （タスク内では文を再実行して受け取る。SimpleEventLoop参照）
+int64_t builtin_channel_recv(ExpressionEvaluator &evaluator,
+                             const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    cb::Channel &channel = channel_arg(interpreter, node, 1);
+    Variable value;
+    if (!interpreter.get_simple_event_loop().channel_recv(channel, value)) {
+        throw std::runtime_error(
+            "channel_recv() on a closed and empty channel");
+    }
+    return return_stored_value(evaluator, node, std::move(value));
+}
+
+// channel_wait(ハンドル) -> 受信できる値があるか
+//   （届くかcloseされるまで待つ。false = close済みで空）
+int64_t builtin_channel_wait(ExpressionEvaluator &evaluator,
+                             const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    cb::Channel &channel = channel_arg(interpreter, node, 1);
+    return interpreter.get_simple_event_loop().channel_wait(channel) ? 1 : 0;
+}
+
+// channel_close(ハンドル)
+int64_t builtin_channel_close(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    cb::Channel &channel = channel_arg(interpreter, node, 1);
+    interpreter.get_simple_event_loop().channel_close(channel);
+    return 0;
+}
+
+// channel_len(ハンドル) -> バッファ内の数
+int64_t builtin_channel_len(ExpressionEvaluator &evaluator,
+                            const ASTNode *node) {
+    return static_cast<int64_t>(
+        channel_arg(evaluator.get_interpreter(), node, 1).size());
+}
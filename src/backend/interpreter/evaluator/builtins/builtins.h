@@ -0,0 +1,125 @@
+#pragma once
+#include "../../../../common/ast.h"
+#include <cstdint>
+
+// 前方宣言
+class ExpressionEvaluator;
+
+// ============================================================================
+// v0.14.0: 組み込み関数のハンドラ
+// ============================================================================
+// 各組み込み関数は1つのハンドラ関数として実装し、BuiltinRegistryに
+// BuiltinIdと対にして登録する。evaluate_function_call_implは解決済みの
+// IDからハンドラを引いて呼び出すだけで、個々の処理は持たない。
+// 戻り値の規約は通常の関数呼び出しと同じ（整数はそのまま返し、
+// 文字列・構造体はReturnExceptionで返す）。
+// ============================================================================
+
+// 引数の数を検査する（"name() requires exactly N argument(s)"、
+// 0個なら"name() takes no arguments"）
+void require_builtin_args(const ASTNode *node, size_t count);
+
+// general.cpp: 汎用・メモリ・FFI
+int64_t builtin_hex(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_memcpy(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_sizeof_type(ExpressionEvaluator &evaluator,
+                            const ASTNode *node);
+int64_t builtin_default(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_call_function_pointer(ExpressionEvaluator &evaluator,
+                                      const ASTNode *node);
+int64_t builtin_sizeof(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_malloc(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_free(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_foreign(ExpressionEvaluator &evaluator, const ASTNode *node);
+
+// arrays.cpp: ポインタ経由の配列要素アクセス
+int64_t builtin_array_get(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_array_set(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_array_get_int(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_array_set_int(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_array_get_long(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_set_long(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_get_char(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_set_char(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_get_bool(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_set_bool(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_array_get_double(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_array_set_double(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_array_get_string(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_array_set_string(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_array_get_struct(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_array_set_struct(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+
+// async.cpp: イベントループ・タイマー・優先度キュー・チャネル
+int64_t builtin_run_event_loop(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_concurrent_await(ExpressionEvaluator &evaluator,
+                                 const ASTNode *node);
+int64_t builtin_race(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_now(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_timeout(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_sleep(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_sleep_ms(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_set_async_quantum(ExpressionEvaluator &evaluator,
+                                  const ASTNode *node);
+int64_t builtin_set_async_time_slice(ExpressionEvaluator &evaluator,
+                                     const ASTNode *node);
+int64_t builtin_with_priority(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_with_deadline(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_priority_queue_create(ExpressionEvaluator &evaluator,
+                                      const ASTNode *node);
+int64_t builtin_priority_queue_push(ExpressionEvaluator &evaluator,
+                                    const ASTNode *node);
+int64_t builtin_priority_queue_pop(ExpressionEvaluator &evaluator,
+                                   const ASTNode *node);
+int64_t builtin_priority_queue_size(ExpressionEvaluator &evaluator,
+                                    const ASTNode *node);
+int64_t builtin_priority_queue_clear(ExpressionEvaluator &evaluator,
+                                     const ASTNode *node);
+int64_t builtin_channel_create(ExpressionEvaluator &evaluator,
+                               const ASTNode *node);
+int64_t builtin_channel_send(ExpressionEvaluator &evaluator,
+                             const ASTNode *node);
+int64_t builtin_channel_recv(ExpressionEvaluator &evaluator,
+                             const ASTNode *node);
+int64_t builtin_channel_wait(ExpressionEvaluator &evaluator,
+                             const ASTNode *node);
+int64_t builtin_channel_close(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_channel_len(ExpressionEvaluator &evaluator,
+                            const ASTNode *node);
+
+// io.cpp: 非同期I/O
+int64_t builtin_io_pipe(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_io_socketpair(ExpressionEvaluator &evaluator,
+                              const ASTNode *node);
+int64_t builtin_tcp_listen(ExpressionEvaluator &evaluator,
+                           const ASTNode *node);
+int64_t builtin_tcp_connect(ExpressionEvaluator &evaluator,
+                            const ASTNode *node);
+int64_t builtin_unix_listen(ExpressionEvaluator &evaluator,
+                            const ASTNode *node);
+int64_t builtin_unix_connect(ExpressionEvaluator &evaluator,
+                             const ASTNode *node);
+int64_t builtin_socket_port(ExpressionEvaluator &evaluator,
+                            const ASTNode *node);
+int64_t builtin_io_read(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_io_write(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_io_accept(ExpressionEvaluator &evaluator, const ASTNode *node);
+int64_t builtin_io_close(ExpressionEvaluator &evaluator, const ASTNode *node);
@@ -0,0 +1,698 @@
+// v0.14.0: 汎用の組み込み関数（hex, memcpy, sizeof, malloc/free, default,
+// call_function_pointer）とFFI関数の呼び出し
+// call_impl.cppのswitchから分離し、BuiltinRegistryに登録して呼び出す
+
+#include "../../../../common/ast.h"
+#include "../../../../common/debug.h"
+#include "../../../../common/debug_messages.h"
+#include "../../../../common/type_helpers.h"
+#include "../../core/error_handler.h"
+#include "../../core/interpreter.h"
+#include "../../core/pointer_metadata.h"
+#include "../../ffi_manager.h" // v0.13.0: FFI Manager
+#include "../../managers/types/manager.h"
+#include "builtins.h"
+#include "evaluator/core/evaluator.h"
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+void require_builtin_args(const ASTNode *node, size_t count) {
+    if (count == 0 && !node->arguments.empty()) {
+        throw std::runtime_error(node->name + "() takes no arguments");
+    }
+    if (node->arguments.size() != count) {
+        throw std::runtime_error(node->name + "() requires exactly " +
+                                 std::to_string(count) +
+                                 (count == 1 ? " argument" : " arguments"));
+    }
+}
+
+// hex(num) - 整数を16進数文字列に変換
+int64_t builtin_hex(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error("hex() requires exactly 1 argument");
+    }
+
+    int64_t value =
+        interpreter.eval_expression(node->arguments[0].get());
+    uint64_t unsigned_value = static_cast<uint64_t>(value);
+
+    // ポインタメタデータのタグビット（最上位ビット）を除去
+    if (unsigned_value & (1ULL << 63)) {
+        unsigned_value &= ~(1ULL << 63);
+    }
+
+    // 16進数文字列を生成
+    std::ostringstream oss;
+    oss << "0x" << std::hex << unsigned_value;
+    std::string hex_str = oss.str();
+
+    // 文字列を返す（ReturnExceptionを使用）
+    throw ReturnException(hex_str);
+}
+
+// 整数配列の変数か（&arr は配列変数の Variable* を返す）
+static bool is_int_array_variable(const Variable *var) {
+    return var->is_array && var->type >= TYPE_ARRAY_BASE + TYPE_TINY &&
+           var->type <= TYPE_ARRAY_BASE + TYPE_BIG;
+}
+
+// タグ付きポインタ（配列要素のPointerMetadata）なら要素のアドレスを返す
+static bool resolve_element_address(int64_t value, void *&address) {
+    uint64_t unsigned_value = static_cast<uint64_t>(value);
+    if (!(unsigned_value & (1ULL << 63))) {
+        return false;
+    }
+    PointerSystem::PointerMetadata *meta =
+        reinterpret_cast<PointerSystem::PointerMetadata *>(
+            unsigned_value & ~(1ULL << 63));
+    if (!meta->is_array_element() || meta->address == 0) {
+        return false;
+    }
+    address = reinterpret_cast<void *>(meta->address);
+    return true;
+}
+
+// memcpy(dest, src, size) - メモリコピー組み込み関数
+int64_t builtin_memcpy(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 3) {
+        throw std::runtime_error("memcpy() requires exactly 3 "
+                                 "arguments: memcpy(dest, src, size)");
+    }
+
+    // 引数を評価
+    int64_t dest_value =
+        interpreter.eval_expression(node->arguments[0].get());
+    int64_t src_value =
+        interpreter.eval_expression(node->arguments[1].get());
+    int64_t size =
+        interpreter.eval_expression(node->arguments[2].get());
+
+    // デバッグ出力（コメントアウト）
+    // std::cerr << "[memcpy ENTRY] dest=" << std::hex << dest_value
+    //           << ", src=" << src_value << ", size=" << std::dec <<
+    //           size << std::endl;
+
+    // null チェック
+    if (dest_value == 0) {
+        std::cerr << "[memcpy] Error: destination pointer is null"
+                  << std::endl;
+        return 0;
+    }
+    if (src_value == 0) {
+        std::cerr << "[memcpy] Error: source pointer is null"
+                  << std::endl;
+        return 0;
+    }
+
+    // サイズチェック
+    if (size <= 0) {
+        return dest_value;
+    }
+
+    // Variable*として有効かどうかをチェック
+    Variable *dest_var = reinterpret_cast<Variable *>(dest_value);
+    Variable *src_var = reinterpret_cast<Variable *>(src_value);
+
+    bool dest_is_var = false;
+    bool src_is_var = false;
+    void *actual_dest = reinterpret_cast<void *>(dest_value);
+    void *actual_src = reinterpret_cast<void *>(src_value);
+
+    // v0.14.0: &arr[i] はタグ付きのPointerMetadataを返す。
+    // 生成時に配列は64ビット幅に固定済みなので、要素のアドレスをそのまま使う
+    bool dest_is_element = resolve_element_address(dest_value, actual_dest);
+    bool src_is_element = resolve_element_address(src_value, actual_src);
+
+    // destがVariable*かチェック（安全に）
+    try {
+        // TypeInfoが有効範囲か簡易チェック（is_assignedは不要、未初期化変数もサポート）
+        // FIX: TYPE_TINYとTYPE_SHORTも含める
+        // FIX v0.11.0:
+        // 型の範囲チェックを厳格化（生のメモリアドレスを誤認識しないため）
+        // FIX v0.11.0: TYPE_POINTER, TYPE_STRUCTも含める
+        // v0.14.0: 整数配列（TYPE_ARRAY_BASE + 要素型）も含める
+        if (!dest_is_element &&
+            ((dest_var->type >= TYPE_TINY && dest_var->type <= TYPE_BIG) ||
+             dest_var->type == TYPE_POINTER ||
+             dest_var->type == TYPE_STRUCT ||
+             is_int_array_variable(dest_var))) {
+            dest_is_var = true;
+
+            // std::cerr << "[memcpy DEBUG dest] Variable*=" << dest_var
+            //           << ", type=" <<
+            //           static_cast<int>(dest_var->type)
+            //           << ", is_struct=" << dest_var->is_struct
+            //           << ", is_array=" << dest_var->is_array
+            //           << ", value=" << dest_var->value << std::endl;
+
+            // プリミティブ型なら&(var->value)を使う
+            if (!dest_var->is_struct && !dest_var->is_array &&
+                dest_var->type != TYPE_POINTER &&
+                dest_var->type != TYPE_STRUCT) {
+                actual_dest = &(dest_var->value);
+            } else if (dest_var->is_array &&
+                       !dest_var->array_values.empty()) {
+                // v0.14.0: 詰めた格納幅のままではバイト列が8バイト単位に
+                // ならないため、アドレス演算子と同じく64ビット幅に固定する
+                dest_var->array_values.make_addressable();
+                actual_dest = dest_var->array_values.data();
+            } else if (dest_var->is_struct ||
+                       dest_var->type == TYPE_POINTER ||
+                       dest_var->type == TYPE_STRUCT) {
+                // 構造体ポインタの場合、valueに実際のアドレスが格納されている
+                actual_dest = reinterpret_cast<void *>(dest_var->value);
+                // std::cerr << "[memcpy DEBUG dest] Struct/Pointer:
+                // actual_dest=" << actual_dest << std::endl;
+            }
+        }
+    } catch (...) {
+        dest_is_var = false;
+    }
+
+    // srcがVariable*かチェック（安全に）
+    try {
+        // FIX: TYPE_TINYとTYPE_SHORTも含める
+        // FIX v0.11.0:
+        // 型の範囲チェックを厳格化（生のメモリアドレスを誤認識しないため）
+        // FIX v0.11.0: TYPE_POINTER, TYPE_STRUCTも含める
+        // v0.14.0: 整数配列（TYPE_ARRAY_BASE + 要素型）も含める
+        if (!src_is_element &&
+            ((src_var->type >= TYPE_TINY && src_var->type <= TYPE_BIG) ||
+             src_var->type == TYPE_POINTER ||
+             src_var->type == TYPE_STRUCT ||
+             is_int_array_variable(src_var))) {
+            src_is_var = true;
+
+            // std::cerr << "[memcpy DEBUG src] Variable*=" << src_var
+            //           << ", type=" << static_cast<int>(src_var->type)
+            //           << ", is_struct=" << src_var->is_struct
+            //           << ", is_array=" << src_var->is_array
+            //           << ", value=" << src_var->value << std::endl;
+
+            // プリミティブ型なら&(var->value)を使う
+            if (!src_var->is_struct && !src_var->is_array &&
+                src_var->type != TYPE_POINTER &&
+                src_var->type != TYPE_STRUCT) {
+                actual_src = &(src_var->value);
+            } else if (src_var->is_array &&
+                       !src_var->array_values.empty()) {
+                // v0.14.0: 詰めた格納幅のままではバイト列が8バイト単位に
+                // ならないため、アドレス演算子と同じく64ビット幅に固定する
+                src_var->array_values.make_addressable();
+                actual_src = src_var->array_values.data();
+            } else if (src_var->is_struct ||
+                       src_var->type == TYPE_POINTER ||
+                       src_var->type == TYPE_STRUCT) {
+                // 構造体ポインタの場合、valueに実際のアドレスが格納されている
+                actual_src = reinterpret_cast<void *>(src_var->value);
+                // std::cerr << "[memcpy DEBUG src] Struct/Pointer:
+                // actual_src=" << actual_src << std::endl;
+            }
+        }
+    } catch (...) {
+        src_is_var = false;
+    }
+
+    // 構造体コピーの特別処理
+    if (dest_is_var && src_is_var && dest_var->is_struct &&
+        src_var->is_struct) {
+        // v0.13.1: Variable構造体のstruct_membersをコピー（参照も考慮）
+        auto &src_members = src_var->get_struct_members();
+        auto &dest_members = dest_var->get_struct_members();
+        for (const auto &member_pair : src_members) {
+            dest_members[member_pair.first] = member_pair.second;
+        }
+
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[memcpy] Copied struct members from "
+                      << src_var << " to " << dest_var << std::endl;
+        }
+    } else {
+        // 通常のmemcpy: actual_destとactual_srcを使用
+        std::memcpy(actual_dest, actual_src, static_cast<size_t>(size));
+
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[memcpy] Copied " << size << " bytes from "
+                      << actual_src << " to " << actual_dest
+                      << " (dest_is_var=" << dest_is_var
+                      << ", src_is_var=" << src_is_var << ")"
+                      << std::endl;
+
+            // 書き込み確認: actual_destから読み戻してみる
+            if (size == 8 && !dest_is_var && src_is_var) {
+                int64_t written_value =
+                    *reinterpret_cast<int64_t *>(actual_dest);
+                int64_t source_value =
+                    *reinterpret_cast<int64_t *>(actual_src);
+                std::cerr
+                    << "[memcpy] Verification: wrote " << source_value
+                    << ", read back " << written_value
+                    << " (match=" << (written_value == source_value)
+                    << ")" << std::endl;
+            }
+        }
+    }
+
+    // destポインタを返す
+    return dest_value;
+}
+
+// sizeof_type("T") - 型コンテキストからTの実際の型のサイズを返す
+// 使用例: int size = sizeof_type("T"); //
+// Queue<Vector<int>>の場合、"T"=Vector<int>で24を返す
+int64_t builtin_sizeof_type(ExpressionEvaluator &evaluator,
+                            const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "sizeof_type() requires 1 argument: sizeof_type(\"T\")");
+    }
+
+    // 型コンテキストから型パラメータを解決
+    const TypeContext *type_ctx =
+        interpreter.get_current_type_context();
+    std::string type_name;
+
+    if (interpreter.is_debug_mode()) {
+        std::cerr << "[sizeof_type] type_ctx="
+                  << (type_ctx ? "YES" : "NO");
+        if (type_ctx) {
+            std::cerr
+                << ", has_T="
+                << (type_ctx->has_mapping_for("T") ? "YES" : "NO");
+        }
+        std::cerr << "\n";
+    }
+
+    if (type_ctx && type_ctx->has_mapping_for("T")) {
+        type_name = type_ctx->resolve_type("T");
+    } else {
+        // フォールバック: デフォルトサイズ（プリミティブ型と仮定）
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[sizeof_type] No type context, returning "
+                         "default 8 bytes\n";
+        }
+        return 8;
+    }
+
+    // プリミティブ型のサイズ
+    if (type_name == "int" || type_name == "long" ||
+        type_name == "bool") {
+        return 8; // 8バイトアライメント
+    }
+    if (type_name == "void*" ||
+        type_name.find("*") != std::string::npos) {
+        return 8; // ポインタは8バイト
+    }
+
+    // 構造体のサイズを計算
+    auto struct_def = interpreter.find_struct_definition(type_name);
+    if (struct_def != nullptr) {
+        size_t total_size = 0;
+        for (const auto &member : struct_def->members) {
+            if (member.is_pointer) {
+                total_size += sizeof(void *); // 8 bytes
+            } else if (member.type == TYPE_LONG) {
+                total_size += sizeof(long); // 8 bytes
+            } else if (member.type == TYPE_INT) {
+                total_size += sizeof(long); // 8 bytes (アライメント)
+            } else {
+                total_size += sizeof(long); // 8 bytes デフォルト
+            }
+        }
+
+        if (interpreter.is_debug_mode()) {
+            std::cerr << "[sizeof_type] T=" << type_name << " => "
+                      << total_size << " bytes ("
+                      << struct_def->members.size() << " members)\n";
+        }
+
+        return static_cast<int64_t>(total_size);
+    }
+
+    // 未知の型の場合はデフォルト8バイト
+    if (interpreter.is_debug_mode()) {
+        std::cerr << "[sizeof_type] T=" << type_name
+                  << " => 8 bytes (default)\n";
+    }
+    return 8;
+}
+
+// default(T) - 型Tのデフォルト値を返す
+// ジェネリクス対応: 型パラメータTに応じたデフォルト値
+int64_t builtin_default(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "default() requires 1 argument: default(T)");
+    }
+
+    // 型名を取得
+    const ASTNode *arg = node->arguments[0].get();
+    if (arg->node_type == ASTNodeType::AST_VARIABLE) {
+        std::string type_name = arg->name;
+
+        // 型に応じたデフォルト値を返す
+        if (type_name == "int" || type_name == "long" ||
+            type_name == "short" || type_name == "char") {
+            return 0;
+        }
+        if (type_name == "bool") {
+            return 0; // false
+        }
+        if (type_name == "double" || type_name == "float") {
+            // 0.0をint64_tビット表現で返す
+            union {
+                double d;
+                int64_t i;
+            } converter;
+            converter.d = 0.0;
+            return converter.i;
+        }
+        if (type_name == "string") {
+            return 0; // 空文字列（nullポインタ）
+        }
+
+        // その他の型はnullptrまたは0を返す
+        return 0;
+    }
+
+    return 0;
+}
+
+// call_function_pointer(func_ptr, arg1, arg2, ...) -
+// 関数ポインタを呼び出す ジェネリック対応:
+// 任意の数の引数で関数ポインタを呼び出す
+int64_t builtin_call_function_pointer(ExpressionEvaluator &evaluator,
+                                      const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() < 1) {
+        throw std::runtime_error(
+            "call_function_pointer() requires at least 1 argument: "
+            "call_function_pointer(func_ptr, arg1, arg2, ...)");
+    }
+
+    // 第1引数: 関数ポインタ（ASTNodeのアドレス）
+    int64_t func_ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+
+    if (func_ptr_value == 0) {
+        throw std::runtime_error(
+            "call_function_pointer: function pointer is null");
+    }
+
+    // 関数ポインタの値はASTNode*のアドレス
+    // まずVariable*として試してみて、is_function_pointerかチェック
+    // そうでなければASTNode*として扱う
+    const ASTNode *func_def = nullptr;
+    std::string func_name;
+
+    // Variable*として解釈を試みる
+    Variable *func_ptr_var =
+        reinterpret_cast<Variable *>(func_ptr_value);
+    if (func_ptr_var->is_function_pointer) {
+        // Variable経由の関数ポインタ（パラメータとして渡された場合など）
+        func_name = func_ptr_var->function_pointer_name;
+        func_def = interpreter.find_function(func_name);
+    } else {
+        // 直接ASTNode*として渡された場合（&func形式）
+        func_def = reinterpret_cast<const ASTNode *>(func_ptr_value);
+        func_name = func_def->name;
+    }
+
+    if (!func_def) {
+        throw std::runtime_error("call_function_pointer: function '" +
+                                 func_name + "' not found");
+    }
+
+    // 残りの引数を評価
+    std::vector<int64_t> arg_values;
+    for (size_t i = 1; i < node->arguments.size(); ++i) {
+        arg_values.push_back(
+            interpreter.eval_expression(node->arguments[i].get()));
+    }
+
+    // 引数の数をチェック
+    if (arg_values.size() != func_def->parameters.size()) {
+        throw std::runtime_error(
+            "call_function_pointer: argument count mismatch for '" +
+            func_name + "': expected " +
+            std::to_string(func_def->parameters.size()) + ", got " +
+            std::to_string(arg_values.size()));
+    }
+
+    // 新しいスコープを作成
+    interpreter.push_scope();
+
+    try {
+        // パラメータをバインド
+        for (size_t i = 0; i < func_def->parameters.size(); ++i) {
+            const ASTNode *param = func_def->parameters[i].get();
+            Variable var;
+            var.value = arg_values[i];
+            var.is_assigned = true;
+            var.type = param->type_info; // パラメータの型情報を使用
+            interpreter.current_scope().variables[param->name] = var;
+        }
+
+        // 関数本体を実行
+        try {
+            interpreter.execute_statement(func_def->body.get());
+        } catch (const ReturnException &re) {
+            // 戻り値を取得
+            interpreter.pop_scope();
+            return re.value;
+        }
+
+        // 戻り値なし（voidまたは明示的なreturn文なし）
+        interpreter.pop_scope();
+        return 0;
+
+    } catch (...) {
+        interpreter.pop_scope();
+        throw;
+    }
+}
+
+// sizeof(type) - 型のサイズを取得
+// 注: sizeof演算子として実装すべきだが、簡易版として組み込み関数で実装
+int64_t builtin_sizeof(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "sizeof() requires 1 argument: sizeof(type_expression)");
+    }
+
+    // 引数の型を推論
+    const ASTNode *arg = node->arguments[0].get();
+
+    // 型名が直接渡された場合（AST_VARIABLEで型名として解釈）
+    if (arg->node_type == ASTNodeType::AST_VARIABLE) {
+        std::string name = arg->name;
+
+        // まず変数として検索
+        Variable *var = interpreter.find_variable(name);
+        if (var) {
+            // 変数が見つかった場合、その型のサイズを返す
+            switch (var->type) {
+            case TYPE_INT:
+                return sizeof(int);
+            case TYPE_LONG:
+                return sizeof(long);
+            case TYPE_SHORT:
+                return sizeof(short);
+            case TYPE_CHAR:
+                return sizeof(char);
+            case TYPE_BOOL:
+                return sizeof(bool);
+            case TYPE_FLOAT:
+                return sizeof(float);
+            case TYPE_DOUBLE:
+                return sizeof(double);
+            case TYPE_QUAD:
+                return sizeof(long double);
+            case TYPE_POINTER:
+                return sizeof(void *);
+            case TYPE_STRING:
+                return sizeof(void *);
+            default:
+                if (var->is_struct)
+                    return sizeof(void *);
+                throw std::runtime_error(
+                    "Cannot determine size of variable type");
+            }
+        }
+
+        // 変数でない場合は型名として解釈
+        std::string type_name = name;
+
+        // プリミティブ型のサイズを返す
+        if (type_name == "int")
+            return sizeof(int);
+        if (type_name == "long")
+            return sizeof(long);
+        if (type_name == "short")
+            return sizeof(short);
+        if (type_name == "char")
+            return sizeof(char);
+        if (type_name == "bool")
+            return sizeof(bool);
+        if (type_name == "float")
+            return sizeof(float);
+        if (type_name == "double")
+            return sizeof(double);
+        if (type_name == "quad")
+            return sizeof(long double);
+        if (type_name == "void*")
+            return sizeof(void *);
+
+        // 構造体のサイズを取得
+        Variable *struct_def = interpreter.find_variable(type_name);
+        if (struct_def && struct_def->is_struct) {
+            // 構造体のサイズは、全メンバーのサイズの合計
+            // 簡易実装: ポインタサイズを返す（構造体は参照渡しのため）
+            return sizeof(void *);
+        }
+
+        throw std::runtime_error("Unknown type for sizeof: " +
+                                 type_name);
+    }
+
+    // 式の型を推論
+    TypedValue typed_val = interpreter.evaluate_typed(arg);
+
+    switch (typed_val.type.type_info) {
+    case TYPE_INT:
+        return sizeof(int);
+    case TYPE_LONG:
+        return sizeof(long);
+    case TYPE_SHORT:
+        return sizeof(short);
+    case TYPE_CHAR:
+        return sizeof(char);
+    case TYPE_BOOL:
+        return sizeof(bool);
+    case TYPE_FLOAT:
+        return sizeof(float);
+    case TYPE_DOUBLE:
+        return sizeof(double);
+    case TYPE_QUAD:
+        return sizeof(long double);
+    case TYPE_POINTER:
+        return sizeof(void *);
+    case TYPE_STRING:
+        return sizeof(void *); // 文字列ポインタ
+    default:
+        throw std::runtime_error("Cannot determine size of type");
+    }
+}
+
+// malloc(size) - メモリ確保
+int64_t builtin_malloc(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "malloc() requires 1 argument: malloc(size)");
+    }
+
+    int64_t size =
+        interpreter.eval_expression(node->arguments[0].get());
+
+    if (size <= 0) {
+        std::cerr << "[malloc] Error: invalid size " << size
+                  << std::endl;
+        return 0;
+    }
+
+    void *ptr = std::malloc(static_cast<size_t>(size));
+    if (ptr == nullptr) {
+        std::cerr << "[malloc] Error: allocation failed for size "
+                  << size << std::endl;
+        return 0;
+    }
+
+    return reinterpret_cast<int64_t>(ptr);
+}
+
+// free(ptr) - メモリ解放
+int64_t builtin_free(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    if (node->arguments.size() != 1) {
+        throw std::runtime_error(
+            "free() requires 1 argument: free(ptr)");
+    }
+
+    int64_t ptr_value =
+        interpreter.eval_expression(node->arguments[0].get());
+
+    if (ptr_value == 0) {
+        // nullptr の解放は何もしない
+        return 0;
+    }
+
+    std::free(reinterpret_cast<void *>(ptr_value));
+    return 0;
+}
+
+// v0.13.0: FFI関数をチェック
+int64_t builtin_foreign(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    // 引数を評価してVariableに変換（型付き評価で正確な型情報を取得）
+    std::vector<Variable> args;
+    for (const auto &arg_node : node->arguments) {
+        // 引数を型付きで評価して正確な型情報を取得
+        TypedValue typed_val =
+            interpreter.evaluate_typed(arg_node.get());
+
+        Variable arg_var;
+        arg_var.type = typed_val.type.type_info;
+
+        // 型情報と値を設定
+        if (typed_val.is_float_result || arg_var.type == TYPE_DOUBLE ||
+            arg_var.type == TYPE_FLOAT) {
+            // float/doubleの場合はdouble_valueを使用
+            arg_var.double_value = typed_val.double_value;
+            arg_var.value =
+                static_cast<int64_t>(typed_val.double_value);
+            if (arg_var.type == TYPE_UNKNOWN) {
+                arg_var.type = TYPE_DOUBLE; // デフォルトでdouble
+            }
+        } else if (typed_val.is_string()) {
+            // 文字列の場合
+            arg_var.str_value = typed_val.string_value;
+            arg_var.value = typed_val.value;
+        } else {
+            // 整数の場合
+            arg_var.value = typed_val.value;
+        }
+
+        args.push_back(arg_var);
+    }
+
+    // FFI関数を呼び出し
+    Variable result =
+        interpreter.get_ffi_manager()->callForeignFunction(node->name,
+                                                            args);
+
+    // 結果を設定
+    if (result.type == TYPE_DOUBLE || result.type == TYPE_FLOAT) {
+        TypedValue typed_result(result.double_value,
+                                InferredType(result.type, ""));
+        evaluator.set_last_typed_result(typed_result);
+        // キャプチャして typed evaluation で利用可能にする
+        evaluator.get_last_captured_function_value() =
+            std::make_pair(node, typed_result);
+        // double値はvalueフィールドにビットパターンとして返す
+        return *reinterpret_cast<int64_t *>(&result.double_value);
+    } else if (result.type == TYPE_STRING) {
+        TypedValue typed_result(result.str_value,
+                                InferredType(TYPE_STRING, "string"));
+        evaluator.set_last_typed_result(typed_result);
+        return 0;
+    } else {
+        return result.value;
+    }
+}
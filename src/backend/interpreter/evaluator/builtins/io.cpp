@@ -0,0 +1,203 @@
+// v0.14.0: 非同期I/O（stdlib/std/io.cb）の組み込み関数
+// 作成するfdはすべて非ブロッキング。読み書き・acceptは準備できて
+// いなければイベントループのepollに登録して待つ
+// call_impl.cppのswitchから分離し、BuiltinRegistryに登録して呼び出す
+
+#include "../../../../common/ast.h"
+#include "../../core/interpreter.h"
+#include "../../event_loop/io_poller.h"         // v0.14.0: 非同期I/O
+#include "../../event_loop/simple_event_loop.h" // v0.13.0: SimpleEventLoop
+#include "builtins.h"
+#include "evaluator/core/evaluator.h"
+#include <string>
+
+// v0.14.0: io_pipe/io_socketpairの戻り値（stdlib/std/io.cbのFdPair）
+static Variable fd_pair_value(const int fds[2]) {
+    Variable pair;
+    pair.type = TYPE_STRUCT;
+    pair.is_struct = true;
+    pair.is_assigned = true;
+    pair.struct_type_name = "FdPair";
+    const char *names[2] = {"first", "second"};
+    for (int i = 0; i < 2; i++) {
+        Variable member;
+        member.type = TYPE_INT;
+        member.value = fds[i];
+        member.is_assigned = true;
+        pair.struct_members[names[i]] = member;
+    }
+    return pair;
+}
+
+// io_pipe/io_socketpairの戻り値をReturnExceptionで返す
+[[noreturn]] static void return_fd_pair(const int fds[2]) {
+    ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
+    ret.type = TYPE_STRUCT;
+    ret.is_struct = true;
+    ret.struct_value = fd_pair_value(fds);
+    throw ret;
+}
+
+// 第1引数をfd（またはポート番号）として評価する
+static int int_arg(Interpreter &interpreter, const ASTNode *node) {
+    require_builtin_args(node, 1);
+    return static_cast<int>(interpreter.evaluate(node->arguments[0].get()));
+}
+
+// 第1引数をソケットのパスとして評価する
+static std::string path_arg(Interpreter &interpreter, const ASTNode *node) {
+    require_builtin_args(node, 1);
+    TypedValue path = interpreter.evaluate_typed(node->arguments[0].get());
+    if (!path.is_string()) {
+        throw std::runtime_error(node->name + "() requires a path string");
+    }
+    return path.string_value;
+}
+
+// io_pipe() -> FdPair{first, second}（firstが読み側、secondが書き側）
+int64_t builtin_io_pipe(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    require_builtin_args(node, 0);
+    int fds[2];
+    cb::io::open_pipe(fds);
+    return_fd_pair(fds);
+}
+
+// io_socketpair() -> FdPair{first, second}（双方向）
+int64_t builtin_io_socketpair(ExpressionEvaluator &evaluator,
+                              const ASTNode *node) {
+    require_builtin_args(node, 0);
+    int fds[2];
+    cb::io::open_socketpair(fds);
+    return_fd_pair(fds);
+}
+
+// tcp_listen(ポート) -> fd（127.0.0.1）
+int64_t builtin_tcp_listen(ExpressionEvaluator &evaluator,
+                           const ASTNode *node) {
+    return cb::io::tcp_listen(int_arg(evaluator.get_interpreter(), node));
+}
+
+// unix_listen(パス) -> fd
+int64_t builtin_unix_listen(ExpressionEvaluator &evaluator,
+                            const ASTNode *node) {
+    return cb::io::unix_listen(path_arg(evaluator.get_interpreter(), node));
+}
+
+// tcp_connect/unix_connectの接続を待つ
+// 接続は非ブロッキングで始め、接続中なら書き込めるようになるまで待つ。
+// タスクは待った文を再実行するので、接続中のソケットをタスクに残して
+// 再実行時にその接続を続ける
+template <typename Start, typename Finish>
+static int connect_and_wait(Interpreter &interpreter, Start start,
+                            Finish finish, const char *builtin_name) {
+    auto &event_loop = interpreter.get_simple_event_loop();
+    int fd = event_loop.connecting_fd();
+    bool connected;
+    try {
+        if (fd < 0) {
+            fd = start(connected);
+        } else {
+            connected = finish(fd);
+        }
+        while (!connected) {
+            event_loop.set_connecting_fd(fd);
+            event_loop.wait_io(fd, cb::IoPoller::Interest::WRITE,
+                               builtin_name);
+            connected = finish(fd);
+        }
+    } catch (const std::runtime_error &) {
+        // 接続に失敗したソケットはio側で閉じている
+        event_loop.set_connecting_fd(-1);
+        throw;
+    }
+    event_loop.set_connecting_fd(-1);
+    return fd;
+}
+
+// tcp_connect(ポート) -> fd（127.0.0.1）
+int64_t builtin_tcp_connect(ExpressionEvaluator &evaluator,
+                            const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    int port = int_arg(interpreter, node);
+    return connect_and_wait(
+        interpreter,
+        [port](bool &connected) {
+            return cb::io::tcp_connect(port, connected);
+        },
+        [port](int fd) { return cb::io::tcp_connect_finish(fd, port); },
+        "tcp_connect");
+}
+
+// unix_connect(パス) -> fd
+int64_t builtin_unix_connect(ExpressionEvaluator &evaluator,
+                             const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    std::string path = path_arg(interpreter, node);
+    return connect_and_wait(
+        interpreter,
+        [&path](bool &connected) {
+            return cb::io::unix_connect(path, connected);
+        },
+        [&path](int fd) { return cb::io::unix_connect_finish(fd, path); },
+        "unix_connect");
+}
+
+// socket_port(fd) -> ポート番号
+int64_t builtin_socket_port(ExpressionEvaluator &evaluator,
+                            const ASTNode *node) {
+    return cb::io::local_port(int_arg(evaluator.get_interpreter(), node));
+}
+
+// io_read(fd, 最大バイト数) -> 文字列（""はEOF）
+int64_t builtin_io_read(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    require_builtin_args(node, 2);
+    int fd = static_cast<int>(interpreter.evaluate(node->arguments[0].get()));
+    int64_t max_bytes = interpreter.evaluate(node->arguments[1].get());
+    if (max_bytes <= 0) {
+        throw std::runtime_error("io_read() max bytes must be positive");
+    }
+    std::string data;
+    while (!cb::io::read_some(fd, static_cast<size_t>(max_bytes), data)) {
+        interpreter.get_simple_event_loop().wait_io(
+            fd, cb::IoPoller::Interest::READ, "io_read");
+    }
+    throw ReturnException(data);
+}
+
+// io_write(fd, 文字列) -> 書き込んだバイト数
+int64_t builtin_io_write(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    require_builtin_args(node, 2);
+    int fd = static_cast<int>(interpreter.evaluate(node->arguments[0].get()));
+    TypedValue data = interpreter.evaluate_typed(node->arguments[1].get());
+    if (!data.is_string()) {
+        throw std::runtime_error("io_write() requires a string");
+    }
+    int64_t written = 0;
+    while (!cb::io::write_some(fd, data.string_value, written)) {
+        interpreter.get_simple_event_loop().wait_io(
+            fd, cb::IoPoller::Interest::WRITE, "io_write");
+    }
+    return written;
+}
+
+// io_accept(fd) -> 接続を受け付けたfd
+int64_t builtin_io_accept(ExpressionEvaluator &evaluator,
+                          const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    int listen_fd = int_arg(interpreter, node);
+    int client_fd;
+    while (!cb::io::accept_one(listen_fd, client_fd)) {
+        interpreter.get_simple_event_loop().wait_io(
+            listen_fd, cb::IoPoller::Interest::READ, "io_accept");
+    }
+    return client_fd;
+}
+
+// io_close(fd)
+int64_t builtin_io_close(ExpressionEvaluator &evaluator, const ASTNode *node) {
+    Interpreter &interpreter = evaluator.get_interpreter();
+    interpreter.get_simple_event_loop().close_io(int_arg(interpreter, node));
+    return 0;
+}
@@ -54,9 +54,8 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
         throw std::runtime_error("Null node in expression evaluation");
     }
 
-    std::string node_type_str =
-        std::to_string(static_cast<int>(node->node_type));
-    debug_msg(DebugMsgId::EXPR_EVAL_START, node_type_str.c_str());
+    debug_msg(DebugMsgId::EXPR_EVAL_START,
+              std::to_string(static_cast<int>(node->node_type)).c_str());
 
     if (node->node_type == ASTNodeType::AST_ARRAY_REF && node->name.empty()) {
         debug_msg(DebugMsgId::EXPR_EVAL_ARRAY_REF_START);
@@ -93,9 +92,16 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
         return ArrayAccessHelpers::evaluate_array_literal(node, interpreter_);
 
     case ASTNodeType::AST_BINARY_OP: {
+        OperatorKind kind = node->operator_kind();
+
         // 比較演算子の場合、文字列比較をサポートするためtyped評価を使用
-        if (node->op == "<" || node->op == ">" || node->op == "<=" ||
-            node->op == ">=" || node->op == "==" || node->op == "!=") {
+        // v0.14.0: int/double/string同士はノードごとに決めた高速パスで比較
+        if (is_comparison_operator(kind)) {
+            int64_t fast_result = 0;
+            if (BinaryUnaryTypedHelpers::try_evaluate_comparison_fast(
+                    node, interpreter_, fast_result)) {
+                return fast_result;
+            }
             auto evaluate_typed_lambda = [&](const ASTNode *n) {
                 return expression_evaluator_.evaluate_typed_expression(n);
             };
@@ -110,18 +116,29 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
         int64_t right = dispatch_expression(node->right.get());
 
         int64_t result = 0;
-        if (node->op == "+" || node->op == "-" || node->op == "*" ||
-            node->op == "/" || node->op == "%") {
-            result = ExpressionHelpers::evaluate_arithmetic_binary(node->op,
-                                                                   left, right);
-        } else if (node->op == "&&" || node->op == "||") {
-            result = ExpressionHelpers::evaluate_logical_binary(node->op, left,
-                                                                right);
-        } else if (node->op == "&" || node->op == "|" || node->op == "^" ||
-                   node->op == "<<" || node->op == ">>") {
-            result = ExpressionHelpers::evaluate_bitwise_binary(node->op, left,
-                                                                right);
-        } else {
+        switch (kind) {
+        case OperatorKind::ADD:
+        case OperatorKind::SUB:
+        case OperatorKind::MUL:
+        case OperatorKind::DIV:
+        case OperatorKind::MOD:
+            result = ExpressionHelpers::evaluate_arithmetic_binary(kind, left,
+                                                                   right);
+            break;
+        case OperatorKind::LOGICAL_AND:
+        case OperatorKind::LOGICAL_OR:
+            result =
+                ExpressionHelpers::evaluate_logical_binary(kind, left, right);
+            break;
+        case OperatorKind::BIT_AND:
+        case OperatorKind::BIT_OR:
+        case OperatorKind::BIT_XOR:
+        case OperatorKind::SHL:
+        case OperatorKind::SHR:
+            result =
+                ExpressionHelpers::evaluate_bitwise_binary(kind, left, right);
+            break;
+        default:
             error_msg(DebugMsgId::UNKNOWN_BINARY_OP_ERROR, node->op.c_str());
             throw std::runtime_error("Unknown binary operator: " + node->op);
         }
@@ -157,8 +174,10 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
     case ASTNodeType::AST_UNARY_OP: {
         debug_msg(DebugMsgId::UNARY_OP_DEBUG, node->op.c_str());
 
+        OperatorKind kind = node->operator_kind();
+
         // v0.12.1: await式の処理（TypedValueを返すように変更）
-        if (node->op == "await" || node->is_await_expression) {
+        if (kind == OperatorKind::AWAIT || node->is_await_expression) {
             std::function<TypedValue(const ASTNode *)> eval_typed_func =
                 [this](const ASTNode *n) -> TypedValue {
                 return expression_evaluator_.evaluate_typed_expression(n);
@@ -174,17 +193,18 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
             }
         }
 
-        if (node->op == "++_post" || node->op == "--_post") {
+        switch (kind) {
+        case OperatorKind::POST_INC:
+        case OperatorKind::POST_DEC:
             return ExpressionHelpers::evaluate_postfix_incdec(node,
                                                               interpreter_);
-        }
 
-        if (node->op == "++" || node->op == "--") {
+        case OperatorKind::PRE_INC:
+        case OperatorKind::PRE_DEC:
             return ExpressionHelpers::evaluate_prefix_incdec(node,
                                                              interpreter_);
-        }
 
-        if (node->op == "ADDRESS_OF") {
+        case OperatorKind::ADDRESS_OF: {
             auto eval_func = [this](const ASTNode *n) {
                 return this->dispatch_expression(n);
             };
@@ -192,7 +212,7 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
                 node, interpreter_, eval_func);
         }
 
-        if (node->op == "DEREFERENCE") {
+        case OperatorKind::DEREFERENCE: {
             auto eval_func = [this](const ASTNode *n) {
                 return this->dispatch_expression(n);
             };
@@ -200,19 +220,17 @@ int64_t ExpressionDispatcher::dispatch_expression(const ASTNode *node) {
                 node, interpreter_, eval_func);
         }
 
-        if (node->op == "!") {
-            int64_t operand = dispatch_expression(node->left.get());
-            return !operand;
-        }
+        case OperatorKind::LOGICAL_NOT:
+            return !dispatch_expression(node->left.get());
 
-        if (node->op == "-") {
-            int64_t operand = dispatch_expression(node->left.get());
-            return -operand;
-        }
+        case OperatorKind::NEGATE:
+            return -dispatch_expression(node->left.get());
+
+        case OperatorKind::BIT_NOT:
+            return ~dispatch_expression(node->left.get());
 
-        if (node->op == "~") {
-            int64_t operand = dispatch_expression(node->left.get());
-            return ~operand;
+        default:
+            break;
         }
 
         error_msg(DebugMsgId::UNKNOWN_UNARY_OP_ERROR, node->op.c_str());
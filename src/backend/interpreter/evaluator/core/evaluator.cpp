@@ -31,6 +31,24 @@
 #include <sstream>
 #include <stdexcept>
 
+// v0.14.0: 評価し直しても副作用のない添字式か（数値・変数とその二項演算）
+static bool is_pure_index_expression(const ASTNode *node) {
+    if (!node) {
+        return false;
+    }
+    switch (node->node_type) {
+    case ASTNodeType::AST_NUMBER:
+    case ASTNodeType::AST_VARIABLE:
+    case ASTNodeType::AST_IDENTIFIER:
+        return true;
+    case ASTNodeType::AST_BINARY_OP:
+        return is_pure_index_expression(node->left.get()) &&
+               is_pure_index_expression(node->right.get());
+    default:
+        return false;
+    }
+}
+
 ExpressionEvaluator::ExpressionEvaluator(Interpreter &interpreter)
     : interpreter_(interpreter), type_engine_(interpreter),
       last_typed_result_(static_cast<int64_t>(0), InferredType()),
@@ -658,7 +676,9 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
             }
 
             try {
-                interpreter_.sync_struct_members_from_direct_access(base_name);
+                // v0.14.0: アクセスするメンバーだけを同期する
+                interpreter_.sync_struct_member_from_direct_access(base_name,
+                                                                   node->name);
                 interpreter_.ensure_struct_member_access_allowed(base_name,
                                                                  node->name);
             } catch (const std::exception &) {
@@ -715,7 +735,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
             node->left->left &&
             node->left->left->node_type == ASTNodeType::AST_FUNC_CALL) {
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Processing func()[index].member pattern: %s[].%s",
@@ -742,13 +762,31 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
             }
         }
 
+        // v0.14.0: arr[i].member（構造体配列）は検索キャッシュで引く
+        // 要素名の組み立てとスコープ検索を避ける。対象外なら従来の経路へ
+        if (node->left && node->left->node_type == ASTNodeType::AST_ARRAY_REF &&
+            node->left->left &&
+            node->left->left->node_type == ASTNodeType::AST_VARIABLE &&
+            is_pure_index_expression(node->left->array_index.get())) {
+            int64_t index = evaluate_expression(node->left->array_index.get());
+            if (Variable *member = interpreter_.find_struct_array_member(
+                    node->left->left.get(), index, node->name)) {
+                TypedValue member_value(static_cast<int64_t>(0),
+                                        InferredType());
+                if (convert_member_to_typed(*member, member_value)) {
+                    last_typed_result_ = member_value;
+                    return member_value;
+                }
+            }
+        }
+
         // ptr[index].member パターンをチェック（ポインタの配列アクセス）
         if (node->left && node->left->node_type == ASTNodeType::AST_ARRAY_REF &&
             node->left->left &&
             node->left->left->node_type == ASTNodeType::AST_VARIABLE) {
             Variable *var = interpreter_.find_variable(node->left->left->name);
             if (var && var->is_pointer) {
-                {
+                if (debug_mode) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Processing ptr[index].member pattern: %s[].%s",
@@ -766,7 +804,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
                         "Expected struct return exception");
 
                 } catch (const ReturnException &struct_ret) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Caught ReturnException, is_struct=%d",
@@ -778,7 +816,8 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
                                                 InferredType());
                         if (resolve_from_struct(struct_ret.struct_value,
                                                 member_value)) {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(dbg_buf, sizeof(dbg_buf),
                                          "Successfully resolved member: %s",
@@ -788,7 +827,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
                             last_typed_result_ = member_value;
                             return member_value;
                         }
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "Failed to resolve member: %s",
@@ -806,7 +845,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
         bool resolved = false;
 
         std::string base_name = build_base_name(node->left.get());
-        {
+        if (debug_mode) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[EVAL_TYPED] base_name='%s', member='%s'",
@@ -876,7 +915,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
     case ASTNodeType::AST_ARRAY_REF: {
         // 関数呼び出しの戻り値に対する配列アクセス: func()[index]
         if (node->left && node->left->node_type == ASTNodeType::AST_FUNC_CALL) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Processing typed function call array access: %s",
@@ -1287,7 +1326,7 @@ ExpressionEvaluator::evaluate_typed_expression_internal(const ASTNode *node) {
                                                        inferred_type);
                 } catch (const std::exception &e) {
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -17,75 +17,85 @@ namespace ExpressionHelpers {
 // ============================================================================
 
 // 算術演算（+, -, *, /, %）の評価
-int64_t evaluate_arithmetic_binary(const std::string &op, int64_t left,
+int64_t evaluate_arithmetic_binary(OperatorKind op, int64_t left,
                                    int64_t right) {
-    if (op == "+") {
+    switch (op) {
+    case OperatorKind::ADD:
         return left + right;
-    } else if (op == "-") {
+    case OperatorKind::SUB:
         return left - right;
-    } else if (op == "*") {
+    case OperatorKind::MUL:
         return left * right;
-    } else if (op == "/") {
+    case OperatorKind::DIV:
         if (right == 0) {
             error_msg(DebugMsgId::ZERO_DIVISION_ERROR);
             throw std::runtime_error("Division by zero");
         }
         return left / right;
-    } else if (op == "%") {
+    case OperatorKind::MOD:
         if (right == 0) {
             error_msg(DebugMsgId::ZERO_DIVISION_ERROR);
             throw std::runtime_error("Modulo by zero");
         }
         return left % right;
+    default:
+        break;
     }
-    throw std::runtime_error("Unknown arithmetic operator: " + op);
+    throw std::runtime_error("Unknown arithmetic operator");
 }
 
 // 比較演算（<, >, <=, >=, ==, !=）の評価
-int64_t evaluate_comparison_binary(const std::string &op, int64_t left,
+int64_t evaluate_comparison_binary(OperatorKind op, int64_t left,
                                    int64_t right) {
-    if (op == "==") {
+    switch (op) {
+    case OperatorKind::EQ:
         return (left == right) ? 1 : 0;
-    } else if (op == "!=") {
+    case OperatorKind::NE:
         return (left != right) ? 1 : 0;
-    } else if (op == "<") {
+    case OperatorKind::LT:
         return (left < right) ? 1 : 0;
-    } else if (op == ">") {
+    case OperatorKind::GT:
         return (left > right) ? 1 : 0;
-    } else if (op == "<=") {
+    case OperatorKind::LE:
         return (left <= right) ? 1 : 0;
-    } else if (op == ">=") {
+    case OperatorKind::GE:
         return (left >= right) ? 1 : 0;
+    default:
+        break;
     }
-    throw std::runtime_error("Unknown comparison operator: " + op);
+    throw std::runtime_error("Unknown comparison operator");
 }
 
 // 論理演算（&&, ||）の評価
-int64_t evaluate_logical_binary(const std::string &op, int64_t left,
-                                int64_t right) {
-    if (op == "&&") {
+int64_t evaluate_logical_binary(OperatorKind op, int64_t left, int64_t right) {
+    switch (op) {
+    case OperatorKind::LOGICAL_AND:
         return (left && right) ? 1 : 0;
-    } else if (op == "||") {
+    case OperatorKind::LOGICAL_OR:
         return (left || right) ? 1 : 0;
+    default:
+        break;
     }
-    throw std::runtime_error("Unknown logical operator: " + op);
+    throw std::runtime_error("Unknown logical operator");
 }
 
 // ビット演算（&, |, ^, <<, >>）の評価
-int64_t evaluate_bitwise_binary(const std::string &op, int64_t left,
-                                int64_t right) {
-    if (op == "&") {
+int64_t evaluate_bitwise_binary(OperatorKind op, int64_t left, int64_t right) {
+    switch (op) {
+    case OperatorKind::BIT_AND:
         return left & right;
-    } else if (op == "|") {
+    case OperatorKind::BIT_OR:
         return left | right;
-    } else if (op == "^") {
+    case OperatorKind::BIT_XOR:
         return left ^ right;
-    } else if (op == "<<") {
+    case OperatorKind::SHL:
         return left << right;
-    } else if (op == ">>") {
+    case OperatorKind::SHR:
         return left >> right;
+    default:
+        break;
     }
-    throw std::runtime_error("Unknown bitwise operator: " + op);
+    throw std::runtime_error("Unknown bitwise operator");
 }
 
 // ============================================================================
@@ -21,20 +21,18 @@ namespace ExpressionHelpers {
 // ============================================================================
 
 // 算術演算（+, -, *, /, %）の評価
-int64_t evaluate_arithmetic_binary(const std::string &op, int64_t left,
+int64_t evaluate_arithmetic_binary(OperatorKind op, int64_t left,
                                    int64_t right);
 
 // 比較演算（<, >, <=, >=, ==, !=）の評価
-int64_t evaluate_comparison_binary(const std::string &op, int64_t left,
+int64_t evaluate_comparison_binary(OperatorKind op, int64_t left,
                                    int64_t right);
 
 // 論理演算（&&, ||）の評価
-int64_t evaluate_logical_binary(const std::string &op, int64_t left,
-                                int64_t right);
+int64_t evaluate_logical_binary(OperatorKind op, int64_t left, int64_t right);
 
 // ビット演算（&, |, ^, <<, >>）の評価
-int64_t evaluate_bitwise_binary(const std::string &op, int64_t left,
-                                int64_t right);
+int64_t evaluate_bitwise_binary(OperatorKind op, int64_t left, int64_t right);
 
 // ============================================================================
 // リテラル評価のヘルパー
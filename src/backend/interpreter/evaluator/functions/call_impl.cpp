@@ -13,6 +13,7 @@
 #include "../../../../common/debug.h"
 #include "../../../../common/debug_messages.h"
 #include "../../../../common/type_helpers.h"
+#include "../../core/builtin_registry.h"
 #include "../../core/error_handler.h"
 #include "../../core/interpreter.h"
 #include "../../event_loop/event_loop.h"        // v0.12.0: EventLoop
@@ -30,14 +31,6 @@
 #include <iomanip>
 #include <sstream>
 
-// v0.12.0: Platform-specific sleep functions
-#ifdef _WIN32
-#include <windows.h>
-#else
-#include <sys/time.h> // for gettimeofday()
-#include <unistd.h>
-#endif
-
 int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
     if (interpreter_.is_debug_mode()) {
         std::cerr << "[DEBUG_IMPL] evaluate_function_call_impl called for: "
@@ -137,7 +130,8 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                 // SimpleEventLoopに登録
                 int task_id =
-                    interpreter_.get_simple_event_loop().register_task(task);
+                    interpreter_.get_simple_event_loop().register_task(
+                        std::move(task));
 
                 // Future.task_id を設定
                 Variable task_id_field;
@@ -241,8 +235,41 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
         }
     }
 
+    // v0.14.0: 組み込み関数はBuiltinRegistryでノードごとに一度だけ解決し、
+    // 関数ポインタや関数定義の探索を経ずに登録済みのハンドラを呼ぶ
+    const BuiltinRegistry &builtins = interpreter_.get_builtin_registry();
+    BuiltinId builtin = builtins.resolve_call(node, interpreter_);
+    if (builtin != BuiltinId::NONE) {
+        if (BuiltinRegistry::Handler handler = builtins.handler(builtin)) {
+            return handler(*this, node);
+        }
+
+        // 埋め込み側がBuiltinRegistryに登録したネイティブ関数
+        if (const auto *native = builtins.native_function(builtin)) {
+            std::vector<TypedValue> args;
+            args.reserve(node->arguments.size());
+            for (const auto &arg_node : node->arguments) {
+                args.push_back(interpreter_.evaluate_typed(arg_node.get()));
+            }
+
+            TypedValue result = (*native)(interpreter_, args);
+            if (result.is_string()) {
+                throw ReturnException(result.string_value);
+            }
+            if (result.is_floating()) {
+                set_last_typed_result(result);
+                last_captured_function_value_ = std::make_pair(node, result);
+                double double_result = result.as_double();
+                return *reinterpret_cast<int64_t *>(&double_result);
+            }
+            return result.as_numeric();
+        }
+    }
+
     // 関数を探す
     const ASTNode *func = nullptr;
+    // v0.14.0: メソッド呼び出しで使った呼び出し箇所のインラインキャッシュ
+    MethodCacheEntry *method_cache_entry = nullptr;
 
     // チェーン呼び出しのチェック: func()() (関数ポインタのチェーン)
     // leftが設定されている場合、それは関数ポインタチェーンまたはメソッドチェーンの可能性
@@ -417,7 +444,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                         // SimpleEventLoopに登録
                         int task_id =
                             interpreter_.get_simple_event_loop().register_task(
-                                task);
+                                std::move(task));
 
                         // Future.task_id を設定
                         Variable task_id_field;
@@ -586,7 +613,8 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                 // SimpleEventLoopに登録
                 int task_id =
-                    interpreter_.get_simple_event_loop().register_task(task);
+                    interpreter_.get_simple_event_loop().register_task(
+                        std::move(task));
 
                 // Future.task_id を設定
                 Variable task_id_field;
@@ -910,7 +938,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
         }
         debug_msg(DebugMsgId::METHOD_CALL_RECEIVER_FOUND,
                   receiver_name.c_str());
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::CALL_IMPL_RECEIVER)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "Looking for receiver '%s'",
                      receiver_name.c_str());
@@ -1012,11 +1040,30 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
             type_name = std::string(::type_info_to_string(receiver_var->type));
         }
 
-        std::string method_key = type_name + "::" + node->name;
+        // v0.14.0: interface型の値は代入時に引いたメソッド表のスロットから
+        // 直接呼び出す（型コンテキストの検索結果は表ごとに共有する）
+        const InterfaceVTable *vtable = receiver_var->vtable;
+        if (vtable && vtable->struct_name == type_name) {
+            if (const ASTNode *slot_func =
+                    interpreter_.lookup_vtable_method(node, *vtable)) {
+                method_cache_entry = interpreter_.vtable_context_entry(*vtable);
+                method_cache_entry->func = slot_func;
+            }
+        }
+
+        // v0.14.0: 同じ型のレシーバーで解決済みならキー文字列の組み立てと
+        // 関数表の検索を省く（ミスのときは従来どおり解決してから記録する）
+        if (!method_cache_entry) {
+            method_cache_entry =
+                interpreter_.find_method_cache_entry(node, type_name);
+        }
+        std::string method_key =
+            method_cache_entry ? std::string() : type_name + "::" + node->name;
         auto &global_scope = interpreter_.get_global_scope();
-        auto it = global_scope.functions.find(method_key);
+        auto it = method_cache_entry ? global_scope.functions.end()
+                                     : global_scope.functions.find(method_key);
 
-        if (interpreter_.is_debug_mode()) {
+        if (interpreter_.is_debug_mode() && !method_cache_entry) {
             std::cerr << "[METHOD_SEARCH] Searching for: " << method_key
                       << " ... "
                       << (it != global_scope.functions.end() ? "FOUND"
@@ -1034,7 +1081,9 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
             }
         }
 
-        if (it != global_scope.functions.end()) {
+        if (method_cache_entry) {
+            func = method_cache_entry->func;
+        } else if (it != global_scope.functions.end()) {
             func = it->second;
         } else {
             // v0.12.0: ジェネリックimplのインスタンス化を試みる
@@ -1081,7 +1130,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 interpreter_.find_impl_for_struct(unmangled_type_name, "");
 
             if (interpreter_.is_debug_mode()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::CALL_IMPL_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "After find_impl_for_struct: impl=%p",
@@ -1094,7 +1143,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 // インスタンス化されたimplのメソッドを再検索
                 method_key = type_name + "::" + node->name;
                 if (interpreter_.is_debug_mode()) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::CALL_IMPL_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Retrying method search: method_key='%s'",
@@ -1106,7 +1155,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 if (it != global_scope.functions.end()) {
                     func = it->second;
                     if (interpreter_.is_debug_mode()) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::CALL_IMPL_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "Retry succeeded! Found func=%p",
@@ -1193,6 +1242,11 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
             }
         }
+
+        if (func && !method_cache_entry) {
+            method_cache_entry =
+                interpreter_.record_method_cache_entry(node, type_name, func);
+        }
     } else {
         auto &global_scope = interpreter_.get_global_scope();
 
@@ -1292,3002 +1346,226 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
     }
 
     // v0.11.0: ジェネリック関数のインスタンス化（キャッシュ付き）
-    std::unique_ptr<ASTNode> instantiated_func;
-    const ASTNode *cached_func = nullptr;
-
-    // デバッグ: 条件を表示
-    if (interpreter_.is_debug_mode()) {
-        std::cerr << "[GENERIC_DEBUG] func=" << (func ? "yes" : "no")
-                  << " func->is_generic="
-                  << (func && func->is_generic ? "yes" : "no")
-                  << " node->is_generic=" << (node->is_generic ? "yes" : "no")
-                  << " type_arguments.size()=" << node->type_arguments.size()
-                  << std::endl;
-        if (func) {
-            std::cerr << "[GENERIC_DEBUG] Original func has "
-                      << func->statements.size() << " statements" << std::endl;
-        }
-    }
-
+    // v0.14.0: インスタンスは(関数, 型引数)ごとにInterpreterのキャッシュが
+    // 保持し、呼び出し箇所は直前に使ったインスタンスを直接指す（呼び出しの
+    // たびに関数本体を複製しない）
     if (func && func->is_generic && node->is_generic &&
         !node->type_arguments.empty()) {
-        // キャッシュキーを生成
-        // FIX:
-        // メソッド呼び出しの場合、type_name（正規化された構造体名）を含める
-        // これにより Queue_int::push と Queue_long::push
-        // が別々にキャッシュされる また、Vector<long>::push と
-        // Queue<long>::push も別々にキャッシュされる
-        std::string function_name = node->name;
-        if (is_method_call) {
-            if (!type_name.empty()) {
-                // メソッド呼び出しの場合：type_name::method_name形式
-                function_name = type_name + "::" + node->name;
-            } else if (func->name.find("::") != std::string::npos) {
-                // type_nameが空でもfunc->nameに::が含まれる場合は使用
-                function_name = func->name;
-            } else {
-                // フォールバック：関数定義時の名前を使用
-                // この場合でも一意性を保つために警告を出す
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[GENERIC_CACHE_KEY_WARNING] type_name is "
-                                 "empty for method call: "
-                              << node->name << std::endl;
-                }
-                // 少なくとも関数ポインタアドレスを含めて一意性を確保
-                function_name =
-                    std::to_string(reinterpret_cast<uintptr_t>(func)) + "_" +
-                    node->name;
-            }
-        }
-        std::string cache_key = GenericInstantiation::generate_cache_key(
-            function_name, node->type_arguments);
-
-        if (interpreter_.is_debug_mode()) {
-            std::cerr << "[GENERIC_CACHE_KEY] is_method_call=" << is_method_call
-                      << ", type_name='" << type_name << "', node->name='"
-                      << node->name << "', function_name='" << function_name
-                      << "', cache_key='" << cache_key << "'" << std::endl;
-        }
-
-        // キャッシュをチェック
-        // FIX v0.11.0: キャッシュを無効化
-        // 理由:
-        // キャッシュからクローンしても、複数回呼び出しでローカル変数スコープが壊れる
-        // TODO: 根本原因を調査して、キャッシュを再有効化する
-        cached_func =
-            nullptr; // GenericInstantiation::get_cached_instance(cache_key);
-
-        if (cached_func) {
-            // キャッシュヒット（現在無効化）
-            instantiated_func =
-                GenericInstantiation::clone_ast_node(cached_func);
-            func = instantiated_func.get();
-            if (interpreter_.is_debug_mode()) {
-                std::cerr << "[GENERIC_CACHE] Cache hit for " << cache_key
-                          << " (cloned)" << std::endl;
-            }
+        GenericInstantiation::InstanceCache &instances =
+            interpreter_.generic_instances();
+        if (const ASTNode *instance =
+                instances.call_site_instance(node, func)) {
+            func = instance;
         } else {
-            // キャッシュミス：新しくインスタンス化
             try {
-                instantiated_func =
-                    GenericInstantiation::instantiate_generic_function(
-                        func, node->type_arguments);
-                func = instantiated_func.get();
-
-                // FIX v0.11.0: キャッシュへの保存を無効化
-                // 理由: キャッシュからの取得を無効化しているため、保存も不要
-                // TODO: 根本原因を調査して、キャッシュを再有効化する
-                // GenericInstantiation::cache_instance(
-                //     cache_key, std::move(instantiated_func));
-                // funcポインタはinstantiated_funcから取得しているので、
-                // instantiated_funcをmoveしない限り有効
-
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr
-                        << "[GENERIC_INST] Instantiated generic function: "
-                        << func->name << " with type arguments: ";
-                    for (const auto &type_arg : node->type_arguments) {
-                        std::cerr << type_arg << " ";
-                    }
-                    std::cerr << std::endl;
-                    std::cerr << "[GENERIC_INST] Cached as " << cache_key
-                              << std::endl;
-                    std::cerr << "[GENERIC_INST] Instantiated func has "
-                              << func->statements.size() << " statements, "
-                              << func->parameters.size() << " parameters"
-                              << std::endl;
-                }
+                instance =
+                    instances.get_or_instantiate(func, node->type_arguments);
+                instances.remember_call_site(node, func, instance);
+                func = instance;
             } catch (const std::exception &e) {
                 throw std::runtime_error(
                     "Failed to instantiate generic function " + node->name +
                     ": " + e.what());
             }
-        }
-    }
-
-    if (!func) {
-        // 組み込み関数のチェック
-        if (node->name == "hex" && !is_method_call) {
-            // hex(num) - 整数を16進数文字列に変換
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error("hex() requires exactly 1 argument");
-            }
 
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            uint64_t unsigned_value = static_cast<uint64_t>(value);
-
-            // ポインタメタデータのタグビット（最上位ビット）を除去
-            if (unsigned_value & (1ULL << 63)) {
-                unsigned_value &= ~(1ULL << 63);
+            if (interpreter_.is_debug_mode()) {
+                std::cerr << "[GENERIC_INST] Instantiated generic function: "
+                          << func->name << " with type arguments: ";
+                for (const auto &type_arg : node->type_arguments) {
+                    std::cerr << type_arg << " ";
+                }
+                std::cerr << std::endl;
+                std::cerr << "[GENERIC_INST] Instantiated func has "
+                          << func->statements.size() << " statements, "
+                          << func->parameters.size() << " parameters"
+                          << std::endl;
             }
-
-            // 16進数文字列を生成
-            std::ostringstream oss;
-            oss << "0x" << std::hex << unsigned_value;
-            std::string hex_str = oss.str();
-
-            // 文字列を返す（ReturnExceptionを使用）
-            throw ReturnException(hex_str);
         }
+    }
 
-        // memcpy(dest, src, size) - メモリコピー組み込み関数
-        if (node->name == "memcpy" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("memcpy() requires exactly 3 "
-                                         "arguments: memcpy(dest, src, size)");
-            }
+    if (!func) {
+        // v0.14.0: 組み込み関数・FFI関数は関数探索の前に処理済みのため、
+        // ここに来るのは未定義の関数のみ
+        throw std::runtime_error("Undefined function: " + node->name);
+    }
 
-            // 引数を評価
-            int64_t dest_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t src_value =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t size =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            // デバッグ出力（コメントアウト）
-            // std::cerr << "[memcpy ENTRY] dest=" << std::hex << dest_value
-            //           << ", src=" << src_value << ", size=" << std::dec <<
-            //           size << std::endl;
-
-            // null チェック
-            if (dest_value == 0) {
-                std::cerr << "[memcpy] Error: destination pointer is null"
-                          << std::endl;
-                return 0;
-            }
-            if (src_value == 0) {
-                std::cerr << "[memcpy] Error: source pointer is null"
-                          << std::endl;
-                return 0;
-            }
+    if (is_method_call && !receiver_name.empty()) {
+        std::string private_check_name = receiver_name;
 
-            // サイズチェック
-            if (size <= 0) {
-                return dest_value;
+        if (private_check_name != "self") {
+            Variable *receiver_var =
+                interpreter_.find_variable(private_check_name);
+            if (!receiver_var && receiver_resolution.variable_ptr) {
+                receiver_var = receiver_resolution.variable_ptr;
             }
-
-            // Variable*として有効かどうかをチェック
-            Variable *dest_var = reinterpret_cast<Variable *>(dest_value);
-            Variable *src_var = reinterpret_cast<Variable *>(src_value);
-
-            bool dest_is_var = false;
-            bool src_is_var = false;
-            void *actual_dest = reinterpret_cast<void *>(dest_value);
-            void *actual_src = reinterpret_cast<void *>(src_value);
-
-            // destがVariable*かチェック（安全に）
-            try {
-                // TypeInfoが有効範囲か簡易チェック（is_assignedは不要、未初期化変数もサポート）
-                // FIX: TYPE_TINYとTYPE_SHORTも含める
-                // FIX v0.11.0:
-                // 型の範囲チェックを厳格化（生のメモリアドレスを誤認識しないため）
-                // FIX v0.11.0: TYPE_POINTER, TYPE_STRUCTも含める
-                if ((dest_var->type >= TYPE_TINY &&
-                     dest_var->type <= TYPE_BIG) ||
-                    dest_var->type == TYPE_POINTER ||
-                    dest_var->type == TYPE_STRUCT) {
-                    dest_is_var = true;
-
-                    // std::cerr << "[memcpy DEBUG dest] Variable*=" << dest_var
-                    //           << ", type=" <<
-                    //           static_cast<int>(dest_var->type)
-                    //           << ", is_struct=" << dest_var->is_struct
-                    //           << ", is_array=" << dest_var->is_array
-                    //           << ", value=" << dest_var->value << std::endl;
-
-                    // プリミティブ型なら&(var->value)を使う
-                    if (!dest_var->is_struct && !dest_var->is_array &&
-                        dest_var->type != TYPE_POINTER &&
-                        dest_var->type != TYPE_STRUCT) {
-                        actual_dest = &(dest_var->value);
-                    } else if (dest_var->is_array &&
-                               !dest_var->array_values.empty()) {
-                        actual_dest = dest_var->array_values.data();
-                    } else if (dest_var->is_struct ||
-                               dest_var->type == TYPE_POINTER ||
-                               dest_var->type == TYPE_STRUCT) {
-                        // 構造体ポインタの場合、valueに実際のアドレスが格納されている
-                        actual_dest = reinterpret_cast<void *>(dest_var->value);
-                        // std::cerr << "[memcpy DEBUG dest] Struct/Pointer:
-                        // actual_dest=" << actual_dest << std::endl;
-                    }
+            if (receiver_var) {
+                std::string type_name;
+                if (receiver_var->type == TYPE_STRUCT) {
+                    type_name = receiver_var->struct_type_name;
+                } else if (!receiver_var->interface_name.empty()) {
+                    type_name = receiver_var->struct_type_name;
+                } else {
+                    type_name =
+                        std::string(::type_info_to_string(receiver_var->type));
                 }
-            } catch (...) {
-                dest_is_var = false;
-            }
-
-            // srcがVariable*かチェック（安全に）
-            try {
-                // FIX: TYPE_TINYとTYPE_SHORTも含める
-                // FIX v0.11.0:
-                // 型の範囲チェックを厳格化（生のメモリアドレスを誤認識しないため）
-                // FIX v0.11.0: TYPE_POINTER, TYPE_STRUCTも含める
-                if ((src_var->type >= TYPE_TINY && src_var->type <= TYPE_BIG) ||
-                    src_var->type == TYPE_POINTER ||
-                    src_var->type == TYPE_STRUCT) {
-                    src_is_var = true;
-
-                    // std::cerr << "[memcpy DEBUG src] Variable*=" << src_var
-                    //           << ", type=" << static_cast<int>(src_var->type)
-                    //           << ", is_struct=" << src_var->is_struct
-                    //           << ", is_array=" << src_var->is_array
-                    //           << ", value=" << src_var->value << std::endl;
-
-                    // プリミティブ型なら&(var->value)を使う
-                    if (!src_var->is_struct && !src_var->is_array &&
-                        src_var->type != TYPE_POINTER &&
-                        src_var->type != TYPE_STRUCT) {
-                        actual_src = &(src_var->value);
-                    } else if (src_var->is_array &&
-                               !src_var->array_values.empty()) {
-                        actual_src = src_var->array_values.data();
-                    } else if (src_var->is_struct ||
-                               src_var->type == TYPE_POINTER ||
-                               src_var->type == TYPE_STRUCT) {
-                        // 構造体ポインタの場合、valueに実際のアドレスが格納されている
-                        actual_src = reinterpret_cast<void *>(src_var->value);
-                        // std::cerr << "[memcpy DEBUG src] Struct/Pointer:
-                        // actual_src=" << actual_src << std::endl;
+                for (const auto &impl_def :
+                     interpreter_.get_impl_definitions()) {
+                    if (impl_def.struct_name == type_name) {
+                        for (const auto &method : impl_def.methods) {
+                            if (method->name == node->name &&
+                                method->is_private_method) {
+                                std::cerr
+                                    << "Error: Cannot access private method '"
+                                    << node->name
+                                    << "' from outside its impl block"
+                                    << std::endl;
+                                std::exit(1);
+                            }
+                        }
+                        break;
                     }
                 }
-            } catch (...) {
-                src_is_var = false;
             }
+        }
+    }
 
-            // 構造体コピーの特別処理
-            if (dest_is_var && src_is_var && dest_var->is_struct &&
-                src_var->is_struct) {
-                // v0.13.1: Variable構造体のstruct_membersをコピー（参照も考慮）
-                auto &src_members = src_var->get_struct_members();
-                auto &dest_members = dest_var->get_struct_members();
-                for (const auto &member_pair : src_members) {
-                    dest_members[member_pair.first] = member_pair.second;
-                }
-
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[memcpy] Copied struct members from "
-                              << src_var << " to " << dest_var << std::endl;
-                }
-            } else {
-                // 通常のmemcpy: actual_destとactual_srcを使用
-                std::memcpy(actual_dest, actual_src, static_cast<size_t>(size));
-
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[memcpy] Copied " << size << " bytes from "
-                              << actual_src << " to " << actual_dest
-                              << " (dest_is_var=" << dest_is_var
-                              << ", src_is_var=" << src_is_var << ")"
-                              << std::endl;
-
-                    // 書き込み確認: actual_destから読み戻してみる
-                    if (size == 8 && !dest_is_var && src_is_var) {
-                        int64_t written_value =
-                            *reinterpret_cast<int64_t *>(actual_dest);
-                        int64_t source_value =
-                            *reinterpret_cast<int64_t *>(actual_src);
-                        std::cerr
-                            << "[memcpy] Verification: wrote " << source_value
-                            << ", read back " << written_value
-                            << " (match=" << (written_value == source_value)
-                            << ")" << std::endl;
-                    }
+    // 新しいスコープを作成
+    auto cleanup_method_context = [&]() {
+        if (method_context.uses_temp_receiver &&
+            !method_context.temp_variable_name.empty()) {
+            Variable *temp_var =
+                interpreter_.find_variable(method_context.temp_variable_name);
+            if (temp_var && method_context.chain_value) {
+                if (temp_var->type == TYPE_STRUCT || temp_var->is_struct) {
+                    method_context.chain_value->struct_value = *temp_var;
+                    method_context.chain_value->struct_value.type = TYPE_STRUCT;
+                    method_context.chain_value->struct_value.is_struct = true;
+                    method_context.chain_value->is_struct = true;
+                    method_context.chain_value->type = TYPE_STRUCT;
+                } else if (temp_var->type == TYPE_STRING) {
+                    method_context.chain_value->str_value = temp_var->str_value;
+                    method_context.chain_value->type = TYPE_STRING;
+                    method_context.chain_value->is_struct = false;
+                    method_context.chain_value->is_array = false;
+                } else {
+                    method_context.chain_value->value = temp_var->value;
+                    method_context.chain_value->type = temp_var->type;
+                    method_context.chain_value->is_struct = false;
+                    method_context.chain_value->is_array = false;
                 }
             }
+            interpreter_.remove_temp_variable(
+                method_context.temp_variable_name);
+            method_context.uses_temp_receiver = false;
+        }
+    };
+    interpreter_.push_scope();
+    bool method_scope_active = true;
 
-            // destポインタを返す
-            return dest_value;
+    // コンストラクタの場合、selfコンテキストを設定
+    bool is_constructor =
+        (func && (func->node_type == ASTNodeType::AST_CONSTRUCTOR_DECL ||
+                  func->is_constructor));
+    if (is_constructor && func) {
+        // コンストラクタの場合、空のselfを作成
+        std::string struct_name = func->constructor_struct_name;
+        if (struct_name.empty() && func->type_name == func->name) {
+            struct_name = func->name; // Rectangle()の場合、関数名が構造体名
         }
 
-        // sizeof_type("T") - 型コンテキストからTの実際の型のサイズを返す
-        // 使用例: int size = sizeof_type("T"); //
-        // Queue<Vector<int>>の場合、"T"=Vector<int>で24を返す
-        if (node->name == "sizeof_type" && !is_method_call) {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "sizeof_type() requires 1 argument: sizeof_type(\"T\")");
-            }
+        if (!struct_name.empty()) {
+            // 構造体定義を取得してselfを作成
+            const StructDefinition *struct_def =
+                interpreter_.find_struct_definition(struct_name);
+            if (struct_def) {
+                Variable self_var;
+                self_var.type = TYPE_STRUCT;
+                self_var.is_struct = true;
+                self_var.struct_type_name = struct_name;
 
-            // 型コンテキストから型パラメータを解決
-            const TypeContext *type_ctx =
-                interpreter_.get_current_type_context();
-            std::string type_name;
+                // メンバーを初期化
+                for (const auto &member : struct_def->members) {
+                    Variable member_var;
+                    member_var.type = member.type;
+                    member_var.is_assigned = false;
+                    self_var.struct_members[member.name] = member_var;
 
-            if (interpreter_.is_debug_mode()) {
-                std::cerr << "[sizeof_type] type_ctx="
-                          << (type_ctx ? "YES" : "NO");
-                if (type_ctx) {
-                    std::cerr
-                        << ", has_T="
-                        << (type_ctx->has_mapping_for("T") ? "YES" : "NO");
+                    // self.memberとしてもアクセス可能にする
+                    std::string self_member_path = "self." + member.name;
+                    interpreter_.get_current_scope()
+                        .variables[self_member_path] = member_var;
                 }
-                std::cerr << "\n";
-            }
 
-            if (type_ctx && type_ctx->has_mapping_for("T")) {
-                type_name = type_ctx->resolve_type("T");
-            } else {
-                // フォールバック: デフォルトサイズ（プリミティブ型と仮定）
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[sizeof_type] No type context, returning "
-                                 "default 8 bytes\n";
-                }
-                return 8;
-            }
+                interpreter_.get_current_scope().variables["self"] = self_var;
 
-            // プリミティブ型のサイズ
-            if (type_name == "int" || type_name == "long" ||
-                type_name == "bool") {
-                return 8; // 8バイトアライメント
-            }
-            if (type_name == "void*" ||
-                type_name.find("*") != std::string::npos) {
-                return 8; // ポインタは8バイト
+                if (debug_mode) {
+                    debug_msg(DebugMsgId::METHOD_CONSTRUCTOR_SELF,
+                              "Created self for constructor");
+                }
             }
+        }
+    }
 
-            // 構造体のサイズを計算
-            auto struct_def = interpreter_.find_struct_definition(type_name);
-            if (struct_def != nullptr) {
-                size_t total_size = 0;
-                for (const auto &member : struct_def->members) {
-                    if (member.is_pointer) {
-                        total_size += sizeof(void *); // 8 bytes
-                    } else if (member.type == TYPE_LONG) {
-                        total_size += sizeof(long); // 8 bytes
-                    } else if (member.type == TYPE_INT) {
-                        total_size += sizeof(long); // 8 bytes (アライメント)
-                    } else {
-                        total_size += sizeof(long); // 8 bytes デフォルト
-                    }
-                }
+    // メソッド呼び出しの場合、selfコンテキストを設定
+    bool used_resolution_ptr = false; // Track if we used pointer dereference
+    Variable *dereferenced_struct_ptr =
+        nullptr; // Store the dereferenced struct pointer
 
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[sizeof_type] T=" << type_name << " => "
-                              << total_size << " bytes ("
-                              << struct_def->members.size() << " members)\n";
-                }
+    if (is_method_call) {
+        Variable *receiver_var = nullptr;
 
-                return static_cast<int64_t>(total_size);
+        // Prioritize receiver_resolution.variable_ptr (e.g., after pointer
+        // dereference)
+        used_resolution_ptr = false;
+        if (debug_mode) {
+            debug_msg(DebugMsgId::METHOD_SELF_SETUP_START,
+                      "receiver_resolution.variable_ptr check");
+        }
+        if (receiver_resolution.variable_ptr) {
+            receiver_var = receiver_resolution.variable_ptr;
+            used_resolution_ptr = true;
+            dereferenced_struct_ptr =
+                receiver_resolution.variable_ptr; // Save pointer for writeback
+            if (debug_mode) {
+                debug_msg(DebugMsgId::METHOD_SELF_SETUP_START,
+                          "Using resolution pointer");
             }
-
-            // 未知の型の場合はデフォルト8バイト
-            if (interpreter_.is_debug_mode()) {
-                std::cerr << "[sizeof_type] T=" << type_name
-                          << " => 8 bytes (default)\n";
+        } else if (!receiver_name.empty()) {
+            receiver_var = interpreter_.find_variable(receiver_name);
+        } else if (node->left &&
+                   (node->left->node_type == ASTNodeType::AST_VARIABLE ||
+                    node->left->node_type == ASTNodeType::AST_IDENTIFIER)) {
+            receiver_var = interpreter_.find_variable(node->left->name);
+            if (receiver_name.empty()) {
+                receiver_name = node->left->name;
             }
-            return 8;
         }
 
-        // array_get(ptr, index) - 汎用配列要素取得（型推論版）
-        // ジェネリクス対応: 型パラメータTから適切なarray_get_Tを呼び出す
-        if (node->name == "array_get" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error(
-                    "array_get() requires 2 arguments: array_get(ptr, index)");
+        if (!receiver_var) {
+            std::string error_name = receiver_name;
+            if (error_name.empty() && node->left) {
+                error_name = node->left->name;
             }
+            throw std::runtime_error("Receiver variable not found: " +
+                                     error_name);
+        }
 
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (interpreter_.is_debug_mode()) {
-                std::cerr << "[array_get] Called with ptr=0x" << std::hex
-                          << ptr_value << std::dec << ", index=" << index
-                          << "\n";
+        // Only sync if receiver_var was not from pointer dereference
+        // (i.e., not from receiver_resolution.variable_ptr)
+        if (!used_resolution_ptr && !receiver_name.empty() &&
+            (receiver_var->type == TYPE_STRUCT ||
+             receiver_var->type == TYPE_INTERFACE || receiver_var->is_struct)) {
+            interpreter_.sync_struct_members_from_direct_access(receiver_name);
+            Variable *synced_var = interpreter_.find_variable(receiver_name);
+            if (synced_var) {
+                receiver_var = synced_var;
             }
+        }
 
-            if (ptr_value == 0 || index < 0)
-                return 0;
-
-            // v0.13.1: 型コンテキストからTの実際の型を取得
-            const TypeContext *type_ctx =
-                interpreter_.get_current_type_context();
-            if (type_ctx && type_ctx->has_mapping_for("T")) {
-                std::string actual_type = type_ctx->resolve_type("T");
-
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[array_get] Resolved T to: " << actual_type
-                              << "\n";
-                }
+        auto &current_scope = interpreter_.get_current_scope();
 
-                // 構造体型の場合、構造体定義を基にメモリから再構築
-                // ネストしたジェネリック構造体（Vector<Queue<T>>など）のサポート
-                auto struct_def =
-                    interpreter_.find_struct_definition(actual_type);
-
-                if (interpreter_.is_debug_mode()) {
-                    std::cerr << "[array_get] struct_def for " << actual_type
-                              << ": " << (struct_def ? "found" : "NOT FOUND")
-                              << "\n";
-                }
-                if (struct_def != nullptr) {
-                    // 構造体の実際のメモリサイズを取得
-                    // 各メンバーの実際のサイズの合計を計算
-                    size_t total_size = 0;
-                    for (const auto &member : struct_def->members) {
-                        if (member.is_pointer) {
-                            total_size += sizeof(void *); // 8 bytes
-                        } else if (member.type == TYPE_LONG) {
-                            total_size += sizeof(long); // 8 bytes
-                        } else if (member.type == TYPE_INT) {
-                            total_size += sizeof(int); // 4 bytes
-                        } else if (member.type == TYPE_FLOAT) {
-                            total_size += sizeof(float); // 4 bytes
-                        } else if (member.type == TYPE_DOUBLE) {
-                            total_size += sizeof(double); // 8 bytes
-                        } else if (member.type == TYPE_CHAR) {
-                            total_size += sizeof(char); // 1 byte
-                        } else {
-                            total_size += sizeof(long); // 8 bytes デフォルト
-                        }
-                    }
-
-                    // 配列内の要素へのポインタを計算
-                    char *arr = reinterpret_cast<char *>(ptr_value);
-                    char *element_ptr = arr + (index * total_size);
-
-                    // メモリから構造体を再構築
-                    Variable result;
-                    result.is_struct = true;
-                    result.struct_type_name = actual_type;
-                    result.type_name = actual_type;
-                    result.is_assigned = true;
-
-                    // メンバーを再構築（8バイトアライメントで読み取り）
-                    size_t offset = 0;
-                    if (interpreter_.is_debug_mode()) {
-                        std::cerr << "[array_get] Reconstructing struct "
-                                  << actual_type << " from memory at "
-                                  << (void *)element_ptr << ", "
-                                  << struct_def->members.size() << " members\n";
-                    }
-
-                    for (const auto &member_def : struct_def->members) {
-                        Variable member_var;
-                        member_var.type = member_def.type;
-                        member_var.is_pointer = member_def.is_pointer;
-
-                        // 型に応じた実際のサイズで読み取り
-                        if (member_def.is_pointer) {
-                            member_var.value = *reinterpret_cast<int64_t *>(
-                                element_ptr + offset);
-                            offset += sizeof(void *);
-                        } else if (member_def.type == TYPE_LONG) {
-                            member_var.value = *reinterpret_cast<int64_t *>(
-                                element_ptr + offset);
-                            offset += sizeof(long);
-                        } else if (member_def.type == TYPE_INT) {
-                            member_var.value = *reinterpret_cast<int32_t *>(
-                                element_ptr + offset);
-                            offset += sizeof(int);
-                        } else if (member_def.type == TYPE_FLOAT) {
-                            float f_val = *reinterpret_cast<float *>(
-                                element_ptr + offset);
-                            member_var.float_value = f_val;
-                            member_var.value = static_cast<int64_t>(f_val);
-                            offset += sizeof(float);
-                        } else if (member_def.type == TYPE_DOUBLE) {
-                            double d_val = *reinterpret_cast<double *>(
-                                element_ptr + offset);
-                            member_var.double_value = d_val;
-                            member_var.value = static_cast<int64_t>(d_val);
-                            offset += sizeof(double);
-                        } else if (member_def.type == TYPE_CHAR) {
-                            member_var.value =
-                                *reinterpret_cast<char *>(element_ptr + offset);
-                            offset += sizeof(char);
-                        } else {
-                            member_var.value = *reinterpret_cast<int64_t *>(
-                                element_ptr + offset);
-                            offset += sizeof(long);
-                        }
-
-                        member_var.is_assigned = true;
-                        result.struct_members[member_def.name] = member_var;
-
-                        if (interpreter_.is_debug_mode()) {
-                            size_t member_size = 0;
-                            if (member_def.is_pointer) {
-                                member_size = sizeof(void *);
-                            } else if (member_def.type == TYPE_LONG) {
-                                member_size = sizeof(long);
-                            } else if (member_def.type == TYPE_INT) {
-                                member_size = sizeof(int);
-                            } else if (member_def.type == TYPE_FLOAT) {
-                                member_size = sizeof(float);
-                            } else if (member_def.type == TYPE_DOUBLE) {
-                                member_size = sizeof(double);
-                            } else if (member_def.type == TYPE_CHAR) {
-                                member_size = sizeof(char);
-                            } else {
-                                member_size = sizeof(long);
-                            }
-                            std::cerr
-                                << "[array_get]   Member " << member_def.name
-                                << " at offset " << (offset - member_size)
-                                << ": type="
-                                << static_cast<int>(member_def.type)
-                                << ", is_pointer=" << member_def.is_pointer
-                                << ", value=" << member_var.value << " (0x"
-                                << std::hex << member_var.value << std::dec
-                                << ")\n";
-                        }
-                    }
-
-                    // Deep copy for nested generic structs
-                    // Vector<T>とQueue<T>のポインタメンバーをdeep copy
-                    if (actual_type.find("Vector<") == 0) {
-                        // Vector<T>のdeep copy: data配列をコピー
-                        auto data_it = result.struct_members.find("data");
-                        auto length_it = result.struct_members.find("length");
-                        auto capacity_it =
-                            result.struct_members.find("capacity");
-
-                        if (data_it != result.struct_members.end() &&
-                            length_it != result.struct_members.end() &&
-                            capacity_it != result.struct_members.end()) {
-
-                            void *original_data =
-                                reinterpret_cast<void *>(data_it->second.value);
-                            int length =
-                                static_cast<int>(length_it->second.value);
-                            int capacity =
-                                static_cast<int>(capacity_it->second.value);
-
-                            if (interpreter_.is_debug_mode()) {
-                                std::cerr
-                                    << "[array_get] Vector deep copy check: "
-                                    << "data=" << original_data
-                                    << ", length=" << length
-                                    << ", capacity=" << capacity << "\n";
-                            }
-
-                            if (original_data != nullptr && capacity > 0) {
-                                // 要素の型を取得（Vector<T>のT）
-                                size_t start = actual_type.find('<') + 1;
-                                size_t end = actual_type.find_last_of('>');
-                                std::string element_type =
-                                    actual_type.substr(start, end - start);
-
-                                // 要素のサイズを計算
-                                size_t element_size = 0;
-                                auto element_struct_def =
-                                    interpreter_.find_struct_definition(
-                                        element_type);
-                                if (element_struct_def != nullptr) {
-                                    // 構造体の場合、8バイトアライメントで計算
-                                    for (size_t i = 0;
-                                         i < element_struct_def->members.size();
-                                         ++i) {
-                                        element_size += sizeof(long);
-                                    }
-                                } else {
-                                    // プリミティブ型の場合
-                                    element_size = sizeof(long);
-                                }
-
-                                // 新しいdata配列を割り当て
-                                size_t total_bytes = capacity * element_size;
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr
-                                        << "[array_get] About to malloc: "
-                                           "capacity="
-                                        << capacity
-                                        << ", element_size=" << element_size
-                                        << ", total_bytes=" << total_bytes
-                                        << "\n";
-                                }
-
-                                void *new_data = malloc(total_bytes);
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr
-                                        << "[array_get] malloc returned: 0x"
-                                        << std::hex << new_data << std::dec
-                                        << "\n";
-                                }
-
-                                if (new_data == nullptr) {
-                                    throw std::runtime_error(
-                                        "malloc failed in deep copy");
-                                }
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr
-                                        << "[array_get] About to memcpy: src=0x"
-                                        << std::hex << original_data
-                                        << ", dst=0x" << new_data << std::dec
-                                        << ", bytes=" << total_bytes << "\n";
-                                }
-
-                                memcpy(new_data, original_data, total_bytes);
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr << "[array_get] memcpy completed "
-                                                 "successfully\n";
-                                }
-
-                                // dataポインタを更新 + 要素型名を保存
-                                data_it->second.value =
-                                    reinterpret_cast<int64_t>(new_data);
-                                data_it->second.type_name =
-                                    element_type; // 要素型名を保存
-                                data_it->second.pointer_base_type_name =
-                                    element_type; // 念のため両方設定
-                                result.struct_members["data"] = data_it->second;
-
-                                // ポインタ要素型をグローバルマップに登録
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr
-                                        << "[array_get] Registering pointer 0x"
-                                        << std::hex << new_data << std::dec
-                                        << " with element type: "
-                                        << element_type << "\n";
-                                }
-                                interpreter_.register_pointer_element_type(
-                                    new_data, element_type);
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr << "[array_get] Registration "
-                                                 "completed\n";
-                                }
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr << "[array_get] Updated "
-                                                 "result.struct_members["
-                                                 "\"data\"] to 0x"
-                                              << std::hex << new_data
-                                              << std::dec << " (was 0x"
-                                              << std::hex << original_data
-                                              << std::dec << ")\n";
-                                }
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr << "[array_get] Deep copied "
-                                                 "Vector data: "
-                                              << total_bytes << " bytes from 0x"
-                                              << std::hex << original_data
-                                              << " to 0x" << new_data
-                                              << std::dec << "\n";
-
-                                    // メモリの内容を確認
-                                    if (element_type == "long" &&
-                                        capacity >= 3) {
-                                        long *src = reinterpret_cast<long *>(
-                                            original_data);
-                                        long *dst =
-                                            reinterpret_cast<long *>(new_data);
-                                        std::cerr
-                                            << "[array_get]   Original data[0]="
-                                            << src[0] << ", [1]=" << src[1]
-                                            << ", [2]=" << src[2] << "\n";
-                                        std::cerr
-                                            << "[array_get]   Copied data[0]="
-                                            << dst[0] << ", [1]=" << dst[1]
-                                            << ", [2]=" << dst[2] << "\n";
-                                    }
-                                }
-                            }
-                        }
-                    } else if (actual_type.find("Queue<") == 0) {
-                        // Queue<T>のdeep copy: リンクリストをコピー
-                        if (interpreter_.is_debug_mode()) {
-                            std::cerr << "[array_get] Starting Queue<T> deep "
-                                         "copy for type: "
-                                      << actual_type << "\n";
-                        }
-                        auto front_it = result.struct_members.find("front");
-                        auto rear_it = result.struct_members.find("rear");
-                        auto length_it = result.struct_members.find("length");
-
-                        if (front_it != result.struct_members.end() &&
-                            rear_it != result.struct_members.end() &&
-                            length_it != result.struct_members.end()) {
-
-                            void *original_front = reinterpret_cast<void *>(
-                                front_it->second.value);
-                            int length =
-                                static_cast<int>(length_it->second.value);
-
-                            if (original_front != nullptr && length > 0) {
-                                // 要素の型を取得（Queue<T>のT）
-                                size_t start = actual_type.find('<') + 1;
-                                size_t end = actual_type.find_last_of('>');
-                                std::string element_type =
-                                    actual_type.substr(start, end - start);
-
-                                // ノードのサイズを計算（T data + void* next）
-                                // 注意:
-                                // Cbインタープリタは全ての型を8バイトアライメントで扱うため、
-                                // primitive型でも8バイトとして計算する
-                                size_t data_size = 0;
-                                auto element_struct_def =
-                                    interpreter_.find_struct_definition(
-                                        element_type);
-                                if (element_struct_def != nullptr) {
-                                    for (size_t i = 0;
-                                         i < element_struct_def->members.size();
-                                         ++i) {
-                                        data_size += 8; // 常に8バイト
-                                    }
-                                } else {
-                                    data_size = 8; // primitive型も8バイト
-                                }
-                                size_t node_size =
-                                    data_size +
-                                    8; // data + next (両方8バイトアライメント)
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr << "[array_get] Queue node "
-                                                 "calculation: element_type="
-                                              << element_type
-                                              << ", data_size=" << data_size
-                                              << ", node_size=" << node_size
-                                              << ", length=" << length << "\n";
-                                    std::cerr << "[array_get] original_front=0x"
-                                              << std::hex << original_front
-                                              << std::dec << "\n";
-                                }
-
-                                // リンクリストをコピー
-                                void *new_front = nullptr;
-                                void *new_rear = nullptr;
-                                void *current_old = original_front;
-
-                                while (current_old != nullptr) {
-                                    if (interpreter_.is_debug_mode()) {
-                                        std::cerr << "[array_get] Processing "
-                                                     "node at 0x"
-                                                  << std::hex << current_old
-                                                  << std::dec << "\n";
-                                        // ノードの内容をダンプ
-                                        int64_t *node_data =
-                                            reinterpret_cast<int64_t *>(
-                                                current_old);
-                                        std::cerr
-                                            << "[array_get]   Node data[0]="
-                                            << node_data[0] << ", data[1]=0x"
-                                            << std::hex << node_data[1]
-                                            << std::dec << "\n";
-                                    }
-
-                                    // 新しいノードを割り当て
-                                    void *new_node = malloc(node_size);
-
-                                    if (interpreter_.is_debug_mode()) {
-                                        std::cerr << "[array_get] Allocated "
-                                                     "new_node at 0x"
-                                                  << std::hex << new_node
-                                                  << std::dec << "\n";
-                                    }
-
-                                    // Vectorの場合は構造体全体（24バイト）をコピー、それ以外は8バイト
-                                    size_t copy_size = data_size;
-                                    if (element_type.find("Vector<") == 0) {
-                                        copy_size =
-                                            24; // Vector struct: data(8) +
-                                                // length(8) + capacity(8)
-                                    }
-                                    memcpy(new_node, current_old, copy_size);
-
-                                    if (interpreter_.is_debug_mode()) {
-                                        std::cerr << "[array_get] Copied data ("
-                                                  << copy_size << " bytes)\n";
-                                    }
-
-                                    // nextポインタを初期化（nullに設定）
-                                    char *next_field_addr =
-                                        reinterpret_cast<char *>(new_node) +
-                                        data_size;
-                                    *reinterpret_cast<void **>(
-                                        next_field_addr) = nullptr;
-
-                                    // ノード内の要素がVectorの場合、deep copy
-                                    if (element_type.find("Vector<") == 0) {
-                                        char *new_node_data =
-                                            reinterpret_cast<char *>(new_node);
-
-                                        // Vectorのメンバーを読み取り
-                                        void *vec_data =
-                                            *reinterpret_cast<void **>(
-                                                new_node_data + 0); // data
-                                        int vec_length =
-                                            *reinterpret_cast<int *>(
-                                                new_node_data + 8); // length
-                                        int vec_capacity =
-                                            *reinterpret_cast<int *>(
-                                                new_node_data + 16); // capacity
-
-                                        if (interpreter_.is_debug_mode()) {
-                                            std::cerr
-                                                << "[array_get] Vector in "
-                                                   "Queue node: "
-                                                << "data=0x" << std::hex
-                                                << vec_data << std::dec
-                                                << ", length=" << vec_length
-                                                << ", capacity=" << vec_capacity
-                                                << "\n";
-                                        }
-
-                                        if (vec_data != nullptr &&
-                                            vec_capacity > 0) {
-                                            // Vector内の要素型を取得
-                                            size_t vec_start =
-                                                element_type.find('<') + 1;
-                                            size_t vec_end =
-                                                element_type.find_last_of('>');
-                                            std::string vec_element_type =
-                                                element_type.substr(
-                                                    vec_start,
-                                                    vec_end - vec_start);
-
-                                            // 要素サイズを計算
-                                            size_t vec_element_size = 0;
-                                            auto vec_element_struct_def =
-                                                interpreter_
-                                                    .find_struct_definition(
-                                                        vec_element_type);
-                                            if (vec_element_struct_def !=
-                                                nullptr) {
-                                                for (size_t i = 0;
-                                                     i < vec_element_struct_def
-                                                             ->members.size();
-                                                     ++i) {
-                                                    vec_element_size +=
-                                                        sizeof(long);
-                                                }
-                                            } else {
-                                                vec_element_size = sizeof(long);
-                                            }
-
-                                            // Vector data配列をコピー
-                                            size_t vec_total_bytes =
-                                                vec_capacity * vec_element_size;
-                                            void *new_vec_data =
-                                                malloc(vec_total_bytes);
-                                            memcpy(new_vec_data, vec_data,
-                                                   vec_total_bytes);
-
-                                            // 新しいdataポインタを設定
-                                            *reinterpret_cast<void **>(
-                                                new_node_data + 0) =
-                                                new_vec_data;
-
-                                            if (interpreter_.is_debug_mode()) {
-                                                std::cerr
-                                                    << "[array_get] Deep "
-                                                       "copied "
-                                                       "Vector in Queue node: "
-                                                    << vec_total_bytes
-                                                    << " bytes\n";
-                                            }
-                                        }
-                                    }
-
-                                    // リンクリストを構築
-                                    if (new_front == nullptr) {
-                                        new_front = new_node;
-                                    }
-                                    if (new_rear != nullptr) {
-                                        // 前のノードのnextを更新
-                                        char *prev_next_field =
-                                            reinterpret_cast<char *>(new_rear) +
-                                            data_size;
-                                        *reinterpret_cast<void **>(
-                                            prev_next_field) = new_node;
-                                    }
-                                    new_rear = new_node;
-
-                                    // 次のノードへ
-                                    char *old_next_field =
-                                        reinterpret_cast<char *>(current_old) +
-                                        data_size;
-                                    current_old = *reinterpret_cast<void **>(
-                                        old_next_field);
-                                }
-
-                                // frontとrearポインタを更新
-                                front_it->second.value =
-                                    reinterpret_cast<int64_t>(new_front);
-                                rear_it->second.value =
-                                    reinterpret_cast<int64_t>(new_rear);
-                                result.struct_members["front"] =
-                                    front_it->second;
-                                result.struct_members["rear"] = rear_it->second;
-
-                                if (interpreter_.is_debug_mode()) {
-                                    std::cerr
-                                        << "[array_get] Deep copied Queue: "
-                                        << length << " nodes from 0x"
-                                        << std::hex << original_front
-                                        << " to 0x" << new_front << std::dec
-                                        << "\n";
-                                }
-                            }
-                        }
-                    }
-
-                    // ReturnExceptionで構造体を返す
-                    throw ReturnException(result);
-                }
-
-                // 型に応じて適切にメモリから読み取る
-                if (actual_type == "short") {
-                    short *arr = reinterpret_cast<short *>(ptr_value);
-                    return static_cast<int64_t>(arr[index]);
-                } else if (actual_type == "long") {
-                    long *arr = reinterpret_cast<long *>(ptr_value);
-                    if (interpreter_.is_debug_mode()) {
-                        std::cerr << "[array_get] Reading long at ptr=0x"
-                                  << std::hex << ptr_value << std::dec
-                                  << ", index=" << index
-                                  << ", offset=" << (index * sizeof(long))
-                                  << ", value=" << arr[index] << "\n";
-                        // メモリ内容も確認
-                        std::cerr << "[array_get]   Memory: arr[0]=" << arr[0]
-                                  << ", arr[1]=" << arr[1]
-                                  << ", arr[2]=" << arr[2] << "\n";
-                    }
-                    return static_cast<int64_t>(arr[index]);
-                } else if (actual_type == "char") {
-                    char *arr = reinterpret_cast<char *>(ptr_value);
-                    return static_cast<int64_t>(arr[index]);
-                } else if (actual_type == "string") {
-                    // v0.13.4: 文字列配列のサポート
-                    // メモリレイアウト: char*ポインタの配列
-                    char **arr = reinterpret_cast<char **>(ptr_value);
-                    char *str = arr[index];
-                    if (str == nullptr) {
-                        // 空文字列を返す
-                        throw ReturnException(std::string(""));
-                    }
-                    // char*をstd::stringに変換して返す
-                    throw ReturnException(std::string(str));
-                }
-                // int, その他はデフォルトのint扱い
-            } else {
-                // 型コンテキストがない場合：ポインタ要素型マップから型名を取得
-                std::string element_type_name =
-                    interpreter_.get_pointer_element_type(
-                        reinterpret_cast<void *>(ptr_value));
-
-                if (interpreter_.is_debug_mode()) {
-                    if (!element_type_name.empty()) {
-                        std::cerr
-                            << "[array_get] Got element type from pointer map: "
-                            << element_type_name << " for ptr=0x" << std::hex
-                            << ptr_value << std::dec << "\n";
-                    } else {
-                        std::cerr
-                            << "[array_get] No element type in map for ptr=0x"
-                            << std::hex << ptr_value << std::dec << "\n";
-                    }
-                }
-
-                // 型名が取得できた場合、その型で読み取り
-                if (!element_type_name.empty()) {
-                    if (element_type_name == "long") {
-                        long *arr = reinterpret_cast<long *>(ptr_value);
-                        if (interpreter_.is_debug_mode()) {
-                            std::cerr << "[array_get] Reading long (from "
-                                         "pointer map) at ptr=0x"
-                                      << std::hex << ptr_value << std::dec
-                                      << ", index=" << index
-                                      << ", value=" << arr[index] << "\n";
-                        }
-                        return static_cast<int64_t>(arr[index]);
-                    } else if (element_type_name == "int") {
-                        int *arr = reinterpret_cast<int *>(ptr_value);
-                        return static_cast<int64_t>(arr[index]);
-                    } else if (element_type_name == "short") {
-                        short *arr = reinterpret_cast<short *>(ptr_value);
-                        return static_cast<int64_t>(arr[index]);
-                    } else if (element_type_name == "char") {
-                        char *arr = reinterpret_cast<char *>(ptr_value);
-                        return static_cast<int64_t>(arr[index]);
-                    }
-                }
-            }
-
-            // デフォルトはintとして扱う
-            if (interpreter_.is_debug_mode()) {
-                std::cerr
-                    << "[array_get] WARNING: Fallback to int type for ptr=0x"
-                    << std::hex << ptr_value << std::dec << ", index=" << index
-                    << "\n";
-            }
-            int *arr = reinterpret_cast<int *>(ptr_value);
-            return static_cast<int64_t>(arr[index]);
-        }
-
-        // array_set(ptr, index, value) - 汎用配列要素設定（型推論版）
-        // ジェネリクス対応: 型パラメータTから適切なarray_set_Tを呼び出す
-        if (node->name == "array_set" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set() requires 3 arguments: "
-                                         "array_set(ptr, index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0 || index < 0)
-                return 0;
-
-            // v0.13.1: 型コンテキストからTの実際の型を取得
-            const TypeContext *type_ctx =
-                interpreter_.get_current_type_context();
-            if (type_ctx && type_ctx->has_mapping_for("T")) {
-                std::string actual_type = type_ctx->resolve_type("T");
-
-                // 構造体型の場合、構造体全体をメモリにコピー
-                auto struct_def =
-                    interpreter_.find_struct_definition(actual_type);
-                if (struct_def != nullptr) {
-                    // 第3引数は構造体変数
-                    const ASTNode *value_node = node->arguments[2].get();
-
-                    // 構造体変数を評価して取得
-                    try {
-                        (void)interpreter_.eval_expression(value_node);
-                        // 通常は数値が返るがエラー
-                        throw std::runtime_error(
-                            "array_set: expected struct but got numeric value");
-                    } catch (const ReturnException &ret) {
-                        if (ret.is_struct) {
-                            // 構造体の実際のサイズを計算
-                            // NOTE:
-                            // sizeof(T)を使うのが正確だが、Cbインタプリタ内では
-                            //       Cbコードで計算されたsizeof(T)を使う必要がある
-                            //       ここではメンバーの実際の型サイズを使用
-                            size_t total_size = 0;
-                            for (const auto &member_def : struct_def->members) {
-                                size_t member_size =
-                                    sizeof(long); // デフォルト8バイト
-
-                                // メンバーの型に応じてサイズを調整
-                                if (member_def.type == TYPE_INT ||
-                                    member_def.type == TYPE_FLOAT) {
-                                    member_size = sizeof(int); // 4バイト
-                                } else if (member_def.type == TYPE_SHORT) {
-                                    member_size = sizeof(short); // 2バイト
-                                } else if (member_def.type == TYPE_CHAR ||
-                                           member_def.type == TYPE_TINY) {
-                                    member_size = sizeof(char); // 1バイト
-                                } else if (member_def.type == TYPE_LONG ||
-                                           member_def.type == TYPE_DOUBLE ||
-                                           member_def.type == TYPE_POINTER ||
-                                           member_def.type == TYPE_STRING) {
-                                    member_size = sizeof(long); // 8バイト
-                                }
-                                // TODO:
-                                // 構造体メンバーや配列の場合は再帰的にサイズ計算が必要
-
-                                total_size += member_size;
-                            }
-
-                            // 配列内の書き込み位置を計算
-                            char *arr = reinterpret_cast<char *>(ptr_value);
-                            char *element_ptr = arr + (index * total_size);
-
-                            // 構造体メンバーをメモリに書き込み
-                            // Vector<T>の場合はdataポインタをdeep copyする
-                            bool is_vector = (actual_type.find("Vector<") == 0);
-                            void *original_data_ptr = nullptr;
-                            size_t vec_capacity = 0;
-                            std::string vec_element_type;
-
-                            if (is_vector) {
-                                // Vector<T>の要素型を取得
-                                size_t start = actual_type.find('<') + 1;
-                                size_t end = actual_type.find_last_of('>');
-                                vec_element_type =
-                                    actual_type.substr(start, end - start);
-
-                                // dataとcapacityを取得
-                                auto data_it =
-                                    ret.struct_value.struct_members.find(
-                                        "data");
-                                auto capacity_it =
-                                    ret.struct_value.struct_members.find(
-                                        "capacity");
-                                if (data_it !=
-                                        ret.struct_value.struct_members.end() &&
-                                    capacity_it !=
-                                        ret.struct_value.struct_members.end()) {
-                                    original_data_ptr =
-                                        reinterpret_cast<void *>(
-                                            data_it->second.value);
-                                    vec_capacity = static_cast<size_t>(
-                                        capacity_it->second.value);
-                                }
-                            }
-
-                            size_t offset = 0;
-                            for (const auto &member_def : struct_def->members) {
-                                auto it = ret.struct_value.struct_members.find(
-                                    member_def.name);
-                                if (it !=
-                                    ret.struct_value.struct_members.end()) {
-                                    int64_t value_to_write = it->second.value;
-
-                                    // Vector<T>のdataメンバーの場合、deep
-                                    // copyを行う
-                                    if (is_vector &&
-                                        member_def.name == "data" &&
-                                        original_data_ptr != nullptr &&
-                                        vec_capacity > 0) {
-                                        // 要素サイズを計算
-                                        size_t element_size = 0;
-                                        auto element_struct_def =
-                                            interpreter_.find_struct_definition(
-                                                vec_element_type);
-                                        if (element_struct_def != nullptr) {
-                                            for (size_t i = 0;
-                                                 i < element_struct_def->members
-                                                         .size();
-                                                 ++i) {
-                                                element_size += sizeof(long);
-                                            }
-                                        } else {
-                                            element_size = sizeof(long);
-                                        }
-
-                                        // 新しいdata配列を確保してコピー
-                                        size_t total_bytes =
-                                            vec_capacity * element_size;
-                                        void *new_data = malloc(total_bytes);
-                                        memcpy(new_data, original_data_ptr,
-                                               total_bytes);
-
-                                        // 新しいポインタを書き込む
-                                        value_to_write =
-                                            reinterpret_cast<int64_t>(new_data);
-
-                                        // ポインタ要素型を登録
-                                        interpreter_
-                                            .register_pointer_element_type(
-                                                new_data, vec_element_type);
-
-                                        if (interpreter_.is_debug_mode()) {
-                                            std::cerr
-                                                << "[array_set] Deep copied "
-                                                   "Vector data: "
-                                                << total_bytes
-                                                << " bytes from 0x" << std::hex
-                                                << original_data_ptr << " to 0x"
-                                                << new_data << std::dec << "\n";
-                                        }
-                                    }
-
-                                    // メンバーサイズに応じて書き込み
-                                    size_t member_size =
-                                        sizeof(long); // デフォルト8バイト
-
-                                    if (member_def.type == TYPE_INT ||
-                                        member_def.type == TYPE_FLOAT) {
-                                        member_size = sizeof(int); // 4バイト
-                                        *reinterpret_cast<int32_t *>(
-                                            element_ptr + offset) =
-                                            static_cast<int32_t>(
-                                                value_to_write);
-                                    } else if (member_def.type == TYPE_SHORT) {
-                                        member_size = sizeof(short); // 2バイト
-                                        *reinterpret_cast<int16_t *>(
-                                            element_ptr + offset) =
-                                            static_cast<int16_t>(
-                                                value_to_write);
-                                    } else if (member_def.type == TYPE_CHAR ||
-                                               member_def.type == TYPE_TINY) {
-                                        member_size = sizeof(char); // 1バイト
-                                        *reinterpret_cast<int8_t *>(
-                                            element_ptr + offset) =
-                                            static_cast<int8_t>(value_to_write);
-                                    } else {
-                                        member_size = sizeof(long); // 8バイト
-                                        *reinterpret_cast<int64_t *>(
-                                            element_ptr + offset) =
-                                            value_to_write;
-                                    }
-
-                                    offset += member_size;
-                                } else {
-                                    // デフォルト値を書き込み
-                                    size_t member_size =
-                                        sizeof(long); // デフォルト8バイト
-
-                                    if (member_def.type == TYPE_INT ||
-                                        member_def.type == TYPE_FLOAT) {
-                                        member_size = sizeof(int); // 4バイト
-                                        *reinterpret_cast<int32_t *>(
-                                            element_ptr + offset) = 0;
-                                    } else if (member_def.type == TYPE_SHORT) {
-                                        member_size = sizeof(short); // 2バイト
-                                        *reinterpret_cast<int16_t *>(
-                                            element_ptr + offset) = 0;
-                                    } else if (member_def.type == TYPE_CHAR ||
-                                               member_def.type == TYPE_TINY) {
-                                        member_size = sizeof(char); // 1バイト
-                                        *reinterpret_cast<int8_t *>(
-                                            element_ptr + offset) = 0;
-                                    } else {
-                                        member_size = sizeof(long); // 8バイト
-                                        *reinterpret_cast<int64_t *>(
-                                            element_ptr + offset) = 0;
-                                    }
-
-                                    offset += member_size;
-                                }
-                            }
-
-                            if (interpreter_.is_debug_mode()) {
-                                std::cerr << "[array_set] Wrote struct "
-                                          << actual_type
-                                          << " to array at index " << index
-                                          << ", total_size=" << total_size
-                                          << "\n";
-                                size_t debug_offset = 0;
-                                for (const auto &member_def :
-                                     struct_def->members) {
-                                    size_t member_size = sizeof(long);
-                                    if (member_def.type == TYPE_INT ||
-                                        member_def.type == TYPE_FLOAT) {
-                                        member_size = sizeof(int);
-                                    } else if (member_def.type == TYPE_SHORT) {
-                                        member_size = sizeof(short);
-                                    } else if (member_def.type == TYPE_CHAR ||
-                                               member_def.type == TYPE_TINY) {
-                                        member_size = sizeof(char);
-                                    }
-
-                                    auto it =
-                                        ret.struct_value.struct_members.find(
-                                            member_def.name);
-                                    if (it !=
-                                        ret.struct_value.struct_members.end()) {
-                                        std::cerr << "[array_set]   Member "
-                                                  << member_def.name
-                                                  << " at offset "
-                                                  << debug_offset << ": "
-                                                  << it->second.value << "\n";
-                                    }
-                                    debug_offset += member_size;
-                                }
-                            }
-
-                            return 0;
-                        }
-                    }
-
-                    // 構造体でなければ変数参照として処理
-                    std::string var_name;
-                    if (value_node->node_type == ASTNodeType::AST_VARIABLE) {
-                        var_name = value_node->name;
-                        Variable *struct_var =
-                            interpreter_.find_variable(var_name);
-                        if (struct_var && struct_var->is_struct) {
-                            // 構造体の実際のサイズを計算
-                            size_t total_size = 0;
-                            for (const auto &member_def : struct_def->members) {
-                                size_t member_size =
-                                    sizeof(long); // デフォルト8バイト
-
-                                // メンバーの型に応じてサイズを調整
-                                if (member_def.type == TYPE_INT ||
-                                    member_def.type == TYPE_FLOAT) {
-                                    member_size = sizeof(int); // 4バイト
-                                } else if (member_def.type == TYPE_SHORT) {
-                                    member_size = sizeof(short); // 2バイト
-                                } else if (member_def.type == TYPE_CHAR ||
-                                           member_def.type == TYPE_TINY) {
-                                    member_size = sizeof(char); // 1バイト
-                                } else if (member_def.type == TYPE_LONG ||
-                                           member_def.type == TYPE_DOUBLE ||
-                                           member_def.type == TYPE_POINTER ||
-                                           member_def.type == TYPE_STRING) {
-                                    member_size = sizeof(long); // 8バイト
-                                }
-
-                                total_size += member_size;
-                            }
-
-                            // 配列内の書き込み位置を計算
-                            char *arr = reinterpret_cast<char *>(ptr_value);
-                            char *element_ptr = arr + (index * total_size);
-
-                            // 構造体メンバーをメモリに書き込み
-                            size_t offset = 0;
-                            for (const auto &member_def : struct_def->members) {
-                                size_t member_size =
-                                    sizeof(long); // デフォルト8バイト
-
-                                // メンバーの型に応じてサイズを調整
-                                if (member_def.type == TYPE_INT ||
-                                    member_def.type == TYPE_FLOAT) {
-                                    member_size = sizeof(int); // 4バイト
-                                } else if (member_def.type == TYPE_SHORT) {
-                                    member_size = sizeof(short); // 2バイト
-                                } else if (member_def.type == TYPE_CHAR ||
-                                           member_def.type == TYPE_TINY) {
-                                    member_size = sizeof(char); // 1バイト
-                                } else if (member_def.type == TYPE_LONG ||
-                                           member_def.type == TYPE_DOUBLE ||
-                                           member_def.type == TYPE_POINTER ||
-                                           member_def.type == TYPE_STRING) {
-                                    member_size = sizeof(long); // 8バイト
-                                }
-
-                                auto it = struct_var->struct_members.find(
-                                    member_def.name);
-                                if (it != struct_var->struct_members.end()) {
-                                    // メンバーサイズに応じて書き込み
-                                    if (member_size == 4) {
-                                        *reinterpret_cast<int32_t *>(
-                                            element_ptr + offset) =
-                                            static_cast<int32_t>(
-                                                it->second.value);
-                                    } else {
-                                        *reinterpret_cast<int64_t *>(
-                                            element_ptr + offset) =
-                                            it->second.value;
-                                    }
-                                } else {
-                                    // デフォルト値を書き込み
-                                    if (member_size == 4) {
-                                        *reinterpret_cast<int32_t *>(
-                                            element_ptr + offset) = 0;
-                                    } else {
-                                        *reinterpret_cast<int64_t *>(
-                                            element_ptr + offset) = 0;
-                                    }
-                                }
-                                offset += member_size;
-                            }
-
-                            if (interpreter_.is_debug_mode()) {
-                                std::cerr << "[array_set] Wrote struct "
-                                          << actual_type << " (" << var_name
-                                          << ") to array at index " << index
-                                          << ", total_size=" << total_size
-                                          << "\n";
-                                for (const auto &m :
-                                     struct_var->struct_members) {
-                                    std::cerr << "[array_set]   " << m.first
-                                              << " = " << m.second.value
-                                              << "\n";
-                                }
-                            }
-
-                            return 0;
-                        }
-                    }
-                }
-
-                // プリミティブ型の処理
-                int64_t value =
-                    interpreter_.eval_expression(node->arguments[2].get());
-
-                // 型に応じて適切にメモリに書き込む
-                if (actual_type == "short") {
-                    short *arr = reinterpret_cast<short *>(ptr_value);
-                    arr[index] = static_cast<short>(value);
-                    return 0;
-                } else if (actual_type == "long") {
-                    long *arr = reinterpret_cast<long *>(ptr_value);
-                    arr[index] = static_cast<long>(value);
-                    return 0;
-                } else if (actual_type == "char") {
-                    char *arr = reinterpret_cast<char *>(ptr_value);
-                    arr[index] = static_cast<char>(value);
-                    return 0;
-                } else if (actual_type == "string") {
-                    // v0.13.4: 文字列配列のサポート
-                    // 第3引数は文字列値
-                    const ASTNode *value_node = node->arguments[2].get();
-
-                    // 文字列リテラルまたは文字列変数を評価
-                    std::string str_value;
-                    if (value_node->node_type ==
-                        ASTNodeType::AST_STRING_LITERAL) {
-                        str_value = value_node->str_value;
-                    } else if (value_node->node_type ==
-                               ASTNodeType::AST_VARIABLE) {
-                        Variable *var =
-                            interpreter_.find_variable(value_node->name);
-                        if (var && var->type == TYPE_STRING) {
-                            str_value = var->str_value;
-                        } else {
-                            throw std::runtime_error(
-                                "array_set: string variable not found or not a "
-                                "string");
-                        }
-                    } else {
-                        throw std::runtime_error(
-                            "array_set: unsupported value type for string");
-                    }
-
-                    // メモリレイアウト: char*ポインタの配列
-                    // 文字列のdeep copyを作成
-                    char *str_copy = (char *)malloc(str_value.size() + 1);
-                    strcpy(str_copy, str_value.c_str());
-
-                    // 配列内のポインタを更新
-                    char **arr = reinterpret_cast<char **>(ptr_value);
-
-                    // 既存の文字列があれば解放
-                    if (arr[index] != nullptr) {
-                        free(arr[index]);
-                    }
-
-                    arr[index] = str_copy;
-
-                    if (interpreter_.is_debug_mode()) {
-                        std::cerr << "[array_set] String set at index " << index
-                                  << ": '" << str_value << "' at "
-                                  << (void *)str_copy << "\n";
-                    }
-
-                    return 0;
-                }
-                // int, その他はデフォルトのint扱い
-            }
-
-            // デフォルトはintとして扱う
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[2].get());
-            int *arr = reinterpret_cast<int *>(ptr_value);
-            arr[index] = static_cast<int>(value);
-            return 0;
-        }
-
-        // default(T) - 型Tのデフォルト値を返す
-        // ジェネリクス対応: 型パラメータTに応じたデフォルト値
-        if (node->name == "default" && !is_method_call) {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "default() requires 1 argument: default(T)");
-            }
-
-            // 型名を取得
-            const ASTNode *arg = node->arguments[0].get();
-            if (arg->node_type == ASTNodeType::AST_VARIABLE) {
-                std::string type_name = arg->name;
-
-                // 型に応じたデフォルト値を返す
-                if (type_name == "int" || type_name == "long" ||
-                    type_name == "short" || type_name == "char") {
-                    return 0;
-                }
-                if (type_name == "bool") {
-                    return 0; // false
-                }
-                if (type_name == "double" || type_name == "float") {
-                    // 0.0をint64_tビット表現で返す
-                    union {
-                        double d;
-                        int64_t i;
-                    } converter;
-                    converter.d = 0.0;
-                    return converter.i;
-                }
-                if (type_name == "string") {
-                    return 0; // 空文字列（nullポインタ）
-                }
-
-                // その他の型はnullptrまたは0を返す
-                return 0;
-            }
-
-            return 0;
-        }
-
-        // call_function_pointer(func_ptr, arg1, arg2, ...) -
-        // 関数ポインタを呼び出す ジェネリック対応:
-        // 任意の数の引数で関数ポインタを呼び出す
-        if (node->name == "call_function_pointer" && !is_method_call) {
-            if (node->arguments.size() < 1) {
-                throw std::runtime_error(
-                    "call_function_pointer() requires at least 1 argument: "
-                    "call_function_pointer(func_ptr, arg1, arg2, ...)");
-            }
-
-            // 第1引数: 関数ポインタ（ASTNodeのアドレス）
-            int64_t func_ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-
-            if (func_ptr_value == 0) {
-                throw std::runtime_error(
-                    "call_function_pointer: function pointer is null");
-            }
-
-            // 関数ポインタの値はASTNode*のアドレス
-            // まずVariable*として試してみて、is_function_pointerかチェック
-            // そうでなければASTNode*として扱う
-            const ASTNode *func_def = nullptr;
-            std::string func_name;
-
-            // Variable*として解釈を試みる
-            Variable *func_ptr_var =
-                reinterpret_cast<Variable *>(func_ptr_value);
-            if (func_ptr_var->is_function_pointer) {
-                // Variable経由の関数ポインタ（パラメータとして渡された場合など）
-                func_name = func_ptr_var->function_pointer_name;
-                func_def = interpreter_.find_function(func_name);
-            } else {
-                // 直接ASTNode*として渡された場合（&func形式）
-                func_def = reinterpret_cast<const ASTNode *>(func_ptr_value);
-                func_name = func_def->name;
-            }
-
-            if (!func_def) {
-                throw std::runtime_error("call_function_pointer: function '" +
-                                         func_name + "' not found");
-            }
-
-            // 残りの引数を評価
-            std::vector<int64_t> arg_values;
-            for (size_t i = 1; i < node->arguments.size(); ++i) {
-                arg_values.push_back(
-                    interpreter_.eval_expression(node->arguments[i].get()));
-            }
-
-            // 引数の数をチェック
-            if (arg_values.size() != func_def->parameters.size()) {
-                throw std::runtime_error(
-                    "call_function_pointer: argument count mismatch for '" +
-                    func_name + "': expected " +
-                    std::to_string(func_def->parameters.size()) + ", got " +
-                    std::to_string(arg_values.size()));
-            }
-
-            // 新しいスコープを作成
-            interpreter_.push_scope();
-
-            try {
-                // パラメータをバインド
-                for (size_t i = 0; i < func_def->parameters.size(); ++i) {
-                    const ASTNode *param = func_def->parameters[i].get();
-                    Variable var;
-                    var.value = arg_values[i];
-                    var.is_assigned = true;
-                    var.type = param->type_info; // パラメータの型情報を使用
-                    interpreter_.current_scope().variables[param->name] = var;
-                }
-
-                // 関数本体を実行
-                try {
-                    interpreter_.execute_statement(func_def->body.get());
-                } catch (const ReturnException &re) {
-                    // 戻り値を取得
-                    interpreter_.pop_scope();
-                    return re.value;
-                }
-
-                // 戻り値なし（voidまたは明示的なreturn文なし）
-                interpreter_.pop_scope();
-                return 0;
-
-            } catch (...) {
-                interpreter_.pop_scope();
-                throw;
-            }
-        }
-
-        // array_get_int(ptr, index) - 配列要素を取得
-        if (node->name == "array_get_int" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error(
-                    "array_get_int() requires 2 arguments: array_get_int(ptr, "
-                    "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_int] Error: null pointer" << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_int] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            int *arr = reinterpret_cast<int *>(ptr_value);
-            return static_cast<int64_t>(arr[index]);
-        }
-
-        // array_set_int(ptr, index, value) - 配列要素を設定
-        if (node->name == "array_set_int" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error(
-                    "array_set_int() requires 3 arguments: array_set_int(ptr, "
-                    "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_int] Error: null pointer" << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_int] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            int *arr = reinterpret_cast<int *>(ptr_value);
-            arr[index] = static_cast<int>(value);
-            return 0;
-        }
-
-        // array_get_long(ptr, index) - long配列要素を取得
-        if (node->name == "array_get_long" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("array_get_long() requires 2 "
-                                         "arguments: array_get_long(ptr, "
-                                         "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_long] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_long] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            long *arr = reinterpret_cast<long *>(ptr_value);
-            return static_cast<int64_t>(arr[index]);
-        }
-
-        // array_set_long(ptr, index, value) - long配列要素を設定
-        if (node->name == "array_set_long" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set_long() requires 3 "
-                                         "arguments: array_set_long(ptr, "
-                                         "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_long] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_long] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            long *arr = reinterpret_cast<long *>(ptr_value);
-            arr[index] = static_cast<long>(value);
-            return 0;
-        }
-
-        // array_get_char(ptr, index) - char配列要素を取得
-        if (node->name == "array_get_char" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("array_get_char() requires 2 "
-                                         "arguments: array_get_char(ptr, "
-                                         "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_char] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_char] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            char *arr = reinterpret_cast<char *>(ptr_value);
-            return static_cast<int64_t>(arr[index]);
-        }
-
-        // array_set_char(ptr, index, value) - char配列要素を設定
-        if (node->name == "array_set_char" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set_char() requires 3 "
-                                         "arguments: array_set_char(ptr, "
-                                         "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_char] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_char] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            char *arr = reinterpret_cast<char *>(ptr_value);
-            arr[index] = static_cast<char>(value);
-            return 0;
-        }
-
-        // array_get_bool(ptr, index) - bool配列要素を取得
-        if (node->name == "array_get_bool" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("array_get_bool() requires 2 "
-                                         "arguments: array_get_bool(ptr, "
-                                         "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_bool] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_bool] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            bool *arr = reinterpret_cast<bool *>(ptr_value);
-            return static_cast<int64_t>(arr[index] ? 1 : 0);
-        }
-
-        // array_set_bool(ptr, index, value) - bool配列要素を設定
-        if (node->name == "array_set_bool" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set_bool() requires 3 "
-                                         "arguments: array_set_bool(ptr, "
-                                         "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t value =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_bool] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_bool] Error: negative index " << index
-                          << std::endl;
-                return 0;
-            }
-
-            bool *arr = reinterpret_cast<bool *>(ptr_value);
-            arr[index] = (value != 0);
-            return 0;
-        }
-
-        // malloc(size) - メモリ確保
-        // sizeof(type) - 型のサイズを取得
-        // 注: sizeof演算子として実装すべきだが、簡易版として組み込み関数で実装
-        if (node->name == "sizeof" && !is_method_call) {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "sizeof() requires 1 argument: sizeof(type_expression)");
-            }
-
-            // 引数の型を推論
-            const ASTNode *arg = node->arguments[0].get();
-
-            // 型名が直接渡された場合（AST_VARIABLEで型名として解釈）
-            if (arg->node_type == ASTNodeType::AST_VARIABLE) {
-                std::string name = arg->name;
-
-                // まず変数として検索
-                Variable *var = interpreter_.find_variable(name);
-                if (var) {
-                    // 変数が見つかった場合、その型のサイズを返す
-                    switch (var->type) {
-                    case TYPE_INT:
-                        return sizeof(int);
-                    case TYPE_LONG:
-                        return sizeof(long);
-                    case TYPE_SHORT:
-                        return sizeof(short);
-                    case TYPE_CHAR:
-                        return sizeof(char);
-                    case TYPE_BOOL:
-                        return sizeof(bool);
-                    case TYPE_FLOAT:
-                        return sizeof(float);
-                    case TYPE_DOUBLE:
-                        return sizeof(double);
-                    case TYPE_QUAD:
-                        return sizeof(long double);
-                    case TYPE_POINTER:
-                        return sizeof(void *);
-                    case TYPE_STRING:
-                        return sizeof(void *);
-                    default:
-                        if (var->is_struct)
-                            return sizeof(void *);
-                        throw std::runtime_error(
-                            "Cannot determine size of variable type");
-                    }
-                }
-
-                // 変数でない場合は型名として解釈
-                std::string type_name = name;
-
-                // プリミティブ型のサイズを返す
-                if (type_name == "int")
-                    return sizeof(int);
-                if (type_name == "long")
-                    return sizeof(long);
-                if (type_name == "short")
-                    return sizeof(short);
-                if (type_name == "char")
-                    return sizeof(char);
-                if (type_name == "bool")
-                    return sizeof(bool);
-                if (type_name == "float")
-                    return sizeof(float);
-                if (type_name == "double")
-                    return sizeof(double);
-                if (type_name == "quad")
-                    return sizeof(long double);
-                if (type_name == "void*")
-                    return sizeof(void *);
-
-                // 構造体のサイズを取得
-                Variable *struct_def = interpreter_.find_variable(type_name);
-                if (struct_def && struct_def->is_struct) {
-                    // 構造体のサイズは、全メンバーのサイズの合計
-                    // 簡易実装: ポインタサイズを返す（構造体は参照渡しのため）
-                    return sizeof(void *);
-                }
-
-                throw std::runtime_error("Unknown type for sizeof: " +
-                                         type_name);
-            }
-
-            // 式の型を推論
-            TypedValue typed_val = interpreter_.evaluate_typed(arg);
-
-            switch (typed_val.type.type_info) {
-            case TYPE_INT:
-                return sizeof(int);
-            case TYPE_LONG:
-                return sizeof(long);
-            case TYPE_SHORT:
-                return sizeof(short);
-            case TYPE_CHAR:
-                return sizeof(char);
-            case TYPE_BOOL:
-                return sizeof(bool);
-            case TYPE_FLOAT:
-                return sizeof(float);
-            case TYPE_DOUBLE:
-                return sizeof(double);
-            case TYPE_QUAD:
-                return sizeof(long double);
-            case TYPE_POINTER:
-                return sizeof(void *);
-            case TYPE_STRING:
-                return sizeof(void *); // 文字列ポインタ
-            default:
-                throw std::runtime_error("Cannot determine size of type");
-            }
-        }
-
-        if (node->name == "malloc" && !is_method_call) {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "malloc() requires 1 argument: malloc(size)");
-            }
-
-            int64_t size =
-                interpreter_.eval_expression(node->arguments[0].get());
-
-            if (size <= 0) {
-                std::cerr << "[malloc] Error: invalid size " << size
-                          << std::endl;
-                return 0;
-            }
-
-            void *ptr = std::malloc(static_cast<size_t>(size));
-            if (ptr == nullptr) {
-                std::cerr << "[malloc] Error: allocation failed for size "
-                          << size << std::endl;
-                return 0;
-            }
-
-            return reinterpret_cast<int64_t>(ptr);
-        }
-
-        // free(ptr) - メモリ解放
-        if (node->name == "free" && !is_method_call) {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "free() requires 1 argument: free(ptr)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-
-            if (ptr_value == 0) {
-                // nullptr の解放は何もしない
-                return 0;
-            }
-
-            std::free(reinterpret_cast<void *>(ptr_value));
-            return 0;
-        }
-
-        // array_get_double(ptr, index) - double配列要素を取得
-        if (node->name == "array_get_double" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("array_get_double() requires 2 "
-                                         "arguments: array_get_double(ptr, "
-                                         "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_double] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_double] Error: negative index "
-                          << index << std::endl;
-                return 0;
-            }
-
-            double *arr = reinterpret_cast<double *>(ptr_value);
-            double value = arr[index];
-
-            // doubleをint64_tのビット表現として返す
-            union {
-                double d;
-                int64_t i;
-            } converter;
-            converter.d = value;
-
-            return converter.i;
-        }
-
-        // array_set_double(ptr, index, value) - double配列要素を設定
-        if (node->name == "array_set_double" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set_double() requires 3 "
-                                         "arguments: array_set_double(ptr, "
-                                         "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            // doubleの値を取得するにはevaluate_typedを使用
-            TypedValue typed_val =
-                interpreter_.evaluate_typed(node->arguments[2].get());
-            double value = typed_val.as_double();
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_double] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_double] Error: negative index "
-                          << index << std::endl;
-                return 0;
-            }
-
-            double *arr = reinterpret_cast<double *>(ptr_value);
-            arr[index] = value;
-            return 0;
-        }
-
-        // array_get_string(ptr, index) - string配列要素を取得
-        if (node->name == "array_get_string" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("array_get_string() requires 2 "
-                                         "arguments: array_get_string(ptr, "
-                                         "index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_string] Error: null pointer"
-                          << std::endl;
-                return 0; // 空文字列として0を返す
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_string] Error: negative index "
-                          << index << std::endl;
-                return 0; // 空文字列として0を返す
-            }
-
-            std::string **arr = reinterpret_cast<std::string **>(ptr_value);
-            return reinterpret_cast<int64_t>(arr[index]);
-        }
-
-        // array_set_string(ptr, index, value) - string配列要素を設定
-        if (node->name == "array_set_string" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error("array_set_string() requires 3 "
-                                         "arguments: array_set_string(ptr, "
-                                         "index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            int64_t str_ptr =
-                interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_string] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_string] Error: negative index "
-                          << index << std::endl;
-                return 0;
-            }
-
-            std::string **arr = reinterpret_cast<std::string **>(ptr_value);
-            arr[index] = reinterpret_cast<std::string *>(str_ptr);
-            return 0;
-        }
-
-        // array_get_struct(ptr, index) -
-        // 構造体配列要素を取得（memcpyで値をコピー）
-        if (node->name == "array_get_struct" && !is_method_call) {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error(
-                    "array_get_struct() requires 2 arguments: "
-                    "array_get_struct(ptr, index)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_get_struct] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_get_struct] Error: negative index "
-                          << index << std::endl;
-                return 0;
-            }
-
-            // 構造体配列は連続したメモリとして扱う
-            // 戻り値は構造体のコピーのアドレス（インタプリタが管理）
-            return ptr_value +
-                   index; // ポインタ演算は呼び出し側で型サイズを考慮する
-        }
-
-        // array_set_struct(ptr, index, value) -
-        // 構造体配列要素を設定（memcpyで値をコピー）
-        if (node->name == "array_set_struct" && !is_method_call) {
-            if (node->arguments.size() != 3) {
-                throw std::runtime_error(
-                    "array_set_struct() requires 3 arguments: "
-                    "array_set_struct(ptr, index, value)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-            int64_t index =
-                interpreter_.eval_expression(node->arguments[1].get());
-            // struct_ptrは呼び出し側で処理されるため、ここでは評価のみ
-            (void)interpreter_.eval_expression(node->arguments[2].get());
-
-            if (ptr_value == 0) {
-                std::cerr << "[array_set_struct] Error: null pointer"
-                          << std::endl;
-                return 0;
-            }
-
-            if (index < 0) {
-                std::cerr << "[array_set_struct] Error: negative index "
-                          << index << std::endl;
-                return 0;
-            }
-
-            // 構造体のコピーは呼び出し側が適切に処理する
-            // ここでは単にポインタ演算の結果を返す
-            return ptr_value + index;
-        }
-
-        // v0.14.0: 組み込み関数のチェック前にエラーを投げないようにする
-        // malloc, free, sizeof などの組み込み関数は functions
-        // マップに登録されていないため、
-        // ここでエラーにせず、後続の組み込み関数チェックに進む
-        static const std::vector<std::string> builtin_function_names = {
-            "malloc",
-            "free",
-            "sizeof",
-            "array_get",
-            "array_set",
-            "array_get_double",
-            "array_set_double",
-            "array_get_bool",
-            "array_set_bool",
-            "array_get_string",
-            "array_set_string",
-            "array_get_struct",
-            "array_set_struct",
-            "println",
-            "print",
-            "printf",
-            "sprintf",
-            "strlen",
-            "strcpy",
-            "strcmp",
-            "strcat",
-            "memcpy",
-            "memset",
-            "memcmp",
-            "run_event_loop",   // v0.13.0 Phase 2.0: SimpleEventLoop execution
-            "concurrent_await", // v0.12.0 Phase 8: concurrent execution
-            "sleep",            // v0.12.0: Sleep function (milliseconds)
-            "sleep_ms",         // v0.12.0: Sleep function alias (milliseconds)
-            "now",              // v0.12.0: Get current time in milliseconds
-            "timeout"}; // v0.12.1: Timeout function for async operations
-
-        bool is_builtin = false;
-        for (const auto &builtin_name : builtin_function_names) {
-            if (node->name == builtin_name) {
-                is_builtin = true;
-                break;
-            }
-        }
-
-        if (!is_builtin) {
-            // v0.13.0: FFI関数もチェック
-            if (interpreter_.get_ffi_manager()->isForeignFunction(node->name)) {
-                // FFI関数の場合は is_builtin として扱う
-                is_builtin = true;
-            } else {
-                if (is_method_call) {
-                    std::string debug_type_name;
-                    if (is_method_call) {
-                        if (!receiver_name.empty()) {
-                            Variable *debug_receiver =
-                                interpreter_.find_variable(receiver_name);
-                            if (!debug_receiver &&
-                                receiver_resolution.variable_ptr) {
-                                debug_receiver =
-                                    receiver_resolution.variable_ptr;
-                            }
-                            if (debug_receiver) {
-                                if (!debug_receiver->struct_type_name.empty()) {
-                                    debug_type_name =
-                                        debug_receiver->struct_type_name;
-                                } else {
-                                    debug_type_name =
-                                        std::string(::type_info_to_string(
-                                            debug_receiver->type));
-                                }
-                            }
-                        }
-                    }
-                }
-                throw std::runtime_error("Undefined function: " + node->name);
-            }
-        }
-
-        // 組み込み関数の場合は、後続の処理（malloc, free などのチェック）に進む
-        // funcはnullptrのままだが、組み込み関数チェックで処理される
-    }
-
-    if (is_method_call && !receiver_name.empty()) {
-        std::string private_check_name = receiver_name;
-
-        if (private_check_name != "self") {
-            Variable *receiver_var =
-                interpreter_.find_variable(private_check_name);
-            if (!receiver_var && receiver_resolution.variable_ptr) {
-                receiver_var = receiver_resolution.variable_ptr;
-            }
-            if (receiver_var) {
-                std::string type_name;
-                if (receiver_var->type == TYPE_STRUCT) {
-                    type_name = receiver_var->struct_type_name;
-                } else if (!receiver_var->interface_name.empty()) {
-                    type_name = receiver_var->struct_type_name;
-                } else {
-                    type_name =
-                        std::string(::type_info_to_string(receiver_var->type));
-                }
-                for (const auto &impl_def :
-                     interpreter_.get_impl_definitions()) {
-                    if (impl_def.struct_name == type_name) {
-                        for (const auto &method : impl_def.methods) {
-                            if (method->name == node->name &&
-                                method->is_private_method) {
-                                std::cerr
-                                    << "Error: Cannot access private method '"
-                                    << node->name
-                                    << "' from outside its impl block"
-                                    << std::endl;
-                                std::exit(1);
-                            }
-                        }
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    // v0.14.0: 組み込み関数の処理（funcがnullptrの場合）
-    // malloc, free, sizeof などの組み込み関数を早期に処理
-    if (interpreter_.is_debug_mode()) {
-        {
-            char dbg_buf[512];
-            snprintf(
-                dbg_buf, sizeof(dbg_buf),
-                "[BUILTIN_CHECK] func=%p, is_method_call=%d, node->name=%s",
-                (void *)func, is_method_call, node->name.c_str());
-            debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-        }
-    }
-
-    if (!func && !is_method_call) {
-        // v0.13.0: FFI関数をチェック
-        if (interpreter_.get_ffi_manager()->isForeignFunction(node->name)) {
-            // 引数を評価してVariableに変換（型付き評価で正確な型情報を取得）
-            std::vector<Variable> args;
-            for (const auto &arg_node : node->arguments) {
-                // 引数を型付きで評価して正確な型情報を取得
-                TypedValue typed_val =
-                    interpreter_.evaluate_typed(arg_node.get());
-
-                Variable arg_var;
-                arg_var.type = typed_val.type.type_info;
-
-                // 型情報と値を設定
-                if (typed_val.is_float_result || arg_var.type == TYPE_DOUBLE ||
-                    arg_var.type == TYPE_FLOAT) {
-                    // float/doubleの場合はdouble_valueを使用
-                    arg_var.double_value = typed_val.double_value;
-                    arg_var.value =
-                        static_cast<int64_t>(typed_val.double_value);
-                    if (arg_var.type == TYPE_UNKNOWN) {
-                        arg_var.type = TYPE_DOUBLE; // デフォルトでdouble
-                    }
-                } else if (typed_val.is_string()) {
-                    // 文字列の場合
-                    arg_var.str_value = typed_val.string_value;
-                    arg_var.value = typed_val.value;
-                } else {
-                    // 整数の場合
-                    arg_var.value = typed_val.value;
-                }
-
-                args.push_back(arg_var);
-            }
-
-            // FFI関数を呼び出し
-            Variable result =
-                interpreter_.get_ffi_manager()->callForeignFunction(node->name,
-                                                                    args);
-
-            // 結果を設定
-            if (result.type == TYPE_DOUBLE || result.type == TYPE_FLOAT) {
-                TypedValue typed_result(result.double_value,
-                                        InferredType(result.type, ""));
-                set_last_typed_result(typed_result);
-                capture_numeric_return(
-                    typed_result); // キャプチャして typed evaluation
-                                   // で利用可能にする
-                // double値はvalueフィールドにビットパターンとして返す
-                return *reinterpret_cast<int64_t *>(&result.double_value);
-            } else if (result.type == TYPE_STRING) {
-                TypedValue typed_result(result.str_value,
-                                        InferredType(TYPE_STRING, "string"));
-                set_last_typed_result(typed_result);
-                return 0;
-            } else {
-                return result.value;
-            }
-        }
-
-        if (interpreter_.is_debug_mode()) {
-            {
-                char dbg_buf[512];
-                snprintf(dbg_buf, sizeof(dbg_buf),
-                         "[BUILTIN_EARLY] Processing builtin function: %s",
-                         node->name.c_str());
-                debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-            }
-        }
-
-        // malloc(size) - メモリ確保
-        if (node->name == "malloc") {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "malloc() requires 1 argument: malloc(size)");
-            }
-
-            int64_t size =
-                interpreter_.eval_expression(node->arguments[0].get());
-
-            if (size <= 0) {
-                std::cerr << "[malloc] Error: invalid size " << size
-                          << std::endl;
-                return 0;
-            }
-
-            void *ptr = std::malloc(static_cast<size_t>(size));
-            if (ptr == nullptr) {
-                std::cerr << "[malloc] Error: allocation failed for size "
-                          << size << std::endl;
-                return 0;
-            }
-
-            if (interpreter_.is_debug_mode()) {
-                {
-                    char dbg_buf[512];
-                    snprintf(dbg_buf, sizeof(dbg_buf),
-                             "Allocated %lld bytes at %p", size, ptr);
-                    debug_msg(DebugMsgId::CALL_IMPL_MALLOC, dbg_buf);
-                }
-            }
-
-            return reinterpret_cast<int64_t>(ptr);
-        }
-
-        // free(ptr) - メモリ解放
-        if (node->name == "free") {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "free() requires 1 argument: free(ptr)");
-            }
-
-            int64_t ptr_value =
-                interpreter_.eval_expression(node->arguments[0].get());
-
-            if (ptr_value == 0) {
-                // nullptr の解放は何もしない
-                return 0;
-            }
-
-            std::free(reinterpret_cast<void *>(ptr_value));
-            return 0;
-        }
-
-        // run_event_loop() - SimpleEventLoopを実行 (v0.13.0 Phase 2.0)
-        if (node->name == "run_event_loop") {
-            if (node->arguments.size() != 0) {
-                throw std::runtime_error("run_event_loop() takes no arguments");
-            }
-
-            // SimpleEventLoopを実行
-            interpreter_.get_simple_event_loop().run();
-
-            return 0;
-        }
-
-        // concurrent_await(future1, future2, future3, ...) -
-        // 複数のFutureを並行実行 (v0.12.0 Phase 8 - Not implemented in Phase 1)
-        if (node->name == "concurrent_await") {
-            throw std::runtime_error(
-                "concurrent_await() is not implemented in Phase 1. "
-                "Phase 1 only supports sequential async/await execution.");
-        }
-
-        // now() - 現在時刻をエポックからのミリ秒で取得 (v0.12.0)
-        if (node->name == "now") {
-            if (node->arguments.size() != 0) {
-                throw std::runtime_error("now() takes no arguments");
-            }
-
-#ifdef _WIN32
-            // Windows: GetSystemTimeAsFileTime()を使用
-            FILETIME ft;
-            GetSystemTimeAsFileTime(&ft);
-
-            // FILETIMEは100ナノ秒単位、1601/1/1からの経過時間
-            ULARGE_INTEGER ull;
-            ull.LowPart = ft.dwLowDateTime;
-            ull.HighPart = ft.dwHighDateTime;
-
-            // UNIXエポック(1970/1/1)との差分: 116444736000000000 * 100ns
-            const uint64_t EPOCH_DIFF = 116444736000000000ULL;
-            uint64_t timestamp_100ns = ull.QuadPart - EPOCH_DIFF;
-
-            // 100ナノ秒 → ミリ秒に変換
-            int64_t timestamp_ms =
-                static_cast<int64_t>(timestamp_100ns / 10000);
-
-            return timestamp_ms;
-#else
-            // POSIX (Linux, macOS): gettimeofday()を使用
-            struct timeval tv;
-            gettimeofday(&tv, nullptr);
-
-            // 秒をミリ秒に変換 + マイクロ秒をミリ秒に変換
-            int64_t timestamp_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                                   static_cast<int64_t>(tv.tv_usec) / 1000;
-
-            return timestamp_ms;
-#endif
-        }
-
-        // timeout(future, milliseconds) - タイムアウト機能 (v0.12.1)
-        // 指定時間内にFutureが完了しなければResult::Errを返す
-        if (node->name == "timeout") {
-            if (node->arguments.size() != 2) {
-                throw std::runtime_error("timeout() requires exactly 2 "
-                                         "arguments (future, timeout_ms)");
-            }
-
-            // 第1引数: Future<T>を評価（実際にはawait対象のFuture）
-            ASTNode *future_arg = node->arguments[0].get();
-            TypedValue future_typed = interpreter_.evaluate_typed(future_arg);
-
-            if (!future_typed.is_struct_result || !future_typed.struct_data ||
-                future_typed.struct_data->struct_type_name.find("Future") ==
-                    std::string::npos) {
-                throw std::runtime_error(
-                    "timeout() first argument must be a Future");
-            }
-
-            // 第2引数: タイムアウト時間（ミリ秒）
-            ASTNode *timeout_arg = node->arguments[1].get();
-            int64_t timeout_ms_val = interpreter_.evaluate(timeout_arg);
-            int timeout_ms = static_cast<int>(timeout_ms_val);
-
-            if (timeout_ms < 0) {
-                throw std::runtime_error(
-                    "timeout() timeout value must be non-negative");
-            }
-
-            // Futureからtask_idを取得
-            auto task_id_it =
-                future_typed.struct_data->struct_members.find("task_id");
-            if (task_id_it == future_typed.struct_data->struct_members.end()) {
-                throw std::runtime_error(
-                    "timeout() future does not have task_id");
-            }
-            int task_id = static_cast<int>(task_id_it->second.value);
-
-            // 現在時刻を取得
-#ifdef _WIN32
-            FILETIME ft;
-            GetSystemTimeAsFileTime(&ft);
-            ULARGE_INTEGER uli;
-            uli.LowPart = ft.dwLowDateTime;
-            uli.HighPart = ft.dwHighDateTime;
-            int64_t current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-            struct timeval tv;
-            gettimeofday(&tv, nullptr);
-            int64_t current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                                      static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
-
-            int64_t timeout_time_ms = current_time_ms + timeout_ms;
-
-            // 元のFutureにタイムアウト情報を追加
-            Variable timeout_field;
-            timeout_field.type = TYPE_INT;
-            timeout_field.value = timeout_time_ms;
-            timeout_field.is_assigned = true;
-            future_typed.struct_data->struct_members["timeout_ms"] =
-                timeout_field;
-
-            // タスクにタイムアウト情報を設定
-            AsyncTask *task =
-                interpreter_.get_simple_event_loop().get_task(task_id);
-            if (task) {
-                task->timeout_ms = timeout_time_ms;
-                task->has_timeout = true;
-            }
-
-            // Result<T, string>を返すFutureを作成
-            // 元のFutureの型情報を保持しつつ、Result型でラップ
-            Variable result_future;
-            result_future.is_struct = true;
-            result_future.struct_type_name = "Future";
-            result_future.type = TYPE_STRUCT;
-
-            // Result Future用のtask_idは同じものを使用
-            Variable result_task_id_field;
-            result_task_id_field.type = TYPE_INT;
-            result_task_id_field.value = task_id;
-            result_task_id_field.is_assigned = true;
-            result_future.struct_members["task_id"] = result_task_id_field;
-
-            // is_ready = false (まだ完了していない)
-            Variable is_ready_field;
-            is_ready_field.type = TYPE_INT;
-            is_ready_field.value = 0;
-            is_ready_field.is_assigned = true;
-            result_future.struct_members["is_ready"] = is_ready_field;
-
-            // value フィールド（初期値はダミー）
-            Variable value_field;
-            value_field.type = TYPE_INT;
-            value_field.value = 0;
-            value_field.is_assigned = true;
-            result_future.struct_members["value"] = value_field;
-
-            // timeout_msフィールドを追加
-            result_future.struct_members["timeout_ms"] = timeout_field;
-
-            // タイムアウト付きFutureを返す
-            ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
-            ret.is_struct = true;
-            ret.struct_value = result_future;
-            ret.struct_value.type = TYPE_STRUCT;
-            ret.struct_value.is_struct = true;
-            throw ret;
-        }
-
-        // sleep(milliseconds) - スリープ関数 (v0.12.0)
-        // awaitをサポートするため、Futureを返す
-        // v0.13.0: イベントループベースの非ブロッキング実装
-        if (node->name == "sleep") {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "sleep() requires exactly 1 argument (milliseconds)");
-            }
-
-            // 引数を評価してミリ秒を取得
-            ASTNode *arg = node->arguments[0].get();
-            int64_t result = interpreter_.evaluate(arg);
-            int milliseconds = static_cast<int>(result);
-
-            if (milliseconds < 0) {
-                throw std::runtime_error(
-                    "sleep() argument must be non-negative");
-            }
-
-            // v0.13.0: 非ブロッキングsleep実装
-            // ダミーのasync関数を作成してイベントループに登録
-            AsyncTask sleep_task;
-            sleep_task.function_name = "sleep";
-            sleep_task.function_node = nullptr; // sleepは特殊なタスク
-            sleep_task.is_started = true;
-            sleep_task.is_executed = false;
-            sleep_task.current_statement_index = 0;
-
-            // すぐにsleep状態にする
-            sleep_task.is_sleeping = true;
-
-            // 起床時刻を設定
-#ifdef _WIN32
-            FILETIME ft;
-            GetSystemTimeAsFileTime(&ft);
-            ULARGE_INTEGER uli;
-            uli.LowPart = ft.dwLowDateTime;
-            uli.HighPart = ft.dwHighDateTime;
-            int64_t current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-            struct timeval tv;
-            gettimeofday(&tv, nullptr);
-            int64_t current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                                      static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
-            sleep_task.wake_up_time_ms = current_time_ms + milliseconds;
-
-            // awaitをサポートするため、Future構造体を作成
-            Variable future_var;
-            future_var.is_struct = true;
-            future_var.struct_type_name = "Future";
-            future_var.type = TYPE_STRUCT;
-
-            // Future.is_ready = false (sleep中)
-            Variable is_ready_field;
-            is_ready_field.type = TYPE_INT;
-            is_ready_field.value = 0; // false
-            is_ready_field.is_assigned = true;
-            future_var.struct_members["is_ready"] = is_ready_field;
-
-            // Future.value = 0 (sleep()は値を返さない)
-            Variable value_field;
-            value_field.type = TYPE_INT;
-            value_field.value = 0;
-            value_field.is_assigned = true;
-            future_var.struct_members["value"] = value_field;
-
-            // internal_futureに設定（deep copy）
-            sleep_task.internal_future.is_struct = true;
-            sleep_task.internal_future.struct_type_name =
-                future_var.struct_type_name;
-            sleep_task.internal_future.type = TYPE_STRUCT;
-            for (const auto &[key, val] : future_var.struct_members) {
-                sleep_task.internal_future.struct_members[key] = val;
-            }
-            sleep_task.use_internal_future = true;
-
-            // タスクをイベントループに登録
-            int task_id =
-                interpreter_.get_simple_event_loop().register_task(sleep_task);
-
-            debug_msg(DebugMsgId::SLEEP_TASK_REGISTER, task_id, milliseconds,
-                      sleep_task.wake_up_time_ms);
-
-            // task_idフィールドを設定
-            Variable task_id_field;
-            task_id_field.type = TYPE_INT;
-            task_id_field.value = task_id;
-            task_id_field.is_assigned = true;
-            future_var.struct_members["task_id"] = task_id_field;
-
-            debug_msg(DebugMsgId::SLEEP_RETURN_FUTURE, task_id);
-
-            // ReturnExceptionでFutureを返す
-            ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
-            ret.is_struct = true;
-            ret.struct_value = future_var;
-            ret.struct_value.type = TYPE_STRUCT;
-            ret.struct_value.is_struct = true;
-            throw ret;
-        }
-
-        // sleep_ms(milliseconds) - sleepのエイリアス（v0.12.0 互換性）
-        // v0.13.0: 非ブロッキング実装（sleep()と同じ）
-        if (node->name == "sleep_ms") {
-            if (node->arguments.size() != 1) {
-                throw std::runtime_error(
-                    "sleep_ms() requires exactly 1 argument (milliseconds)");
-            }
-
-            // 引数を評価してミリ秒を取得
-            ASTNode *arg = node->arguments[0].get();
-            int64_t result = interpreter_.evaluate(arg);
-            int milliseconds = static_cast<int>(result);
-
-            if (milliseconds < 0) {
-                throw std::runtime_error(
-                    "sleep_ms() argument must be non-negative");
-            }
-
-            // v0.13.0: 非ブロッキングsleep実装（sleep()と同じロジック）
-            // ダミーのasync関数を作成してイベントループに登録
-            AsyncTask sleep_task;
-            sleep_task.function_name = "sleep_ms";
-            sleep_task.function_node = nullptr; // sleepは特殊なタスク
-            sleep_task.is_started = true;
-            sleep_task.is_executed = false;
-            sleep_task.current_statement_index = 0;
-
-            // すぐにsleep状態にする
-            sleep_task.is_sleeping = true;
-
-            // 起床時刻を設定
-#ifdef _WIN32
-            FILETIME ft;
-            GetSystemTimeAsFileTime(&ft);
-            ULARGE_INTEGER uli;
-            uli.LowPart = ft.dwLowDateTime;
-            uli.HighPart = ft.dwHighDateTime;
-            int64_t current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-            struct timeval tv;
-            gettimeofday(&tv, nullptr);
-            int64_t current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                                      static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
-            sleep_task.wake_up_time_ms = current_time_ms + milliseconds;
-
-            // awaitをサポートするため、Future構造体を作成
-            Variable future_var;
-            future_var.is_struct = true;
-            future_var.struct_type_name = "Future";
-            future_var.type = TYPE_STRUCT;
-
-            // Future.is_ready = false (sleep中)
-            Variable is_ready_field;
-            is_ready_field.type = TYPE_INT;
-            is_ready_field.value = 0; // false
-            is_ready_field.is_assigned = true;
-            future_var.struct_members["is_ready"] = is_ready_field;
-
-            // Future.value = 0 (sleep_ms()は値を返さない)
-            Variable value_field;
-            value_field.type = TYPE_INT;
-            value_field.value = 0;
-            value_field.is_assigned = true;
-            future_var.struct_members["value"] = value_field;
-
-            // internal_futureに設定（deep copy）
-            sleep_task.internal_future.is_struct = true;
-            sleep_task.internal_future.struct_type_name =
-                future_var.struct_type_name;
-            sleep_task.internal_future.type = TYPE_STRUCT;
-            for (const auto &[key, val] : future_var.struct_members) {
-                sleep_task.internal_future.struct_members[key] = val;
-            }
-            sleep_task.use_internal_future = true;
-
-            // タスクをイベントループに登録
-            int task_id =
-                interpreter_.get_simple_event_loop().register_task(sleep_task);
-
-            debug_msg(DebugMsgId::SLEEP_TASK_REGISTER, task_id, milliseconds,
-                      sleep_task.wake_up_time_ms);
-
-            // task_idフィールドを設定
-            Variable task_id_field;
-            task_id_field.type = TYPE_INT;
-            task_id_field.value = task_id;
-            task_id_field.is_assigned = true;
-            future_var.struct_members["task_id"] = task_id_field;
-
-            debug_msg(DebugMsgId::SLEEP_RETURN_FUTURE, task_id);
-
-            // ReturnExceptionでFutureを返す
-            ReturnException ret(static_cast<int64_t>(0), TYPE_INT);
-            ret.is_struct = true;
-            ret.struct_value = future_var;
-            ret.struct_value.type = TYPE_STRUCT;
-            ret.struct_value.is_struct = true;
-            throw ret;
-        }
-
-        // その他の組み込み関数は後続の処理で対応
-        // funcがnullptrのままの場合、この時点では処理できない組み込み関数
-        // エラーにするか、後続の処理に任せる
-    }
-
-    // v0.14.0: funcがnullptrの場合、通常の関数処理をスキップ
-    // 組み込み関数は上記で処理済み、または後続の組み込み関数チェックで処理
-    if (!func) {
-        // funcがnullptrなのに、ここまで到達した場合
-        // 未実装の組み込み関数か、エラー
-        // 後続の組み込み関数チェック（sizeof等）に進むため、ここでは何もしない
-        // ただし、通常の関数処理（スコープ作成等）はスキップ
-        if (interpreter_.is_debug_mode()) {
-            debug_msg(DebugMsgId::CALL_IMPL_BUILTIN,
-                      "Function %s not handled in builtin check");
-        }
-        // 後続の組み込み関数チェックセクションまでジャンプする必要があるが、
-        // C++ではgotoを使わずに、処理を別関数に分離するのが良い
-        // 今回は時間の制約上、既存のmallocチェックを早期リターンで処理した
-        // その他の組み込み関数も同様に早期リターンで処理すべき
-        throw std::runtime_error(
-            "Builtin function not fully implemented in早期 check: " +
-            node->name);
-    }
-
-    // 新しいスコープを作成
-    auto cleanup_method_context = [&]() {
-        if (method_context.uses_temp_receiver &&
-            !method_context.temp_variable_name.empty()) {
-            Variable *temp_var =
-                interpreter_.find_variable(method_context.temp_variable_name);
-            if (temp_var && method_context.chain_value) {
-                if (temp_var->type == TYPE_STRUCT || temp_var->is_struct) {
-                    method_context.chain_value->struct_value = *temp_var;
-                    method_context.chain_value->struct_value.type = TYPE_STRUCT;
-                    method_context.chain_value->struct_value.is_struct = true;
-                    method_context.chain_value->is_struct = true;
-                    method_context.chain_value->type = TYPE_STRUCT;
-                } else if (temp_var->type == TYPE_STRING) {
-                    method_context.chain_value->str_value = temp_var->str_value;
-                    method_context.chain_value->type = TYPE_STRING;
-                    method_context.chain_value->is_struct = false;
-                    method_context.chain_value->is_array = false;
-                } else {
-                    method_context.chain_value->value = temp_var->value;
-                    method_context.chain_value->type = temp_var->type;
-                    method_context.chain_value->is_struct = false;
-                    method_context.chain_value->is_array = false;
-                }
-            }
-            interpreter_.remove_temp_variable(
-                method_context.temp_variable_name);
-            method_context.uses_temp_receiver = false;
-        }
-    };
-    interpreter_.push_scope();
-    bool method_scope_active = true;
-
-    // コンストラクタの場合、selfコンテキストを設定
-    bool is_constructor =
-        (func && (func->node_type == ASTNodeType::AST_CONSTRUCTOR_DECL ||
-                  func->is_constructor));
-    if (is_constructor && func) {
-        // コンストラクタの場合、空のselfを作成
-        std::string struct_name = func->constructor_struct_name;
-        if (struct_name.empty() && func->type_name == func->name) {
-            struct_name = func->name; // Rectangle()の場合、関数名が構造体名
-        }
-
-        if (!struct_name.empty()) {
-            // 構造体定義を取得してselfを作成
-            const StructDefinition *struct_def =
-                interpreter_.find_struct_definition(struct_name);
-            if (struct_def) {
-                Variable self_var;
-                self_var.type = TYPE_STRUCT;
-                self_var.is_struct = true;
-                self_var.struct_type_name = struct_name;
-
-                // メンバーを初期化
-                for (const auto &member : struct_def->members) {
-                    Variable member_var;
-                    member_var.type = member.type;
-                    member_var.is_assigned = false;
-                    self_var.struct_members[member.name] = member_var;
-
-                    // self.memberとしてもアクセス可能にする
-                    std::string self_member_path = "self." + member.name;
-                    interpreter_.get_current_scope()
-                        .variables[self_member_path] = member_var;
-                }
-
-                interpreter_.get_current_scope().variables["self"] = self_var;
-
-                if (debug_mode) {
-                    debug_msg(DebugMsgId::METHOD_CONSTRUCTOR_SELF,
-                              "Created self for constructor");
-                }
-            }
-        }
-    }
-
-    // メソッド呼び出しの場合、selfコンテキストを設定
-    bool used_resolution_ptr = false; // Track if we used pointer dereference
-    Variable *dereferenced_struct_ptr =
-        nullptr; // Store the dereferenced struct pointer
-
-    if (is_method_call) {
-        Variable *receiver_var = nullptr;
-
-        // Prioritize receiver_resolution.variable_ptr (e.g., after pointer
-        // dereference)
-        used_resolution_ptr = false;
-        if (debug_mode) {
-            debug_msg(DebugMsgId::METHOD_SELF_SETUP_START,
-                      "receiver_resolution.variable_ptr check");
-        }
-        if (receiver_resolution.variable_ptr) {
-            receiver_var = receiver_resolution.variable_ptr;
-            used_resolution_ptr = true;
-            dereferenced_struct_ptr =
-                receiver_resolution.variable_ptr; // Save pointer for writeback
-            if (debug_mode) {
-                debug_msg(DebugMsgId::METHOD_SELF_SETUP_START,
-                          "Using resolution pointer");
-            }
-        } else if (!receiver_name.empty()) {
-            receiver_var = interpreter_.find_variable(receiver_name);
-        } else if (node->left &&
-                   (node->left->node_type == ASTNodeType::AST_VARIABLE ||
-                    node->left->node_type == ASTNodeType::AST_IDENTIFIER)) {
-            receiver_var = interpreter_.find_variable(node->left->name);
-            if (receiver_name.empty()) {
-                receiver_name = node->left->name;
-            }
-        }
-
-        if (!receiver_var) {
-            std::string error_name = receiver_name;
-            if (error_name.empty() && node->left) {
-                error_name = node->left->name;
-            }
-            throw std::runtime_error("Receiver variable not found: " +
-                                     error_name);
-        }
-
-        // Only sync if receiver_var was not from pointer dereference
-        // (i.e., not from receiver_resolution.variable_ptr)
-        if (!used_resolution_ptr && !receiver_name.empty() &&
-            (receiver_var->type == TYPE_STRUCT ||
-             receiver_var->type == TYPE_INTERFACE || receiver_var->is_struct)) {
-            interpreter_.sync_struct_members_from_direct_access(receiver_name);
-            Variable *synced_var = interpreter_.find_variable(receiver_name);
-            if (synced_var) {
-                receiver_var = synced_var;
-            }
-        }
-
-        auto &current_scope = interpreter_.get_current_scope();
-
-        // Copy receiver to self
-        current_scope.variables["self"] = *receiver_var;
+        // Copy receiver to self
+        current_scope.variables["self"] = *receiver_var;
 
         // Ensure self has correct type info after copy
         Variable &self_var = current_scope.variables["self"];
@@ -4304,7 +1582,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
             self_var.is_struct = true;
         }
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::METHOD_SELF_SETUP_COMPLETE)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "self.type=%d, self.is_struct=%d",
@@ -4502,7 +1780,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
 
                 current_scope.variables[self_member_path] = member_value;
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "SELF_SETUP: Created %s",
                              self_member_path.c_str());
@@ -4537,7 +1815,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                         current_scope.variables[nested_self_path] =
                             nested_member_value;
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -4609,11 +1887,11 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
     try {
         // パラメータの評価と設定（デフォルト引数対応）
+        // v0.14.0: 引数ごとの渡し方とスロットは関数宣言ごとに一度だけ求める
+        const CallLayout &call_layout = interpreter_.call_layout(func);
         size_t num_params = func->parameters.size();
         size_t num_args = node->arguments.size();
-        size_t required_args = (func->first_default_param_index >= 0)
-                                   ? func->first_default_param_index
-                                   : num_params;
+        size_t required_args = call_layout.required_args;
 
         // 引数数の検証（デフォルト引数を考慮）
         if (num_args < required_args || num_args > num_params) {
@@ -4648,7 +1926,9 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
         }
 
         // ジェネリックメソッドの場合、パラメータの型を解決
-        std::map<std::string, std::string> type_context;
+        static const std::map<std::string, std::string> no_type_context;
+        const std::map<std::string, std::string> *type_context =
+            &no_type_context;
         if (is_method_call && !receiver_name.empty()) {
             Variable *receiver_var = interpreter_.find_variable(receiver_name);
             if (!receiver_var && receiver_resolution.variable_ptr) {
@@ -4656,24 +1936,44 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
             }
 
             if (receiver_var) {
-                std::string type_name = receiver_var->struct_type_name;
+                const std::string &type_name = receiver_var->struct_type_name;
+
+                // v0.14.0: 呼び出し箇所のキャッシュが同じ型なら探した結果を使う
+                // （引数の評価中に同じ箇所が別の型で再解決されていれば探し直す）
+                MethodCacheEntry *entry =
+                    method_cache_entry &&
+                            method_cache_entry->receiver_type == type_name
+                        ? method_cache_entry
+                        : nullptr;
+                const ImplDefinition *context_impl = nullptr;
+                if (entry && entry->type_context_resolved) {
+                    context_impl = entry->type_context_impl;
+                } else {
+                    // impl_defを探す
+                    for (const auto &impl :
+                         interpreter_.get_impl_definitions()) {
+                        if (impl.struct_name == type_name &&
+                            !impl.type_parameter_map.empty()) {
+                            context_impl = &impl;
+                            break;
+                        }
+                    }
+                    if (entry) {
+                        entry->type_context_impl = context_impl;
+                        entry->type_context_resolved = true;
+                    }
+                }
 
-                // impl_defを探す
-                for (const auto &impl : interpreter_.get_impl_definitions()) {
-                    if (impl.struct_name == type_name &&
-                        !impl.type_parameter_map.empty()) {
-                        type_context = impl.type_parameter_map;
+                if (context_impl) {
+                    type_context = &context_impl->type_parameter_map;
 
-                        if (debug_mode) {
-                            std::cerr
-                                << "[GENERIC_PARAM] Found type context for "
-                                << type_name << ":" << std::endl;
-                            for (const auto &pair : type_context) {
-                                std::cerr << "  " << pair.first << " -> "
-                                          << pair.second << std::endl;
-                            }
+                    if (debug_mode) {
+                        std::cerr << "[GENERIC_PARAM] Found type context for "
+                                  << type_name << ":" << std::endl;
+                        for (const auto &pair : *type_context) {
+                            std::cerr << "  " << pair.first << " -> "
+                                      << pair.second << std::endl;
                         }
-                        break;
                     }
                 }
             }
@@ -4684,9 +1984,9 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
             // ジェネリック型パラメータを解決
             TypeInfo resolved_type_info = param_orig->type_info;
-            if (!type_context.empty() && !param_orig->type_name.empty()) {
-                auto it = type_context.find(param_orig->type_name);
-                if (it != type_context.end()) {
+            if (!type_context->empty() && !param_orig->type_name.empty()) {
+                auto it = type_context->find(param_orig->type_name);
+                if (it != type_context->end()) {
                     const std::string &resolved_type = it->second;
 
                     // 型情報を更新
@@ -4717,6 +2017,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
             // resolved_type_infoを使ってパラメータを処理
             const auto &param = param_orig;
+            const ParamLayout &param_layout = call_layout.params[i];
 
             // 引数が提供されている場合
             if (i < num_args) {
@@ -4773,7 +2074,12 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
 
                 // 参照パラメータのサポート
-                if (param->is_reference) {
+                // v0.14.0: T&&も変数を渡したときは呼び出し元の変数を指す
+                // （一時値はこれまでどおり値として受け取る）
+                if (param_layout.passing == ParamPassing::REFERENCE &&
+                    (param->is_reference ||
+                     arg->node_type == ASTNodeType::AST_VARIABLE ||
+                     arg->node_type == ASTNodeType::AST_IDENTIFIER)) {
                     // 参照パラメータは変数のみを受け取れる
                     if (arg->node_type != ASTNodeType::AST_VARIABLE &&
                         arg->node_type != ASTNodeType::AST_IDENTIFIER) {
@@ -4826,8 +2132,9 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                     }
 
                     // パラメータスコープに参照変数を登録
-                    interpreter_.current_scope().variables[param->name] =
-                        ref_var;
+                    *interpreter_.current_scope()
+                         .variables.emplace_slot(param_layout.slot, param->name)
+                         .first = std::move(ref_var);
                     continue; // 次のパラメータへ
                 }
 
@@ -4911,8 +2218,10 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                         }
 
                         // パラメータとして登録
-                        interpreter_.current_scope().variables[param->name] =
-                            array_ref;
+                        *interpreter_.current_scope()
+                             .variables
+                             .emplace_slot(param_layout.slot, param->name)
+                             .first = std::move(array_ref);
                     } else if (arg->node_type ==
                                ASTNodeType::AST_ARRAY_LITERAL) {
                         // 配列リテラルとして直接渡された場合
@@ -5067,15 +2376,8 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                                     source_name);
                             };
 
-                        bool param_is_interface = false;
-                        if (param->type_info == TYPE_INTERFACE) {
-                            param_is_interface = true;
-                        } else if (!param->type_name.empty()) {
-                            if (interpreter_.find_interface_definition(
-                                    param->type_name) != nullptr) {
-                                param_is_interface = true;
-                            }
-                        }
+                        bool param_is_interface =
+                            param_layout.passing == ParamPassing::INTERFACE;
 
                         if (param_is_interface) {
                             if (arg->node_type == ASTNodeType::AST_VARIABLE ||
@@ -5547,6 +2849,13 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                             TypedValue arg_value =
                                 evaluate_typed_expression(arg.get());
+                            // v0.14.0: 数値の値渡しは呼び出し先のスロットへ直接
+                            if (param_layout.passing == ParamPassing::VALUE &&
+                                resolved_type_info == param->type_info &&
+                                interpreter_.bind_value_parameter(
+                                    param.get(), param_layout, arg_value)) {
+                                continue;
+                            }
                             interpreter_.assign_function_parameter(
                                 param->name, arg_value, param->type_info,
                                 param->type_name, param->is_unsigned);
@@ -5635,16 +2944,21 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                     evaluate_typed_expression(param->default_value.get());
 
                 // パラメータに設定
-                interpreter_.assign_function_parameter(
-                    param->name, default_val, param->type_info,
-                    param->type_name, param->is_unsigned);
-
-                // const修飾を設定
-                if (param->is_const) {
-                    Variable *param_var =
-                        interpreter_.find_variable(param->name);
-                    if (param_var) {
-                        param_var->is_const = true;
+                if (param_layout.passing != ParamPassing::VALUE ||
+                    resolved_type_info != param->type_info ||
+                    !interpreter_.bind_value_parameter(
+                        param.get(), param_layout, default_val)) {
+                    interpreter_.assign_function_parameter(
+                        param->name, default_val, param->type_info,
+                        param->type_name, param->is_unsigned);
+
+                    // const修飾を設定
+                    if (param->is_const) {
+                        Variable *param_var =
+                            interpreter_.find_variable(param->name);
+                        if (param_var) {
+                            param_var->is_const = true;
+                        }
                     }
                 }
 
@@ -5675,7 +2989,7 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                                                     struct_type);
                     impl_context_active = true;
                     if (debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -5706,9 +3020,24 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                 // Queue<int>のようなジェネリック型のメソッド呼び出し
                 if (receiver_type_name.find('<') != std::string::npos) {
-                    const ImplDefinition *impl_def =
-                        interpreter_.find_impl_for_struct(receiver_type_name,
-                                                          "");
+                    // v0.14.0: 呼び出し箇所のキャッシュが同じ型なら検索を省く
+                    MethodCacheEntry *entry =
+                        method_cache_entry &&
+                                method_cache_entry->receiver_type ==
+                                    receiver_type_name
+                            ? method_cache_entry
+                            : nullptr;
+                    const ImplDefinition *impl_def = nullptr;
+                    if (entry && entry->generic_impl_resolved) {
+                        impl_def = entry->generic_impl;
+                    } else {
+                        impl_def = interpreter_.find_impl_for_struct(
+                            receiver_type_name, "");
+                        if (entry) {
+                            entry->generic_impl = impl_def;
+                            entry->generic_impl_resolved = true;
+                        }
+                    }
 
                     if (impl_def && impl_def->is_generic_instance) {
                         interpreter_.push_type_context(
@@ -5716,7 +3045,8 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                         type_context_pushed = true;
 
                         if (interpreter_.is_debug_mode()) {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(dbg_buf, sizeof(dbg_buf),
                                          "[TYPE_CONTEXT] Pushed for %s::%s",
@@ -5792,12 +3122,13 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 if (is_method_call &&
                     current.variables.find("self") != current.variables.end()) {
                     task.has_self = true;
-                    task.self_value = current.variables["self"];
+                    task.self_value =
+                        std::make_shared<Variable>(current.variables["self"]);
                     if (debug_mode) {
                         std::cerr << "[ASYNC_SELF] Copied self to async task: "
-                                  << "type=" << task.self_value.type
+                                  << "type=" << task.self_value->type
                                   << ", struct_type="
-                                  << task.self_value.struct_type_name
+                                  << task.self_value->struct_type_name
                                   << std::endl;
                     }
                 }
@@ -5832,7 +3163,8 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
 
                 // SimpleEventLoopに登録
                 int task_id =
-                    interpreter_.get_simple_event_loop().register_task(task);
+                    interpreter_.get_simple_event_loop().register_task(
+                        std::move(task));
 
                 // Future.task_id を設定（future_var と internal_future の両方）
                 Variable task_id_field;
@@ -5971,50 +3303,115 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
             throw ret;
         }
 
-        // 関数本体を実行（通常の同期実行）
-        try {
-            if (interpreter_.is_debug_mode()) {
-                {
-                    char dbg_buf[512];
-                    snprintf(dbg_buf, sizeof(dbg_buf),
-                             "[METHOD_EXEC] func->name='%s', body=%p, "
-                             "statements=%zu",
-                             func->name.c_str(), (void *)func->body.get(),
-                             func->body ? func->body->statements.size() : 0);
-                    debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
+        // v0.14.0: return時の後処理（完了レコード/ReturnException共通）
+        bool return_finished = false;
+        auto finish_with_return = [&](const ReturnException &ret) -> int64_t {
+            return_finished = true;
+            // v0.11.0: 型コンテキストをクリア（例外時）
+            if (type_context_pushed) {
+                interpreter_.pop_type_context();
+                if (interpreter_.is_debug_mode()) {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
+                        char dbg_buf[512];
+                        snprintf(
+                            dbg_buf, sizeof(dbg_buf),
+                            "[TYPE_CONTEXT] Popped (exception) after %s::%s",
+                            receiver_type_name.c_str(), node->name.c_str());
+                        debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
+                    }
                 }
             }
-            if (func->body) {
-                interpreter_.execute_statement(func->body.get());
-            } else {
-                if (interpreter_.is_debug_mode()) {
-                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                              "[METHOD_EXEC] Warning: func->body is null!");
+
+            // implコンテキストをクリア
+            if (impl_context_active) {
+                interpreter_.exit_impl_context();
+                impl_context_active = false;
+            }
+
+            // v0.12.0: async関数の場合、ReturnExceptionをFutureに変換
+            // ただし、すでにFutureである場合はスキップ（二重変換を防ぐ）
+            if (is_async) {
+                // async関数でFutureを返している場合、早期に再throwしてスコープpopを回避
+                if (ret.struct_value.struct_type_name == "Future") {
+                    cleanup_method_context();
+                    if (method_scope_active) {
+                        interpreter_.pop_scope();
+                        method_scope_active = false;
+                    }
+                    interpreter_.current_function_name = prev_function_name;
+                    throw ret; // Futureを返して終了
+                }
+
+                // async関数でFuture以外を返している場合、Futureでラップ
+                debug_msg(DebugMsgId::ASYNC_WRAPPING_FUTURE);
+
+                cleanup_method_context();
+                if (method_scope_active) {
+                    interpreter_.pop_scope();
+                    method_scope_active = false;
+                }
+                interpreter_.current_function_name = prev_function_name;
+
+                // Future<T>構造体を作成
+                Variable future_var;
+                future_var.type = TYPE_STRUCT;
+                future_var.is_struct = true;
+                future_var.struct_type_name = "Future";
+                future_var.is_assigned = true;
+
+                // v0.12.0 Phase 1: 即座実行モード（常にis_ready=true）
+                // valueメンバーにreturn値を格納
+                Variable value_member;
+                if (ret.type == TYPE_STRING) {
+                    value_member.type = TYPE_STRING;
+                    value_member.str_value = ret.str_value;
+                } else if (ret.type == TYPE_FLOAT || ret.type == TYPE_DOUBLE ||
+                           ret.type == TYPE_QUAD) {
+                    value_member.type = ret.type;
+                    value_member.double_value = ret.double_value;
+                } else if (ret.is_struct) {
+                    value_member = ret.struct_value;
+                } else {
+                    value_member.type = TYPE_INT;
+                    value_member.value = ret.value;
                 }
-            }
+                value_member.is_assigned = true;
+                future_var.struct_members["value"] = value_member;
 
-            // v0.11.0: 型コンテキストをクリア
-            if (type_context_pushed) {
-                interpreter_.pop_type_context();
-                if (interpreter_.is_debug_mode()) {
-                    {
-                        char dbg_buf[512];
-                        snprintf(dbg_buf, sizeof(dbg_buf),
-                                 "[TYPE_CONTEXT] Popped after %s::%s",
-                                 receiver_type_name.c_str(),
-                                 node->name.c_str());
-                        debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-                    }
+                // is_ready=true（即座実行）
+                Variable ready_member;
+                ready_member.type = TYPE_BOOL;
+                ready_member.value = 1; // true
+                ready_member.is_assigned = true;
+                future_var.struct_members["is_ready"] = ready_member;
+
+                // task_idメンバー（デバッグ用）
+                int task_id = interpreter_.get_async_task_counter();
+                interpreter_.increment_async_task_counter();
+
+                Variable task_id_member;
+                task_id_member.type = TYPE_INT;
+                task_id_member.value = task_id;
+                task_id_member.is_assigned = true;
+                future_var.struct_members["task_id"] = task_id_member;
+
+                // 返却値の表示
+                int64_t display_value = 0;
+                if (ret.type == TYPE_FLOAT || ret.type == TYPE_DOUBLE ||
+                    ret.type == TYPE_QUAD) {
+                    display_value = static_cast<int64_t>(ret.double_value);
+                } else if (!ret.is_struct) {
+                    display_value = ret.value;
                 }
-            }
+                debug_msg(DebugMsgId::ASYNC_FUNCTION_RETURNED, display_value,
+                          static_cast<int>(ret.type));
 
-            // implコンテキストをクリア
-            if (impl_context_active) {
-                interpreter_.exit_impl_context();
-                impl_context_active = false;
+                // Futureを返すReturnExceptionとして投げ直す
+                ReturnException future_ret(future_var);
+                throw future_ret;
             }
 
-            // void関数は0を返す
+            // return文で戻り値がある場合
 
             // メソッド実行後、selfの変更をレシーバーに同期
             if (has_receiver && !receiver_name.empty()) {
@@ -6070,228 +3467,26 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                         receiver_var->value = self_var.value;
                         receiver_var->str_value = self_var.str_value;
                         receiver_var->float_value = self_var.float_value;
-                        receiver_var->double_value = self_var.double_value;
-                        receiver_var->quad_value = self_var.quad_value;
-                        receiver_var->big_value = self_var.big_value;
-                        receiver_var->array_values = self_var.array_values;
-                        receiver_var->array_float_values =
-                            self_var.array_float_values;
-                        receiver_var->array_double_values =
-                            self_var.array_double_values;
-                        receiver_var->array_quad_values =
-                            self_var.array_quad_values;
-                        receiver_var->array_strings = self_var.array_strings;
-                        receiver_var->is_assigned = self_var.is_assigned;
-
-                        if (debug_mode) {
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "SELF_WRITEBACK_FULL: Copied all ");
-                        }
-                    }
-
-                    // すべての self.* 変数を検索して書き戻し
-                    for (const auto &var_pair : current_scope.variables) {
-                        const std::string &var_name = var_pair.first;
-
-                        // self. で始まる変数を検索
-                        if (var_name.find("self.") == 0) {
-                            // self.member または self.member.nested の形式
-                            std::string member_path =
-                                var_name.substr(5); // "self." を除去
-
-                            const Variable &self_member_var = var_pair.second;
-
-                            // If using dereferenced pointer, write directly to
-                            // struct_members
-                            if (used_resolution_ptr &&
-                                dereferenced_struct_ptr) {
-                                // Extract member name (first component of
-                                // member_path)
-                                std::string member_name = member_path;
-                                size_t dot_pos = member_path.find('.');
-                                if (dot_pos != std::string::npos) {
-                                    member_name =
-                                        member_path.substr(0, dot_pos);
-                                }
-
-                                // Write directly to struct_members
-                                if (receiver_var->struct_members.find(
-                                        member_name) !=
-                                    receiver_var->struct_members.end()) {
-                                    receiver_var->struct_members[member_name]
-                                        .value = self_member_var.value;
-                                    receiver_var->struct_members[member_name]
-                                        .str_value = self_member_var.str_value;
-                                    receiver_var->struct_members[member_name]
-                                        .is_assigned =
-                                        self_member_var.is_assigned;
-                                    receiver_var->struct_members[member_name]
-                                        .float_value =
-                                        self_member_var.float_value;
-                                    receiver_var->struct_members[member_name]
-                                        .double_value =
-                                        self_member_var.double_value;
-                                    receiver_var->struct_members[member_name]
-                                        .quad_value =
-                                        self_member_var.quad_value;
-
-                                    // Also sync to individual variable if it
-                                    // exists
-                                    interpreter_
-                                        .sync_individual_member_from_struct(
-                                            receiver_var, member_name);
-
-                                    if (debug_mode) {
-                                        debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                                  "SELF_WRITEBACK_PTR: %s -> ");
-                                    }
-                                }
-                            } else {
-                                // Normal writeback to named variables
-                                std::string receiver_path =
-                                    receiver_name + "." + member_path;
-
-                                // receiver側の対応する変数に値を書き戻し
-                                Variable *receiver_member_var =
-                                    interpreter_.find_variable(receiver_path);
-                                if (receiver_member_var) {
-                                    receiver_member_var->value =
-                                        self_member_var.value;
-                                    receiver_member_var->str_value =
-                                        self_member_var.str_value;
-                                    receiver_member_var->is_assigned =
-                                        self_member_var.is_assigned;
-                                    receiver_member_var->float_value =
-                                        self_member_var.float_value;
-                                    receiver_member_var->double_value =
-                                        self_member_var.double_value;
-                                    receiver_member_var->quad_value =
-                                        self_member_var.quad_value;
-
-                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                              "SELF_WRITEBACK: %s -> %s ");
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
-            // v0.13.1: メソッド内でメソッドを呼んだ場合、parent
-            // scopeのselfも更新する
-            // これにより、vec.push()内でself.reserve()を呼んだ後、push()内のselfが更新される
-            if (has_receiver && !receiver_name.empty()) {
-                auto &scope_stack = interpreter_.get_scope_stack();
-                // 現在のスコープ(呼ばれたメソッドのスコープ)の1つ上を確認
-                if (scope_stack.size() >= 2) {
-                    auto &parent_scope = scope_stack[scope_stack.size() - 2];
-                    // parent
-                    // scopeにselfが存在し、同じreceiverを参照している場合
-                    if (parent_scope.variables.find("self") !=
-                        parent_scope.variables.end()) {
-                        Variable &parent_self = parent_scope.variables["self"];
-                        // receiverと同じstruct_type_nameを持つ場合、更新する
-                        Variable *receiver_var_for_parent = nullptr;
-                        if (used_resolution_ptr && dereferenced_struct_ptr) {
-                            receiver_var_for_parent = dereferenced_struct_ptr;
-                        } else {
-                            receiver_var_for_parent =
-                                interpreter_.find_variable(receiver_name);
-                        }
-
-                        if (receiver_var_for_parent &&
-                            parent_self.struct_type_name ==
-                                receiver_var_for_parent->struct_type_name) {
-                            // parent scopeのselfを更新
-                            parent_self.struct_members =
-                                receiver_var_for_parent->struct_members;
-                            parent_self.value = receiver_var_for_parent->value;
-                            parent_self.str_value =
-                                receiver_var_for_parent->str_value;
-                            parent_self.float_value =
-                                receiver_var_for_parent->float_value;
-                            parent_self.double_value =
-                                receiver_var_for_parent->double_value;
-                            parent_self.quad_value =
-                                receiver_var_for_parent->quad_value;
-                            parent_self.big_value =
-                                receiver_var_for_parent->big_value;
-
-                            // parent scopeのself.member変数も更新
-                            for (const auto &member_pair :
-                                 parent_self.struct_members) {
-                                const std::string &member_name =
-                                    member_pair.first;
-                                const Variable &member_var = member_pair.second;
-                                std::string var_name = "self." + member_name;
-
-                                if (parent_scope.variables.find(var_name) !=
-                                    parent_scope.variables.end()) {
-                                    parent_scope.variables[var_name] =
-                                        member_var;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
-            // 配列参照のコピーバック処理
-            // 関数終了時に、参照変数のデータベクトルを元の配列にコピーバック
-            for (auto &var_pair : interpreter_.current_scope().variables) {
-                Variable &var = var_pair.second;
-                if (var.is_reference && var.is_array) {
-                    // 元の配列へのポインタを取得
-                    Variable *original_array =
-                        reinterpret_cast<Variable *>(var.value);
-                    if (original_array) {
-                        // データベクトルをコピーバック
-                        if (var.is_multidimensional) {
-                            original_array->multidim_array_values =
-                                var.multidim_array_values;
-                            original_array->multidim_array_float_values =
-                                var.multidim_array_float_values;
-                            original_array->multidim_array_double_values =
-                                var.multidim_array_double_values;
-                            original_array->multidim_array_quad_values =
-                                var.multidim_array_quad_values;
-                            original_array->multidim_array_strings =
-                                var.multidim_array_strings;
-                        } else {
-                            original_array->array_values = var.array_values;
-                            original_array->array_float_values =
-                                var.array_float_values;
-                            original_array->array_double_values =
-                                var.array_double_values;
-                            original_array->array_quad_values =
-                                var.array_quad_values;
-                            original_array->array_strings = var.array_strings;
-                        }
-                    }
-                }
-            }
-
-            // メソッド通常終了時も、selfの変更をレシーバーに同期
-            if (has_receiver && !receiver_name.empty()) {
-                Variable *receiver_var = nullptr;
+                        receiver_var->double_value = self_var.double_value;
+                        receiver_var->quad_value = self_var.quad_value;
+                        receiver_var->big_value = self_var.big_value;
+                        receiver_var->array_values = self_var.array_values;
+                        receiver_var->array_float_values =
+                            self_var.array_float_values;
+                        receiver_var->array_double_values =
+                            self_var.array_double_values;
+                        receiver_var->array_quad_values =
+                            self_var.array_quad_values;
+                        receiver_var->array_strings = self_var.array_strings;
+                        receiver_var->is_assigned = self_var.is_assigned;
 
-                // If we used pointer dereference, write back to the
-                // dereferenced struct
-                if (used_resolution_ptr && dereferenced_struct_ptr) {
-                    receiver_var = dereferenced_struct_ptr;
-                    if (debug_mode) {
-                        debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                  "SELF_WRITEBACK_PTR: Using dereferenced "
-                                  "struct at ");
+                        if (debug_mode) {
+                            debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                      "SELF_WRITEBACK_FULL: Copied all ");
+                        }
                     }
-                } else {
-                    receiver_var = interpreter_.find_variable(receiver_name);
-                }
 
-                if (receiver_var && (receiver_var->type == TYPE_STRUCT ||
-                                     receiver_var->type == TYPE_INTERFACE)) {
                     // すべての self.* 変数を検索して書き戻し
-                    auto &current_scope = interpreter_.get_current_scope();
                     for (const auto &var_pair : current_scope.variables) {
                         const std::string &var_name = var_pair.first;
 
@@ -6379,117 +3574,177 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
             }
 
+            // 配列参照のコピーバック処理
+            for (auto &var_pair : interpreter_.current_scope().variables) {
+                Variable &var = var_pair.second;
+                if (var.is_reference && var.is_array) {
+                    Variable *original_array =
+                        reinterpret_cast<Variable *>(var.value);
+                    if (original_array) {
+                        if (var.is_multidimensional) {
+                            original_array->multidim_array_values =
+                                var.multidim_array_values;
+                            original_array->multidim_array_float_values =
+                                var.multidim_array_float_values;
+                            original_array->multidim_array_double_values =
+                                var.multidim_array_double_values;
+                            original_array->multidim_array_quad_values =
+                                var.multidim_array_quad_values;
+                            original_array->multidim_array_strings =
+                                var.multidim_array_strings;
+                        } else {
+                            original_array->array_values = var.array_values;
+                            original_array->array_float_values =
+                                var.array_float_values;
+                            original_array->array_double_values =
+                                var.array_double_values;
+                            original_array->array_quad_values =
+                                var.array_quad_values;
+                            original_array->array_strings = var.array_strings;
+                        }
+                    }
+                }
+            }
+
             cleanup_method_context();
             interpreter_.pop_scope();
             method_scope_active = false;
             interpreter_.current_function_name = prev_function_name;
-            return 0;
-        } catch (const ReturnException &ret) {
-            // v0.11.0: 型コンテキストをクリア（例外時）
-            if (type_context_pushed) {
-                interpreter_.pop_type_context();
-                if (interpreter_.is_debug_mode()) {
-                    {
-                        char dbg_buf[512];
-                        snprintf(
-                            dbg_buf, sizeof(dbg_buf),
-                            "[TYPE_CONTEXT] Popped (exception) after %s::%s",
-                            receiver_type_name.c_str(), node->name.c_str());
-                        debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-                    }
-                }
-            }
 
-            // implコンテキストをクリア
-            if (impl_context_active) {
-                interpreter_.exit_impl_context();
-                impl_context_active = false;
+            // 関数ポインタ戻り値の場合は例外を再度投げる
+            if (ret.is_function_pointer) {
+                throw ret;
             }
 
-            // v0.12.0: async関数の場合、ReturnExceptionをFutureに変換
-            // ただし、すでにFutureである場合はスキップ（二重変換を防ぐ）
-            if (is_async) {
-                // async関数でFutureを返している場合、早期に再throwしてスコープpopを回避
-                if (ret.struct_value.struct_type_name == "Future") {
-                    cleanup_method_context();
-                    if (method_scope_active) {
-                        interpreter_.pop_scope();
-                        method_scope_active = false;
-                    }
-                    interpreter_.current_function_name = prev_function_name;
-                    throw ret; // Futureを返して終了
+            if (ret.is_struct) {
+                // struct戻り値の場合、構造体を一時的に処理して戻り値として使用
+                debug_msg(DebugMsgId::INTERPRETER_GET_STRUCT_MEMBER,
+                          "Processing struct return value");
+                // 構造体戻り値は0を返す（実際の構造体はReturnExceptionで管理）
+                throw ret; // 上位レベルでstruct処理が必要な場合は例外を伝播
+            } else if (ret.is_array) {
+                // 配列戻り値の場合は例外を再度投げる
+                throw ret;
+            }
+            // 文字列戻り値の場合は例外を再度投げる
+            if (TypeHelpers::isString(ret.type)) {
+                throw ret;
+            }
+            // float/double/quad戻り値の場合は例外を再度投げる
+            // (evaluate_expressionはint64_tしか返せないため、上位でTypedValueとして処理する必要がある)
+            if (TypeHelpers::isFloating(ret.type) || ret.type == TYPE_QUAD) {
+                throw ret;
+            }
+            // 参照戻り値の場合は例外を再度投げる
+            if (ret.is_reference) {
+                throw ret;
+            }
+            // 通常の戻り値の場合
+            auto make_typed_from_return =
+                [&](int64_t coerced_numeric) -> TypedValue {
+                if (ret.type == TYPE_FLOAT) {
+                    return TypedValue(ret.double_value,
+                                      InferredType(TYPE_FLOAT, "float"));
                 }
-
-                // async関数でFuture以外を返している場合、Futureでラップ
-                debug_msg(DebugMsgId::ASYNC_WRAPPING_FUTURE);
-
-                cleanup_method_context();
-                if (method_scope_active) {
-                    interpreter_.pop_scope();
-                    method_scope_active = false;
+                if (ret.type == TYPE_DOUBLE) {
+                    return TypedValue(ret.double_value,
+                                      InferredType(TYPE_DOUBLE, "double"));
                 }
-                interpreter_.current_function_name = prev_function_name;
-
-                // Future<T>構造体を作成
-                Variable future_var;
-                future_var.type = TYPE_STRUCT;
-                future_var.is_struct = true;
-                future_var.struct_type_name = "Future";
-                future_var.is_assigned = true;
-
-                // v0.12.0 Phase 1: 即座実行モード（常にis_ready=true）
-                // valueメンバーにreturn値を格納
-                Variable value_member;
-                if (ret.type == TYPE_STRING) {
-                    value_member.type = TYPE_STRING;
-                    value_member.str_value = ret.str_value;
-                } else if (ret.type == TYPE_FLOAT || ret.type == TYPE_DOUBLE ||
-                           ret.type == TYPE_QUAD) {
-                    value_member.type = ret.type;
-                    value_member.double_value = ret.double_value;
-                } else if (ret.is_struct) {
-                    value_member = ret.struct_value;
-                } else {
-                    value_member.type = TYPE_INT;
-                    value_member.value = ret.value;
+                if (ret.type == TYPE_QUAD) {
+                    return TypedValue(ret.quad_value,
+                                      InferredType(TYPE_QUAD, "quad"));
                 }
-                value_member.is_assigned = true;
-                future_var.struct_members["value"] = value_member;
+                TypeInfo resolved =
+                    ret.type != TYPE_UNKNOWN ? ret.type : TYPE_INT;
+                std::string resolved_name =
+                    std::string(::type_info_to_string(resolved));
+                if (resolved_name.empty()) {
+                    resolved = TYPE_INT;
+                    resolved_name =
+                        std::string(::type_info_to_string(resolved));
+                }
+                return TypedValue(coerced_numeric,
+                                  InferredType(resolved, resolved_name));
+            };
 
-                // is_ready=true（即座実行）
-                Variable ready_member;
-                ready_member.type = TYPE_BOOL;
-                ready_member.value = 1; // true
-                ready_member.is_assigned = true;
-                future_var.struct_members["is_ready"] = ready_member;
+            int64_t return_value = ret.value;
+            if (func && func->is_unsigned && return_value < 0) {
+                const char *call_kind = is_method_call ? "method" : "function";
+                // DEBUG_WARN(FUNCTION, "Unsigned %s '%s' returned negative
+                // value (%lld); clamping to 0", ...);
+                if (debug_mode) {
+                    std::cerr << "WARNING: Unsigned " << call_kind << " '"
+                              << func->name << "' returned negative value ("
+                              << return_value << "); clamping to 0"
+                              << std::endl;
+                }
+                return_value = 0;
+            }
+            TypedValue typed_return = make_typed_from_return(return_value);
+            capture_numeric_return(typed_return);
 
-                // task_idメンバー（デバッグ用）
-                int task_id = interpreter_.get_async_task_counter();
-                interpreter_.increment_async_task_counter();
+            // v0.12.0:
+            // async関数は早期リターン済み（関数呼び出し開始時にFutureを返す）
+            // ここには到達しないはず
 
-                Variable task_id_member;
-                task_id_member.type = TYPE_INT;
-                task_id_member.value = task_id;
-                task_id_member.is_assigned = true;
-                future_var.struct_members["task_id"] = task_id_member;
+            return return_value;
+        };
 
-                // 返却値の表示
-                int64_t display_value = 0;
-                if (ret.type == TYPE_FLOAT || ret.type == TYPE_DOUBLE ||
-                    ret.type == TYPE_QUAD) {
-                    display_value = static_cast<int64_t>(ret.double_value);
-                } else if (!ret.is_struct) {
-                    display_value = ret.value;
+        // 関数本体を実行（通常の同期実行）
+        try {
+            if (interpreter_.is_debug_mode()) {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
+                    char dbg_buf[512];
+                    snprintf(dbg_buf, sizeof(dbg_buf),
+                             "[METHOD_EXEC] func->name='%s', body=%p, "
+                             "statements=%zu",
+                             func->name.c_str(), (void *)func->body.get(),
+                             func->body ? func->body->statements.size() : 0);
+                    debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
-                debug_msg(DebugMsgId::ASYNC_FUNCTION_RETURNED, display_value,
-                          static_cast<int>(ret.type));
+            }
+            if (func->body) {
+                // v0.14.0: 本体のreturnは完了レコードで受け取る
+                auto return_frame = interpreter_.enter_return_frame();
+                interpreter_.execute_statement(func->body.get());
+            } else {
+                if (interpreter_.is_debug_mode()) {
+                    debug_msg(DebugMsgId::GENERIC_DEBUG,
+                              "[METHOD_EXEC] Warning: func->body is null!");
+                }
+            }
+            // スカラーの戻り値はヒープ確保なしでValueから受け取る
+            Value scalar_return;
+            if (interpreter_.take_return_value(scalar_return)) {
+                return finish_with_return(
+                    scalar_return.to_return_exception());
+            }
+            if (auto completed = interpreter_.take_return_completion()) {
+                return finish_with_return(*completed);
+            }
 
-                // Futureを返すReturnExceptionとして投げ直す
-                ReturnException future_ret(future_var);
-                throw future_ret;
+            // v0.11.0: 型コンテキストをクリア
+            if (type_context_pushed) {
+                interpreter_.pop_type_context();
+                if (interpreter_.is_debug_mode()) {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
+                        char dbg_buf[512];
+                        snprintf(dbg_buf, sizeof(dbg_buf),
+                                 "[TYPE_CONTEXT] Popped after %s::%s",
+                                 receiver_type_name.c_str(),
+                                 node->name.c_str());
+                        debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
+                    }
+                }
             }
 
-            // return文で戻り値がある場合
+            // implコンテキストをクリア
+            if (impl_context_active) {
+                interpreter_.exit_impl_context();
+                impl_context_active = false;
+            }
+
+            // void関数は0を返す
 
             // メソッド実行後、selfの変更をレシーバーに同期
             if (has_receiver && !receiver_name.empty()) {
@@ -6652,13 +3907,75 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
             }
 
+            // v0.13.1: メソッド内でメソッドを呼んだ場合、parent
+            // scopeのselfも更新する
+            // これにより、vec.push()内でself.reserve()を呼んだ後、push()内のselfが更新される
+            if (has_receiver && !receiver_name.empty()) {
+                auto &scope_stack = interpreter_.get_scope_stack();
+                // 現在のスコープ(呼ばれたメソッドのスコープ)の1つ上を確認
+                if (scope_stack.size() >= 2) {
+                    auto &parent_scope = scope_stack[scope_stack.size() - 2];
+                    // parent
+                    // scopeにselfが存在し、同じreceiverを参照している場合
+                    if (parent_scope.variables.find("self") !=
+                        parent_scope.variables.end()) {
+                        Variable &parent_self = parent_scope.variables["self"];
+                        // receiverと同じstruct_type_nameを持つ場合、更新する
+                        Variable *receiver_var_for_parent = nullptr;
+                        if (used_resolution_ptr && dereferenced_struct_ptr) {
+                            receiver_var_for_parent = dereferenced_struct_ptr;
+                        } else {
+                            receiver_var_for_parent =
+                                interpreter_.find_variable(receiver_name);
+                        }
+
+                        if (receiver_var_for_parent &&
+                            parent_self.struct_type_name ==
+                                receiver_var_for_parent->struct_type_name) {
+                            // parent scopeのselfを更新
+                            parent_self.struct_members =
+                                receiver_var_for_parent->struct_members;
+                            parent_self.value = receiver_var_for_parent->value;
+                            parent_self.str_value =
+                                receiver_var_for_parent->str_value;
+                            parent_self.float_value =
+                                receiver_var_for_parent->float_value;
+                            parent_self.double_value =
+                                receiver_var_for_parent->double_value;
+                            parent_self.quad_value =
+                                receiver_var_for_parent->quad_value;
+                            parent_self.big_value =
+                                receiver_var_for_parent->big_value;
+
+                            // parent scopeのself.member変数も更新
+                            for (const auto &member_pair :
+                                 parent_self.struct_members) {
+                                const std::string &member_name =
+                                    member_pair.first;
+                                const Variable &member_var = member_pair.second;
+                                std::string var_name = "self." + member_name;
+
+                                if (parent_scope.variables.find(var_name) !=
+                                    parent_scope.variables.end()) {
+                                    parent_scope.variables[var_name] =
+                                        member_var;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             // 配列参照のコピーバック処理
+            // 関数終了時に、参照変数のデータベクトルを元の配列にコピーバック
             for (auto &var_pair : interpreter_.current_scope().variables) {
                 Variable &var = var_pair.second;
                 if (var.is_reference && var.is_array) {
+                    // 元の配列へのポインタを取得
                     Variable *original_array =
                         reinterpret_cast<Variable *>(var.value);
                     if (original_array) {
+                        // データベクトルをコピーバック
                         if (var.is_multidimensional) {
                             original_array->multidim_array_values =
                                 var.multidim_array_values;
@@ -6684,88 +4001,125 @@ int64_t ExpressionEvaluator::evaluate_function_call_impl(const ASTNode *node) {
                 }
             }
 
-            cleanup_method_context();
-            interpreter_.pop_scope();
-            method_scope_active = false;
-            interpreter_.current_function_name = prev_function_name;
-
-            // 関数ポインタ戻り値の場合は例外を再度投げる
-            if (ret.is_function_pointer) {
-                throw ret;
-            }
+            // メソッド通常終了時も、selfの変更をレシーバーに同期
+            if (has_receiver && !receiver_name.empty()) {
+                Variable *receiver_var = nullptr;
 
-            if (ret.is_struct) {
-                // struct戻り値の場合、構造体を一時的に処理して戻り値として使用
-                debug_msg(DebugMsgId::INTERPRETER_GET_STRUCT_MEMBER,
-                          "Processing struct return value");
-                // 構造体戻り値は0を返す（実際の構造体はReturnExceptionで管理）
-                throw ret; // 上位レベルでstruct処理が必要な場合は例外を伝播
-            } else if (ret.is_array) {
-                // 配列戻り値の場合は例外を再度投げる
-                throw ret;
-            }
-            // 文字列戻り値の場合は例外を再度投げる
-            if (TypeHelpers::isString(ret.type)) {
-                throw ret;
-            }
-            // float/double/quad戻り値の場合は例外を再度投げる
-            // (evaluate_expressionはint64_tしか返せないため、上位でTypedValueとして処理する必要がある)
-            if (TypeHelpers::isFloating(ret.type) || ret.type == TYPE_QUAD) {
-                throw ret;
-            }
-            // 参照戻り値の場合は例外を再度投げる
-            if (ret.is_reference) {
-                throw ret;
-            }
-            // 通常の戻り値の場合
-            auto make_typed_from_return =
-                [&](int64_t coerced_numeric) -> TypedValue {
-                if (ret.type == TYPE_FLOAT) {
-                    return TypedValue(ret.double_value,
-                                      InferredType(TYPE_FLOAT, "float"));
-                }
-                if (ret.type == TYPE_DOUBLE) {
-                    return TypedValue(ret.double_value,
-                                      InferredType(TYPE_DOUBLE, "double"));
-                }
-                if (ret.type == TYPE_QUAD) {
-                    return TypedValue(ret.quad_value,
-                                      InferredType(TYPE_QUAD, "quad"));
-                }
-                TypeInfo resolved =
-                    ret.type != TYPE_UNKNOWN ? ret.type : TYPE_INT;
-                std::string resolved_name =
-                    std::string(::type_info_to_string(resolved));
-                if (resolved_name.empty()) {
-                    resolved = TYPE_INT;
-                    resolved_name =
-                        std::string(::type_info_to_string(resolved));
+                // If we used pointer dereference, write back to the
+                // dereferenced struct
+                if (used_resolution_ptr && dereferenced_struct_ptr) {
+                    receiver_var = dereferenced_struct_ptr;
+                    if (debug_mode) {
+                        debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                  "SELF_WRITEBACK_PTR: Using dereferenced "
+                                  "struct at ");
+                    }
+                } else {
+                    receiver_var = interpreter_.find_variable(receiver_name);
                 }
-                return TypedValue(coerced_numeric,
-                                  InferredType(resolved, resolved_name));
-            };
 
-            int64_t return_value = ret.value;
-            if (func && func->is_unsigned && return_value < 0) {
-                const char *call_kind = is_method_call ? "method" : "function";
-                // DEBUG_WARN(FUNCTION, "Unsigned %s '%s' returned negative
-                // value (%lld); clamping to 0", ...);
-                if (debug_mode) {
-                    std::cerr << "WARNING: Unsigned " << call_kind << " '"
-                              << func->name << "' returned negative value ("
-                              << return_value << "); clamping to 0"
-                              << std::endl;
+                if (receiver_var && (receiver_var->type == TYPE_STRUCT ||
+                                     receiver_var->type == TYPE_INTERFACE)) {
+                    // すべての self.* 変数を検索して書き戻し
+                    auto &current_scope = interpreter_.get_current_scope();
+                    for (const auto &var_pair : current_scope.variables) {
+                        const std::string &var_name = var_pair.first;
+
+                        // self. で始まる変数を検索
+                        if (var_name.find("self.") == 0) {
+                            // self.member または self.member.nested の形式
+                            std::string member_path =
+                                var_name.substr(5); // "self." を除去
+
+                            const Variable &self_member_var = var_pair.second;
+
+                            // If using dereferenced pointer, write directly to
+                            // struct_members
+                            if (used_resolution_ptr &&
+                                dereferenced_struct_ptr) {
+                                // Extract member name (first component of
+                                // member_path)
+                                std::string member_name = member_path;
+                                size_t dot_pos = member_path.find('.');
+                                if (dot_pos != std::string::npos) {
+                                    member_name =
+                                        member_path.substr(0, dot_pos);
+                                }
+
+                                // Write directly to struct_members
+                                if (receiver_var->struct_members.find(
+                                        member_name) !=
+                                    receiver_var->struct_members.end()) {
+                                    receiver_var->struct_members[member_name]
+                                        .value = self_member_var.value;
+                                    receiver_var->struct_members[member_name]
+                                        .str_value = self_member_var.str_value;
+                                    receiver_var->struct_members[member_name]
+                                        .is_assigned =
+                                        self_member_var.is_assigned;
+                                    receiver_var->struct_members[member_name]
+                                        .float_value =
+                                        self_member_var.float_value;
+                                    receiver_var->struct_members[member_name]
+                                        .double_value =
+                                        self_member_var.double_value;
+                                    receiver_var->struct_members[member_name]
+                                        .quad_value =
+                                        self_member_var.quad_value;
+
+                                    // Also sync to individual variable if it
+                                    // exists
+                                    interpreter_
+                                        .sync_individual_member_from_struct(
+                                            receiver_var, member_name);
+
+                                    if (debug_mode) {
+                                        debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                                  "SELF_WRITEBACK_PTR: %s -> ");
+                                    }
+                                }
+                            } else {
+                                // Normal writeback to named variables
+                                std::string receiver_path =
+                                    receiver_name + "." + member_path;
+
+                                // receiver側の対応する変数に値を書き戻し
+                                Variable *receiver_member_var =
+                                    interpreter_.find_variable(receiver_path);
+                                if (receiver_member_var) {
+                                    receiver_member_var->value =
+                                        self_member_var.value;
+                                    receiver_member_var->str_value =
+                                        self_member_var.str_value;
+                                    receiver_member_var->is_assigned =
+                                        self_member_var.is_assigned;
+                                    receiver_member_var->float_value =
+                                        self_member_var.float_value;
+                                    receiver_member_var->double_value =
+                                        self_member_var.double_value;
+                                    receiver_member_var->quad_value =
+                                        self_member_var.quad_value;
+
+                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                              "SELF_WRITEBACK: %s -> %s ");
+                                }
+                            }
+                        }
+                    }
                 }
-                return_value = 0;
             }
-            TypedValue typed_return = make_typed_from_return(return_value);
-            capture_numeric_return(typed_return);
-
-            // v0.12.0:
-            // async関数は早期リターン済み（関数呼び出し開始時にFutureを返す）
-            // ここには到達しないはず
 
-            return return_value;
+            cleanup_method_context();
+            interpreter_.pop_scope();
+            method_scope_active = false;
+            interpreter_.current_function_name = prev_function_name;
+            return 0;
+        } catch (const ReturnException &ret) {
+            // finish_with_return内から再送出された戻り値は外側で処理する
+            if (return_finished) {
+                throw;
+            }
+            return finish_with_return(ret);
         }
     } catch (const ReturnException &ret) {
         // implコンテキストをクリア
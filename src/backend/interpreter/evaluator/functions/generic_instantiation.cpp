@@ -13,10 +13,8 @@
 
 namespace GenericInstantiation {
 
-// v0.11.0: インスタンス化キャッシュ（グローバル）
-// キー: "function_name<type1,type2,...>"
-// 値: インスタンス化されたASTノード
-static std::map<std::string, std::unique_ptr<ASTNode>> instantiation_cache;
+// v0.14.0: InstanceCacheの世代番号（0は「未記録」として予約）
+static uint64_t next_cache_generation = 1;
 
 // 正規化されたジェネリック型名を置換（例: "Box_T" + {"T"->"int"} -> "Box_int"）
 static std::string substitute_normalized_generic_type(
@@ -182,37 +180,44 @@ static std::string substitute_generic_type_name(
     return result;
 }
 
-// キャッシュキーを生成
-std::string generate_cache_key(const std::string &function_name,
-                               const std::vector<std::string> &type_arguments) {
-    std::string key = function_name + "<";
-    for (size_t i = 0; i < type_arguments.size(); ++i) {
-        if (i > 0) {
-            key += ",";
-        }
-        key += type_arguments[i];
+InstanceCache::InstanceCache() : generation_(next_cache_generation++) {}
+
+const ASTNode *InstanceCache::get_or_instantiate(
+    const ASTNode *func, const std::vector<std::string> &type_arguments) {
+    InstanceKey key(func, type_arguments);
+    auto it = instances_.find(key);
+    if (it != instances_.end()) {
+        return it->second.get();
     }
-    key += ">";
-    return key;
+    std::unique_ptr<ASTNode> instance =
+        instantiate_generic_function(func, type_arguments);
+    const ASTNode *result = instance.get();
+    instances_.emplace(std::move(key), std::move(instance));
+    return result;
 }
 
-// キャッシュからインスタンスを取得
-const ASTNode *get_cached_instance(const std::string &cache_key) {
-    auto it = instantiation_cache.find(cache_key);
-    if (it != instantiation_cache.end()) {
-        return it->second.get();
+const ASTNode *InstanceCache::call_site_instance(const ASTNode *call,
+                                                 const ASTNode *func) const {
+    if (call->generic_cache_generation != generation_ ||
+        call->generic_source != func) {
+        return nullptr;
     }
-    return nullptr;
+    return call->generic_instance;
 }
 
-// インスタンスをキャッシュに保存
-void cache_instance(const std::string &cache_key,
-                    std::unique_ptr<ASTNode> instance) {
-    instantiation_cache[cache_key] = std::move(instance);
+void InstanceCache::remember_call_site(const ASTNode *call,
+                                       const ASTNode *func,
+                                       const ASTNode *instance) const {
+    call->generic_cache_generation = generation_;
+    call->generic_source = func;
+    call->generic_instance = instance;
 }
 
-// キャッシュをクリア
-void clear_cache() { instantiation_cache.clear(); }
+void InstanceCache::clear_cache() {
+    // 呼び出し箇所の記録（ASTノード側）は書き換えず、世代を進めて無効にする
+    instances_.clear();
+    generation_ = next_cache_generation++;
+}
 
 // ASTノードを深くコピー
 std::unique_ptr<ASTNode> clone_ast_node(const ASTNode *node) {
@@ -233,6 +238,7 @@ std::unique_ptr<ASTNode> clone_ast_node(const ASTNode *node) {
     // 基本フィールドをコピー
     cloned->name = node->name;
     cloned->op = node->op;
+    cloned->op_kind = node->op_kind;
     cloned->int_value = node->int_value;
     cloned->double_value = node->double_value;
     cloned->str_value = node->str_value;
@@ -584,7 +590,7 @@ instantiate_generic_impl(const ASTNode *impl_node,
     std::map<std::string, std::string> type_map;
     for (size_t i = 0; i < type_parameters.size(); ++i) {
         type_map[type_parameters[i]] = type_arguments[i];
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[INSTANTIATE_IMPL] Type mapping: %s -> %s",
@@ -599,7 +605,7 @@ instantiate_generic_impl(const ASTNode *impl_node,
     std::string instantiated_struct =
         substitute_generic_type_name(struct_name, type_map);
 
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[INSTANTIATE_IMPL] Instantiated: %s for %s (no clone)",
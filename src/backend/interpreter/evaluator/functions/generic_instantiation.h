@@ -2,6 +2,7 @@
 #define GENERIC_INSTANTIATION_H
 
 #include "../../../../common/ast.h"
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -15,7 +16,7 @@ namespace GenericInstantiation {
 // 機能:
 // - ASTノードの深いコピー（すべてのフィールドを保持）
 // - 型パラメータの置換（type_name, type_info, pointer_base_type等）
-// - インスタンス化のキャッシュ（パフォーマンス最適化）
+// - インスタンス化のキャッシュ（(関数, 型引数)ごとにInterpreterが保持）
 //
 // 依存関係:
 // - common/ast.h: ASTNode構造体、TypeInfo列挙型
@@ -55,20 +56,41 @@ std::unique_ptr<ASTNode>
 instantiate_generic_function(const ASTNode *func,
                              const std::vector<std::string> &type_arguments);
 
-// v0.11.0: インスタンス化キャッシュ（パフォーマンス最適化）
-// キャッシュキーを生成: "function_name<type1,type2,...>"
-std::string generate_cache_key(const std::string &function_name,
-                               const std::vector<std::string> &type_arguments);
+// v0.14.0: インスタンス化キャッシュ
+// (ジェネリック関数, 型引数リスト)ごとにインスタンスを保持し、2回目以降は
+// 同じインスタンスを返す（呼び出しのたびに複製しない）。Interpreterが
+// 1つ所有し、インスタンスの寿命はキャッシュ（Interpreter）と同じ
+class InstanceCache {
+  public:
+    InstanceCache();
 
-// キャッシュからインスタンスを取得（存在しない場合はnullptr）
-const ASTNode *get_cached_instance(const std::string &cache_key);
+    // 戻り値のポインタはclear_cache()かキャッシュの破棄まで有効
+    const ASTNode *
+    get_or_instantiate(const ASTNode *func,
+                       const std::vector<std::string> &type_arguments);
 
-// インスタンスをキャッシュに保存
-void cache_instance(const std::string &cache_key,
-                    std::unique_ptr<ASTNode> instance);
+    // 呼び出し箇所callが直前に使ったインスタンス（funcと一致しない、
+    // または別のキャッシュ・clear_cache()前のものならnullptr）
+    const ASTNode *call_site_instance(const ASTNode *call,
+                                      const ASTNode *func) const;
+    // callがfuncのinstanceを使ったことを覚える
+    void remember_call_site(const ASTNode *call, const ASTNode *func,
+                            const ASTNode *instance) const;
 
-// キャッシュをクリア（テスト用）
-void clear_cache();
+    // キャッシュしているインスタンスの数
+    size_t size() const { return instances_.size(); }
+
+    // すべてのインスタンスを破棄する（呼び出し箇所の記録も無効になる）
+    void clear_cache();
+
+  private:
+    using InstanceKey = std::pair<const ASTNode *, std::vector<std::string>>;
+
+    std::map<InstanceKey, std::unique_ptr<ASTNode>> instances_;
+    // 呼び出し箇所の記録がこのキャッシュの現在の内容を指すかの識別子
+    // （キャッシュごと・clear_cache()ごとに一意）
+    uint64_t generation_;
+};
 
 // v0.12.0: implブロックのインスタンス化
 // impl VectorOps<T> for Vector<T>のような汎用implブロックを
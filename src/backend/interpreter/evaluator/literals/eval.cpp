@@ -105,7 +105,7 @@ TypedValue evaluate_variable_typed(const ASTNode *node,
                                    Interpreter &interpreter,
                                    const InferredType &inferred_type) {
     // 変数参照の場合、変数の型に応じて適切なTypedValueを返す
-    Variable *var = interpreter.find_variable(node->name);
+    Variable *var = interpreter.find_variable(node);
     if (!var) {
         std::string error_message = (debug_language == DebugLanguage::JAPANESE)
                                         ? "未定義の変数です: " + node->name
@@ -239,7 +239,7 @@ int64_t evaluate_identifier(const ASTNode *node, Interpreter &interpreter) {
     }
 
     // 通常の識別子として処理
-    Variable *var = interpreter.find_variable(node->name);
+    Variable *var = interpreter.find_variable(node);
     if (!var) {
         debug_msg(DebugMsgId::EXPR_EVAL_VAR_NOT_FOUND, node->name.c_str());
         std::string error_message = (debug_language == DebugLanguage::JAPANESE)
@@ -294,7 +294,7 @@ int64_t evaluate_variable(const ASTNode *node, Interpreter &interpreter) {
         }
     }
 
-    Variable *var = interpreter.find_variable(node->name);
+    Variable *var = interpreter.find_variable(node);
     if (!var) {
         debug_msg(DebugMsgId::EXPR_EVAL_VAR_NOT_FOUND, node->name.c_str());
         std::string error_message = (debug_language == DebugLanguage::JAPANESE)
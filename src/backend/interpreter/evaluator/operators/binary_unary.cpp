@@ -59,15 +59,248 @@ static InferredType ensure_type(const InferredType &inferred, TypeInfo type,
     return InferredType(type, name);
 }
 
+// ============================================================================
+// v0.14.0: 比較演算の高速パス
+// ============================================================================
+
+// 高速パスで扱える単純な変数を取得（参照・ポインタ・配列等は対象外）
+static const Variable *find_plain_variable(const ASTNode *node,
+                                           Interpreter &interpreter) {
+    if (node->node_type != ASTNodeType::AST_VARIABLE &&
+        node->node_type != ASTNodeType::AST_IDENTIFIER) {
+        return nullptr;
+    }
+    const Variable *var = interpreter.find_variable(node);
+    if (!var || var->is_reference || var->is_pointer || var->is_array ||
+        var->is_function_pointer || var->is_enum) {
+        return nullptr;
+    }
+    return var;
+}
+
+static bool is_fast_integral_type(TypeInfo type) {
+    switch (type) {
+    case TYPE_BOOL:
+    case TYPE_CHAR:
+    case TYPE_TINY:
+    case TYPE_SHORT:
+    case TYPE_INT:
+    case TYPE_LONG:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// 整数オペランドの読み取り（リテラル、整数変数、それらの加減乗算）
+static bool read_int_operand(const ASTNode *node, Interpreter &interpreter,
+                             int64_t &out) {
+    switch (node->node_type) {
+    case ASTNodeType::AST_NUMBER:
+        if (node->is_float_literal) {
+            return false;
+        }
+        out = node->int_value;
+        return true;
+    case ASTNodeType::AST_VARIABLE:
+    case ASTNodeType::AST_IDENTIFIER: {
+        const Variable *var = find_plain_variable(node, interpreter);
+        if (!var || !is_fast_integral_type(var->type)) {
+            return false;
+        }
+        out = var->value;
+        return true;
+    }
+    case ASTNodeType::AST_BINARY_OP: {
+        OperatorKind kind = node->operator_kind();
+        if (kind != OperatorKind::ADD && kind != OperatorKind::SUB &&
+            kind != OperatorKind::MUL) {
+            return false;
+        }
+        int64_t left = 0;
+        int64_t right = 0;
+        if (!read_int_operand(node->left.get(), interpreter, left) ||
+            !read_int_operand(node->right.get(), interpreter, right)) {
+            return false;
+        }
+        // 64ビットで溢れる場合は通常の評価に任せる（符号付き演算の溢れは未定義動作）
+        bool overflow = kind == OperatorKind::ADD
+                            ? __builtin_add_overflow(left, right, &out)
+                        : kind == OperatorKind::SUB
+                            ? __builtin_sub_overflow(left, right, &out)
+                            : __builtin_mul_overflow(left, right, &out);
+        return !overflow;
+    }
+    default:
+        return false;
+    }
+}
+
+// 浮動小数点オペランドの読み取り（double/floatのリテラルと変数）
+static bool read_double_operand(const ASTNode *node, Interpreter &interpreter,
+                                double &out) {
+    if (node->node_type == ASTNodeType::AST_NUMBER) {
+        if (!node->is_float_literal || node->literal_type == TYPE_QUAD) {
+            return false;
+        }
+        out = node->double_value;
+        return true;
+    }
+    const Variable *var = find_plain_variable(node, interpreter);
+    if (!var) {
+        return false;
+    }
+    if (var->type == TYPE_DOUBLE) {
+        out = var->double_value;
+        return true;
+    }
+    if (var->type == TYPE_FLOAT) {
+        out = static_cast<double>(var->float_value);
+        return true;
+    }
+    return false;
+}
+
+// 文字列オペランドの読み取り（文字列リテラルとstring変数）
+static const std::string *read_string_operand(const ASTNode *node,
+                                              Interpreter &interpreter) {
+    if (node->node_type == ASTNodeType::AST_STRING_LITERAL) {
+        return &node->str_value;
+    }
+    const Variable *var = find_plain_variable(node, interpreter);
+    if (!var || var->type != TYPE_STRING ||
+        (var->str_value.empty() && var->value != 0)) {
+        return nullptr;
+    }
+    return &var->str_value;
+}
+
+template <typename T>
+static int64_t compare_values(OperatorKind kind, const T &left,
+                              const T &right) {
+    switch (kind) {
+    case OperatorKind::EQ:
+        return left == right ? 1 : 0;
+    case OperatorKind::NE:
+        return left != right ? 1 : 0;
+    case OperatorKind::LT:
+        return left < right ? 1 : 0;
+    case OperatorKind::GT:
+        return left > right ? 1 : 0;
+    case OperatorKind::LE:
+        return left <= right ? 1 : 0;
+    default:
+        return left >= right ? 1 : 0;
+    }
+}
+
+static bool try_int_comparison(const ASTNode *node, Interpreter &interpreter,
+                               int64_t &result) {
+    int64_t left = 0;
+    int64_t right = 0;
+    if (!read_int_operand(node->left.get(), interpreter, left) ||
+        !read_int_operand(node->right.get(), interpreter, right)) {
+        return false;
+    }
+    result = compare_values(node->op_kind, left, right);
+    return true;
+}
+
+static bool try_double_comparison(const ASTNode *node,
+                                  Interpreter &interpreter, int64_t &result) {
+    double left = 0.0;
+    double right = 0.0;
+    if (!read_double_operand(node->left.get(), interpreter, left) ||
+        !read_double_operand(node->right.get(), interpreter, right)) {
+        return false;
+    }
+    result = compare_values(node->op_kind, left, right);
+    return true;
+}
+
+static bool try_string_comparison(const ASTNode *node,
+                                  Interpreter &interpreter, int64_t &result) {
+    const std::string *left =
+        read_string_operand(node->left.get(), interpreter);
+    if (!left) {
+        return false;
+    }
+    const std::string *right =
+        read_string_operand(node->right.get(), interpreter);
+    if (!right) {
+        return false;
+    }
+    result = compare_values(node->op_kind, *left, *right);
+    return true;
+}
+
+bool try_evaluate_comparison_fast(const ASTNode *node,
+                                  Interpreter &interpreter, int64_t &result) {
+    if (!node->left || !node->right ||
+        !is_comparison_operator(node->operator_kind())) {
+        return false;
+    }
+
+    switch (node->operand_fast_path) {
+    case OperandFastPath::GENERIC:
+        return false;
+    case OperandFastPath::INT:
+        if (try_int_comparison(node, interpreter, result)) {
+            return true;
+        }
+        break;
+    case OperandFastPath::DOUBLE:
+        if (try_double_comparison(node, interpreter, result)) {
+            return true;
+        }
+        break;
+    case OperandFastPath::STRING:
+        if (try_string_comparison(node, interpreter, result)) {
+            return true;
+        }
+        break;
+    case OperandFastPath::UNDECIDED:
+        // 初回評価: オペランドの形と変数の型から高速パスを決める
+        if (try_int_comparison(node, interpreter, result)) {
+            node->operand_fast_path = OperandFastPath::INT;
+            return true;
+        }
+        if (try_double_comparison(node, interpreter, result)) {
+            node->operand_fast_path = OperandFastPath::DOUBLE;
+            return true;
+        }
+        if (try_string_comparison(node, interpreter, result)) {
+            node->operand_fast_path = OperandFastPath::STRING;
+            return true;
+        }
+        break;
+    }
+
+    // 型が合わなかったノードは以後typed評価のみを使う
+    node->operand_fast_path = OperandFastPath::GENERIC;
+    return false;
+}
+
 TypedValue evaluate_binary_op_typed(
     const ASTNode *node, Interpreter &interpreter,
     const InferredType &inferred_type,
     std::function<TypedValue(const ASTNode *)> evaluate_typed_func) {
+    OperatorKind kind = node->operator_kind();
+
+    // v0.14.0: int/double/string同士の比較はTypedValueを経由しない
+    if (is_comparison_operator(kind)) {
+        int64_t fast_result = 0;
+        if (try_evaluate_comparison_fast(node, interpreter, fast_result)) {
+            return TypedValue(fast_result,
+                              ensure_type(inferred_type, TYPE_BOOL, "bool"));
+        }
+    }
+
     TypedValue left_value = evaluate_typed_func(node->left.get());
     TypedValue right_value = evaluate_typed_func(node->right.get());
 
     // ポインタ演算のチェック（加算のみ）
-    if (node->op == "+") {
+    if (kind == OperatorKind::ADD) {
         bool left_is_pointer = false;
         bool right_is_pointer = false;
 
@@ -261,14 +494,15 @@ TypedValue evaluate_binary_op_typed(
     };
 
     // 文字列連結の処理（+演算子）
-    if (node->op == "+" && left_value.is_string() && right_value.is_string()) {
+    if (kind == OperatorKind::ADD && left_value.is_string() &&
+        right_value.is_string()) {
         std::string result_str =
             left_value.string_value + right_value.string_value;
         return TypedValue(result_str, InferredType(TYPE_STRING, "string"));
     }
 
     // ポインタ演算の特別処理
-    if (node->op == "+" || node->op == "-") {
+    if (kind == OperatorKind::ADD || kind == OperatorKind::SUB) {
         // 左オペランドがポインタの場合
         if (left_value.numeric_type == TYPE_POINTER ||
             TypeHelpers::isPointer(left_value)) {
@@ -285,13 +519,19 @@ TypedValue evaluate_binary_op_typed(
                 if (meta) {
                     // 真のポインタ演算：アドレス = アドレス + (オフセット ×
                     // sizeof(要素型))
-                    // 配列要素はint64_t（8バイト）として保存されているため、実際のメモリレイアウトに合わせる
+                    // v0.14.0: 配列要素は宣言された幅で詰めて保存されるため、
+                    // 要素間隔はポインタ作成時の配列範囲から求める
                     ptrdiff_t offset_value = static_cast<ptrdiff_t>(offset);
                     uintptr_t new_address;
-                    size_t actual_element_size =
-                        sizeof(int64_t); // 配列要素は常にint64_tで保存
+                    size_t actual_element_size = sizeof(int64_t);
+                    if (meta->array_var && meta->array_var->array_size > 0 &&
+                        meta->array_end_addr > meta->array_start_addr) {
+                        actual_element_size =
+                            (meta->array_end_addr - meta->array_start_addr) /
+                            static_cast<size_t>(meta->array_var->array_size);
+                    }
 
-                    if (node->op == "+") {
+                    if (kind == OperatorKind::ADD) {
                         new_address = meta->address +
                                       (offset_value * actual_element_size);
                     } else { // "-"
@@ -347,16 +587,16 @@ TypedValue evaluate_binary_op_typed(
         }
     }
 
-    if (node->op == "+") {
+    if (kind == OperatorKind::ADD) {
         return make_numeric_typed_value(left_quad + right_quad,
                                         prefer_integral_result);
-    } else if (node->op == "-") {
+    } else if (kind == OperatorKind::SUB) {
         return make_numeric_typed_value(left_quad - right_quad,
                                         prefer_integral_result);
-    } else if (node->op == "*") {
+    } else if (kind == OperatorKind::MUL) {
         return make_numeric_typed_value(left_quad * right_quad,
                                         prefer_integral_result);
-    } else if (node->op == "/") {
+    } else if (kind == OperatorKind::DIV) {
         bool treat_as_float_division =
             !prefer_integral_result &&
             (inferred_type.type_info == TYPE_QUAD ||
@@ -375,13 +615,13 @@ TypedValue evaluate_binary_op_typed(
             }
             return make_integer_typed_value(left_int / right_int);
         }
-    } else if (node->op == "%") {
+    } else if (kind == OperatorKind::MOD) {
         if (right_int == 0) {
             error_msg(DebugMsgId::ZERO_DIVISION_ERROR);
             throw std::runtime_error("Modulo by zero");
         }
         return make_integer_typed_value(left_int % right_int);
-    } else if (node->op == "==") {
+    } else if (kind == OperatorKind::EQ) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value ==
@@ -395,7 +635,7 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad == right_quad);
         }
         return make_bool_typed_value(left_int == right_int);
-    } else if (node->op == "!=") {
+    } else if (kind == OperatorKind::NE) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value !=
@@ -409,7 +649,7 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad != right_quad);
         }
         return make_bool_typed_value(left_int != right_int);
-    } else if (node->op == "<") {
+    } else if (kind == OperatorKind::LT) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value <
@@ -423,7 +663,7 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad < right_quad);
         }
         return make_bool_typed_value(left_int < right_int);
-    } else if (node->op == ">") {
+    } else if (kind == OperatorKind::GT) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value >
@@ -437,7 +677,7 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad > right_quad);
         }
         return make_bool_typed_value(left_int > right_int);
-    } else if (node->op == "<=") {
+    } else if (kind == OperatorKind::LE) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value <=
@@ -451,7 +691,7 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad <= right_quad);
         }
         return make_bool_typed_value(left_int <= right_int);
-    } else if (node->op == ">=") {
+    } else if (kind == OperatorKind::GE) {
         // 文字列比較
         if (left_value.is_string() || right_value.is_string()) {
             return make_bool_typed_value(left_value.string_value >=
@@ -465,19 +705,19 @@ TypedValue evaluate_binary_op_typed(
             return make_bool_typed_value(left_quad >= right_quad);
         }
         return make_bool_typed_value(left_int >= right_int);
-    } else if (node->op == "&&") {
+    } else if (kind == OperatorKind::LOGICAL_AND) {
         return make_bool_typed_value(truthy(left_value) && truthy(right_value));
-    } else if (node->op == "||") {
+    } else if (kind == OperatorKind::LOGICAL_OR) {
         return make_bool_typed_value(truthy(left_value) || truthy(right_value));
-    } else if (node->op == "&") {
+    } else if (kind == OperatorKind::BIT_AND) {
         return make_integer_typed_value(left_int & right_int);
-    } else if (node->op == "|") {
+    } else if (kind == OperatorKind::BIT_OR) {
         return make_integer_typed_value(left_int | right_int);
-    } else if (node->op == "^") {
+    } else if (kind == OperatorKind::BIT_XOR) {
         return make_integer_typed_value(left_int ^ right_int);
-    } else if (node->op == "<<") {
+    } else if (kind == OperatorKind::SHL) {
         return make_integer_typed_value(left_int << right_int);
-    } else if (node->op == ">>") {
+    } else if (kind == OperatorKind::SHR) {
         return make_integer_typed_value(left_int >> right_int);
     }
 
@@ -979,6 +1219,25 @@ TypedValue evaluate_unary_op_typed(
 
 namespace BinaryAndUnaryOperators {
 
+// v0.14.0: awaitで受け取った値をFuture変数へ書き戻し、タスクを解放する
+// 同じ変数を再度awaitした場合は書き戻した値を返す（解放済みのタスクIDは
+// get_taskで見つからないため、Future.valueへのフォールバックが使われる）
+static void consume_awaited_future(Interpreter &interpreter,
+                                   const std::string &var_name, int task_id,
+                                   const Variable &value) {
+    if (!var_name.empty()) {
+        Variable *future = interpreter.get_variable(var_name);
+        if (future) {
+            future->struct_members["value"] = value;
+            auto ready_it = future->struct_members.find("is_ready");
+            if (ready_it != future->struct_members.end()) {
+                ready_it->second.value = 1;
+            }
+        }
+    }
+    interpreter.get_simple_event_loop().release_task(task_id);
+}
+
 // v0.12.1: await式の評価（TypedValueを返すように変更）
 TypedValue evaluate_await(
     const ASTNode *node, Interpreter &interpreter,
@@ -1049,6 +1308,19 @@ TypedValue evaluate_await(
                             current_task->waiting_for_task_id = awaited_task_id;
                             debug_msg(DebugMsgId::AWAIT_TASK_WAITING,
                                       current_task_id, awaited_task_id);
+
+                            // v0.14.0: Future変数のawaitはステップを終えて
+                            // 待機先のwaitersに停止し、待機先の完了後に文を
+                            // 再実行して値を受け取る（式のawaitは再実行で
+                            // タスクを作り直すため、入れ子の実行で待つ）
+                            const AsyncTask *awaited =
+                                interpreter.get_simple_event_loop().get_task(
+                                    awaited_task_id);
+                            if (!var_name.empty() && awaited &&
+                                !awaited->is_executed &&
+                                awaited_task_id != current_task_id) {
+                                throw YieldException(true, true);
+                            }
                         }
                     }
 
@@ -1110,6 +1382,9 @@ TypedValue evaluate_await(
                             "Cannot retrieve value from Future after "
                             "run_until_complete");
                     }
+                    consume_awaited_future(interpreter, var_name,
+                                           awaited_task_id,
+                                           value_member_updated);
 
                     // v0.12.1:
                     // valueメンバーをTypedValueとして返す（enum情報を保持）
@@ -1178,8 +1453,12 @@ TypedValue evaluate_await(
                                     "value");
                             if (value_it_ready != task_ready->internal_future
                                                       .struct_members.end()) {
-                                const Variable &value_member =
+                                // 解放でタスクの値が消えるため先にコピーする
+                                const Variable value_member =
                                     value_it_ready->second;
+                                consume_awaited_future(interpreter, var_name,
+                                                       task_id_ready,
+                                                       value_member);
 
                                 // v0.12.1: TypedValueとして返す
                                 if (value_member.is_enum ||
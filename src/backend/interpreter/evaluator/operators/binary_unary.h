@@ -23,6 +23,21 @@ TypedValue evaluate_binary_op_typed(
     const InferredType &inferred_type,
     std::function<TypedValue(const ASTNode *)> evaluate_typed_func);
 
+/**
+ * @brief 比較演算の高速パス（int/int, double/double, string/string）
+ *
+ * オペランドがリテラル・単純な変数（int同士は加減乗算の部分式も可）の場合、
+ * TypedValueを経由せずに比較する。どのパスを使うかは初回評価時に
+ * node->operand_fast_pathへ記録し、型が合わなくなったらGENERICに落とす。
+ *
+ * @param node 比較演算子のAST_BINARY_OPノード
+ * @param interpreter インタプリタインスタンス
+ * @param result 比較結果（0または1）
+ * @return 高速パスで評価できた場合true（falseなら通常のtyped評価を行う）
+ */
+bool try_evaluate_comparison_fast(const ASTNode *node,
+                                  Interpreter &interpreter, int64_t &result);
+
 /**
  * @brief evaluate_typed_expressionで使用される単項演算子の評価
  *
@@ -172,7 +172,7 @@ int64_t evaluate_incdec(
 
     // 変数の場合
     if (node->left->node_type == ASTNodeType::AST_VARIABLE) {
-        Variable *var = interpreter.find_variable(node->left->name);
+        Variable *var = interpreter.find_variable(node->left.get());
         if (!var) {
             error_msg(DebugMsgId::UNDEFINED_VAR_ERROR,
                       node->left->name.c_str());
@@ -447,7 +447,7 @@ int64_t evaluate_incdec(
             }
 
             char new_str[32];
-            snprintf(new_str, sizeof(new_str), "%" PRId64, values[index]);
+            snprintf(new_str, sizeof(new_str), "%" PRId64, values.get(index));
             debug_msg(DebugMsgId::INCDEC_NEW_VALUE, new_str);
 
             int64_t result = (node->node_type == ASTNodeType::AST_PRE_INCDEC)
@@ -48,7 +48,7 @@ static size_t get_type_size(const std::string &type_name,
     // v0.11.0: ジェネリック型パラメータ（T, U等）を現在のTypeContextで解決
     std::string resolved_in_context =
         interpreter->resolve_type_in_context(type_name);
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(
             dbg_buf, sizeof(dbg_buf),
@@ -59,7 +59,7 @@ static size_t get_type_size(const std::string &type_name,
     }
     if (resolved_in_context != type_name) {
         // TypeContextで解決された型（例: T → int）
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[get_type_size] Resolved '%s' -> '%s' via TypeContext",
@@ -131,7 +131,7 @@ static size_t get_type_size(const std::string &type_name,
                                    i < type_args.size();
                      ++i) {
                     type_arg_map[struct_def->type_parameters[i]] = type_args[i];
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[get_type_size] Type param mapping: %s -> %s",
@@ -0,0 +1,79 @@
+#include "channel.h"
+#include <utility>
+
+namespace cb {
+
+Channel::Channel(size_t capacity) : ring_(capacity) {}
+
+void Channel::push_back(Variable &value) {
+    ring_[(head_ + count_) % ring_.size()] = std::move(value);
+    ++count_;
+}
+
+bool Channel::try_send(Variable &value, ChannelWaiterList &woken) {
+    while (!receivers_.empty()) {
+        std::shared_ptr<ChannelWaiter> receiver = std::move(receivers_.front());
+        receivers_.pop_front();
+        if (receiver->abandoned) {
+            continue;
+        }
+        receiver->done = true;
+        woken.push_back(receiver);
+        if (receiver->kind == ChannelWaiter::Kind::RECV) {
+            receiver->value = std::move(value);
+            return true;
+        }
+        // NOTIFYは値を受け取らない: 起こしたうえで次の受信待ちを探す
+        // （見つからなければバッファへ入れ、起こしたタスクが受信する）
+    }
+    if (count_ == ring_.size()) {
+        return false;
+    }
+    push_back(value);
+    return true;
+}
+
+bool Channel::try_recv(Variable &out, ChannelWaiterList &woken) {
+    if (count_ == 0) {
+        return false;
+    }
+    out = std::move(ring_[head_]);
+    head_ = (head_ + 1) % ring_.size();
+    --count_;
+
+    while (!senders_.empty()) {
+        std::shared_ptr<ChannelWaiter> sender = std::move(senders_.front());
+        senders_.pop_front();
+        if (sender->abandoned) {
+            continue;
+        }
+        push_back(sender->value);
+        sender->done = true;
+        woken.push_back(std::move(sender));
+        break;
+    }
+    return true;
+}
+
+std::shared_ptr<ChannelWaiter> Channel::park(ChannelWaiter::Kind kind,
+                                             int task_id, Variable value) {
+    auto waiter = std::make_shared<ChannelWaiter>();
+    waiter->kind = kind;
+    waiter->task_id = task_id;
+    waiter->value = std::move(value);
+    (kind == ChannelWaiter::Kind::SEND ? senders_ : receivers_)
+        .push_back(waiter);
+    return waiter;
+}
+
+void Channel::close(ChannelWaiterList &woken) {
+    closed_ = true;
+    for (auto &receiver : receivers_) {
+        if (!receiver->abandoned) {
+            woken.push_back(std::move(receiver));
+        }
+    }
+    receivers_.clear();
+}
+
+} // namespace cb
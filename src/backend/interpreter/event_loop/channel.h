@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../core/interpreter.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace cb {
+
+// v0.14.0: チャネルの待ち行列の要素
+// SENDは送る値を、RECVは受け渡された値をvalueに持つ
+// NOTIFYは値を受け取らず、値が届いたことだけを知らされる（channel_wait）
+struct ChannelWaiter {
+    enum class Kind : uint8_t { SEND, RECV, NOTIFY };
+
+    Kind kind = Kind::RECV;
+    int task_id = -1; // 待っているタスク（-1 = main）
+    Variable value;
+    bool done = false;      // 値を受け渡した（NOTIFY: 値が届いた）
+    bool abandoned = false; // 待つのをやめた（取り消し・デッドロック）
+};
+
+using ChannelWaiterList = std::vector<std::shared_ptr<ChannelWaiter>>;
+
+// v0.14.0: 容量固定のチャネル（channel_* 組み込み関数、stdlib/std/channel.cb）
+// 値はリングバッファへムーブして保持し、受信時にムーブして取り出す。
+// 送信・受信できない側は待ち行列に並び、相手側の操作で値を直接受け渡される
+// 待ち行列から外れて再開すべき要素はwokenへ追加する（再開のさせ方は
+// SimpleEventLoop::channel_send/channel_recvを参照）
+class Channel {
+  public:
+    explicit Channel(size_t capacity);
+
+    // 受信待ちがいれば先頭へ直接渡し、空きがあればバッファへ入れる
+    // どちらもできなければfalse（valueはそのまま）
+    bool try_send(Variable &value, ChannelWaiterList &woken);
+    // バッファの先頭を取り出し、空いた場所へ送信待ちの先頭の値を入れる
+    // バッファが空ならfalse
+    bool try_recv(Variable &out, ChannelWaiterList &woken);
+
+    // 待ち行列の末尾に並ぶ（SENDは送信待ち、RECV/NOTIFYは受信待ち）
+    std::shared_ptr<ChannelWaiter> park(ChannelWaiter::Kind kind, int task_id,
+                                        Variable value = Variable());
+
+    // 以降の送信を禁止し、受信待ちをすべて再開させる
+    // （バッファと送信待ちの値は引き続き受信できる）
+    void close(ChannelWaiterList &woken);
+
+    bool is_closed() const { return closed_; }
+    size_t size() const { return count_; }
+    size_t capacity() const { return ring_.size(); }
+
+  private:
+    void push_back(Variable &value);
+
+    std::vector<Variable> ring_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    bool closed_ = false;
+    // 送信待ちはバッファが満杯のとき、受信待ちは空のときだけ存在する
+    std::deque<std::shared_ptr<ChannelWaiter>> senders_;
+    std::deque<std::shared_ptr<ChannelWaiter>> receivers_;
+};
+
+} // namespace cb
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <windows.h> // GetSystemTimeAsFileTime()
+#else
+#include <sys/time.h> // gettimeofday()
+#endif
+
+namespace cb {
+
+// v0.14.0: 非同期ランタイムの時計
+// now()・sleep・timeout・deadlineと、イベントループのタイマーが
+// 同じ基準で比較できるよう、時刻の取得はここに集める
+
+// 現在時刻（UNIXエポックからのミリ秒、now()関数の戻り値）
+inline int64_t epoch_now_ms() {
+#ifdef _WIN32
+    // FILETIMEは1601/1/1からの100ナノ秒単位
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    ULARGE_INTEGER uli;
+    uli.LowPart = ft.dwLowDateTime;
+    uli.HighPart = ft.dwHighDateTime;
+    return (uli.QuadPart / 10000) - 11644473600000LL;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return static_cast<int64_t>(tv.tv_sec) * 1000 +
+           static_cast<int64_t>(tv.tv_usec) / 1000;
+#endif
+}
+
+// タイムスライス・統計用の単調時計（マイクロ秒）
+inline int64_t steady_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace cb
@@ -12,6 +12,7 @@ void EventLoop::schedule_task(std::function<void()> task) {
 void EventLoop::schedule_delayed_task(std::function<void()> task,
                                       std::chrono::milliseconds delay) {
     timer_queue_.push_back(std::make_unique<TimerTask>(std::move(task), delay));
+    std::push_heap(timer_queue_.begin(), timer_queue_.end(), timer_later);
 }
 
 void EventLoop::run() {
@@ -31,9 +32,9 @@ void EventLoop::run() {
             }
         }
 
-        // タスクがない場合は短時間スリープ（CPUを無駄に使わない）
+        // タスクがない場合は次のタイマーまでブロック（CPUを無駄に使わない）
         if (task_queue_.empty() && !timer_queue_.empty()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            wait_for_next_timer();
         }
     }
 
@@ -64,8 +65,8 @@ void EventLoop::run_until(const std::function<bool()> &condition) {
             // 短時間スリープしてから再チェック
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
         } else {
-            // タイマーだけある場合は短時間スリープ
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // タイマーだけある場合は次のタイマーまでブロック
+            wait_for_next_timer();
         }
     }
 
@@ -79,17 +80,20 @@ bool EventLoop::has_pending_tasks() const {
 }
 
 void EventLoop::process_timers() {
-    // 準備完了したタイマーを検索してタスクキューに移動
-    auto it = timer_queue_.begin();
-    while (it != timer_queue_.end()) {
-        if ((*it)->is_ready()) {
-            // タイマーが準備完了 → タスクキューに追加
-            task_queue_.push(std::move(*it));
-            it = timer_queue_.erase(it);
-        } else {
-            ++it;
-        }
+    // 準備完了したタイマーをヒープの先頭から取り出してタスクキューに移動
+    // 先頭が未到達なら残りのタイマーも未到達なので走査しない
+    while (!timer_queue_.empty() && timer_queue_.front()->is_ready()) {
+        std::pop_heap(timer_queue_.begin(), timer_queue_.end(), timer_later);
+        task_queue_.push(std::move(timer_queue_.back()));
+        timer_queue_.pop_back();
+    }
+}
+
+void EventLoop::wait_for_next_timer() {
+    if (timer_queue_.empty()) {
+        return;
     }
+    std::this_thread::sleep_until(timer_queue_.front()->get_execute_at());
 }
 
 } // namespace cb
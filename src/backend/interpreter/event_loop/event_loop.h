@@ -88,11 +88,21 @@ class EventLoop {
 
   private:
     std::queue<std::unique_ptr<Task>> task_queue_;
+    // v0.14.0: 実行時刻の最小ヒープ（先頭が最も早いタイマー）
     std::vector<std::unique_ptr<TimerTask>> timer_queue_;
     bool is_running_ = false;
 
     // タイマーキューから準備完了したタスクを処理
     void process_timers();
+
+    // 次のタイマーの実行時刻までスレッドをブロック
+    void wait_for_next_timer();
+
+    // ヒープ順序の比較（実行時刻が遅い方を「小さい」とみなす）
+    static bool timer_later(const std::unique_ptr<TimerTask> &a,
+                            const std::unique_ptr<TimerTask> &b) {
+        return a->get_execute_at() > b->get_execute_at();
+    }
 };
 
 } // namespace cb
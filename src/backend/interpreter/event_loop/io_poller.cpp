@@ -0,0 +1,415 @@
+#include "io_poller.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <arpa/inet.h>  // htonl(), htons()
+#include <fcntl.h>      // fcntl(), O_NONBLOCK
+#include <netinet/in.h> // sockaddr_in
+#include <sys/epoll.h>  // epoll_create1(), epoll_ctl(), epoll_wait()
+#include <sys/socket.h> // socket(), socketpair(), accept4()
+#include <sys/stat.h>   // lstat()
+#include <sys/un.h>     // sockaddr_un
+#include <unistd.h>     // pipe2(), read(), write(), close()
+#endif
+
+namespace cb {
+
+#ifdef __linux__
+
+IoPoller::IoPoller() : epoll_fd_(epoll_create1(EPOLL_CLOEXEC)) {}
+
+IoPoller::~IoPoller() {
+    if (epoll_fd_ >= 0) {
+        ::close(epoll_fd_);
+    }
+}
+
+void IoPoller::update(int fd, const Watch &watch, bool registered) {
+    uint32_t events = 0;
+    if (watch.reader != kNone) {
+        events |= EPOLLIN;
+    }
+    if (watch.writer != kNone) {
+        events |= EPOLLOUT;
+    }
+    if (events == 0) {
+        if (registered) {
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+        }
+        watches_.erase(fd);
+        return;
+    }
+    struct epoll_event event;
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd_, registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd,
+                  &event) != 0) {
+        int error = errno;
+        watches_.erase(fd);
+        throw std::runtime_error(std::string("cannot watch fd: ") +
+                                 std::strerror(error));
+    }
+}
+
+bool IoPoller::watch(int fd, Interest interest, int waiter_id) {
+    if (epoll_fd_ < 0) {
+        throw std::runtime_error("async I/O is not available (epoll)");
+    }
+    auto it = watches_.find(fd);
+    bool registered = it != watches_.end();
+    Watch watch = registered ? it->second : Watch();
+    int &slot = interest == Interest::READ ? watch.reader : watch.writer;
+    if (slot == waiter_id) {
+        return true;
+    }
+    if (slot != kNone) {
+        return false;
+    }
+    slot = waiter_id;
+    watches_[fd] = watch;
+    update(fd, watch, registered);
+    ++waiter_count_;
+    return true;
+}
+
+void IoPoller::unwatch(int fd, int waiter_id) {
+    auto it = watches_.find(fd);
+    if (it == watches_.end()) {
+        return;
+    }
+    Watch watch = it->second;
+    for (int *slot : {&watch.reader, &watch.writer}) {
+        if (*slot == waiter_id) {
+            *slot = kNone;
+            --waiter_count_;
+        }
+    }
+    it->second = watch;
+    update(fd, watch, true);
+}
+
+void IoPoller::forget(int fd, std::vector<int> &woken) {
+    auto it = watches_.find(fd);
+    if (it == watches_.end()) {
+        return;
+    }
+    for (int waiter_id : {it->second.reader, it->second.writer}) {
+        if (waiter_id != kNone) {
+            woken.push_back(waiter_id);
+            --waiter_count_;
+        }
+    }
+    update(fd, Watch(), true);
+}
+
+bool IoPoller::wait(int64_t timeout_ms, std::vector<int> &woken) {
+    if (epoll_fd_ < 0) {
+        return false;
+    }
+    constexpr int kMaxEvents = 64;
+    struct epoll_event events[kMaxEvents];
+    int timeout = timeout_ms < 0 ? -1
+                  : timeout_ms > 0x7fffffff
+                      ? 0x7fffffff
+                      : static_cast<int>(timeout_ms);
+    int count = epoll_wait(epoll_fd_, events, kMaxEvents, timeout);
+    // シグナルによる中断（EINTR）は起こすコンテキストなしとして扱う
+    for (int i = 0; i < count; i++) {
+        int fd = events[i].data.fd;
+        auto it = watches_.find(fd);
+        if (it == watches_.end()) {
+            continue;
+        }
+        Watch watch = it->second;
+        // エラー・切断は読み書きの両方を起こす（再実行した操作が検出する）
+        uint32_t ready = events[i].events;
+        bool hangup = (ready & (EPOLLERR | EPOLLHUP)) != 0;
+        if (watch.reader != kNone && ((ready & EPOLLIN) || hangup)) {
+            woken.push_back(watch.reader);
+            watch.reader = kNone;
+            --waiter_count_;
+        }
+        if (watch.writer != kNone && ((ready & EPOLLOUT) || hangup)) {
+            woken.push_back(watch.writer);
+            watch.writer = kNone;
+            --waiter_count_;
+        }
+        it->second = watch;
+        update(fd, watch, true);
+    }
+    return true;
+}
+
+namespace io {
+
+[[noreturn]] static void throw_errno(const char *operation) {
+    throw std::runtime_error(std::string(operation) +
+                             "() failed: " + std::strerror(errno));
+}
+
+static void set_nonblocking(int fd, const char *operation) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0 ||
+        fcntl(fd, F_SETFD, FD_CLOEXEC) < 0) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_errno(operation);
+    }
+}
+
+static bool would_block() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+
+void open_pipe(int fds[2]) {
+    if (pipe2(fds, O_NONBLOCK | O_CLOEXEC) != 0) {
+        throw_errno("io_pipe");
+    }
+}
+
+void open_socketpair(int fds[2]) {
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0,
+                   fds) != 0) {
+        throw_errno("io_socketpair");
+    }
+}
+
+static sockaddr_in loopback_address(int port) {
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    return address;
+}
+
+static sockaddr_un unix_address(const std::string &path,
+                                const char *operation) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error(std::string(operation) +
+                                 "() invalid socket path");
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+// listen中のソケットを作る（失敗時はfdを閉じて例外）
+static int open_listen_socket(int domain, const sockaddr *address,
+                              socklen_t length, const char *operation) {
+    int fd = socket(domain, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throw_errno(operation);
+    }
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    int result = bind(fd, address, length);
+    if (result == 0) {
+        result = listen(fd, SOMAXCONN);
+    }
+    if (result != 0) {
+        int error = errno;
+        ::close(fd);
+        errno = error;
+        throw_errno(operation);
+    }
+    set_nonblocking(fd, operation);
+    return fd;
+}
+
+// 非ブロッキングのconnect（接続中ならfalse、失敗時はfdを閉じて例外）
+// 接続中のソケットに呼び直すと接続を進める。TCPは書き込めるようになると
+// 結果がSO_ERRORに入り、UNIXドメインソケットは相手のbacklogが空くまで
+// EAGAINを返すため、書き込み待ちの後にconnectをやり直す
+static bool connect_socket(int fd, const sockaddr *address, socklen_t length,
+                           const char *operation) {
+    int error = 0;
+    socklen_t error_length = sizeof(error);
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_length) != 0) {
+        error = errno;
+    }
+    if (error == 0) {
+        int result;
+        do {
+            result = connect(fd, address, length);
+        } while (result != 0 && errno == EINTR);
+        if (result == 0 || errno == EISCONN) {
+            return true;
+        }
+        if (errno == EINPROGRESS || errno == EALREADY || errno == EAGAIN) {
+            return false;
+        }
+        error = errno;
+    }
+    ::close(fd);
+    errno = error;
+    throw_errno(operation);
+}
+
+// 接続用のソケットを作って接続を始める
+static int start_connect(int domain, const sockaddr *address,
+                         socklen_t length, bool &connected,
+                         const char *operation) {
+    int fd = socket(domain, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throw_errno(operation);
+    }
+    connected = connect_socket(fd, address, length, operation);
+    return fd;
+}
+
+int tcp_listen(int port) {
+    sockaddr_in address = loopback_address(port);
+    return open_listen_socket(AF_INET, reinterpret_cast<sockaddr *>(&address),
+                              sizeof(address), "tcp_listen");
+}
+
+int tcp_connect(int port, bool &connected) {
+    sockaddr_in address = loopback_address(port);
+    return start_connect(AF_INET, reinterpret_cast<sockaddr *>(&address),
+                         sizeof(address), connected, "tcp_connect");
+}
+
+bool tcp_connect_finish(int fd, int port) {
+    sockaddr_in address = loopback_address(port);
+    return connect_socket(fd, reinterpret_cast<sockaddr *>(&address),
+                          sizeof(address), "tcp_connect");
+}
+
+int unix_listen(const std::string &path) {
+    sockaddr_un address = unix_address(path, "unix_listen");
+    // 前回の実行で残ったソケットファイルは置き換える（ソケット以外は残す）
+    struct stat info;
+    if (lstat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+        unlink(path.c_str());
+    }
+    return open_listen_socket(AF_UNIX, reinterpret_cast<sockaddr *>(&address),
+                              sizeof(address), "unix_listen");
+}
+
+int unix_connect(const std::string &path, bool &connected) {
+    sockaddr_un address = unix_address(path, "unix_connect");
+    return start_connect(AF_UNIX, reinterpret_cast<sockaddr *>(&address),
+                         sizeof(address), connected, "unix_connect");
+}
+
+bool unix_connect_finish(int fd, const std::string &path) {
+    sockaddr_un address = unix_address(path, "unix_connect");
+    return connect_socket(fd, reinterpret_cast<sockaddr *>(&address),
+                          sizeof(address), "unix_connect");
+}
+
+int local_port(int fd) {
+    sockaddr_in address;
+    socklen_t length = sizeof(address);
+    if (getsockname(fd, reinterpret_cast<sockaddr *>(&address), &length) !=
+        0) {
+        throw_errno("socket_port");
+    }
+    return ntohs(address.sin_port);
+}
+
+bool read_some(int fd, size_t max_bytes, std::string &out) {
+    out.resize(max_bytes);
+    ssize_t count;
+    do {
+        count = ::read(fd, &out[0], max_bytes);
+    } while (count < 0 && errno == EINTR);
+    if (count < 0) {
+        out.clear();
+        if (would_block()) {
+            return false;
+        }
+        throw_errno("io_read");
+    }
+    out.resize(static_cast<size_t>(count));
+    return true;
+}
+
+bool write_some(int fd, const std::string &data, int64_t &written) {
+    ssize_t count;
+    do {
+        // 閉じたパイプ・ソケットへの書き込みはSIGPIPEではなくEPIPEにする
+        count = send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (count < 0 && errno == ENOTSOCK) {
+            count = ::write(fd, data.data(), data.size());
+        }
+    } while (count < 0 && errno == EINTR);
+    if (count < 0) {
+        if (would_block()) {
+            return false;
+        }
+        throw_errno("io_write");
+    }
+    written = count;
+    return true;
+}
+
+bool accept_one(int fd, int &client_fd) {
+    do {
+        client_fd = accept4(fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    } while (client_fd < 0 && errno == EINTR);
+    if (client_fd < 0) {
+        if (would_block()) {
+            return false;
+        }
+        throw_errno("io_accept");
+    }
+    return true;
+}
+
+void close_fd(int fd) {
+    if (::close(fd) != 0) {
+        throw_errno("io_close");
+    }
+}
+
+} // namespace io
+
+#else // !__linux__
+
+// epollのないプラットフォームでは非同期I/Oを使えない
+// （SimpleEventLoopの待機は従来どおりスレッドのsleepで行う）
+IoPoller::IoPoller() {}
+IoPoller::~IoPoller() {}
+void IoPoller::update(int, const Watch &, bool) {}
+bool IoPoller::watch(int, Interest, int) {
+    throw std::runtime_error("async I/O is not available on this platform");
+}
+void IoPoller::unwatch(int, int) {}
+void IoPoller::forget(int, std::vector<int> &) {}
+bool IoPoller::wait(int64_t, std::vector<int> &) { return false; }
+
+namespace io {
+
+[[noreturn]] static void unsupported(const char *operation) {
+    throw std::runtime_error(std::string(operation) +
+                             "() is not available on this platform");
+}
+
+void open_pipe(int[2]) { unsupported("io_pipe"); }
+void open_socketpair(int[2]) { unsupported("io_socketpair"); }
+int tcp_listen(int) { unsupported("tcp_listen"); }
+int tcp_connect(int, bool &) { unsupported("tcp_connect"); }
+bool tcp_connect_finish(int, int) { unsupported("tcp_connect"); }
+int unix_listen(const std::string &) { unsupported("unix_listen"); }
+int unix_connect(const std::string &, bool &) { unsupported("unix_connect"); }
+bool unix_connect_finish(int, const std::string &) {
+    unsupported("unix_connect");
+}
+int local_port(int) { unsupported("socket_port"); }
+bool read_some(int, size_t, std::string &) { unsupported("io_read"); }
+bool write_some(int, const std::string &, int64_t &) {
+    unsupported("io_write");
+}
+bool accept_one(int, int &) { unsupported("io_accept"); }
+void close_fd(int) { unsupported("io_close"); }
+
+} // namespace io
+
+#endif
+
+} // namespace cb
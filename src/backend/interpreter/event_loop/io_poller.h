@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cb {
+
+// v0.14.0: ファイルディスクリプタの読み書き待ち（io_* 組み込み関数）
+// Linuxではepollを使い、SimpleEventLoopの待機（次の起床時刻までの
+// ブロック）もepoll_waitで行う。fdごとに読み待ち・書き待ちのコンテキスト
+// （タスクIDまたは-1 = main）を1つずつ持ち、準備できたら登録を外す
+class IoPoller {
+  public:
+    enum class Interest : uint8_t { READ, WRITE };
+
+    IoPoller();
+    ~IoPoller();
+    IoPoller(const IoPoller &) = delete;
+    IoPoller &operator=(const IoPoller &) = delete;
+
+    // epollを使えるかどうか（使えなければwaitは何もしない）
+    bool available() const { return epoll_fd_ >= 0; }
+
+    // fdが読み書きできるようになったらwaiter_idを起こすよう登録する
+    // 同じ向きで別のコンテキストが待っていればfalse
+    bool watch(int fd, Interest interest, int waiter_id);
+    // waiter_idの登録を外す（取り消されたタスク）
+    void unwatch(int fd, int waiter_id);
+    // fdを閉じる前に登録を外し、待っていたコンテキストをwokenへ追加する
+    void forget(int fd, std::vector<int> &woken);
+
+    // 準備できたfdを待っていたコンテキストをwokenへ追加する
+    // timeout_ms: 0 = 待たない、負 = 無期限
+    // 戻り値: false = epollを使えない
+    bool wait(int64_t timeout_ms, std::vector<int> &woken);
+
+    // 待っているコンテキストの数
+    size_t waiter_count() const { return waiter_count_; }
+
+  private:
+    struct Watch {
+        int reader = kNone;
+        int writer = kNone;
+    };
+    static constexpr int kNone = -2; // -1はmainが使う
+
+    // 登録内容をepollへ反映する（待つコンテキストがなければ外す）
+    void update(int fd, const Watch &watch, bool registered);
+
+    int epoll_fd_ = -1;
+    std::unordered_map<int, Watch> watches_;
+    size_t waiter_count_ = 0;
+};
+
+// v0.14.0: 非同期I/O用のファイルディスクリプタ操作
+// 作成するfdはすべてO_NONBLOCK | FD_CLOEXEC。失敗時はerrnoの内容を
+// 含むstd::runtime_errorを送出する
+namespace io {
+
+// パイプ・UNIXドメインソケットの組 [0]=読み側(socketpairは両方向)
+void open_pipe(int fds[2]);
+void open_socketpair(int fds[2]);
+// ループバック(127.0.0.1)のTCPソケット。port 0は空いているポート
+int tcp_listen(int port);
+// pathに残っているソケットファイルは置き換える
+int unix_listen(const std::string &path);
+// 接続は非ブロッキングで始め、まだ接続中ならconnected = false
+// 書き込めるようになったら*_connect_finishで接続を進める
+// （まだ接続中ならfalse。失敗時はfdを閉じて例外）
+int tcp_connect(int port, bool &connected);
+bool tcp_connect_finish(int fd, int port);
+int unix_connect(const std::string &path, bool &connected);
+bool unix_connect_finish(int fd, const std::string &path);
+// ソケットに割り当てられたポート番号
+int local_port(int fd);
+
+// 読み書き・accept（準備できていなければfalse）
+bool read_some(int fd, size_t max_bytes, std::string &out);
+bool write_some(int fd, const std::string &data, int64_t &written);
+bool accept_one(int fd, int &client_fd);
+
+void close_fd(int fd);
+
+} // namespace io
+
+} // namespace cb
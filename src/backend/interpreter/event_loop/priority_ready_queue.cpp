@@ -0,0 +1,99 @@
+#include "priority_ready_queue.h"
+#include <algorithm>
+#include <iterator>
+
+namespace cb {
+
+void PriorityReadyQueue::push(int id, int priority) {
+    levels_[priority].push_back(id);
+    ++size_;
+}
+
+int PriorityReadyQueue::pop() {
+    if (levels_.empty()) {
+        return -1;
+    }
+    auto top = levels_.begin();
+    int id = top->second.front();
+    top->second.pop_front();
+    if (top->second.empty()) {
+        levels_.erase(top);
+    }
+    --size_;
+    return id;
+}
+
+bool PriorityReadyQueue::remove(int id) {
+    for (auto it = levels_.begin(); it != levels_.end(); ++it) {
+        auto found = std::find(it->second.begin(), it->second.end(), id);
+        if (found != it->second.end()) {
+            it->second.erase(found);
+            if (it->second.empty()) {
+                levels_.erase(it);
+            }
+            --size_;
+            return true;
+        }
+    }
+    return false;
+}
+
+void PriorityReadyQueue::age() {
+    if (levels_.size() < 2) {
+        return;
+    }
+    // 各優先度は1段下から1つ受け取り、1段上へ1つ渡す
+    // （空になり得るのは最も低い優先度のみ）
+    auto upper = levels_.begin();
+    for (auto lower = std::next(upper); lower != levels_.end();
+         upper = lower++) {
+        upper->second.push_back(lower->second.front());
+        lower->second.pop_front();
+    }
+    auto lowest = std::prev(levels_.end());
+    if (lowest->second.empty()) {
+        levels_.erase(lowest);
+    }
+}
+
+void PriorityReadyQueue::clear() {
+    levels_.clear();
+    size_ = 0;
+}
+
+SlotPriorityQueue::SlotPriorityQueue(int capacity) : capacity_(capacity) {
+    clear();
+}
+
+int SlotPriorityQueue::push(int priority) {
+    int slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    } else if (capacity_ == 0) {
+        slot = next_slot_++;
+    } else {
+        return -1;
+    }
+    queue_.push(slot, priority);
+    return slot;
+}
+
+int SlotPriorityQueue::pop() {
+    int slot = queue_.pop();
+    if (slot >= 0) {
+        free_slots_.push_back(slot);
+    }
+    return slot;
+}
+
+void SlotPriorityQueue::clear() {
+    queue_.clear();
+    free_slots_.clear();
+    next_slot_ = 0;
+    for (int slot = capacity_ - 1; slot >= 0; --slot) {
+        free_slots_.push_back(slot);
+    }
+}
+
+} // namespace cb
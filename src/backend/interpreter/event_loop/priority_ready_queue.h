@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace cb {
+
+// v0.14.0: 優先度別のFIFOキュー
+// 優先度は任意の整数で、値が小さいほど先に取り出す。同じ優先度の要素は
+// 入れた順に取り出す。SimpleEventLoopの実行キューと、Cb側のTaskQueue
+// （priority_queue_* 組み込み関数）が共有する
+class PriorityReadyQueue {
+  public:
+    void push(int id, int priority);
+    // 最も優先度の高い要素を取り出す（空なら-1）
+    int pop();
+    // 指定した要素を取り除く（見つからなければfalse）
+    bool remove(int id);
+    // エージング: 最高優先度以外の各優先度の先頭要素を1段上の優先度の
+    // 末尾へ移し、低優先度の要素が飢餓状態にならないようにする
+    void age();
+    void clear();
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    // 最も高い優先度（空なら引数の値）
+    int top_priority(int fallback) const {
+        return levels_.empty() ? fallback : levels_.begin()->first;
+    }
+
+  private:
+    // 優先度 -> 要素（空になった優先度は削除する）
+    std::map<int, std::deque<int>> levels_;
+    size_t size_ = 0;
+};
+
+// v0.14.0: スロットを優先度順に取り出すキュー（Cb側のTaskQueue用）
+// 要素の中身はUserPriorityQueue（user_queue.h）がスロット番号ごとに保持する
+class SlotPriorityQueue {
+  public:
+    // capacity: スロット数（0 = 上限なし、必要なだけ番号を増やす）
+    explicit SlotPriorityQueue(int capacity);
+    // 空きスロットを確保して入れる（満杯なら-1）
+    int push(int priority);
+    // 最も優先度の高いスロットを取り出して解放する（空なら-1）
+    int pop();
+    void clear();
+    size_t size() const { return queue_.size(); }
+
+  private:
+    PriorityReadyQueue queue_;
+    std::vector<int> free_slots_; // 小さい番号から使うよう逆順に積む
+    int capacity_;
+    int next_slot_ = 0; // 上限なしのキューで次に割り当てる番号
+};
+
+} // namespace cb
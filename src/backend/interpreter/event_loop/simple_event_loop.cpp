@@ -2,62 +2,77 @@
 #include "../../../common/debug.h"
 #include "../../../common/debug_messages.h"
 #include "../core/interpreter.h"
+#include "../executors/statement_list_executor.h"
+#include "channel.h"
+#include "clock.h"
+#include "user_queue.h"
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 // プラットフォーム固有のヘッダー (sleep_task用)
 #ifdef _WIN32
-#include <windows.h> // GetSystemTimeAsFileTime()
+#include <windows.h> // Sleep()
 #else
-#include <sys/time.h> // gettimeofday()
+#include <time.h> // nanosleep()
 #endif
 
 namespace cb {
 
-// 関数内にyield文があるかどうかを再帰的にチェック
-static bool has_yield_statement(const ASTNode *node) {
-    if (!node) {
-        return false;
+// 指定ミリ秒だけスレッドをブロックする
+static void block_for_ms(int64_t duration_ms) {
+    if (duration_ms <= 0) {
+        return;
     }
-
-    // yield文を発見
-    if (node->node_type == ASTNodeType::AST_YIELD_STMT) {
-        return true;
+#ifdef _WIN32
+    Sleep(static_cast<DWORD>(duration_ms));
+#else
+    struct timespec req;
+    req.tv_sec = static_cast<time_t>(duration_ms / 1000);
+    req.tv_nsec = static_cast<long>((duration_ms % 1000) * 1000000);
+    while (nanosleep(&req, &req) != 0) {
+        // シグナルで中断された場合は残り時間を待つ
     }
+#endif
+}
 
-    // 子ノードを再帰的にチェック
-    if (node->left && has_yield_statement(node->left.get())) {
-        return true;
-    }
-    if (node->right && has_yield_statement(node->right.get())) {
-        return true;
+// Result::Err（ユーザーのenum値またはtimeoutが作るstruct）かどうか
+static bool is_error_result(const Variable &value) {
+    if (value.is_enum && value.enum_type_name.rfind("Result", 0) == 0) {
+        return value.enum_variant == "Err";
     }
-    if (node->body && has_yield_statement(node->body.get())) {
-        return true;
+    if (value.struct_type_name == "Result") {
+        auto tag_it = value.struct_members.find("tag");
+        return tag_it != value.struct_members.end() && tag_it->second.value == 1;
     }
-
-    // statements配列をチェック
-    for (const auto &stmt : node->statements) {
-        if (has_yield_statement(stmt.get())) {
-            return true;
-        }
-    }
-
     return false;
 }
 
 SimpleEventLoop::SimpleEventLoop(Interpreter &interpreter)
     : interpreter_(interpreter) {}
 
-int SimpleEventLoop::register_task(AsyncTask task) {
-    int task_id = next_task_id_++;
-    task.task_id = task_id;
+SimpleEventLoop::~SimpleEventLoop() = default;
 
-    // v0.13.0 Phase 2.0: yield文がない場合は自動yieldを有効化
-    // 各ステートメント実行後に自動的にyieldして協調的マルチタスクを実現
-    if (task.function_node && !has_yield_statement(task.function_node)) {
-        task.auto_yield = true;
+int SimpleEventLoop::register_task(AsyncTask task) {
+    // v0.14.0: 解放済みのスロットがあれば再利用し、なければ末尾に追加する
+    uint32_t slot_index;
+    if (!free_slots_.empty()) {
+        slot_index = free_slots_.back();
+        free_slots_.pop_back();
+    } else {
+        if (slots_.size() >= kSlotMask) {
+            throw std::runtime_error("Too many concurrent async tasks");
+        }
+        slot_index = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+        slots_.back().task = std::make_unique<AsyncTask>();
     }
+    TaskSlot &slot = slots_[slot_index];
+    int task_id = static_cast<int>((slot.generation << kSlotBits) |
+                                   (slot_index + 1));
+    task.task_id = task_id;
 
     debug_msg(DebugMsgId::EVENT_LOOP_REGISTER_TASK, task_id,
               static_cast<int>(task.internal_future.struct_members.size()));
@@ -65,71 +80,136 @@ int SimpleEventLoop::register_task(AsyncTask task) {
     // Store task before potentially being moved
     debug_msg(DebugMsgId::EVENT_LOOP_STORE_TASK, task_id);
 
-    tasks_[task_id] = task;
+    *slot.task = std::move(task);
+    slot.in_use = true;
+    ++live_task_count_;
+    stats_.tasks++;
 
-    task_queue_.push_back(task_id);
+    enqueue_task(task_id);
+    sync_queue_state();
 
-    debug_msg(DebugMsgId::ASYNC_TASK_REGISTER, task.function_name.c_str(),
-              task_id);
+    debug_msg(DebugMsgId::ASYNC_TASK_REGISTER,
+              slot.task->function_name.c_str(), task_id);
 
     return task_id;
 }
 
+void SimpleEventLoop::detach_task(int task_id) {
+    AsyncTask *task = find_task(task_id);
+    if (!task) {
+        return;
+    }
+    task->is_detached = true;
+    if (task->is_executed) {
+        release_task(task_id);
+    }
+}
+
+AsyncTask *SimpleEventLoop::find_task(int task_id) {
+    return const_cast<AsyncTask *>(
+        static_cast<const SimpleEventLoop *>(this)->find_task(task_id));
+}
+
+const AsyncTask *SimpleEventLoop::find_task(int task_id) const {
+    if (task_id <= 0) {
+        return nullptr;
+    }
+    uint32_t slot_number = static_cast<uint32_t>(task_id) & kSlotMask;
+    if (slot_number == 0 || slot_number > slots_.size()) {
+        return nullptr;
+    }
+    const TaskSlot &slot = slots_[slot_number - 1];
+    if (!slot.in_use || slot.task->task_id != task_id) {
+        return nullptr;
+    }
+    return slot.task.get();
+}
+
+void SimpleEventLoop::release_task(int task_id) {
+    AsyncTask *task = find_task(task_id);
+    if (!task || !task->is_executed || !task->waiters.empty() ||
+        task->group_id >= 0 || task_id == current_executing_task_id_) {
+        return;
+    }
+    uint32_t slot_index = (static_cast<uint32_t>(task_id) & kSlotMask) - 1;
+    TaskSlot &slot = slots_[slot_index];
+    *slot.task = AsyncTask();
+    slot.in_use = false;
+    --live_task_count_;
+    // 世代を使い切ったスロットは再利用しない（古いIDとの衝突を避ける）
+    if (slot.generation < kMaxGeneration) {
+        ++slot.generation;
+        free_slots_.push_back(slot_index);
+    }
+}
+
 void SimpleEventLoop::run() {
-    if (task_queue_.empty()) {
+    if (is_empty()) {
         return;
     }
 
     // 全タスクが完了するまでラウンドロビン実行
-    while (!task_queue_.empty()) {
-        int task_id = task_queue_.front();
-        task_queue_.pop_front();
+    while (!is_empty()) {
+        wake_due_tasks();
+        if (ready_queue_.empty()) {
+            // 実行可能なタスクがなければ次の起床時刻までブロック
+            wait_for_next_event();
+            continue;
+        }
+
+        int task_id = pop_ready();
 
         bool should_continue = execute_one_step(task_id);
 
         if (should_continue) {
             // タスクがまだ完了していない場合、キューの最後に追加
-            task_queue_.push_back(task_id);
+            enqueue_task(task_id);
         } else {
             // タスク完了
             finalize_task_if_needed(task_id);
             debug_msg(DebugMsgId::EVENT_LOOP_TASK_COMPLETED, task_id);
         }
     }
+    sync_queue_state();
 }
 
 // v0.12.0: イベントループを1サイクル実行（1タスクを1ステップだけ）
 // async関数呼び出し時にバックグラウンドでタスクを少しずつ実行するために使用
 // 協調的マルチタスク: mainとバックグラウンドタスクが交互に実行される
-void SimpleEventLoop::run_one_cycle() {
-    if (task_queue_.empty()) {
-        return;
+bool SimpleEventLoop::run_one_cycle() {
+    // v0.14.0: 起床時刻を過ぎたsleep中タスクを実行キューへ戻す
+    // 実行可能なタスクがなくてもここではブロックしない（呼び出し元のmainは
+    // 実行可能なため）
+    wake_due_tasks();
+    if (ready_queue_.empty()) {
+        return false;
     }
 
     debug_msg(DebugMsgId::EVENT_LOOP_RUN_ONE_CYCLE, 1);
 
-    // キューの先頭タスクを1ステップだけ実行
-    int task_id = task_queue_.front();
-    task_queue_.pop_front();
+    // 最も優先度の高いタスクを1ステップだけ実行
+    int task_id = pop_ready();
 
     // v0.13.0: 現在実行中のタスクはスキップ（再帰実行を防ぐ）
     if (task_id == current_executing_task_id_) {
         debug_msg(DebugMsgId::EVENT_LOOP_SKIP_EXECUTING, task_id);
         // キューに戻す
-        task_queue_.push_back(task_id);
-        return;
+        push_ready(task_id);
+        return true;
     }
 
     bool should_continue = execute_one_step(task_id);
 
     if (should_continue) {
         // タスクがまだ完了していない場合、キューの最後に追加
-        task_queue_.push_back(task_id);
+        enqueue_task(task_id);
     } else {
         // タスク完了
         finalize_task_if_needed(task_id);
         debug_msg(DebugMsgId::EVENT_LOOP_TASK_COMPLETED, task_id);
+        sync_queue_state();
     }
+    return true;
 }
 
 bool SimpleEventLoop::execute_one_step(int task_id) {
@@ -151,12 +231,12 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
         }
     } guard(current_executing_task_id_, interpreter_, task_id);
 
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    AsyncTask *task_ptr = find_task(task_id);
+    if (!task_ptr) {
         return false;
     }
 
-    AsyncTask &task = it->second;
+    AsyncTask &task = *task_ptr;
 
     if (task.is_executed) {
         return false;
@@ -164,36 +244,23 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
 
     // v0.13.0: 待機中のタスクはスキップ
     if (task.is_waiting) {
-        // 待機中のタスクが完了したかチェック
-        auto waited_it = tasks_.find(task.waiting_for_task_id);
-        if (waited_it != tasks_.end() && waited_it->second.is_executed) {
+        // 待機中のタスクが完了したかチェック（解放済みなら完了している）
+        const AsyncTask *waited = find_task(task.waiting_for_task_id);
+        if (!waited || waited->is_executed) {
             // 待機タスクが完了したので、待機状態を解除
             task.is_waiting = false;
             task.waiting_for_task_id = -1;
             debug_msg(DebugMsgId::EVENT_LOOP_TASK_RESUME, task_id);
         } else {
-            // まだ待機中
-            return true; // キューに戻す
+            // まだ待機中（enqueue_taskで待機先のwaitersに停止させる）
+            return true;
         }
     }
 
     // v0.12.0: sleep中のタスクをチェック
     if (task.is_sleeping) {
         // 現在時刻を取得
-        int64_t current_time_ms;
-#ifdef _WIN32
-        FILETIME ft;
-        GetSystemTimeAsFileTime(&ft);
-        ULARGE_INTEGER uli;
-        uli.LowPart = ft.dwLowDateTime;
-        uli.HighPart = ft.dwHighDateTime;
-        current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-        struct timeval tv;
-        gettimeofday(&tv, nullptr);
-        current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                          static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
+        int64_t current_time_ms = epoch_now_ms();
 
         if (current_time_ms < task.wake_up_time_ms) {
             // まだsleep中
@@ -232,20 +299,7 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
     // v0.12.1: タイムアウトチェック
     if (task.has_timeout && !task.is_executed) {
         // 現在時刻を取得
-        int64_t current_time_ms;
-#ifdef _WIN32
-        FILETIME ft;
-        GetSystemTimeAsFileTime(&ft);
-        ULARGE_INTEGER uli;
-        uli.LowPart = ft.dwLowDateTime;
-        uli.HighPart = ft.dwHighDateTime;
-        current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-        struct timeval tv;
-        gettimeofday(&tv, nullptr);
-        current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                          static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
+        int64_t current_time_ms = epoch_now_ms();
 
         if (current_time_ms >= task.timeout_ms) {
             // タイムアウト発生
@@ -274,8 +328,6 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
             err_field.is_assigned = true;
             result_var.struct_members["err"] = err_field;
 
-            task.return_struct_value = result_var;
-
             // Future.is_readyをtrueに設定
             if (task.use_internal_future) {
                 auto ready_it =
@@ -319,55 +371,63 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
         return false;
     }
 
+    // v0.14.0: このステップのタイムスライスを開始する
+    // タスク固有の設定がなければ全体設定（--async-quantum等）を使う
+    // ステップ終了時に呼び出し元（mainや入れ子の親タスク）のスライスへ戻す
+    struct TimeSliceGuard {
+        SimpleEventLoop &loop;
+        Interpreter &interpreter;
+        int64_t start_us;
+        TimeSlice outer;
+        int64_t budget;
+        TimeSliceGuard(SimpleEventLoop &l, Interpreter &interp,
+                       int64_t quantum, int64_t us)
+            : loop(l), interpreter(interp),
+              start_us(l.stats_enabled_ ? steady_now_us() : 0),
+              outer(interp.begin_time_slice(quantum, us)),
+              budget(interp.current_time_slice().statements_left) {}
+        ~TimeSliceGuard() {
+            loop.stats_.steps++;
+            loop.stats_.statements +=
+                budget - interpreter.current_time_slice().statements_left;
+            if (loop.stats_enabled_) {
+                int64_t elapsed_us = steady_now_us() - start_us;
+                loop.stats_.total_step_us += elapsed_us;
+                loop.stats_.max_step_us =
+                    std::max(loop.stats_.max_step_us, elapsed_us);
+            }
+            interpreter.restore_time_slice(outer);
+        }
+    };
+    if (stats_enabled_) {
+        record_queue_wait(task_id);
+    }
+    TimeSliceGuard slice_guard(
+        *this, interpreter_,
+        task.quantum > 0 ? task.quantum : interpreter_.async_quantum(),
+        task.time_slice_us >= 0 ? task.time_slice_us
+                                : interpreter_.async_time_slice_us());
+
     // スコープスタックのサイズを記録
     size_t scope_stack_size_before = interpreter_.get_scope_stack().size();
 
-    // 新しいスコープをpushする前に、タスクスコープの内容を一時保存
-    Scope task_scope_copy = *task.task_scope;
-
     // 新しいスコープをpush
     interpreter_.push_scope();
     auto resume_positions = task.statement_positions
                                 ? task.statement_positions
-                                : task_scope_copy.statement_positions;
+                                : task.task_scope->statement_positions;
     if (resume_positions) {
         interpreter_.set_current_statement_positions(resume_positions);
     } else {
         resume_positions = interpreter_.current_statement_positions();
     }
     task.statement_positions = resume_positions;
-    task_scope_copy.statement_positions = resume_positions;
-
-    // pushされたスコープにタスクスコープの変数をコピー
-    // (上書きではなく、変数だけをコピー)
-    for (auto &var_pair : task_scope_copy.variables) {
-        // v0.12.1: デバッグ - enum情報の確認
-        if (var_pair.second.is_enum) {
-            char dbg_buf[512];
-            snprintf(
-                dbg_buf, sizeof(dbg_buf),
-                "[EVENT_LOOP_SCOPE] Copying var '%s': is_enum=%d, variant='%s'",
-                var_pair.first.c_str(), var_pair.second.is_enum,
-                var_pair.second.enum_variant.c_str());
-            debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-        }
-
-        interpreter_.current_scope().variables[var_pair.first] =
-            var_pair.second;
-
-        // v0.12.1: コピー後の確認
-        if (var_pair.second.is_enum) {
-            Variable &copied_var =
-                interpreter_.current_scope().variables[var_pair.first];
-            char dbg_buf[512];
-            snprintf(
-                dbg_buf, sizeof(dbg_buf),
-                "[EVENT_LOOP_SCOPE] After copy '%s': is_enum=%d, variant='%s'",
-                var_pair.first.c_str(), copied_var.is_enum,
-                copied_var.enum_variant.c_str());
-            debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-        }
-    }
+    task.task_scope->statement_positions = resume_positions;
+
+    // v0.14.0: タスクの実行フレーム（ローカル変数）をpushしたスコープへ移す
+    // 変数はコピーせず、ステップ終了時にsuspend_task_frameで戻す
+    interpreter_.current_scope().variables =
+        std::move(task.task_scope->variables);
 
     try {
         // トップレベルのステートメントを1つ実行
@@ -377,71 +437,73 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
                                   : task.function_node->body.get();
 
         if (body->node_type == ASTNodeType::AST_STMT_LIST) {
-            if (task.current_statement_index < body->statements.size()) {
+            // v0.14.0: タイムスライスが残っている間はトップレベルの
+            // ステートメントを続けて実行する（既定の量子1では1文ずつ）
+            while (task.current_statement_index < body->statements.size()) {
                 const ASTNode *stmt =
                     body->statements[task.current_statement_index].get();
 
+                // v0.14.0: トップレベルの `await sleep(ms);`
+                // は入れ子のrun_until_completeで待たず、タスク自体をsleep
+                // させて制御を返す（他のタスクと並行に起床時刻を待つ）
+                if (is_sleep_await_statement(stmt)) {
+                    int64_t duration_ms = interpreter_.eval_expression(
+                        stmt->left->arguments[0].get());
+                    if (duration_ms >= 0) {
+                        task.current_statement_index++;
+                        task.statement_positions =
+                            interpreter_.current_statement_positions();
+                        suspend_task_frame(task, scope_stack_size_before);
+                        interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
+                        sleep_task(task_id, duration_ms);
+                        return true;
+                    }
+                }
+
                 // ステートメントを実行
                 interpreter_.execute_statement(stmt);
 
                 // 次のステートメントへ進む
                 task.current_statement_index++;
 
-                // タスクスコープを保存
-                *task.task_scope = interpreter_.current_scope();
-                task.statement_positions =
-                    interpreter_.current_statement_positions();
-
-                // スコープをpopして元のサイズに戻す
-                while (interpreter_.get_scope_stack().size() >
-                       scope_stack_size_before) {
-                    interpreter_.pop_scope();
+                if (task.is_executed || interpreter_.time_slice_expired()) {
+                    break;
                 }
+            }
 
-                // auto_yieldモードを元に戻す
-                interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
+            // 実行フレームをタスクへ戻してスコープを元のサイズに戻す
+            task.statement_positions =
+                interpreter_.current_statement_positions();
+            suspend_task_frame(task, scope_stack_size_before);
 
-                // まだステートメントが残っている
-                if (task.current_statement_index < body->statements.size()) {
-                    // v0.13.0 Phase 2.0:
-                    // auto_yieldが有効な場合、毎ステートメント後にyield
-                    if (task.auto_yield) {
-                        // Auto-yield after statement
-                    }
-                    return true; // 次のステートメントがあるので継続
-                } else {
-                    // 全ステートメント実行完了
-                    task.is_executed = true;
-
-                    // Future.is_readyをtrueに設定
-                    if (task.use_internal_future) {
-                        auto ready_it =
-                            task.internal_future.struct_members.find(
-                                "is_ready");
-                        if (ready_it !=
-                            task.internal_future.struct_members.end()) {
-                            ready_it->second.value = 1;
-                        }
-                    } else if (task.future_var) {
-                        auto ready_it =
-                            task.future_var->struct_members.find("is_ready");
-                        if (ready_it != task.future_var->struct_members.end()) {
-                            ready_it->second.value = 1;
-                        }
-                    }
+            // auto_yieldモードを元に戻す
+            interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
 
-                    return false;
+            // まだステートメントが残っている（タイムスライス切れ）
+            if (task.current_statement_index < body->statements.size()) {
+                stats_.preemptions++;
+                return true; // 次のステートメントがあるので継続
+            }
+
+            // 全ステートメント実行完了
+            task.is_executed = true;
+
+            // Future.is_readyをtrueに設定
+            if (task.use_internal_future) {
+                auto ready_it =
+                    task.internal_future.struct_members.find("is_ready");
+                if (ready_it != task.internal_future.struct_members.end()) {
+                    ready_it->second.value = 1;
                 }
-            } else {
-                // 既に全ステートメント実行済み
-                task.is_executed = true;
-                interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
-                while (interpreter_.get_scope_stack().size() >
-                       scope_stack_size_before) {
-                    interpreter_.pop_scope();
+            } else if (task.future_var) {
+                auto ready_it =
+                    task.future_var->struct_members.find("is_ready");
+                if (ready_it != task.future_var->struct_members.end()) {
+                    ready_it->second.value = 1;
                 }
-                return false;
             }
+
+            return false;
         } else {
             // STMT_LISTでない場合（通常あり得ない）
             interpreter_.execute_statement(body);
@@ -462,25 +524,16 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
             }
 
             interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
-            while (interpreter_.get_scope_stack().size() >
-                   scope_stack_size_before) {
-                interpreter_.pop_scope();
-            }
+            suspend_task_frame(task, scope_stack_size_before);
             return false;
         }
-    } catch (const YieldException &e) {
+    } catch (YieldException &e) {
         // yieldで中断
 
-        // タスクスコープを保存
-        *task.task_scope = interpreter_.current_scope();
+        // 実行フレームをタスクへ戻してスコープを元のサイズに戻す
         task.statement_positions = interpreter_.current_statement_positions();
-
-        // スコープをpopして元のサイズに戻す
         interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
-        while (interpreter_.get_scope_stack().size() >
-               scope_stack_size_before) {
-            interpreter_.pop_scope();
-        }
+        suspend_task_frame(task, scope_stack_size_before);
 
         // v0.13.0 Phase 2.0:
         // - ループ内の自動yield (e.is_from_loop == true):
@@ -489,25 +542,41 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
         //   yield後のコードを実行するため、次のステートメントに進む
         if (!e.is_from_loop) {
             task.current_statement_index++;
+        } else if (!e.retry_statement) {
+            stats_.preemptions++;
+        }
+
+        // v0.14.0: 待ちで中断したトップレベルの文は再開時に最初から実行される
+        const ASTNode *body = task.function_node->lambda_body
+                                  ? task.function_node->lambda_body.get()
+                                  : task.function_node->body.get();
+        if (e.retry_statement &&
+            body->node_type == ASTNodeType::AST_STMT_LIST) {
+            StatementListExecutor::check_retry_statement(
+                e, body, task.current_statement_index,
+                task.statement_positions.get(), false);
         }
 
         return true; // キューに戻す
     } catch (const ReturnException &e) {
-        // return文で完了
-        if (task.task_scope) {
-            *task.task_scope = interpreter_.current_scope();
+        // v0.14.0: ステップ中に取り消されたタスクの戻り値は捨てる
+        if (task.is_cancelled) {
+            interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
+            suspend_task_frame(task, scope_stack_size_before);
+            return false;
         }
+
+        // return文で完了
         task.statement_positions = interpreter_.current_statement_positions();
         task.is_executed = true;
         task.has_return_value = true;
         task.return_type = e.type;
 
-        // タスクに戻り値を保存
+        // 戻り値の種別を記録（値はFuture.valueに設定する）
+        // v0.14.0: TYPE_ENUMから作る構造体はFuture.valueへ設定するまで保持
+        Variable enum_struct_value;
         if (e.is_struct) {
             task.return_is_struct = true;
-            task.return_struct_value = e.struct_value;
-        } else if (e.type == TYPE_STRING) {
-            task.return_string_value = e.str_value;
         } else if (e.type == TYPE_ENUM) {
             // v0.13.0: TYPE_ENUMの場合、enum情報を含むstruct_valueとして保存
             // 古いスタイルのenum (Option::None等) がTYPE_ENUMとして返される場合
@@ -537,15 +606,10 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
                 enum_var.struct_type_name = "UnknownEnum";
             }
 
-            task.return_struct_value = enum_var;
+            enum_struct_value = std::move(enum_var);
 
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "[EVENT_LOOP] Stored TYPE_ENUM as struct_value");
-        } else if (e.type == TYPE_FLOAT || e.type == TYPE_DOUBLE ||
-                   e.type == TYPE_QUAD) {
-            task.return_double_value = e.double_value;
-        } else {
-            task.return_value = e.value;
         }
 
         // Future.valueに値を設定
@@ -607,11 +671,8 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
                     } else if (e.is_struct || task.return_is_struct) {
                         // v0.13.0:
                         // task.return_is_structもチェック（TYPE_ENUMの場合）
-                        if (task.return_is_struct) {
-                            value_it->second = task.return_struct_value;
-                        } else {
-                            value_it->second = e.struct_value;
-                        }
+                        value_it->second =
+                            e.is_struct ? e.struct_value : enum_struct_value;
                     } else {
                         value_it->second.type = TYPE_INT;
                         value_it->second.value = e.value;
@@ -667,11 +728,8 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
                     } else if (e.is_struct || task.return_is_struct) {
                         // v0.13.0:
                         // task.return_is_structもチェック（TYPE_ENUMの場合）
-                        if (task.return_is_struct) {
-                            value_it->second = task.return_struct_value;
-                        } else {
-                            value_it->second = e.struct_value;
-                        }
+                        value_it->second =
+                            e.is_struct ? e.struct_value : enum_struct_value;
                     } else {
                         value_it->second.type = TYPE_INT;
                         value_it->second.value = e.value;
@@ -690,41 +748,74 @@ bool SimpleEventLoop::execute_one_step(int task_id) {
         }
 
         interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
-        while (interpreter_.get_scope_stack().size() >
-               scope_stack_size_before) {
-            interpreter_.pop_scope();
-        }
+        suspend_task_frame(task, scope_stack_size_before);
+        return false;
+    } catch (const TaskCancelledException &) {
+        // v0.14.0: await中に取り消されたのでステップを巻き戻して終了する
+        interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
+        suspend_task_frame(task, scope_stack_size_before);
         return false;
     } catch (...) {
         // その他の例外
         interpreter_.set_auto_yield_mode(prev_auto_yield_mode);
-        while (interpreter_.get_scope_stack().size() >
-               scope_stack_size_before) {
-            interpreter_.pop_scope();
-        }
+        suspend_task_frame(task, scope_stack_size_before);
         throw;
     }
 }
 
+void SimpleEventLoop::suspend_task_frame(AsyncTask &task,
+                                         size_t scope_stack_size_before) {
+    // ステップ中に残った内側のスコープを先に閉じる
+    while (interpreter_.get_scope_stack().size() >
+           scope_stack_size_before + 1) {
+        interpreter_.pop_scope();
+    }
+    // タスクのスコープは変数を保持したまま閉じる
+    if (interpreter_.get_scope_stack().size() > scope_stack_size_before) {
+        interpreter_.pop_scope_into(task.task_scope->variables);
+    }
+}
+
+// v0.14.0: 構造体引数のメンバーを "引数名.メンバー名" の個別変数にも置く
+// （メンバーアクセスは個別変数を先に探すため、置かないと呼び出し元の
+// 同名変数のメンバーが見えてしまう）
+static void add_struct_member_variables(Scope &scope, const std::string &base,
+                                        const Variable &value) {
+    for (const auto &member : value.struct_members) {
+        std::string path = base + "." + member.first;
+        scope.variables[path] = member.second;
+        if (member.second.is_struct) {
+            add_struct_member_variables(scope, path, member.second);
+        }
+    }
+}
+
 void SimpleEventLoop::initialize_task_scope(AsyncTask &task) {
     task.task_scope = std::make_shared<Scope>();
 
     // 引数をタスクスコープに設定
+    // v0.14.0: 引数とselfはタスクスコープへ移し、タスク側には残さない
     const ASTNode *func = task.function_node;
     for (size_t i = 0; i < task.args.size() && i < func->parameters.size();
          i++) {
         const auto &param = func->parameters[i];
-        task.task_scope->variables[param->name] = task.args[i];
+        Variable &arg = task.task_scope->variables[param->name];
+        arg = std::move(task.args[i]);
+        if (arg.is_struct) {
+            add_struct_member_variables(*task.task_scope, param->name, arg);
+        }
     }
+    std::vector<Variable>().swap(task.args);
 
     // v0.13.0 Phase 2.0: selfをタスクスコープに設定
-    if (task.has_self) {
-        task.task_scope->variables["self"] = task.self_value;
+    if (task.has_self && task.self_value) {
+        Variable &self = task.task_scope->variables["self"];
+        self = std::move(*task.self_value);
+        task.self_value.reset();
         debug_msg(
             DebugMsgId::GENERIC_DEBUG,
             "[TASK_SCOPE] Set self in task scope: type=%d, struct_type=%s",
-            static_cast<int>(task.self_value.type),
-            task.self_value.struct_type_name.c_str());
+            static_cast<int>(self.type), self.struct_type_name.c_str());
     }
 
     if (task.has_self_receiver && !task.self_receiver_name.empty()) {
@@ -737,17 +828,34 @@ void SimpleEventLoop::initialize_task_scope(AsyncTask &task) {
 }
 
 void SimpleEventLoop::finalize_task_if_needed(int task_id) {
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    AsyncTask *task_ptr = find_task(task_id);
+    if (!task_ptr || !task_ptr->is_executed) {
         return;
     }
 
-    AsyncTask &task = it->second;
-    if (!task.is_executed) {
-        return;
+    AsyncTask &task = *task_ptr;
+
+    // v0.14.0: concurrent_await/raceのグループが決着したら残りを取り消す
+    if (task.group_id >= 0) {
+        resolve_task_group(task);
     }
 
+    // v0.14.0: 完了を待って停止していたタスクを実行キューへ戻す
+    wake_waiters(task);
+    sync_queue_state();
+
     sync_async_self_receiver(task);
+
+    // v0.14.0: 完了したタスクの実行フレームは不要なので先に破棄する
+    // （Futureの値は解放されるまでinternal_futureに残る）
+    task.task_scope.reset();
+    task.statement_positions.reset();
+    task.self_value.reset();
+    std::vector<Variable>().swap(task.args);
+
+    if (task.is_detached) {
+        release_task(task_id);
+    }
 }
 
 void SimpleEventLoop::sync_async_self_receiver(AsyncTask &task) {
@@ -814,17 +922,515 @@ void SimpleEventLoop::sync_async_self_receiver(AsyncTask &task) {
     task.has_self_receiver = false;
 }
 
-bool SimpleEventLoop::is_empty() const { return task_queue_.empty(); }
+bool SimpleEventLoop::is_empty() const {
+    return ready_queue_.empty() && !has_pending_wakeups();
+}
+
+void SimpleEventLoop::enqueue_task(int task_id) {
+    AsyncTask *task_ptr = find_task(task_id);
+    if (!task_ptr) {
+        push_ready(task_id);
+        return;
+    }
+    AsyncTask &task = *task_ptr;
+    if (task.is_waiting && !task.is_executed) {
+        AsyncTask *waited = find_task(task.waiting_for_task_id);
+        if (waited && !waited->is_executed) {
+            // 待機先が未完了なら待機先のwaitersに停止させる
+            // （実行キューには入れず、待機先の完了時に戻す）
+            waited->waiters.push_back(task_id);
+            return;
+        }
+        task.is_waiting = false;
+        task.waiting_for_task_id = -1;
+    }
+    if (!task.is_executed &&
+        (task.pending_channel_sends > 0 ||
+         (task.channel_receiver && !task.channel_receiver->done))) {
+        // v0.14.0: チャネル待ちのタスクは受け渡しが済むまで停止させる
+        // （wake_channel_waitersで実行キューへ戻す）
+        task.is_channel_parked = true;
+        return;
+    }
+    if (!task.is_executed && task.io_wait_fd >= 0) {
+        // v0.14.0: I/O待ちのタスクはfdの準備ができるまで停止させる
+        // （poll_ioで実行キューへ戻す）
+        task.is_io_parked = true;
+        return;
+    }
+    if (task.is_sleeping && !task.is_executed) {
+        // sleep中のタスクは起床時刻の最小ヒープで待機させる
+        sleep_heap_.push_back({task.wake_up_time_ms, task_id});
+        std::push_heap(sleep_heap_.begin(), sleep_heap_.end(),
+                       std::greater<TimedEntry>());
+        return;
+    }
+    push_ready(task_id);
+}
+
+void SimpleEventLoop::push_ready(int task_id) {
+    const AsyncTask *task = find_task(task_id);
+    int priority = 0;
+    if (task) {
+        priority = task->priority;
+        if (task->deadline_ms > 0 && epoch_now_ms() >= task->deadline_ms) {
+            priority = overdue_priority(priority);
+        }
+    }
+    ready_queue_.push(task_id, priority);
+    if (stats_enabled_) {
+        mark_ready(task_id);
+    }
+}
+
+int SimpleEventLoop::pop_ready() {
+    promote_overdue_tasks();
+    if (++dispatches_since_aging_ >= kAgingInterval) {
+        dispatches_since_aging_ = 0;
+        ready_queue_.age();
+    }
+    return ready_queue_.pop();
+}
+
+// デッドラインを過ぎた実行待ちのタスクを最高優先度へ移す
+// （sleep中・待機中のタスクは実行キューへ戻るときにpush_readyで引き上げる）
+void SimpleEventLoop::promote_overdue_tasks() {
+    if (deadline_heap_.empty()) {
+        return;
+    }
+    int64_t current_time_ms = epoch_now_ms();
+    while (!deadline_heap_.empty() &&
+           deadline_heap_.front().time_ms <= current_time_ms) {
+        std::pop_heap(deadline_heap_.begin(), deadline_heap_.end(),
+                      std::greater<TimedEntry>());
+        int task_id = deadline_heap_.back().task_id;
+        deadline_heap_.pop_back();
+        const AsyncTask *task = find_task(task_id);
+        if (task && !task->is_executed && ready_queue_.remove(task_id)) {
+            ready_queue_.push(task_id, overdue_priority(task->priority));
+        }
+    }
+}
+
+void SimpleEventLoop::set_task_priority(int task_id, int priority) {
+    AsyncTask *task = find_task(task_id);
+    if (!task || task->priority == priority) {
+        return;
+    }
+    task->priority = priority;
+    if (!task->is_executed && ready_queue_.remove(task_id)) {
+        push_ready(task_id);
+    }
+}
+
+void SimpleEventLoop::set_task_deadline(int task_id, int64_t deadline_ms) {
+    AsyncTask *task = find_task(task_id);
+    if (!task || task->is_executed) {
+        return;
+    }
+    task->deadline_ms = deadline_ms;
+    deadline_heap_.push_back({deadline_ms, task_id});
+    std::push_heap(deadline_heap_.begin(), deadline_heap_.end(),
+                   std::greater<TimedEntry>());
+}
+
+int SimpleEventLoop::create_user_queue(int capacity) {
+    user_queues_.push_back(std::make_unique<UserPriorityQueue>(capacity));
+    return static_cast<int>(user_queues_.size());
+}
+
+UserPriorityQueue *SimpleEventLoop::user_queue(int handle) {
+    if (handle <= 0 || handle > static_cast<int>(user_queues_.size())) {
+        return nullptr;
+    }
+    return user_queues_[handle - 1].get();
+}
+
+int SimpleEventLoop::create_channel(size_t capacity) {
+    channels_.push_back(std::make_unique<Channel>(capacity));
+    return static_cast<int>(channels_.size());
+}
+
+Channel *SimpleEventLoop::channel(int handle) {
+    if (handle <= 0 || handle > static_cast<int>(channels_.size())) {
+        return nullptr;
+    }
+    return channels_[handle - 1].get();
+}
+
+bool SimpleEventLoop::channel_send(Channel &channel, Variable &value) {
+    if (channel.is_closed()) {
+        return false;
+    }
+    ChannelWaiterList woken;
+    if (channel.try_send(value, woken)) {
+        wake_channel_waiters(woken);
+        return true;
+    }
+
+    AsyncTask *task = find_task(current_executing_task_id_);
+    if (task) {
+        // 評価器はスタックを持つため、ここで止まると受信側のタスクを
+        // 実行できない。値を預けて戻り、次の切り替え点で停止する
+        channel.park(ChannelWaiter::Kind::SEND, task->task_id,
+                     std::move(value));
+        task->pending_channel_sends++;
+        interpreter_.expire_time_slice();
+        return true;
+    }
 
-bool SimpleEventLoop::has_tasks() const { return !tasks_.empty(); }
+    auto waiter =
+        channel.park(ChannelWaiter::Kind::SEND, -1, std::move(value));
+    try {
+        wait_channel("channel_send", [&]() { return waiter->done; });
+    } catch (...) {
+        waiter->abandoned = true;
+        throw;
+    }
+    return true;
+}
 
-size_t SimpleEventLoop::task_count() const { return tasks_.size(); }
+bool SimpleEventLoop::channel_recv(Channel &channel, Variable &out) {
+    AsyncTask *task = find_task(current_executing_task_id_);
+    if (task && task->channel_receiver) {
+        // 受信待ちから再開した文の再実行: 受け渡された値を受け取る
+        std::shared_ptr<ChannelWaiter> waiter =
+            std::move(task->channel_receiver);
+        if (waiter->done && waiter->kind == ChannelWaiter::Kind::RECV) {
+            out = std::move(waiter->value);
+            return true;
+        }
+        waiter->abandoned = true;
+    }
+
+    ChannelWaiterList woken;
+    if (channel.try_recv(out, woken)) {
+        wake_channel_waiters(woken);
+        return true;
+    }
+    if (channel.is_closed()) {
+        return false;
+    }
+
+    if (task) {
+        task->channel_receiver =
+            channel.park(ChannelWaiter::Kind::RECV, task->task_id);
+        throw YieldException(true, true);
+    }
+
+    auto waiter = channel.park(ChannelWaiter::Kind::RECV, -1);
+    try {
+        wait_channel("channel_recv",
+                     [&]() { return waiter->done || channel.is_closed(); });
+    } catch (...) {
+        waiter->abandoned = true;
+        throw;
+    }
+    if (!waiter->done) {
+        return false;
+    }
+    out = std::move(waiter->value);
+    return true;
+}
+
+bool SimpleEventLoop::channel_wait(Channel &channel) {
+    AsyncTask *task = find_task(current_executing_task_id_);
+    if (task && task->channel_receiver) {
+        // 受け渡された値はこのタスクが次のchannel_recvで受け取る
+        if (task->channel_receiver->done &&
+            task->channel_receiver->kind == ChannelWaiter::Kind::RECV) {
+            return true;
+        }
+        task->channel_receiver->abandoned = true;
+        task->channel_receiver.reset();
+    }
+    if (channel.size() > 0) {
+        return true;
+    }
+    if (channel.is_closed()) {
+        return false;
+    }
+
+    if (task) {
+        task->channel_receiver =
+            channel.park(ChannelWaiter::Kind::NOTIFY, task->task_id);
+        throw YieldException(true, true);
+    }
+
+    auto waiter = channel.park(ChannelWaiter::Kind::NOTIFY, -1);
+    try {
+        wait_channel("channel_wait", [&]() {
+            return channel.size() > 0 || channel.is_closed();
+        });
+    } catch (...) {
+        waiter->abandoned = true;
+        throw;
+    }
+    waiter->abandoned = true;
+    return channel.size() > 0;
+}
+
+void SimpleEventLoop::channel_close(Channel &channel) {
+    ChannelWaiterList woken;
+    channel.close(woken);
+    wake_channel_waiters(woken);
+}
+
+void SimpleEventLoop::wake_channel_waiters(const ChannelWaiterList &woken) {
+    for (const auto &waiter : woken) {
+        // mainは待っている条件を自分で確認する
+        AsyncTask *task = find_task(waiter->task_id);
+        if (!task || task->is_executed) {
+            continue;
+        }
+        if (waiter->kind == ChannelWaiter::Kind::SEND) {
+            if (--task->pending_channel_sends > 0) {
+                continue;
+            }
+        } else if (task->channel_receiver == waiter &&
+                   !(waiter->done &&
+                     waiter->kind == ChannelWaiter::Kind::RECV)) {
+            // closeやNOTIFYで起こされたタスクは文を再実行して確かめ直す
+            task->channel_receiver.reset();
+        }
+        if (task->is_channel_parked) {
+            task->is_channel_parked = false;
+            enqueue_task(waiter->task_id);
+        }
+    }
+}
+
+void SimpleEventLoop::wait_channel(const char *builtin_name,
+                                   const std::function<bool()> &done) {
+    // run_until_completeと同じく、待っている間は他のタスクを進める
+    while (!done()) {
+        wake_due_tasks();
+        if (ready_queue_.empty()) {
+            if (!has_pending_wakeups()) {
+                throw std::runtime_error(
+                    std::string(builtin_name) +
+                    "() deadlock: no other task can make progress");
+            }
+            wait_for_next_event();
+            continue;
+        }
+        run_one_cycle();
+    }
+}
+
+void SimpleEventLoop::mark_ready(int task_id) {
+    if (find_task(task_id)) {
+        slots_[(static_cast<uint32_t>(task_id) & kSlotMask) - 1]
+            .ready_since_us = steady_now_us();
+    }
+}
+
+void SimpleEventLoop::record_queue_wait(int task_id) {
+    TaskSlot &slot = slots_[(static_cast<uint32_t>(task_id) & kSlotMask) - 1];
+    if (slot.ready_since_us == 0) {
+        return;
+    }
+    int64_t wait_us = steady_now_us() - slot.ready_since_us;
+    slot.ready_since_us = 0;
+    stats_.queue_waits++;
+    stats_.total_queue_wait_us += wait_us;
+    stats_.max_queue_wait_us = std::max(stats_.max_queue_wait_us, wait_us);
+}
+
+void SimpleEventLoop::print_stats(std::FILE *out) const {
+    double avg_step_us =
+        stats_.steps ? static_cast<double>(stats_.total_step_us) / stats_.steps
+                     : 0.0;
+    double avg_wait_us = stats_.queue_waits
+                             ? static_cast<double>(stats_.total_queue_wait_us) /
+                                   stats_.queue_waits
+                             : 0.0;
+    // 量子が未設定なら実際の区切り方（時間制限のみ or 1文ごと）を表示する
+    int64_t time_slice_us = interpreter_.async_time_slice_us();
+    std::string quantum =
+        interpreter_.async_quantum() > 0
+            ? std::to_string(interpreter_.async_quantum())
+            : (time_slice_us > 0 ? "none" : "1");
+    std::fprintf(out,
+                 "[async-stats] quantum=%s time_slice_us=%lld tasks=%llu "
+                 "steps=%llu preemptions=%llu statements=%lld\n",
+                 quantum.c_str(), static_cast<long long>(time_slice_us),
+                 static_cast<unsigned long long>(stats_.tasks),
+                 static_cast<unsigned long long>(stats_.steps),
+                 static_cast<unsigned long long>(stats_.preemptions),
+                 static_cast<long long>(stats_.statements));
+    std::fprintf(out,
+                 "[async-stats] step_us avg=%.1f max=%lld "
+                 "queue_wait_us avg=%.1f max=%lld\n",
+                 avg_step_us, static_cast<long long>(stats_.max_step_us),
+                 avg_wait_us, static_cast<long long>(stats_.max_queue_wait_us));
+}
+
+void SimpleEventLoop::wake_waiters(AsyncTask &task) {
+    if (task.waiters.empty()) {
+        return;
+    }
+    std::vector<int> waiters;
+    waiters.swap(task.waiters);
+    for (int waiter_id : waiters) {
+        debug_msg(DebugMsgId::EVENT_LOOP_TASK_RESUME, waiter_id);
+        enqueue_task(waiter_id);
+    }
+}
+
+void SimpleEventLoop::wake_due_tasks() {
+    if (io_poller_.waiter_count() > 0 &&
+        (ready_queue_.empty() ||
+         ++wakeups_since_io_poll_ >= kIoPollInterval)) {
+        wakeups_since_io_poll_ = 0;
+        poll_io(0);
+    }
+    if (sleep_heap_.empty()) {
+        return;
+    }
+    int64_t current_time_ms = epoch_now_ms();
+    while (!sleep_heap_.empty() &&
+           sleep_heap_.front().time_ms <= current_time_ms) {
+        std::pop_heap(sleep_heap_.begin(), sleep_heap_.end(),
+                      std::greater<TimedEntry>());
+        push_ready(sleep_heap_.back().task_id);
+        sleep_heap_.pop_back();
+    }
+}
+
+void SimpleEventLoop::wait_for_next_event() {
+    // 取り消されたタスクの起床時刻までは待たない
+    while (!sleep_heap_.empty()) {
+        const AsyncTask *task = find_task(sleep_heap_.front().task_id);
+        if (task && !task->is_executed) {
+            break;
+        }
+        std::pop_heap(sleep_heap_.begin(), sleep_heap_.end(),
+                      std::greater<TimedEntry>());
+        sleep_heap_.pop_back();
+    }
+    int64_t timeout_ms = -1;
+    if (!sleep_heap_.empty()) {
+        timeout_ms = std::max<int64_t>(
+            0, sleep_heap_.front().time_ms - epoch_now_ms());
+    } else if (io_poller_.waiter_count() == 0) {
+        return;
+    }
+    if (!poll_io(timeout_ms)) {
+        block_for_ms(timeout_ms);
+    }
+    wake_due_tasks();
+}
+
+bool SimpleEventLoop::poll_io(int64_t timeout_ms) {
+    std::vector<int> woken;
+    if (!io_poller_.wait(timeout_ms, woken)) {
+        return false;
+    }
+    for (int waiter_id : woken) {
+        if (waiter_id < 0) {
+            main_io_ready_ = true;
+            continue;
+        }
+        AsyncTask *task = find_task(waiter_id);
+        if (!task || task->is_executed) {
+            continue;
+        }
+        task->io_wait_fd = -1;
+        if (task->is_io_parked) {
+            task->is_io_parked = false;
+            enqueue_task(waiter_id);
+        }
+    }
+    return true;
+}
+
+void SimpleEventLoop::wait_io(int fd, IoPoller::Interest interest,
+                              const char *builtin_name) {
+    AsyncTask *task = find_task(current_executing_task_id_);
+    int waiter_id = task ? task->task_id : -1;
+    if (!io_poller_.watch(fd, interest, waiter_id)) {
+        throw std::runtime_error(std::string(builtin_name) +
+                                 "() another task is already waiting on fd " +
+                                 std::to_string(fd));
+    }
+    if (task) {
+        // 評価器はスタックを持つため、ここでは待たずにステップを終える
+        task->io_wait_fd = fd;
+        throw YieldException(true, true);
+    }
+
+    // mainは他のタスクを実行しながら待つ（相手は外部のプロセスの
+    // こともあるため、待っているfdがある限りデッドロックとはしない）
+    main_io_ready_ = false;
+    try {
+        while (!main_io_ready_) {
+            wake_due_tasks();
+            if (main_io_ready_) {
+                break;
+            }
+            if (ready_queue_.empty()) {
+                wait_for_next_event();
+                continue;
+            }
+            run_one_cycle();
+        }
+    } catch (...) {
+        io_poller_.unwatch(fd, -1);
+        throw;
+    }
+}
+
+void SimpleEventLoop::close_io(int fd) {
+    std::vector<int> woken;
+    io_poller_.forget(fd, woken);
+    io::close_fd(fd);
+    for (int waiter_id : woken) {
+        if (waiter_id < 0) {
+            main_io_ready_ = true;
+            continue;
+        }
+        AsyncTask *task = find_task(waiter_id);
+        if (task && !task->is_executed) {
+            task->io_wait_fd = -1;
+            if (task->is_io_parked) {
+                task->is_io_parked = false;
+                enqueue_task(waiter_id);
+            }
+        }
+    }
+}
+
+int SimpleEventLoop::connecting_fd() const {
+    const AsyncTask *task = find_task(current_executing_task_id_);
+    return task ? task->connecting_fd : -1;
+}
+
+void SimpleEventLoop::set_connecting_fd(int fd) {
+    if (AsyncTask *task = find_task(current_executing_task_id_)) {
+        task->connecting_fd = fd;
+    }
+}
+
+const std::map<const ASTNode *, size_t> *
+SimpleEventLoop::current_task_positions() const {
+    const AsyncTask *task = find_task(current_executing_task_id_);
+    return task ? task->statement_positions.get() : nullptr;
+}
+
+void SimpleEventLoop::sync_queue_state() {
+    interpreter_.set_has_queued_async_tasks(!is_empty());
+}
+
+bool SimpleEventLoop::has_tasks() const { return live_task_count_ > 0; }
+
+size_t SimpleEventLoop::task_count() const { return live_task_count_; }
 
 AsyncTask *SimpleEventLoop::get_task(int task_id) {
-    auto it = tasks_.find(task_id);
-    if (it != tasks_.end()) {
+    AsyncTask *task = find_task(task_id);
+    if (task) {
         debug_msg(DebugMsgId::EVENT_LOOP_GET_TASK, task_id, "found");
-        return &it->second;
+        return task;
     }
     debug_msg(DebugMsgId::EVENT_LOOP_GET_TASK, task_id, "not found");
     return nullptr;
@@ -832,14 +1438,14 @@ AsyncTask *SimpleEventLoop::get_task(int task_id) {
 
 // v0.12.0: 特定のタスクが完了するまで実行（await用）
 void SimpleEventLoop::run_until_complete(int task_id) {
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    const AsyncTask *task = find_task(task_id);
+    if (!task) {
         debug_msg(DebugMsgId::EVENT_LOOP_RUN_UNTIL_COMPLETE, task_id,
                   "not found");
         return;
     }
 
-    if (it->second.is_executed) {
+    if (task->is_executed) {
         // 既に完了している
         debug_msg(DebugMsgId::EVENT_LOOP_RUN_UNTIL_COMPLETE, task_id,
                   "already completed");
@@ -850,17 +1456,41 @@ void SimpleEventLoop::run_until_complete(int task_id) {
 
     // ターゲットタスクが完了するまで run_one_cycle を繰り返し呼び出す
     // これにより、すべてのタスクが平等にラウンドロビンで実行される
+    // 待っている間に他のawaitが値を受け取ってタスクを解放する場合があるため
+    // 毎回タスクIDから引き直す（解放済みなら完了している）
+    int waiter_id = current_executing_task_id_;
     while (true) {
-        auto target_it = tasks_.find(task_id);
-        if (target_it == tasks_.end() || target_it->second.is_executed) {
+        // v0.14.0: 待っている間にawait元のタスクが取り消された
+        throw_if_cancelled(waiter_id);
+
+        const AsyncTask *target = find_task(task_id);
+        if (!target || target->is_executed) {
             debug_msg(DebugMsgId::EVENT_LOOP_RUN_UNTIL_COMPLETE, task_id,
                       "completed");
             break;
         }
 
-        // キューが空で、ターゲットタスクが未完了の場合
-        if (task_queue_.empty()) {
-            break;
+        // 実行可能なタスクがない場合
+        wake_due_tasks();
+        if (ready_queue_.empty()) {
+            if (!has_pending_wakeups()) {
+                // v0.14.0: チャネル待ちのタスクを再開させるタスクがない
+                if (target->is_channel_parked) {
+                    throw std::runtime_error(
+                        "await deadlock: the awaited task is blocked on a "
+                        "channel");
+                }
+                // 待機先のwaitersに停止したタスクも再開させるタスクがない
+                if (target->is_waiting) {
+                    throw std::runtime_error(
+                        "await deadlock: the awaited task is waiting for a "
+                        "task that cannot finish");
+                }
+                break;
+            }
+            // sleep中のタスクの起床時刻までブロック（空回りしない）
+            wait_for_next_event();
+            continue;
         }
 
         // 1サイクル実行
@@ -868,31 +1498,213 @@ void SimpleEventLoop::run_until_complete(int task_id) {
     }
 }
 
+// `await sleep(ms);` / `await sleep_ms(ms);` 文かどうか
+// （同名のユーザー定義関数がある場合は対象外）
+bool SimpleEventLoop::is_sleep_await_statement(const ASTNode *stmt) {
+    if (stmt->node_type != ASTNodeType::AST_UNARY_OP ||
+        !stmt->is_await_expression || !stmt->left) {
+        return false;
+    }
+    const ASTNode *call = stmt->left.get();
+    if (call->node_type != ASTNodeType::AST_FUNC_CALL || call->left ||
+        call->arguments.size() != 1 ||
+        (call->name != "sleep" && call->name != "sleep_ms")) {
+        return false;
+    }
+    return interpreter_.find_function(call->name) == nullptr;
+}
+
+// v0.14.0: concurrent_await - 全タスクの完了（またはErrでの打ち切り）を待つ
+int SimpleEventLoop::run_until_all_complete(const std::vector<int> &task_ids) {
+    return run_task_group(task_ids, false);
+}
+
+// v0.14.0: race - 最初に完了したタスクを待ち、残りを取り消す
+int SimpleEventLoop::run_until_any_complete(const std::vector<int> &task_ids) {
+    return run_task_group(task_ids, true);
+}
+
+int SimpleEventLoop::run_task_group(const std::vector<int> &task_ids,
+                                    bool cancel_on_first_completion) {
+    int group_id = next_group_id_++;
+    TaskGroup &group = groups_[group_id];
+    group.task_ids = task_ids;
+    group.cancel_on_first_completion = cancel_on_first_completion;
+
+    std::vector<const AsyncTask *> members;
+    for (int task_id : task_ids) {
+        AsyncTask *task = find_task(task_id);
+        if (!task) {
+            continue;
+        }
+        members.push_back(task);
+        task->group_id = group_id;
+    }
+    // 呼び出し時点で完了済みのタスクで決着する場合もある
+    for (int task_id : task_ids) {
+        AsyncTask *task = find_task(task_id);
+        if (task && task->is_executed) {
+            resolve_task_group(*task);
+        }
+    }
+
+    auto all_executed = [&members]() {
+        for (const AsyncTask *member : members) {
+            if (!member->is_executed) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto release_group = [&]() {
+        for (int task_id : task_ids) {
+            AsyncTask *task = find_task(task_id);
+            if (task && task->group_id == group_id) {
+                task->group_id = -1;
+            }
+        }
+        groups_.erase(group_id);
+    };
+
+    // run_until_completeと同じく、全タスクをラウンドロビンで進める
+    int waiter_id = current_executing_task_id_;
+    int resolved_index = -1;
+    try {
+        while (group.resolved_index < 0 && !all_executed()) {
+            throw_if_cancelled(waiter_id);
+
+            wake_due_tasks();
+            if (ready_queue_.empty()) {
+                if (!has_pending_wakeups()) {
+                    break;
+                }
+                wait_for_next_event();
+                continue;
+            }
+            run_one_cycle();
+        }
+        resolved_index = group.resolved_index;
+    } catch (...) {
+        release_group();
+        throw;
+    }
+    release_group();
+    return resolved_index;
+}
+
+void SimpleEventLoop::resolve_task_group(AsyncTask &task) {
+    auto group_it = groups_.find(task.group_id);
+    if (group_it == groups_.end() || task.is_cancelled) {
+        return;
+    }
+    TaskGroup &group = group_it->second;
+    if (group.resolved_index >= 0) {
+        return;
+    }
+    if (!group.cancel_on_first_completion) {
+        // 戻り値はFuture.valueに設定されている
+        const Variable *future =
+            task.use_internal_future ? &task.internal_future : task.future_var;
+        if (!future || !task.has_return_value || !task.return_is_struct) {
+            return;
+        }
+        auto value_it = future->struct_members.find("value");
+        if (value_it == future->struct_members.end() ||
+            !is_error_result(value_it->second)) {
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < group.task_ids.size(); ++i) {
+        if (group.task_ids[i] == task.task_id) {
+            group.resolved_index = static_cast<int>(i);
+            break;
+        }
+    }
+    // 決着したので残りのタスクはこれ以上インタプリタを消費させない
+    for (int task_id : group.task_ids) {
+        if (task_id != task.task_id) {
+            debug_msg(DebugMsgId::EVENT_LOOP_TASK_CANCELLED, task_id,
+                      task.group_id);
+            cancel_task(task_id);
+        }
+    }
+}
+
+void SimpleEventLoop::cancel_task(int task_id) {
+    AsyncTask *task_ptr = find_task(task_id);
+    if (!task_ptr || task_ptr->is_executed) {
+        return;
+    }
+    AsyncTask &task = *task_ptr;
+    task.is_cancelled = true;
+    task.is_executed = true;
+
+    // Futureは完了扱いにする（awaitすると既定値が返る）
+    Variable *future =
+        task.use_internal_future ? &task.internal_future : task.future_var;
+    if (future) {
+        auto ready_it = future->struct_members.find("is_ready");
+        if (ready_it != future->struct_members.end()) {
+            ready_it->second.value = 1;
+        }
+    }
+
+    // await中だったsleepは待つ必要がなくなる
+    if (task.is_waiting) {
+        const AsyncTask *waited = find_task(task.waiting_for_task_id);
+        if (waited && waited->function_node == nullptr) {
+            cancel_task(task.waiting_for_task_id);
+        }
+    }
+
+    // チャネルの受信待ちから外す（送信待ちの値は受信できるまま残す）
+    if (task.channel_receiver) {
+        task.channel_receiver->abandoned = true;
+        task.channel_receiver.reset();
+    }
+
+    if (task.io_wait_fd >= 0) {
+        io_poller_.unwatch(task.io_wait_fd, task_id);
+        task.io_wait_fd = -1;
+    }
+
+    // 接続を待っていたソケットは呼び出し元に渡らないので閉じる
+    if (task.connecting_fd >= 0) {
+        try {
+            io::close_fd(task.connecting_fd);
+        } catch (const std::runtime_error &) {
+        }
+        task.connecting_fd = -1;
+    }
+
+    // キュー・sleepヒープ上の要素は取り出し時に完了済みとして捨てられる
+    // 実行中（await中）のタスクはthrow_if_cancelledでステップを巻き戻す
+    wake_waiters(task);
+    sync_queue_state();
+}
+
+void SimpleEventLoop::throw_if_cancelled(int task_id) {
+    if (task_id < 0) {
+        return;
+    }
+    const AsyncTask *task = find_task(task_id);
+    if (task && task->is_cancelled) {
+        throw TaskCancelledException(task_id);
+    }
+}
+
 // v0.12.0: タスクをsleep状態にする
 void SimpleEventLoop::sleep_task(int task_id, int64_t duration_ms) {
-    auto it = tasks_.find(task_id);
-    if (it == tasks_.end()) {
+    AsyncTask *task_ptr = find_task(task_id);
+    if (!task_ptr) {
         return;
     }
 
-    AsyncTask &task = it->second;
+    AsyncTask &task = *task_ptr;
 
     // 現在時刻を取得してwake_up_timeを設定
-    // now()関数と同じ実装
-    int64_t current_time_ms;
-#ifdef _WIN32
-    FILETIME ft;
-    GetSystemTimeAsFileTime(&ft);
-    ULARGE_INTEGER uli;
-    uli.LowPart = ft.dwLowDateTime;
-    uli.HighPart = ft.dwHighDateTime;
-    current_time_ms = (uli.QuadPart / 10000) - 11644473600000LL;
-#else
-    struct timeval tv;
-    gettimeofday(&tv, nullptr);
-    current_time_ms = static_cast<int64_t>(tv.tv_sec) * 1000 +
-                      static_cast<int64_t>(tv.tv_usec) / 1000;
-#endif
+    int64_t current_time_ms = epoch_now_ms();
 
     task.is_sleeping = true;
     task.wake_up_time_ms = current_time_ms + duration_ms;
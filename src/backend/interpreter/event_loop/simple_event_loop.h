@@ -1,22 +1,37 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <vector>
+
+#include "io_poller.h"
+#include "priority_ready_queue.h"
 
 // 前方宣言
 class Interpreter;
+struct Variable;
 struct AsyncTask;
+struct ASTNode;
 
 namespace cb {
 
+class Channel;
+class UserPriorityQueue;
+struct ChannelWaiter;
+using ChannelWaiterList = std::vector<std::shared_ptr<ChannelWaiter>>;
+
 // v0.12.0: SimpleEventLoop
 // async関数をラウンドロビン方式で実行する
 // バックグラウンドタスクはメインプログラム終了時に自動的に破棄される
 class SimpleEventLoop {
   public:
     SimpleEventLoop(Interpreter &interpreter);
-    ~SimpleEventLoop() = default;
+    ~SimpleEventLoop();
 
     // タスクを登録してキューに追加
     // 戻り値: タスクID
@@ -27,45 +42,242 @@ class SimpleEventLoop {
 
     // イベントループを1サイクル実行（全タスクを1ステップずつ）
     // v0.12.0: async関数呼び出し時にバックグラウンド実行を実現
-    void run_one_cycle();
+    // 戻り値: false = 実行可能なタスクがなかった
+    bool run_one_cycle();
 
     // 特定のタスクが完了するまで実行（await用）
     // 指定されたタスクを優先的に実行し、完了するまでブロック
     void run_until_complete(int task_id);
 
-    // タスクキューが空かどうか
+    // v0.14.0: 複数タスクを並行実行し、すべての完了を待つ（concurrent_await用）
+    // Result::Errで完了したタスクがあれば残りを取り消して打ち切る
+    // 戻り値: 最初にErrで完了したタスクの位置（なければ-1）
+    int run_until_all_complete(const std::vector<int> &task_ids);
+
+    // v0.14.0: 複数タスクを並行実行し、最初の完了を待つ（race用）
+    // 残りのタスクは取り消される
+    // 戻り値: 最初に完了したタスクの位置
+    int run_until_any_complete(const std::vector<int> &task_ids);
+
+    // v0.14.0: 未完了のタスクを取り消す（以降は実行されない）
+    void cancel_task(int task_id);
+
+    // 実行待ち・sleep中のタスクがどちらもないかどうか
     bool is_empty() const;
 
     // 登録されているタスクがあるかどうか
     bool has_tasks() const;
 
-    // 登録されているタスク数
+    // 登録されているタスク数（解放済みのタスクは含まない）
     size_t task_count() const;
 
-    // タスクIDからタスクを取得
+    // タスクIDからタスクを取得（解放済みのタスクIDならnullptr）
     AsyncTask *get_task(int task_id);
 
+    // v0.14.0: awaitでFutureの値を受け取り終えた完了済みタスクを解放する
+    // スロットは次に登録されるタスクが再利用する（待機中のタスクや
+    // concurrent_await/raceのグループから参照されている間は解放しない）
+    void release_task(int task_id);
+
+    // v0.14.0: Futureを捨てた（式文として呼び出した）タスクを完了時に解放する
+    void detach_task(int task_id);
+
     // v0.12.0: タスクをsleep状態にする（非同期sleep用）
     void sleep_task(int task_id, int64_t duration_ms);
 
+    // v0.14.0: タスクの優先度（値が小さいほど先に実行、既定0）
+    // 実行待ちのタスクは新しい優先度の実行キューへ移す
+    void set_task_priority(int task_id, int priority);
+    // v0.14.0: タスクのデッドライン（エポックからのミリ秒）
+    // 過ぎても完了していないタスクは実行待ちの最高優先度で実行する
+    void set_task_deadline(int task_id, int64_t deadline_ms);
+
+    // v0.14.0: Cb側のTaskQueue用の優先度キュー（priority_queue_*）
+    // capacity: 0 = 上限なし。戻り値: ハンドル（1以上）
+    int create_user_queue(int capacity);
+    UserPriorityQueue *user_queue(int handle);
+
+    // v0.14.0: チャネル（channel_*）
+    // 戻り値: ハンドル（1以上）
+    int create_channel(size_t capacity);
+    Channel *channel(int handle);
+    // 送信: 満杯なら、タスクは値を送信待ちに並べてすぐに戻り、次の切り替え点で
+    // 受信されるまで停止する。mainは受信されるまで他のタスクを実行して待つ
+    // 戻り値: false = close済み（値は送らない）
+    bool channel_send(Channel &channel, Variable &value);
+    // 受信: 空なら、タスクは受信待ちに並んでYieldExceptionでステップを終え、
+    // 値が受け渡されたら文を再実行して受け取る。mainは届くまで待つ
+    // 戻り値: false = close済みで空
+    bool channel_recv(Channel &channel, Variable &out);
+    // 受信できる値が届くかcloseされるまで待つ（待ち方はchannel_recvと同じ）
+    // 戻り値: false = close済みで空
+    bool channel_wait(Channel &channel);
+    // 以降の送信を禁止し、受信待ちのタスクを再開させる
+    void channel_close(Channel &channel);
+
+    // v0.14.0: 非同期I/O（io_* 組み込み関数）
+    // fdが読み書きできるようになるまで待つ。タスクはfdを登録して
+    // YieldExceptionでステップを終え、準備できたら文を再実行する
+    // mainは準備できるまで他のタスクを実行して待つ
+    void wait_io(int fd, IoPoller::Interest interest, const char *builtin_name);
+    // fdを閉じる（待っていたコンテキストは再開し、閉じたfdの操作でエラーになる）
+    void close_io(int fd);
+    // 実行中のタスクが接続を待っているソケット（mainと接続中でなければ-1）
+    // タスクは書き込み待ちから再開すると文を再実行するため、ここに残した
+    // ソケットで接続を続ける
+    int connecting_fd() const;
+    void set_connecting_fd(int fd);
+
+    // v0.14.0: 実行中のタスク本体の再開位置マップ（タスク外ならnullptr）
+    // これと異なるマップの文はタスクから呼んだ関数の中で、再開時は
+    // 関数の先頭から実行し直される
+    const std::map<const ASTNode *, size_t> *current_task_positions() const;
+
+    // v0.14.0: スケジューラの統計（--async-stats）
+    // 時間の計測（ステップの実行時間・実行キューでの待ち時間）は
+    // 有効にした場合のみ行う
+    struct SchedulerStats {
+        uint64_t tasks = 0;       // 登録されたタスク数
+        uint64_t steps = 0;       // 実行したステップ数
+        uint64_t preemptions = 0; // タイムスライス切れで中断したステップ数
+        int64_t statements = 0;   // タスク内で実行した文の数
+        int64_t total_step_us = 0;
+        int64_t max_step_us = 0;
+        uint64_t queue_waits = 0; // 待ち時間を計測した回数
+        int64_t total_queue_wait_us = 0;
+        int64_t max_queue_wait_us = 0; // 実行可能になってから実行までの最大
+    };
+    void set_stats_enabled(bool enabled) { stats_enabled_ = enabled; }
+    const SchedulerStats &stats() const { return stats_; }
+    void print_stats(std::FILE *out) const;
+
   private:
+    // v0.14.0: タスクIDからスロットを引く（O(1)、解放済みならnullptr）
+    AsyncTask *find_task(int task_id);
+    const AsyncTask *find_task(int task_id) const;
+
     // 1タスクを1ステートメント実行
     // 戻り値: true = タスクを継続, false = タスク完了
     bool execute_one_step(int task_id);
 
+    // v0.14.0: タスクをsleepさせて実行できるトップレベルの `await sleep(ms);`
+    bool is_sleep_await_statement(const ASTNode *stmt);
+
     // タスクスコープの初期化
     void initialize_task_scope(AsyncTask &task);
 
-    // タスク完了時の後処理（selfの同期など）
+    // v0.14.0: ステップ終了時にスコープを閉じ、実行フレームをタスクへ戻す
+    void suspend_task_frame(AsyncTask &task, size_t scope_stack_size_before);
+
+    // タスク完了時の後処理（selfの同期、実行フレームの破棄など）
     void finalize_task_if_needed(int task_id);
     void sync_async_self_receiver(AsyncTask &task);
 
+    // v0.14.0: キューの状態をInterpreterのキャッシュへ反映
+    void sync_queue_state();
+
+    // v0.14.0: 待機中なら待機先のwaitersへ、sleep中ならsleepヒープへ、
+    // それ以外は実行キューへ入れる
+    void enqueue_task(int task_id);
+    // v0.14.0: 優先度別の実行キューへの出し入れ
+    // 取り出すたびにデッドラインを過ぎたタスクを引き上げ、
+    // kAgingInterval回ごとに低優先度のタスクを1段引き上げる
+    void push_ready(int task_id);
+    int pop_ready();
+    void promote_overdue_tasks();
+    // 実行待ちの最高優先度（デッドラインを過ぎたタスク用）
+    int overdue_priority(int priority) const {
+        return std::min(priority, ready_queue_.top_priority(priority));
+    }
+    // 実行キューへ入れたタスクの待ち時間の計測を開始・終了する
+    void mark_ready(int task_id);
+    void record_queue_wait(int task_id);
+    // 起床時刻を過ぎたタスクと、準備できたfdを待っていたタスクを
+    // 実行キューへ移す（fdはkIoPollInterval回に1回、または実行キューが
+    // 空のときに待たずに確認する）
+    void wake_due_tasks();
+    // 完了したタスクを待っていたタスクを実行キューへ戻す
+    void wake_waiters(AsyncTask &task);
+    // 最も早い起床時刻か、待っているfdの準備ができるまでブロックする
+    // v0.14.0: epollを使える場合はepoll_waitで待つ
+    void wait_for_next_event();
+    // v0.14.0: 準備できたfdを待っていたコンテキストを再開させる
+    // 戻り値: false = epollを使えない
+    bool poll_io(int64_t timeout_ms);
+    // sleep中・I/O待ちのタスクがあるか（待てば実行できるタスクがあるか）
+    bool has_pending_wakeups() const {
+        return !sleep_heap_.empty() || io_poller_.waiter_count() > 0;
+    }
+    // v0.14.0: チャネル操作で待ち行列から外れたタスクを実行キューへ戻す
+    void wake_channel_waiters(const ChannelWaiterList &woken);
+    // mainがチャネルで待つ間、doneがtrueになるまで他のタスクを実行する
+    // 実行できるタスクもsleep中のタスクもなくなればデッドロックとして例外
+    void wait_channel(const char *builtin_name,
+                      const std::function<bool()> &done);
+
+    // v0.14.0: タスクグループを並行実行し、決着した位置を返す
+    int run_task_group(const std::vector<int> &task_ids,
+                       bool cancel_on_first_completion);
+    // グループのタスクが完了したとき、決着していれば残りを取り消す
+    void resolve_task_group(AsyncTask &task);
+    // await中のタスクが取り消されていればTaskCancelledExceptionを送出する
+    void throw_if_cancelled(int task_id);
+
+    // v0.14.0: concurrent_await/raceで並行実行するタスクの組
+    struct TaskGroup {
+        std::vector<int> task_ids;
+        bool cancel_on_first_completion = false; // race: 最初の完了で決着
+        int resolved_index = -1; // raceの勝者 / 最初にErrで完了した位置
+    };
+
+    // sleepヒープ・デッドラインヒープの要素（time_msの最小ヒープ）
+    struct TimedEntry {
+        int64_t time_ms;
+        int task_id;
+        bool operator>(const TimedEntry &other) const {
+            return time_ms > other.time_ms;
+        }
+    };
+
+    // v0.14.0: タスクを格納するスロット
+    // タスクIDの下位kSlotBitsビットはスロット番号+1、上位ビットはスロットの
+    // 再利用回数（世代）。解放済みタスクの古いIDは世代が一致しないため、
+    // 同じスロットを再利用した別のタスクを指すことはない
+    // タスク本体はスロットごとに一度だけ確保し、再利用時は上書きする
+    // （スロット配列が伸びてもタスクへの参照は解放されるまで有効）
+    struct TaskSlot {
+        std::unique_ptr<AsyncTask> task;
+        uint32_t generation = 0;
+        bool in_use = false;
+        int64_t ready_since_us = 0; // 実行キューに入った時刻（統計用）
+    };
+    static constexpr int kSlotBits = 20;
+    static constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1;
+    static constexpr uint32_t kMaxGeneration = (1u << (31 - kSlotBits)) - 1;
+
     Interpreter &interpreter_;
-    std::deque<int> task_queue_;     // 実行待ちタスクID
-    std::map<int, AsyncTask> tasks_; // タスクID -> AsyncTask
-    int next_task_id_ = 1;           // 次のタスクID
+    PriorityReadyQueue ready_queue_; // 実行待ちタスクID（優先度別）
+    std::vector<TimedEntry> sleep_heap_;    // sleep中タスク（起床時刻順）
+    std::vector<TimedEntry> deadline_heap_; // デッドライン付きタスク
+    int dispatches_since_aging_ = 0;
+    // 実行キューから取り出した回数がこれに達するごとにエージング
+    static constexpr int kAgingInterval = 8;
+    // Cb側のTaskQueueが使う優先度キュー（ハンドル-1が添字）
+    std::vector<std::unique_ptr<UserPriorityQueue>> user_queues_;
+    std::vector<std::unique_ptr<Channel>> channels_; // ハンドル-1が添字
+    IoPoller io_poller_;
+    int wakeups_since_io_poll_ = 0;
+    static constexpr int kIoPollInterval = 16;
+    bool main_io_ready_ = false; // mainが待っているfdの準備ができた
+    std::vector<TaskSlot> slots_;
+    std::vector<uint32_t> free_slots_; // 再利用できるスロット番号
+    size_t live_task_count_ = 0;       // 解放されていないタスク数
+    std::map<int, TaskGroup> groups_; // グループID -> TaskGroup
+    int next_group_id_ = 1;
     int current_executing_task_id_ =
         -1; // 現在execute_one_step中のタスクID (-1=なし)
+    SchedulerStats stats_;
+    bool stats_enabled_ = false;
 };
 
 } // namespace cb
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../core/interpreter.h"
+#include "priority_ready_queue.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cb {
+
+// v0.14.0: Cb側のTaskQueueが使う優先度キュー（priority_queue_* 組み込み関数）
+// 並べ替えはSlotPriorityQueueが行い、値はスロット番号ごとにムーブして保持する
+class UserPriorityQueue {
+  public:
+    // capacity: 0 = 上限なし
+    explicit UserPriorityQueue(int capacity) : slots_(capacity) {}
+
+    // 満杯ならfalse（valueはそのまま）
+    bool push(int priority, Variable &value) {
+        int slot = slots_.push(priority);
+        if (slot < 0) {
+            return false;
+        }
+        if (static_cast<size_t>(slot) >= values_.size()) {
+            values_.resize(static_cast<size_t>(slot) + 1);
+        }
+        values_[slot] = std::move(value);
+        return true;
+    }
+
+    // 最も優先度の高い値を取り出す（空ならfalse）
+    bool pop(Variable &out) {
+        int slot = slots_.pop();
+        if (slot < 0) {
+            return false;
+        }
+        out = std::move(values_[slot]);
+        values_[slot] = Variable();
+        return true;
+    }
+
+    void clear() {
+        slots_.clear();
+        values_.clear();
+    }
+
+    size_t size() const { return slots_.size(); }
+
+  private:
+    SlotPriorityQueue slots_;
+    std::vector<Variable> values_;
+};
+
+} // namespace cb
@@ -20,7 +20,7 @@ void execute_member_assignment(StatementExecutor *executor,
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "DEBUG: execute_member_assignment - starting");
     }
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(
             dbg_buf, sizeof(dbg_buf),
@@ -31,7 +31,7 @@ void execute_member_assignment(StatementExecutor *executor,
     }
 
     if (member_access->left) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: member_access->left->node_type=%d, name='%s'",
@@ -68,7 +68,7 @@ void execute_member_assignment(StatementExecutor *executor,
         }
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "DEBUG: Struct member access - variable: %s",
@@ -80,7 +80,7 @@ void execute_member_assignment(StatementExecutor *executor,
                member_access->left->node_type == ASTNodeType::AST_UNARY_OP &&
                member_access->left->op == "*") {
         // デリファレンスされたポインタへのメンバアクセス: (*ptr).member = value
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Dereference member access assignment - member=%s",
@@ -144,7 +144,7 @@ void execute_member_assignment(StatementExecutor *executor,
                 member_access->left->node_type == ASTNodeType::AST_ARRAY_REF)) {
         // ネストメンバアクセス: obj.mid.data.value = 100
         // または配列を含むネスト: container.shapes[0].edges[0].start.x = 10
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Nested/Array member access assignment - member=%s",
@@ -199,7 +199,7 @@ void execute_member_assignment(StatementExecutor *executor,
         auto &members = parent_struct->get_struct_members();
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -210,7 +210,7 @@ void execute_member_assignment(StatementExecutor *executor,
             }
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Resolved parent struct, final member: %s",
@@ -254,7 +254,7 @@ void execute_member_assignment(StatementExecutor *executor,
                       "DEBUG: member_ref after assignment -> value=%lld, ");
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Nested member assignment completed: %s = %lld",
@@ -301,7 +301,7 @@ void execute_member_assignment(StatementExecutor *executor,
                     individual_var->double_value = member_ref.double_value;
                     individual_var->quad_value = member_ref.quad_value;
                 }
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "DEBUG: Synced individual variable: %s = %lld",
@@ -335,7 +335,7 @@ void execute_member_assignment(StatementExecutor *executor,
         obj_name = array_base_name + "[" + std::to_string(index) + "]";
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "DEBUG: Struct array element member assignment: %s.%s",
@@ -363,7 +363,7 @@ void execute_member_assignment(StatementExecutor *executor,
         int64_t ptr_value = 0;
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "DEBUG: deref_target node_type=%d (MEMBER_ACCESS=%d)",
@@ -698,7 +698,7 @@ void execute_member_assignment(StatementExecutor *executor,
         // 右辺の構造体メンバ配列要素を取得
         Variable *right_member_var =
             interpreter.get_struct_member(right_obj_name, right_member_name);
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: right_member_var type=%d, is_array=%d",
@@ -741,7 +741,7 @@ void execute_arrow_assignment(StatementExecutor *executor,
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "DEBUG: execute_arrow_assignment - starting");
     }
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(
             dbg_buf, sizeof(dbg_buf),
@@ -1223,7 +1223,7 @@ void execute_arrow_assignment(StatementExecutor *executor,
             break;
         case TYPE_POINTER:
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -1246,7 +1246,7 @@ void execute_arrow_assignment(StatementExecutor *executor,
 
             const char *str_data = strdup(new_value.str_value.c_str());
             *reinterpret_cast<const char **>(member_addr) = str_data;
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
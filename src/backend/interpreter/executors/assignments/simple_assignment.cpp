@@ -643,7 +643,7 @@ void execute_assignment(StatementExecutor *executor, Interpreter &interpreter,
                 obj_name = node->left->left->left->name;
             } else {
                 if (node->left->left->left) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "ERROR: Invalid node type for object: %d",
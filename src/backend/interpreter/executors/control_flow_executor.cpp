@@ -33,6 +33,9 @@ void ControlFlowExecutor::execute_while_statement(const ASTNode *node) {
     // whileループ用のdeferスコープのみを作成（変数スコープは作成しない）
     interpreter_->push_defer_scope();
 
+    // v0.14.0: 本体内のbreak/continueを完了レコードで受け取る
+    auto loop_frame = interpreter_->enter_loop_frame();
+
     try {
         int iteration = 0;
         while (true) {
@@ -51,9 +54,26 @@ void ControlFlowExecutor::execute_while_statement(const ASTNode *node) {
                 debug_msg(DebugMsgId::INTERPRETER_WHILE_BODY_EXEC, iteration);
                 interpreter_->execute_statement(node->body.get());
 
+                if (interpreter_->has_pending_completion()) {
+                    CompletionType completion =
+                        interpreter_->pending_completion();
+                    if (completion == CompletionType::CONTINUE) {
+                        interpreter_->clear_completion();
+                        continue;
+                    }
+                    if (completion == CompletionType::BREAK) {
+                        interpreter_->clear_completion();
+                        debug_msg(DebugMsgId::INTERPRETER_WHILE_BREAK, "");
+                    }
+                    // returnは完了レコードを残したまま呼び出し元へ伝播
+                    break;
+                }
+
                 // v0.12.0: auto_yieldモードの場合、各イテレーション後にyield
                 // これにより、whileループが他のタスクを独占しない
-                if (interpreter_->is_in_auto_yield_mode()) {
+                // v0.14.0: タイムスライス（量子）を使い切ったイテレーションでのみ
+                if (interpreter_->is_in_auto_yield_mode() &&
+                    interpreter_->time_slice_expired()) {
                     throw YieldException(true); // ループ内の自動yield
                 }
 
@@ -98,6 +118,9 @@ void ControlFlowExecutor::execute_for_statement(const ASTNode *node) {
               "[FOR_LOOP] About to call push_defer_scope()");
     interpreter_->push_defer_scope();
 
+    // v0.14.0: 本体内のbreak/continueを完了レコードで受け取る
+    auto loop_frame = interpreter_->enter_loop_frame();
+
     // v0.13.0 Phase 2.0 FIX: init式で宣言された変数名を記憶
     std::string init_var_name;
     bool init_var_declared = false;
@@ -151,6 +174,22 @@ void ControlFlowExecutor::execute_for_statement(const ASTNode *node) {
             try {
                 debug_msg(DebugMsgId::INTERPRETER_FOR_BODY_EXEC, iteration);
                 interpreter_->execute_statement(node->body.get());
+
+                if (interpreter_->has_pending_completion()) {
+                    CompletionType completion =
+                        interpreter_->pending_completion();
+                    if (completion != CompletionType::CONTINUE) {
+                        if (completion == CompletionType::BREAK) {
+                            interpreter_->clear_completion();
+                            debug_msg(DebugMsgId::INTERPRETER_WHILE_BREAK);
+                        }
+                        // returnは完了レコードを残したまま呼び出し元へ伝播
+                        break;
+                    }
+                    // continueはupdate部分だけ実行
+                    interpreter_->clear_completion();
+                    debug_msg(DebugMsgId::INTERPRETER_FOR_CONTINUE, iteration);
+                }
             } catch (const ContinueException &e) {
                 // continue文でループ継続、update部分だけ実行
                 debug_msg(DebugMsgId::INTERPRETER_FOR_CONTINUE, iteration);
@@ -158,7 +197,8 @@ void ControlFlowExecutor::execute_for_statement(const ASTNode *node) {
                 // v0.12.0: auto_yieldモードでのyield
                 if (yield_exc.is_from_loop) {
                     // 自動yield時のみupdate式を先に実行
-                    if (node->update_expr) {
+                    // v0.14.0: 文の再実行（チャネルの受信待ち）では実行しない
+                    if (node->update_expr && !yield_exc.retry_statement) {
                         debug_msg(DebugMsgId::INTERPRETER_FOR_UPDATE_EXEC,
                                   iteration);
                         interpreter_->execute_statement(
@@ -178,7 +218,9 @@ void ControlFlowExecutor::execute_for_statement(const ASTNode *node) {
 
             // v0.12.0: auto_yieldモードの場合、各イテレーション後にyield
             // これにより、forループが他のタスクを独占しない
-            if (interpreter_->is_in_auto_yield_mode()) {
+            // v0.14.0: タイムスライス（量子）を使い切ったイテレーションでのみ
+            if (interpreter_->is_in_auto_yield_mode() &&
+                interpreter_->time_slice_expired()) {
                 throw YieldException(true); // ループ内の自動yield
             }
 
@@ -83,38 +83,38 @@ void execute_variable_declaration(StatementExecutor *executor,
                 ", target_value: " + std::to_string(target_var->value));
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "[REF_DEBUG] Reference created:");
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  ref_name=%s",
                          node->name.c_str());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  target_name=%s",
                          target_var_name.c_str());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  target_var ptr=%p",
                          (void *)target_var);
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "  target_var->is_struct=%d",
                          target_var->is_struct);
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "  target_var->struct_type_name=%s",
                          target_var->struct_type_name.c_str());
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "  target_var->struct_members.size()=%zu",
@@ -122,7 +122,7 @@ void execute_variable_declaration(StatementExecutor *executor,
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
             if (target_var->is_struct && !target_var->struct_members.empty()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "  First member: name=%s, value=%lld",
@@ -449,7 +449,7 @@ void execute_variable_declaration(StatementExecutor *executor,
         var.enum_type_name = node->type_name; // 例: "Option_int"
         var.is_assigned = false;              // 初期化前はfalse
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[ENUM_VAR_DECL] Set is_enum=true for variable '%s'",
@@ -25,9 +25,8 @@ void StatementExecutor::execute_statement(const ASTNode *node) {
 
     // v0.12.0: バックグラウンドタスクを1サイクル実行
     // async関数呼び出し（awaitなし）時に、ラウンドロビンでタスクを進める
-    if (interpreter_.get_simple_event_loop().has_tasks()) {
-        interpreter_.get_simple_event_loop().run_one_cycle();
-    }
+    // v0.14.0: 実行中のコンテキストのタイムスライスを使い切った場合のみ
+    interpreter_.run_queued_tasks_if_slice_expired();
 }
 
 void StatementExecutor::execute(const ASTNode *node) {
@@ -119,7 +118,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
 
     if (!member_array_access || member_array_access->node_type !=
                                     ASTNodeType::AST_MEMBER_ARRAY_ACCESS) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Not AST_MEMBER_ARRAY_ACCESS, node_type=%d",
@@ -171,7 +170,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
         }
     } else {
         if (member_array_access->left) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -255,7 +254,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
         std::string element_key =
             array_member_name + "[" + std::to_string(array_index) + "]";
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Looking for struct array element: %s",
@@ -281,7 +280,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
                 debug_msg(DebugMsgId::GENERIC_DEBUG,
                           "DEBUG: Available keys in parent struct_members:");
                 for (const auto &pair : parent_struct->struct_members) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf), "  - %s",
                                  pair.first.c_str());
@@ -292,7 +291,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
                     DebugMsgId::GENERIC_DEBUG,
                     "DEBUG: Available keys in array_member struct_members:");
                 for (const auto &pair : array_member->struct_members) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf), "  - %s",
                                  pair.first.c_str());
@@ -322,7 +321,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
         if (node->right->node_type == ASTNodeType::AST_STRING_LITERAL) {
             member_it->second.str_value = node->right->str_value;
             member_it->second.type = TYPE_STRING;
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "DEBUG_ASSIGN: Assigned string '%s' to %s.%s[%d].%s",
@@ -337,7 +336,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
             if (typed_value.is_floating()) {
                 member_it->second.double_value = typed_value.as_double();
                 member_it->second.type = typed_value.type.type_info;
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "DEBUG_ASSIGN: Assigned double %f to %s.%s[%d].%s",
@@ -350,7 +349,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
                 int64_t value = typed_value.as_numeric();
                 member_it->second.value = value;
                 member_it->second.type = typed_value.type.type_info;
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -378,7 +377,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
             }
             direct_var->type = member_it->second.type;
             direct_var->is_assigned = true;
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -402,7 +401,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
             }
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DEBUG: Nested struct array member assigned: %s.%s[%d].%s",
@@ -455,7 +454,7 @@ void StatementExecutor::execute_member_array_assignment(const ASTNode *node) {
 
             Variable *right_member_var = interpreter_.get_struct_member(
                 right_obj_name, right_member_name);
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "DEBUG: AST_ARRAY_REF right_member_var type=%d, "
@@ -722,7 +721,7 @@ void StatementExecutor::execute_self_member_assignment(
 
     if (self_var && receiver_info && !receiver_info->str_value.empty()) {
         original_receiver_path = receiver_info->str_value + "." + member_name;
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "SELF_ASSIGN_DEBUG: Original receiver path: %s",
@@ -739,7 +738,7 @@ void StatementExecutor::execute_self_member_assignment(
 
         // 元の変数のメンバーも同時に更新
         if (!original_receiver_path.empty()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_ASSIGN_DEBUG: Looking for original member: %s",
@@ -754,7 +753,7 @@ void StatementExecutor::execute_self_member_assignment(
                 original_member->str_value = value_node->str_value;
                 original_member->type = TYPE_STRING;
                 original_member->is_assigned = true;
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "SELF_ASSIGN_SYNC: %s = \"%s\"",
@@ -763,7 +762,7 @@ void StatementExecutor::execute_self_member_assignment(
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
             } else {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -774,7 +773,7 @@ void StatementExecutor::execute_self_member_assignment(
             }
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "SELF_ASSIGN: %s = \"%s\"",
                      member_name.c_str(), value_node->str_value.c_str());
@@ -830,7 +829,7 @@ void StatementExecutor::execute_self_member_assignment(
 
             // 元の変数のメンバーも同時に更新
             if (!original_receiver_path.empty()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -846,7 +845,7 @@ void StatementExecutor::execute_self_member_assignment(
                     original_member->str_value = source_var->str_value;
                     original_member->type = TYPE_STRING;
                     original_member->is_assigned = true;
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -861,7 +860,7 @@ void StatementExecutor::execute_self_member_assignment(
                 }
             }
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_ASSIGN: %s = \"%s\" (from variable)",
@@ -884,7 +883,7 @@ void StatementExecutor::execute_self_member_assignment(
 
             // 元の変数のメンバーも同時に更新
             if (!original_receiver_path.empty()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -903,7 +902,7 @@ void StatementExecutor::execute_self_member_assignment(
                         original_member->type = TYPE_INT;
                     }
                     original_member->is_assigned = true;
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "SELF_ASSIGN_SYNC: %s = %lld (from variable)",
@@ -917,7 +916,7 @@ void StatementExecutor::execute_self_member_assignment(
                 }
             }
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_ASSIGN: %s = %lld (from variable)",
@@ -936,7 +935,7 @@ void StatementExecutor::execute_self_member_assignment(
             if (value_node->name == "+=" || value_node->name == "-=" ||
                 value_node->name == "*=" || value_node->name == "/=") {
                 // 複合代入は既に評価済みの値として処理
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "SELF_COMPOUND_ASSIGN: %s %s= %lld",
@@ -959,7 +958,7 @@ void StatementExecutor::execute_self_member_assignment(
 
         // 元の変数のメンバーも同時に更新
         if (!original_receiver_path.empty()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_ASSIGN_DEBUG: Looking for original member: %s",
@@ -977,7 +976,7 @@ void StatementExecutor::execute_self_member_assignment(
                     original_member->type = TYPE_INT;
                 }
                 original_member->is_assigned = true;
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "SELF_ASSIGN_SYNC: %s = %lld",
@@ -985,7 +984,7 @@ void StatementExecutor::execute_self_member_assignment(
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
             } else {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -996,7 +995,7 @@ void StatementExecutor::execute_self_member_assignment(
             }
         }
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "SELF_ASSIGN: %s = %lld",
                      member_name.c_str(), (long long)value);
@@ -1012,7 +1011,7 @@ void StatementExecutor::execute_self_member_assignment(
         self_member_var->str_value = self_member->str_value;
         self_member_var->type = self_member->type;
         self_member_var->is_assigned = true;
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "SELF_ASSIGN_DIRECT: %s = %lld",
                      self_member_path.c_str(),
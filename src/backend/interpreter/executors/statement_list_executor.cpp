@@ -4,6 +4,8 @@
 #include "../../../common/debug_messages.h"
 #include "core/interpreter.h"
 #include "event_loop/simple_event_loop.h"
+#include <exception>
+#include <stdexcept>
 
 StatementListExecutor::StatementListExecutor(Interpreter *interpreter)
     : interpreter_(interpreter) {}
@@ -13,8 +15,217 @@ void clear_resume_position(std::map<const ASTNode *, size_t> &positions,
                            const ASTNode *node) {
     positions.erase(node);
 }
+
+// v0.14.0: 複合文のデストラクタスコープ（RAIIで抜ける経路を問わず閉じる）
+// デストラクタ実行中の複合文ではスコープを積まない
+class DestructorScopeGuard {
+  public:
+    explicit DestructorScopeGuard(Interpreter &interpreter)
+        : interpreter_(interpreter),
+          pushed_(!interpreter.is_calling_destructor()),
+          uncaught_(std::uncaught_exceptions()) {
+        if (pushed_) {
+            interpreter_.push_destructor_scope();
+        }
+    }
+    // 通常の終了時はデストラクタ内の例外をそのまま伝播させる
+    ~DestructorScopeGuard() noexcept(false) {
+        if (!pushed_) {
+            return;
+        }
+        if (std::uncaught_exceptions() == uncaught_) {
+            interpreter_.pop_destructor_scope();
+            return;
+        }
+        // 例外の伝播中は二重例外にならないよう握りつぶす
+        try {
+            interpreter_.pop_destructor_scope();
+        } catch (...) {
+        }
+    }
+
+    DestructorScopeGuard(const DestructorScopeGuard &) = delete;
+    DestructorScopeGuard &operator=(const DestructorScopeGuard &) = delete;
+
+  private:
+    Interpreter &interpreter_;
+    bool pushed_;
+    int uncaught_;
+};
+
+// v0.14.0: 式の中の副作用（関数呼び出し・代入・インクリメント・new・await）を
+// 数える。文の本体（複合文・ラムダ本体など）は別の文として検査されるので辿らない
+size_t count_side_effects(const ASTNode *node) {
+    if (!node) {
+        return 0;
+    }
+
+    size_t count = 0;
+    switch (node->node_type) {
+    case ASTNodeType::AST_FUNC_CALL:
+    case ASTNodeType::AST_FUNC_PTR_CALL:
+    case ASTNodeType::AST_ASSIGN:
+    case ASTNodeType::AST_PRE_INCDEC:
+    case ASTNodeType::AST_POST_INCDEC:
+    case ASTNodeType::AST_NEW_EXPR:
+        count = 1;
+        break;
+    case ASTNodeType::AST_UNARY_OP:
+        // Future変数のawaitは待ちとして文を再実行する
+        count = node->is_await_expression ? 1 : 0;
+        break;
+    default:
+        break;
+    }
+
+    for (const ASTNode *child :
+         {node->left.get(), node->right.get(), node->third.get(),
+          node->condition.get(), node->init_expr.get(),
+          node->array_index.get(), node->array_size_expr.get(),
+          node->cast_expr.get(), node->new_array_size.get(),
+          node->delete_expr.get(), node->sizeof_expr.get()}) {
+        count += count_side_effects(child);
+    }
+    for (const auto *list : {&node->arguments, &node->children,
+                             &node->array_indices, &node->array_dimensions,
+                             &node->interpolation_segments}) {
+        for (const auto &child : *list) {
+            count += count_side_effects(child.get());
+        }
+    }
+    return count;
+}
+
+// v0.14.0: 文リストの再開位置マップがタスクから呼んだ関数のものか
+bool is_callee_frame(
+    Interpreter &interpreter,
+    const std::shared_ptr<std::map<const ASTNode *, size_t>> &positions) {
+    return positions.get() !=
+           interpreter.get_simple_event_loop().current_task_positions();
+}
+
+bool is_block(const ASTNode *node) {
+    return node && (node->node_type == ASTNodeType::AST_STMT_LIST ||
+                    node->node_type == ASTNodeType::AST_COMPOUND_STMT);
+}
+
+// v0.14.0: 文を再実行したときに評価し直される式の副作用を数える
+// with_branches: ブロックでない分岐・本体（`if (c) v = f();`）も数える
+size_t count_statement_head_effects(const ASTNode *stmt, bool with_branches) {
+    size_t count = 0;
+    switch (stmt->node_type) {
+    case ASTNodeType::AST_IF_STMT:
+        count = count_side_effects(stmt->condition.get());
+        if (with_branches) {
+            for (const ASTNode *branch :
+                 {stmt->left.get(), stmt->right.get()}) {
+                if (branch && !is_block(branch)) {
+                    count += count_statement_head_effects(branch, true);
+                }
+            }
+        }
+        return count;
+    case ASTNodeType::AST_WHILE_STMT:
+    case ASTNodeType::AST_FOR_STMT:
+        // forのinit式は宣言済みの変数でなければ再実行される
+        count = count_side_effects(stmt->condition.get()) +
+                count_side_effects(stmt->init_expr.get());
+        if (with_branches && stmt->body && !is_block(stmt->body.get())) {
+            count += count_statement_head_effects(stmt->body.get(), true);
+        }
+        return count;
+    case ASTNodeType::AST_SWITCH_STMT:
+        return count_side_effects(stmt->switch_expr.get());
+    case ASTNodeType::AST_MATCH_STMT:
+        return count_side_effects(stmt->match_expr.get());
+    case ASTNodeType::AST_STMT_LIST:
+    case ASTNodeType::AST_COMPOUND_STMT:
+    case ASTNodeType::AST_TRY_STMT:
+        return 0;
+    case ASTNodeType::AST_ASSIGN:
+        // 代入そのものは待ち終わった後に1回だけ行われる
+        count = count_side_effects(stmt->left.get()) +
+                count_side_effects(stmt->right.get()) +
+                count_side_effects(stmt->array_index.get());
+        for (const auto &index : stmt->array_indices) {
+            count += count_side_effects(index.get());
+        }
+        return count;
+    default:
+        return count_side_effects(stmt);
+    }
+}
+
+// v0.14.0: 文全体（入れ子のブロックを含む）の副作用を数える
+// 関数の中で待つと、関数の先頭から待った文までが再実行される
+size_t count_statement_effects(const ASTNode *stmt) {
+    if (!stmt) {
+        return 0;
+    }
+    // 再実行される代入は代入そのものも副作用になる
+    if (stmt->node_type == ASTNodeType::AST_ASSIGN) {
+        return count_side_effects(stmt);
+    }
+    size_t count = count_statement_head_effects(stmt, false);
+    if (stmt->node_type == ASTNodeType::AST_IF_STMT) {
+        count += count_statement_effects(stmt->left.get()) +
+                 count_statement_effects(stmt->right.get());
+    }
+    for (const ASTNode *child :
+         {stmt->body.get(), stmt->update_expr.get(), stmt->try_body.get(),
+          stmt->catch_body.get(), stmt->finally_body.get(),
+          stmt->else_body.get(), stmt->case_body.get()}) {
+        count += count_statement_effects(child);
+    }
+    for (const auto *list : {&stmt->statements, &stmt->cases}) {
+        for (const auto &child : *list) {
+            count += count_statement_effects(child.get());
+        }
+    }
+    return count;
+}
 } // namespace
 
+void StatementListExecutor::check_retry_statement(
+    YieldException &e, const ASTNode *list, size_t index,
+    const std::map<const ASTNode *, size_t> *frame, bool callee_frame) {
+    if (!list || index >= list->statements.size()) {
+        return;
+    }
+    const ASTNode *stmt = list->statements[index].get();
+
+    // 再実行される副作用のうち許されるのは待ちへつながる1つだけ
+    // - 待った文そのもの: 待つ呼び出し（Future変数のawaitを含む）
+    // - 同じ関数のブロックの中で待った文: なし（条件式などが評価し直される）
+    // - 呼び出した関数の中で待った文: その関数の呼び出し
+    size_t allowed = 1;
+    size_t side_effects = 0;
+    if (e.retry_frame == frame) {
+        allowed = 0;
+        side_effects = count_statement_head_effects(stmt, false);
+    } else {
+        side_effects = count_statement_head_effects(stmt, true);
+    }
+
+    // 呼び出した関数の再開位置は残らないため、先行する文も再実行される
+    if (callee_frame) {
+        for (size_t i = 0; i < index; ++i) {
+            side_effects += count_statement_effects(list->statements[i].get());
+        }
+    }
+    e.retry_frame = frame;
+
+    if (side_effects > allowed) {
+        throw std::runtime_error(
+            "A statement that waits in an async task (channel recv/has_next, "
+            "async I/O or await of a Future variable) is re-run when the task "
+            "resumes; the statement, its enclosing conditions and the "
+            "statements before it in called functions must not contain other "
+            "function calls, assignments or increments. Assign the waiting "
+            "call to a variable in its own statement");
+    }
+}
+
 void StatementListExecutor::execute_statement_list(const ASTNode *node) {
     if (!node) {
         return;
@@ -22,6 +233,21 @@ void StatementListExecutor::execute_statement_list(const ASTNode *node) {
 
     debug_msg(DebugMsgId::INTERPRETER_STMT_LIST_EXEC, node->statements.size());
 
+    // v0.14.0: asyncタスク外では再開位置を記録せずに直接実行する
+    if (!interpreter_->is_executing_async_task()) {
+        for (const auto &stmt : node->statements) {
+            interpreter_->execute_statement(stmt.get());
+
+            if (interpreter_->has_pending_completion()) {
+                return;
+            }
+
+            // v0.14.0: タイムスライスを使い切ったら他のタスクを1サイクル進める
+            interpreter_->run_queued_tasks_if_slice_expired();
+        }
+        return;
+    }
+
     auto stmt_positions = interpreter_->current_statement_positions();
     size_t start_index = 0;
     if (auto it = stmt_positions->find(node); it != stmt_positions->end()) {
@@ -36,16 +262,26 @@ void StatementListExecutor::execute_statement_list(const ASTNode *node) {
 
             try {
                 interpreter_->execute_statement(node->statements[i].get());
-            } catch (const YieldException &e) {
+            } catch (YieldException &e) {
+                if (e.retry_statement) {
+                    check_retry_statement(e, node, i, stmt_positions.get(),
+                                          is_callee_frame(*interpreter_,
+                                                          stmt_positions));
+                }
                 (*stmt_positions)[node] = e.is_from_loop ? i : (i + 1);
                 throw;
             }
 
+            // v0.14.0: return/break/continueは完了レコードで呼び出し元へ伝播
+            if (interpreter_->has_pending_completion()) {
+                clear_entry();
+                return;
+            }
+
             (*stmt_positions)[node] = i + 1;
 
-            if (interpreter_->get_simple_event_loop().has_tasks()) {
-                interpreter_->get_simple_event_loop().run_one_cycle();
-            }
+            // v0.14.0: タイムスライスを使い切ったら他のタスクを1サイクル進める
+            interpreter_->run_queued_tasks_if_slice_expired();
         }
 
         clear_entry();
@@ -69,10 +305,17 @@ void StatementListExecutor::execute_compound_statement(const ASTNode *node) {
     debug_msg(DebugMsgId::INTERPRETER_COMPOUND_STMT_EXEC,
               node->statements.size());
 
-    bool pushed_scope = false;
-    if (!interpreter_->is_calling_destructor()) {
-        interpreter_->push_destructor_scope();
-        pushed_scope = true;
+    DestructorScopeGuard scope_guard(*interpreter_);
+
+    // v0.14.0: asyncタスク外では再開位置を記録せずに直接実行する
+    if (!interpreter_->is_executing_async_task()) {
+        for (const auto &stmt : node->statements) {
+            interpreter_->execute_statement(stmt.get());
+            if (interpreter_->has_pending_completion()) {
+                break;
+            }
+        }
+        return;
     }
 
     auto stmt_positions = interpreter_->current_statement_positions();
@@ -89,38 +332,32 @@ void StatementListExecutor::execute_compound_statement(const ASTNode *node) {
 
             try {
                 interpreter_->execute_statement(node->statements[i].get());
-            } catch (const YieldException &e) {
-                (*stmt_positions)[node] = e.is_from_loop ? i : (i + 1);
-                if (pushed_scope) {
-                    interpreter_->pop_destructor_scope();
+            } catch (YieldException &e) {
+                if (e.retry_statement) {
+                    check_retry_statement(e, node, i, stmt_positions.get(),
+                                          is_callee_frame(*interpreter_,
+                                                          stmt_positions));
                 }
+                (*stmt_positions)[node] = e.is_from_loop ? i : (i + 1);
                 throw;
             }
 
+            if (interpreter_->has_pending_completion()) {
+                break;
+            }
+
             (*stmt_positions)[node] = i + 1;
         }
 
-        if (pushed_scope) {
-            interpreter_->pop_destructor_scope();
-        }
         clear_entry();
     } catch (const ReturnException &) {
         clear_entry();
-        if (pushed_scope) {
-            interpreter_->pop_destructor_scope();
-        }
         throw;
     } catch (const BreakException &) {
         clear_entry();
-        if (pushed_scope) {
-            interpreter_->pop_destructor_scope();
-        }
         throw;
     } catch (const ContinueException &) {
         clear_entry();
-        if (pushed_scope) {
-            interpreter_->pop_destructor_scope();
-        }
         throw;
     }
 }
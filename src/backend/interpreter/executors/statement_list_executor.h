@@ -1,8 +1,12 @@
 #ifndef CB_INTERPRETER_STATEMENT_LIST_EXECUTOR_H
 #define CB_INTERPRETER_STATEMENT_LIST_EXECUTOR_H
 
+#include <cstddef>
+#include <map>
+
 struct ASTNode;
 class Interpreter;
+class YieldException;
 
 /**
  * @brief 文リスト・複合文の実行を管理するクラス
@@ -26,6 +30,24 @@ class StatementListExecutor {
      */
     void execute_compound_statement(const ASTNode *node);
 
+    /**
+     * @brief 待ちから再開すると最初から実行し直される文を検査する
+     *
+     * チャネルの受信待ち・非同期I/Oの待ち・Future変数のawaitは文を再実行して
+     * 値を受け取るため、再実行される経路に待つ操作以外の副作用があれば
+     * 実行時エラーにする。待ちの例外が通った文ごとに内側から呼ばれる
+     * @param e 待ちの例外（内側で検査した文の位置を記録する）
+     * @param list 文を含む文リスト・複合文
+     * @param index 待ちで中断した文の位置
+     * @param frame listの再開位置マップ
+     * @param callee_frame
+     * タスクから呼んだ関数の中か（関数は最初から実行し直される）
+     */
+    static void
+    check_retry_statement(YieldException &e, const ASTNode *list, size_t index,
+                          const std::map<const ASTNode *, size_t> *frame,
+                          bool callee_frame);
+
   private:
     Interpreter *interpreter_;
 };
@@ -13,6 +13,11 @@ void BreakContinueHandler::handle_break(const ASTNode *node) {
             node->left.get());
     }
     if (cond) {
+        // v0.14.0: ループ本体の実行中は完了レコードで通知する
+        if (interpreter_->can_complete_loop()) {
+            interpreter_->complete_loop(CompletionType::BREAK);
+            return;
+        }
         throw BreakException(cond);
     }
 }
@@ -24,6 +29,10 @@ void BreakContinueHandler::handle_continue(const ASTNode *node) {
             node->left.get());
     }
     if (cond) {
+        if (interpreter_->can_complete_loop()) {
+            interpreter_->complete_loop(CompletionType::CONTINUE);
+            return;
+        }
         throw ContinueException(cond);
     }
 }
@@ -18,7 +18,8 @@ class BreakContinueHandler {
      * @brief break文(AST_BREAK_STMT)を実行
      * @param node AST_BREAK_STMT ノード
      *
-     * BreakException をスローしてループを抜ける。
+     * ループ本体の実行中は完了レコード(CompletionType::BREAK)を設定し、
+     * それ以外では BreakException をスローしてループを抜ける。
      */
     void handle_break(const ASTNode *node);
 
@@ -26,7 +27,8 @@ class BreakContinueHandler {
      * @brief continue文(AST_CONTINUE_STMT)を実行
      * @param node AST_CONTINUE_STMT ノード
      *
-     * ContinueException をスローしてループの次のイテレーションに進む。
+     * ループ本体の実行中は完了レコード(CompletionType::CONTINUE)を設定し、
+     * それ以外では ContinueException をスローして次のイテレーションに進む。
      */
     void handle_continue(const ASTNode *node);
 
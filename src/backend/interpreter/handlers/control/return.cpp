@@ -7,6 +7,22 @@
 #include "../../evaluator/core/evaluator.h"
 #include <stdexcept>
 
+void ReturnHandler::complete(ReturnException ret) {
+    if (interpreter_->can_complete_return()) {
+        interpreter_->complete_return(std::move(ret));
+        return;
+    }
+    throw ret;
+}
+
+void ReturnHandler::complete_value(Value value) {
+    if (interpreter_->can_complete_return()) {
+        interpreter_->complete_return_value(std::move(value));
+        return;
+    }
+    throw value.to_return_exception();
+}
+
 // return文の実行
 void ReturnHandler::execute_return_statement(const ASTNode *node) {
     debug_msg(DebugMsgId::INTERPRETER_RETURN_STMT);
@@ -17,8 +33,8 @@ void ReturnHandler::execute_return_statement(const ASTNode *node) {
 
     if (!node->left) {
         // return値なし（void関数のreturn）
-        // ReturnExceptionを投げて関数から抜ける
-        throw ReturnException(static_cast<int64_t>(0)); // voidの場合は0を返す
+        // 完了レコード（またはReturnException）で関数から抜ける
+        return complete_value(Value::integer(0)); // voidの場合は0を返す
     }
 
     debug_msg(DebugMsgId::INTERPRETER_RETURN_STMT);
@@ -39,7 +55,7 @@ void ReturnHandler::execute_return_statement(const ASTNode *node) {
         break;
 
     case ASTNodeType::AST_STRING_LITERAL:
-        throw ReturnException(node->left->str_value);
+        return complete_value(Value::string(node->left->str_value));
         break;
 
     case ASTNodeType::AST_IDENTIFIER:
@@ -120,9 +136,9 @@ void ReturnHandler::handle_array_literal_return(const ASTNode *node) {
             }
             str_array_3d.push_back(str_array_2d);
 
-            throw ReturnException(
+            return complete(ReturnException(
                 str_array_3d, "string[][]",
-                static_cast<TypeInfo>(TYPE_ARRAY_BASE + TYPE_STRING));
+                static_cast<TypeInfo>(TYPE_ARRAY_BASE + TYPE_STRING)));
         } else {
             // 多次元整数配列を3D形式に変換
             std::vector<std::vector<std::vector<int64_t>>> int_array_3d;
@@ -144,7 +160,7 @@ void ReturnHandler::handle_array_literal_return(const ASTNode *node) {
             }
             int_array_3d.push_back(int_array_2d);
 
-            throw ReturnException(int_array_3d, "int[][]", TYPE_INT);
+            return complete(ReturnException(int_array_3d, "int[][]", TYPE_INT));
         }
     }
 
@@ -175,13 +191,13 @@ void ReturnHandler::handle_array_literal_return(const ASTNode *node) {
         std::vector<std::vector<std::string>> str_array_2d;
         str_array_2d.push_back(array_strings);
         str_array_3d.push_back(str_array_2d);
-        throw ReturnException(str_array_3d, "string[]", TYPE_STRING);
+        return complete(ReturnException(str_array_3d, "string[]", TYPE_STRING));
     } else {
         std::vector<std::vector<std::vector<int64_t>>> int_array_3d;
         std::vector<std::vector<int64_t>> int_array_2d;
         int_array_2d.push_back(array_values);
         int_array_3d.push_back(int_array_2d);
-        throw ReturnException(int_array_3d, "int[]", TYPE_INT);
+        return complete(ReturnException(int_array_3d, "int[]", TYPE_INT));
     }
 }
 
@@ -198,7 +214,7 @@ void ReturnHandler::handle_identifier_return(const ASTNode *node) {
             if (self_var->type != TYPE_INTERFACE) {
                 self_var->type = TYPE_STRUCT;
             }
-            throw ReturnException(*self_var);
+            return complete(ReturnException(*self_var));
         }
     } else {
         Variable *var = interpreter_->find_variable(node->left->name);
@@ -219,13 +235,13 @@ void ReturnHandler::handle_identifier_return(const ASTNode *node) {
                 if (var->is_reference) {
                     Variable *target_var =
                         reinterpret_cast<Variable *>(var->value);
-                    throw ReturnException(target_var);
+                    return complete(ReturnException(target_var));
                 } else {
-                    throw ReturnException(var);
+                    return complete(ReturnException(var));
                 }
             } else if (var->is_enum) {
                 // v0.11.0: Enum変数の返り値処理（パターンマッチング対応）
-                throw ReturnException(*var);
+                return complete(ReturnException(*var));
             } else if (var->is_array) {
                 // 配列の場合、handle_array_variable_returnに委譲
                 handle_array_variable_return(node, var);
@@ -236,13 +252,13 @@ void ReturnHandler::handle_identifier_return(const ASTNode *node) {
                 if (var->type != TYPE_INTERFACE) {
                     var->type = TYPE_STRUCT;
                 }
-                throw ReturnException(*var);
+                return complete(ReturnException(*var));
             } else if (!var->interface_name.empty()) {
                 Variable interface_copy = *var;
                 interface_copy.type = TYPE_INTERFACE;
-                throw ReturnException(interface_copy);
+                return complete(ReturnException(interface_copy));
             } else if (var->type == TYPE_STRING) {
-                throw ReturnException(var->str_value);
+                return complete_value(Value::string(var->str_value));
             } else if (var->type == TYPE_POINTER) {
                 // ポインタ戻り値の場合、const情報を保持する（Phase 2: v0.9.2）
                 ReturnException ret(var->value);
@@ -253,9 +269,9 @@ void ReturnHandler::handle_identifier_return(const ASTNode *node) {
                 ret.pointer_depth = var->pointer_depth;
                 ret.pointer_base_type = var->pointer_base_type;
                 ret.pointer_base_type_name = var->pointer_base_type_name;
-                throw ret;
+                return complete(std::move(ret));
             } else {
-                throw ReturnException(var->value);
+                return complete_value(Value::integer(var->value));
             }
         } else {
             // 変数が見つからない場合、式として評価
@@ -283,9 +299,9 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
     if (return_as_reference && var) {
         if (var->is_reference) {
             Variable *target_var = reinterpret_cast<Variable *>(var->value);
-            throw ReturnException(target_var);
+            return complete(ReturnException(target_var));
         } else {
-            throw ReturnException(var);
+            return complete(ReturnException(var));
         }
     }
 
@@ -293,7 +309,7 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
         // v0.11.0: Enum変数の返り値処理（パターンマッチング対応）
         // Enumのメタデータ（variant名、関連値）を保持したまま返す
         debug_msg(DebugMsgId::INTERPRETER_RETURN_VAR, node->left->name.c_str());
-        throw ReturnException(*var);
+        return complete(ReturnException(*var));
     } else if (var && var->is_struct) {
         interpreter_->sync_struct_members_from_direct_access(node->left->name);
         if (var->type != TYPE_INTERFACE) {
@@ -306,11 +322,11 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
         }
 
         debug_msg(DebugMsgId::INTERPRETER_RETURN_ARRAY_VAR);
-        throw ReturnException(*var);
+        return complete(ReturnException(*var));
     } else if (var && !var->interface_name.empty()) {
         Variable interface_copy = *var;
         interface_copy.type = TYPE_INTERFACE;
-        throw ReturnException(interface_copy);
+        return complete(ReturnException(interface_copy));
     } else if (var && var->is_array) {
         handle_array_variable_return(node, var);
         return;
@@ -319,10 +335,10 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
     // 非配列変数の処理
     if (var && var->is_struct) {
         interpreter_->sync_struct_members_from_direct_access(node->left->name);
-        throw ReturnException(*var);
+        return complete(ReturnException(*var));
     } else if (var && (var->type == TYPE_STRING ||
                        (var->is_assigned && !var->str_value.empty()))) {
-        throw ReturnException(var->str_value);
+        return complete_value(Value::string(var->str_value));
     } else if (var && var->type == TYPE_POINTER) {
         // ポインタ戻り値の場合、const情報を保持する（Phase 2: v0.9.2）
         ReturnException ret(var->value);
@@ -333,21 +349,24 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
         ret.pointer_depth = var->pointer_depth;
         ret.pointer_base_type = var->pointer_base_type;
         ret.pointer_base_type_name = var->pointer_base_type_name;
-        throw ret;
+        return complete(std::move(ret));
     } else if (var) {
         // 数値変数を型推論で正しく返す
         TypedValue typed_result =
             interpreter_->expression_evaluator_->evaluate_typed_expression(
                 node->left.get());
         if (typed_result.numeric_type == TYPE_FLOAT) {
-            throw ReturnException(typed_result.double_value, TYPE_FLOAT);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_FLOAT));
         } else if (typed_result.numeric_type == TYPE_DOUBLE) {
-            throw ReturnException(typed_result.double_value, TYPE_DOUBLE);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_DOUBLE));
         } else if (typed_result.numeric_type == TYPE_QUAD) {
-            throw ReturnException(typed_result.quad_value, TYPE_QUAD);
+            return complete(
+                ReturnException(typed_result.quad_value, TYPE_QUAD));
         } else {
-            throw ReturnException(typed_result.value,
-                                  typed_result.numeric_type);
+            return complete_value(Value::integer(typed_result.value,
+                                                 typed_result.numeric_type));
         }
     } else {
         // 変数が見つからない場合
@@ -357,14 +376,17 @@ void ReturnHandler::handle_variable_return(const ASTNode *node) {
             interpreter_->expression_evaluator_->evaluate_typed_expression(
                 node->left.get());
         if (typed_result.numeric_type == TYPE_FLOAT) {
-            throw ReturnException(typed_result.double_value, TYPE_FLOAT);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_FLOAT));
         } else if (typed_result.numeric_type == TYPE_DOUBLE) {
-            throw ReturnException(typed_result.double_value, TYPE_DOUBLE);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_DOUBLE));
         } else if (typed_result.numeric_type == TYPE_QUAD) {
-            throw ReturnException(typed_result.quad_value, TYPE_QUAD);
+            return complete(
+                ReturnException(typed_result.quad_value, TYPE_QUAD));
         } else {
-            throw ReturnException(typed_result.value,
-                                  typed_result.numeric_type);
+            return complete_value(Value::integer(typed_result.value,
+                                                 typed_result.numeric_type));
         }
     }
 }
@@ -416,7 +438,7 @@ void ReturnHandler::handle_enum_construct_return(const ASTNode *node) {
         enum_var.has_associated_value = false;
     }
 
-    throw ReturnException(enum_var);
+    return complete(ReturnException(enum_var));
 }
 
 // 古いスタイルのEnum（AST_ENUM_ACCESS）のreturn処理
@@ -446,7 +468,7 @@ void ReturnHandler::handle_enum_access_return(const ASTNode *node) {
         enum_var.struct_type_name = enum_access->enum_name;
         enum_var.is_struct = true;
 
-        throw ReturnException(enum_var);
+        return complete(ReturnException(enum_var));
     } else {
         // 古いスタイルenum（Status::ERRORなど）：整数値として返す
         Variable enum_var;
@@ -458,7 +480,7 @@ void ReturnHandler::handle_enum_access_return(const ASTNode *node) {
         enum_var.is_assigned = true;
 
         // v0.13.0: TYPE_ENUMとして返す（asyncで正しく処理されるように）
-        throw ReturnException(enum_value, TYPE_ENUM);
+        return complete(ReturnException(enum_value, TYPE_ENUM));
     }
 }
 
@@ -508,7 +530,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
                 str_array_2d.push_back(str_array_1d);
                 str_array_3d.push_back(str_array_2d);
             }
-            throw ReturnException(str_array_3d, node->left->name, var->type);
+            return complete(
+                ReturnException(str_array_3d, node->left->name, var->type));
         }
 
         // float/double/quad配列
@@ -551,7 +574,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
                 }
                 double_array_3d.push_back(double_array_2d);
             }
-            throw ReturnException(double_array_3d, node->left->name, base_type);
+            return complete(
+                ReturnException(double_array_3d, node->left->name, base_type));
         }
 
         // 整数型配列
@@ -582,7 +606,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
             int_array_2d.push_back(int_array_1d);
             int_array_3d.push_back(int_array_2d);
         }
-        throw ReturnException(int_array_3d, node->left->name, var->type);
+        return complete(
+            ReturnException(int_array_3d, node->left->name, var->type));
     }
 
     // 1次元配列の処理
@@ -659,7 +684,7 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
 
         std::string struct_type_name =
             var->type_name.empty() ? node->left->name : var->type_name;
-        throw ReturnException(struct_array_3d, struct_type_name);
+        return complete(ReturnException(struct_array_3d, struct_type_name));
     }
 
     // float/double/quad配列
@@ -687,7 +712,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
         double_array_2d.push_back(double_array_1d);
         double_array_3d.push_back(double_array_2d);
 
-        throw ReturnException(double_array_3d, node->left->name, base_type);
+        return complete(
+            ReturnException(double_array_3d, node->left->name, base_type));
     }
 
     // 整数型配列
@@ -706,7 +732,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
         int_array_2d.push_back(int_array_1d);
         int_array_3d.push_back(int_array_2d);
 
-        throw ReturnException(int_array_3d, node->left->name, type_info);
+        return complete(
+            ReturnException(int_array_3d, node->left->name, type_info));
     }
 
     // 文字列配列
@@ -722,7 +749,8 @@ void ReturnHandler::handle_array_variable_return(const ASTNode *node,
         str_array_2d.push_back(str_array_1d);
         str_array_3d.push_back(str_array_2d);
 
-        throw ReturnException(str_array_3d, node->left->name, type_info);
+        return complete(
+            ReturnException(str_array_3d, node->left->name, type_info));
     }
 }
 
@@ -737,7 +765,7 @@ void ReturnHandler::handle_expression_return(const ASTNode *node) {
     bool debug_mode = interpreter_->is_debug_mode();
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[RETURN_EXPR] Handling expression return, node_type=%d",
@@ -758,9 +786,9 @@ void ReturnHandler::handle_expression_return(const ASTNode *node) {
     }
 
     if (typed_result.is_function_pointer) {
-        throw ReturnException(
+        return complete(ReturnException(
             typed_result.value, typed_result.function_pointer_name,
-            typed_result.function_pointer_node, typed_result.numeric_type);
+            typed_result.function_pointer_node, typed_result.numeric_type));
     } else if (typed_result.is_pointer) {
         // ポインタの場合、ポインタ型情報を保持してReturnExceptionを作成
         if (debug_mode) {
@@ -777,12 +805,12 @@ void ReturnHandler::handle_expression_return(const ASTNode *node) {
         ret_ex.pointer_base_type_name = typed_result.pointer_base_type_name;
         ret_ex.is_pointee_const = typed_result.is_pointee_const;
         ret_ex.is_pointer_const = typed_result.is_pointer_const;
-        throw ret_ex;
+        return complete(std::move(ret_ex));
     } else if (typed_result.is_struct_result) {
         // 構造体の場合、struct_dataから直接ReturnExceptionを作成
         if (typed_result.struct_data) {
             // struct_dataが存在する場合、それを使用
-            throw ReturnException(*typed_result.struct_data);
+            return complete(ReturnException(*typed_result.struct_data));
         } else {
             // struct_dataがない場合、再度評価してReturnExceptionを取得（従来の動作）
             try {
@@ -791,16 +819,16 @@ void ReturnHandler::handle_expression_return(const ASTNode *node) {
                 throw std::runtime_error(
                     "Struct evaluation did not throw ReturnException");
             } catch (const ReturnException &ret_ex) {
-                throw ret_ex;
+                return complete(ret_ex);
             }
         }
     } else if (typed_result.is_string()) {
-        throw ReturnException(typed_result.string_value);
+        return complete_value(Value::string(typed_result.string_value));
     } else if (typed_result.numeric_type == TYPE_ENUM ||
                typed_result.type.type_info == TYPE_ENUM) {
         // Enum型の場合、TYPE_ENUMとして返す（古いスタイルenum）
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -809,18 +837,21 @@ void ReturnHandler::handle_expression_return(const ASTNode *node) {
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
         }
-        throw ReturnException(typed_result.value, TYPE_ENUM);
+        return complete_value(Value::integer(typed_result.value, TYPE_ENUM));
     } else {
         // 数値の場合、型情報を保持
         if (typed_result.numeric_type == TYPE_FLOAT) {
-            throw ReturnException(typed_result.double_value, TYPE_FLOAT);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_FLOAT));
         } else if (typed_result.numeric_type == TYPE_DOUBLE) {
-            throw ReturnException(typed_result.double_value, TYPE_DOUBLE);
+            return complete_value(
+                Value::floating(typed_result.double_value, TYPE_DOUBLE));
         } else if (typed_result.numeric_type == TYPE_QUAD) {
-            throw ReturnException(typed_result.quad_value, TYPE_QUAD);
+            return complete(
+                ReturnException(typed_result.quad_value, TYPE_QUAD));
         } else {
-            throw ReturnException(typed_result.value,
-                                  typed_result.numeric_type);
+            return complete_value(Value::integer(typed_result.value,
+                                                 typed_result.numeric_type));
         }
     }
 }
@@ -6,6 +6,8 @@
 struct ASTNode;
 struct Variable;
 class Interpreter;
+class ReturnException;
+class Value;
 
 // return文の処理を担当するクラス
 class ReturnHandler {
@@ -14,12 +16,17 @@ class ReturnHandler {
         : interpreter_(interpreter) {}
 
     // return文の実行
-    // ReturnExceptionをスローすることで戻り値を返す
+    // 関数本体の実行中は完了レコードで、それ以外はReturnExceptionで戻り値を返す
     void execute_return_statement(const ASTNode *node);
 
   private:
     Interpreter *interpreter_;
 
+    // v0.14.0: 戻り値を完了レコードに格納する（受け取るフレームがなければthrow）
+    void complete(ReturnException ret);
+    // スカラー/文字列の戻り値は16バイトのValueのまま格納する
+    void complete_value(Value value);
+
     // 配列リテラルのreturn処理
     void handle_array_literal_return(const ASTNode *node);
 
@@ -2,6 +2,7 @@
 #include "../../../../common/ast.h"
 #include "../../core/interpreter.h"
 #include "../../evaluator/core/evaluator.h"
+#include "../../event_loop/simple_event_loop.h"
 
 ExpressionStatementHandler::ExpressionStatementHandler(Interpreter *interpreter)
     : interpreter_(interpreter) {}
@@ -14,5 +15,32 @@ void ExpressionStatementHandler::handle_expression_statement(
     } catch (const ReturnException &e) {
         // 関数呼び出し文でのreturn値は無視する（void文として扱う）
         // struct、array、stringの戻り値も含めて例外を伝播させない
+        if (e.is_struct && node->node_type == ASTNodeType::AST_FUNC_CALL) {
+            detach_discarded_future(node, e.struct_value);
+        }
+    }
+}
+
+// v0.14.0: `worker(i);` のように捨てられたasync関数のFutureは誰もawait
+// できないため、タスクを完了時にすぐ解放してスロットを再利用させる
+void ExpressionStatementHandler::detach_discarded_future(
+    const ASTNode *node, const Variable &future) {
+    if (node->left || future.struct_type_name.rfind("Future", 0) != 0) {
+        return;
+    }
+    const ASTNode *func = interpreter_->find_function(node->name);
+    if (!func || !func->is_async_function) {
+        return;
+    }
+    auto task_id_it = future.struct_members.find("task_id");
+    if (task_id_it == future.struct_members.end()) {
+        return;
+    }
+    // 呼び出したasync関数自身のタスクのFutureであることを確認する
+    auto &event_loop = interpreter_->get_simple_event_loop();
+    int task_id = static_cast<int>(task_id_it->second.value);
+    AsyncTask *task = event_loop.get_task(task_id);
+    if (task && task->function_node == func) {
+        event_loop.detach_task(task_id);
     }
 }
@@ -2,6 +2,7 @@
 
 // 前方宣言
 struct ASTNode;
+struct Variable;
 class Interpreter;
 
 /**
@@ -20,4 +21,7 @@ class ExpressionStatementHandler {
 
   private:
     Interpreter *interpreter_;
+
+    // 捨てられたasync関数のFutureのタスクを完了時に解放させる
+    void detach_discarded_future(const ASTNode *node, const Variable &future);
 };
@@ -47,6 +47,10 @@ void ensure_numeric_storage(Variable &var, size_t total_size, bool is_multidim,
             var.multidim_array_double_values.clear();
             var.multidim_array_values.clear();
         } else {
+            // v0.14.0: 宣言された要素型の幅で格納する
+            var.multidim_array_values.clear();
+            var.multidim_array_values.set_element_type(base_type,
+                                                       var.is_unsigned);
             var.multidim_array_values.assign(total_size, 0);
             var.multidim_array_float_values.clear();
             var.multidim_array_double_values.clear();
@@ -69,6 +73,8 @@ void ensure_numeric_storage(Variable &var, size_t total_size, bool is_multidim,
             var.array_double_values.clear();
             var.array_values.clear();
         } else {
+            var.array_values.clear();
+            var.array_values.set_element_type(base_type, var.is_unsigned);
             var.array_values.assign(total_size, 0);
             var.array_float_values.clear();
             var.array_double_values.clear();
@@ -313,7 +319,7 @@ void ArrayManager::processArrayDeclaration(Variable &var, const ASTNode *node) {
         // array_dimensionsが利用可能な場合はそちらを優先（VLA対応）
         if (node->array_dimensions.size() == 1 &&
             node->array_dimensions[0].get() != nullptr) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -335,7 +341,7 @@ void ArrayManager::processArrayDeclaration(Variable &var, const ASTNode *node) {
             var.array_dimensions.push_back(size);
 
             // 配列要素を初期化
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -344,7 +350,7 @@ void ArrayManager::processArrayDeclaration(Variable &var, const ASTNode *node) {
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -373,7 +379,7 @@ void ArrayManager::processArrayDeclaration(Variable &var, const ASTNode *node) {
                           "Numeric storage prepared");
             }
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "ARRAY_DEBUG: After 1D array init, var.array_size=%d",
@@ -1115,7 +1121,7 @@ void ArrayManager::processArrayDeclaration(Variable &var, const ASTNode *node) {
     }
 
     // デバッグ: 最終的な配列状態を確認
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "ARRAY_DEBUG: Before final debug, var.array_size=%d, "
@@ -53,7 +53,7 @@ void GlobalInitializationManager::initialize_global_variables(
 
     case ASTNodeType::AST_VAR_DECL:
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Initializing global variable: %s",
@@ -72,7 +72,7 @@ void GlobalInitializationManager::initialize_global_variables(
                 debug_msg(DebugMsgId::GENERIC_DEBUG,
                           "Global variable %s created successfully: ");
             } else {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "ERROR: Global variable %s creation failed",
@@ -102,7 +102,7 @@ void GlobalInitializationManager::sync_enum_definitions_from_parser(
         interpreter_->enum_manager_->register_enum(enum_name, enum_def);
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Synced enum definition: %s with %zu members",
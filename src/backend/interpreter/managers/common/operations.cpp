@@ -73,7 +73,7 @@ void CommonOperations::assign_array_literal_to_variable(
     }
 
     if (interpreter_->is_debug_mode()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
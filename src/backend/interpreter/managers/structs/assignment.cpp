@@ -17,7 +17,7 @@ void StructAssignmentManager::assign_struct_member(
     const Variable &value_var) {
     // Note: value_var contains the source value to assign
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -242,7 +242,7 @@ void StructAssignmentManager::assign_struct_member(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Updated direct access var %s (type=%d)",
@@ -275,7 +275,7 @@ void StructAssignmentManager::assign_struct_member(
     // 最上位の親変数がconstかチェック
     if (Variable *root_var = interpreter_->find_variable(root_var_name)) {
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "INT: Root variable %s found, is_const=%d",
@@ -384,7 +384,7 @@ void StructAssignmentManager::assign_struct_member(
     const std::string &var_name, const std::string &member_name,
     const std::string &str_value) {
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -478,7 +478,7 @@ void StructAssignmentManager::assign_struct_member(
         direct_var->str_value = str_value;
         direct_var->is_assigned = true;
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Updated direct access var %s with value '%s'",
@@ -488,7 +488,7 @@ void StructAssignmentManager::assign_struct_member(
         }
     } else {
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Direct access var %s not found",
@@ -503,7 +503,7 @@ void StructAssignmentManager::assign_struct_member_struct(
     const std::string &var_name, const std::string &member_name,
     const Variable &struct_value) {
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "assign_struct_member_struct: var=%s, member=%s, "
@@ -553,7 +553,7 @@ void StructAssignmentManager::assign_struct_member_struct(
     if (member_var->struct_type_name.empty()) {
         member_var->struct_type_name = struct_value.struct_type_name;
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Setting member struct type to: %s",
@@ -580,7 +580,7 @@ void StructAssignmentManager::assign_struct_member_struct(
         *direct_var = struct_value;
         direct_var->is_assigned = true;
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Updated direct access struct var %s",
@@ -694,11 +694,12 @@ void StructAssignmentManager::assign_struct_member_array_element(
     }
 
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Assignment completed, array_values[%d] = %lld", index,
-                     member_var->array_values[index]);
+                     static_cast<long long>(
+                         member_var->array_values.get(index)));
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
     }
@@ -751,7 +752,7 @@ void StructAssignmentManager::assign_struct_member_array_element(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -785,7 +786,7 @@ void StructAssignmentManager::assign_struct_member_array_element(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "After assignment: array_strings[%d]=%s", index,
@@ -804,7 +805,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
     const std::string &var_name, const std::string &member_name,
     const ASTNode *array_literal) {
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "assign_struct_member_array_literal: var=%s, member=%s",
@@ -822,7 +823,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
     if (interpreter_->debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "member_var->is_multidimensional: %d, ");
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf), "Address of member_var: %p",
                      (void *)member_var);
@@ -849,7 +850,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "result.is_string_array: %d, result.size: %zu",
@@ -863,14 +864,14 @@ void StructAssignmentManager::assign_struct_member_array_literal(
             if (interpreter_->debug_mode) {
                 debug_msg(DebugMsgId::GENERIC_DEBUG,
                           "Entering individual element update block");
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "member_var->is_multidimensional: %d",
                              member_var->is_multidimensional);
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "member_var->array_dimensions.size(): %zu",
@@ -880,7 +881,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
                 if (member_var->array_dimensions.size() >= 2) {
                     for (size_t i = 0; i < member_var->array_dimensions.size();
                          i++) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "dimension[%zu]: %d", i,
@@ -899,7 +900,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
                 member_var->array_dimensions.size() >= 2) {
                 // N次元配列の場合 - フラット配列として直接更新
                 if (interpreter_->debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -907,7 +908,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
                             var_name.c_str(), member_name.c_str());
                         debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                     }
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Total array size: %zu, values to assign: %zu",
@@ -927,7 +928,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
                     member_var->multidim_array_values.resize(
                         member_var->array_values.size());
                     if (interpreter_->debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -958,12 +959,16 @@ void StructAssignmentManager::assign_struct_member_array_literal(
                         for (size_t c = 0;
                              c < cols && (r * cols + c) < assigned_count; c++) {
                             size_t flat_index = r * cols + c;
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(
                                     dbg_buf, sizeof(dbg_buf),
                                     "  [%zu][%zu] = %lld (flat_index: %zu)", r,
-                                    c, member_var->array_values[flat_index],
+                                    c,
+                                    static_cast<long long>(
+                                        member_var->array_values.get(
+                                            flat_index)),
                                     flat_index);
                                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                             }
@@ -1023,7 +1028,7 @@ void StructAssignmentManager::assign_struct_member_array_literal(
         }
     } catch (const std::exception &e) {
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -1420,7 +1425,7 @@ void StructAssignmentManager::process_named_initialization(
                 direct_array_var->is_assigned = true;
 
                 if (interpreter_->debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -1638,7 +1643,7 @@ void StructAssignmentManager::process_positional_initialization(
             }
         } else if (it->second.is_array &&
                    init_value->node_type == ASTNodeType::AST_ARRAY_LITERAL) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -1858,7 +1863,7 @@ void StructAssignmentManager::sync_nested_struct_members_recursive(
             nested_var->is_assigned = true;
 
             if (interpreter_->debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Updated nested member: %s (type=%d)",
@@ -1875,7 +1880,7 @@ void StructAssignmentManager::sync_nested_struct_members_recursive(
             // スキップして、struct_membersマップだけを信頼する
 
             if (interpreter_->debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Skipped creating nested member (not found): %s",
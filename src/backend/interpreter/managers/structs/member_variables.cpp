@@ -17,7 +17,7 @@ StructVariableManager::StructVariableManager(Interpreter *interpreter)
 void StructVariableManager::create_struct_variable(
     const std::string &var_name, const std::string &struct_type_name) {
     if (interpreter_->is_debug_mode()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -74,7 +74,7 @@ void StructVariableManager::create_struct_variable(
     // メンバ変数を初期化
     for (const auto &member : struct_def->members) {
         if (interpreter_->is_debug_mode()) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Processing member: %s, is_array: %d",
@@ -85,7 +85,7 @@ void StructVariableManager::create_struct_variable(
 
         if (member.array_info.is_array()) {
             if (interpreter_->is_debug_mode()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "Member %s is an array with %zu dimensions",
@@ -146,7 +146,7 @@ void StructVariableManager::create_struct_variable(
 
     // v0.13.0: ジェネリック構造体のimplブロックをインスタンス化
     // 例: Box<int>の場合、impl Box<T>のTをintに置換してインスタンス化
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[GENERIC_CTOR_DEBUG] resolved_type_name=%s, checking for '_'",
@@ -218,7 +218,7 @@ void StructVariableManager::create_struct_variable(
                     }
                 } catch (const std::exception &e) {
                     if (interpreter_->is_debug_mode()) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[GENERIC_CTOR] Failed to instantiate: %s",
@@ -341,7 +341,7 @@ void StructVariableManager::process_multidimensional_array_member(
     multidim_array_member.is_const = member.is_const;
 
     if (interpreter_->is_debug_mode()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Set is_multidimensional = true for %s",
@@ -614,7 +614,7 @@ void StructVariableManager::post_process_array_elements(
 
 int StructVariableManager::resolve_array_size(const ArrayDimension &dim_info) {
     if (interpreter_->is_debug_mode()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Attempting to resolve constant: %s",
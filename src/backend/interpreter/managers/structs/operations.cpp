@@ -478,7 +478,7 @@ Variable *StructOperations::get_struct_member(const std::string &var_name,
             if (array_var && array_var->is_array && array_var->is_struct &&
                 !array_var->struct_type_name.empty()) {
                 // 親配列が存在する場合、要素変数を作成
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[DEBUG] Auto-creating struct array element: %s",
@@ -522,7 +522,8 @@ Variable *StructOperations::get_struct_member(const std::string &var_name,
     // 構造体メンバーアクセス前に最新状態を同期
     // 注: 参照の場合、参照先で同期する必要があるが、
     // 参照先は名前がないため、元の変数名で同期を試みる
-    interpreter_->sync_struct_members_from_direct_access(var_name);
+    // v0.14.0: アクセスするメンバーだけを同期する
+    interpreter_->sync_struct_member_from_direct_access(var_name, member_name);
 
     ensure_struct_member_access_allowed(var_name, member_name);
 
@@ -670,7 +671,7 @@ void StructOperations::sync_individual_member_from_struct(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -711,7 +712,7 @@ int64_t StructOperations::get_struct_member_multidim_array_element(
     }
 
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -721,7 +722,7 @@ int64_t StructOperations::get_struct_member_multidim_array_element(
         }
         debug_msg(DebugMsgId::GENERIC_DEBUG, "Indices: ");
         for (size_t i = 0; i < indices.size(); i++) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "[%lld]", indices[i]);
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
@@ -730,7 +731,7 @@ int64_t StructOperations::get_struct_member_multidim_array_element(
         debug_msg(DebugMsgId::GENERIC_DEBUG, "");
         debug_msg(DebugMsgId::GENERIC_DEBUG, "Array dimensions: ");
         for (size_t i = 0; i < member_var->array_dimensions.size(); i++) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf), "[%d]",
                          member_var->array_dimensions[i]);
@@ -781,12 +782,14 @@ int64_t StructOperations::get_struct_member_multidim_array_element(
         }
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Reading from multidim_array_values[%zu] = %lld",
                          flat_index,
-                         member_var->multidim_array_values[flat_index]);
+                         static_cast<long long>(
+                             member_var->multidim_array_values.get(
+                                 flat_index)));
                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
             }
         }
@@ -851,7 +854,7 @@ std::string StructOperations::get_struct_member_array_string_element(
     }
 
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "Returning string: array_strings[%d]=%s", index,
@@ -16,7 +16,7 @@ void StructSyncManager::sync_direct_access_from_struct_value(
     debug_msg(DebugMsgId::INTERPRETER_SYNC_STRUCT_MEMBERS_START,
               var_name.c_str());
 
-    std::map<std::string, Variable> *target_map = nullptr;
+    VariableMap *target_map = nullptr;
     for (auto it = interpreter_->scope_stack.rbegin();
          it != interpreter_->scope_stack.rend(); ++it) {
         if (it->variables.find(var_name) != it->variables.end()) {
@@ -52,7 +52,7 @@ void StructSyncManager::sync_direct_access_from_struct_value(
     root_var.is_struct = true;
 
     if (interpreter_->debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "DIRECT_SYNC: updating %s with %zu members",
@@ -61,10 +61,10 @@ void StructSyncManager::sync_direct_access_from_struct_value(
         }
     }
 
-    std::function<void(std::map<std::string, Variable> &, const std::string &,
+    std::function<void(VariableMap &, const std::string &,
                        const Variable &)>
         copy_members;
-    copy_members = [&](std::map<std::string, Variable> &vars,
+    copy_members = [&](VariableMap &vars,
                        const std::string &base_name, const Variable &source) {
         for (const auto &member_pair : source.struct_members) {
             const std::string &member_name = member_pair.first;
@@ -173,7 +173,8 @@ void StructSyncManager::sync_direct_access_from_struct_value(
                     vars[element_name] = element_var;
                     if (interpreter_->debug_mode) {
                         if (TypeHelpers::isString(element_var.type)) {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(dbg_buf, sizeof(dbg_buf),
                                          "DIRECT_SYNC_ARRAY_ELEM: %s str='%s'",
@@ -182,7 +183,8 @@ void StructSyncManager::sync_direct_access_from_struct_value(
                                 debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                             }
                         } else {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(
                                     dbg_buf, sizeof(dbg_buf),
@@ -263,424 +265,458 @@ void StructSyncManager::sync_struct_members_from_direct_access(
 
     // 各メンバについてダイレクトアクセス変数から struct_members に同期
     for (const auto &member : struct_def->members) {
-        std::string direct_var_name = var_name + "." + member.name;
-        Variable *direct_var = interpreter_->find_variable(direct_var_name);
+        sync_member_from_direct_access(var_name, var, member);
+    }
 
-        if (direct_var) {
-            debug_msg(DebugMsgId::INTERPRETER_STRUCT_MEMBER_FOUND,
-                      member.name.c_str());
-            auto resolve_base_type = [](TypeInfo type) {
-                if (type >= TYPE_ARRAY_BASE) {
-                    return static_cast<TypeInfo>(type - TYPE_ARRAY_BASE);
-                }
-                return type;
-            };
-            TypeInfo member_base_type = resolve_base_type(member.type);
-            TypeInfo direct_base_type = resolve_base_type(direct_var->type);
-
-            // struct_membersに保存（配列チェックを先に実行）
-            if (member.type >= TYPE_ARRAY_BASE ||
-                member.array_info.base_type != TYPE_UNKNOWN ||
-                direct_var->is_array) {
-                // v0.11.1: 配列サイズの決定
-                int array_size = -1;
-
-                // 1. direct_varが有効な配列でサイズが設定されている場合
-                if (direct_var->is_array && direct_var->array_size > 0) {
-                    array_size = direct_var->array_size;
-                }
-                // 2. member定義にサイズがある場合
-                else if (!member.array_info.dimensions.empty() &&
-                         member.array_info.dimensions[0].size > 0) {
-                    array_size = member.array_info.dimensions[0].size;
-                }
-                // 3. 実際の配列要素をカウント
-                else {
-                    int count = 0;
-                    for (int i = 0; i < 1000; ++i) { // 上限1000
-                        std::string element_name = var_name + "." +
-                                                   member.name + "[" +
-                                                   std::to_string(i) + "]";
-                        if (!interpreter_->find_variable(element_name)) {
-                            break;
-                        }
-                        count++;
-                    }
-                    if (count > 0) {
-                        array_size = count;
-                    } else {
-                        array_size = 1; // デフォルト
+    debug_msg(DebugMsgId::INTERPRETER_SYNC_STRUCT_MEMBERS_END,
+              var_name.c_str());
+}
+
+void StructSyncManager::sync_struct_member_from_direct_access(
+    const std::string &var_name, const std::string &member_name) {
+    if (var_name.empty()) {
+        return;
+    }
+
+    Variable *var = interpreter_->find_variable(var_name);
+    if (!var || !var->is_struct) {
+        return;
+    }
+
+    std::string resolved_struct_name =
+        interpreter_->type_manager_->resolve_typedef(var->struct_type_name);
+    const StructDefinition *struct_def =
+        interpreter_->find_struct_definition(resolved_struct_name);
+    if (!struct_def) {
+        return;
+    }
+
+    // v0.14.0: レイアウトのフィールド番号で対象メンバーだけを同期する
+    int index = struct_def->field_index(member_name);
+    if (index < 0) {
+        // 定義にないキー（配列要素など）は従来通り全メンバーを同期
+        sync_struct_members_from_direct_access(var_name);
+        return;
+    }
+    sync_member_from_direct_access(var_name, var, struct_def->members[index]);
+}
+
+void StructSyncManager::sync_member_from_direct_access(
+    const std::string &var_name, Variable *var, const StructMember &member) {
+    std::string direct_var_name = var_name + "." + member.name;
+    Variable *direct_var = interpreter_->find_variable(direct_var_name);
+
+    if (direct_var) {
+        debug_msg(DebugMsgId::INTERPRETER_STRUCT_MEMBER_FOUND,
+                  member.name.c_str());
+        auto resolve_base_type = [](TypeInfo type) {
+            if (type >= TYPE_ARRAY_BASE) {
+                return static_cast<TypeInfo>(type - TYPE_ARRAY_BASE);
+            }
+            return type;
+        };
+        TypeInfo member_base_type = resolve_base_type(member.type);
+        TypeInfo direct_base_type = resolve_base_type(direct_var->type);
+
+        // struct_membersに保存（配列チェックを先に実行）
+        if (member.type >= TYPE_ARRAY_BASE ||
+            member.array_info.base_type != TYPE_UNKNOWN ||
+            direct_var->is_array) {
+            // v0.11.1: 配列サイズの決定
+            int array_size = -1;
+
+            // 1. direct_varが有効な配列でサイズが設定されている場合
+            if (direct_var->is_array && direct_var->array_size > 0) {
+                array_size = direct_var->array_size;
+            }
+            // 2. member定義にサイズがある場合
+            else if (!member.array_info.dimensions.empty() &&
+                     member.array_info.dimensions[0].size > 0) {
+                array_size = member.array_info.dimensions[0].size;
+            }
+            // 3. 実際の配列要素をカウント
+            else {
+                int count = 0;
+                for (int i = 0; i < 1000; ++i) { // 上限1000
+                    std::string element_name = var_name + "." +
+                                               member.name + "[" +
+                                               std::to_string(i) + "]";
+                    if (!interpreter_->find_variable(element_name)) {
+                        break;
                     }
+                    count++;
+                }
+                if (count > 0) {
+                    array_size = count;
+                } else {
+                    array_size = 1; // デフォルト
                 }
+            }
 
-                if (interpreter_->debug_mode) {
-                    {
-                        char dbg_buf[512];
-                        snprintf(dbg_buf, sizeof(dbg_buf),
-                                 "[SYNC_DEBUG] member=%s, final array_size=%d",
-                                 member.name.c_str(), array_size);
-                        debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
-                    }
+            if (interpreter_->debug_mode) {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
+                    char dbg_buf[512];
+                    snprintf(dbg_buf, sizeof(dbg_buf),
+                             "[SYNC_DEBUG] member=%s, final array_size=%d",
+                             member.name.c_str(), array_size);
+                    debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
+            }
 
-                debug_msg(DebugMsgId::INTERPRETER_STRUCT_ARRAY_MEMBER_ADDED,
-                          member.name.c_str(), (int)member.type, array_size);
+            debug_msg(DebugMsgId::INTERPRETER_STRUCT_ARRAY_MEMBER_ADDED,
+                      member.name.c_str(), (int)member.type, array_size);
 
-                // 既存のメンバーがあれば保持、なければ新規作成
-                if (var->struct_members.find(member.name) ==
-                    var->struct_members.end()) {
-                    var->struct_members[member.name] = Variable();
-                }
+            // 既存のメンバーがあれば保持、なければ新規作成
+            if (var->struct_members.find(member.name) ==
+                var->struct_members.end()) {
+                var->struct_members[member.name] = Variable();
+            }
 
-                var->struct_members[member.name].type = member.type;
-                var->struct_members[member.name].is_array = true;
-                var->struct_members[member.name].array_size = array_size;
-
-                // 多次元配列情報をコピー
-                if (direct_var->is_multidimensional) {
-                    var->struct_members[member.name].is_multidimensional = true;
-                    var->struct_members[member.name].array_dimensions =
-                        direct_var->array_dimensions;
-                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                              "SYNC_STRUCT: Preserved multidimensional info ");
-                }
+            var->struct_members[member.name].type = member.type;
+            var->struct_members[member.name].is_array = true;
+            var->struct_members[member.name].array_size = array_size;
 
-                // 配列要素を個別にチェックして同期
-                // 既存の値を保持するため、サイズが変わる場合のみresize
-                if (var->struct_members[member.name].array_values.size() !=
-                    static_cast<size_t>(array_size)) {
-                    var->struct_members[member.name].array_values.resize(
-                        array_size);
-                }
-                if (var->struct_members[member.name].array_strings.size() !=
-                    static_cast<size_t>(array_size)) {
-                    var->struct_members[member.name].array_strings.resize(
-                        array_size);
-                }
+            // 多次元配列情報をコピー
+            if (direct_var->is_multidimensional) {
+                var->struct_members[member.name].is_multidimensional = true;
+                var->struct_members[member.name].array_dimensions =
+                    direct_var->array_dimensions;
+                debug_msg(DebugMsgId::GENERIC_DEBUG,
+                          "SYNC_STRUCT: Preserved multidimensional info ");
+            }
 
-                // 多次元配列の場合は multidim_array_values
-                // も初期化（元の値をコピー）
-                if (var->struct_members[member.name].is_multidimensional) {
-                    // 多次元配列のtotal sizeを計算
-                    size_t total_size = 1;
-                    for (int dim : direct_var->array_dimensions) {
-                        if (dim > 0) {
-                            total_size *= dim;
-                        }
+            // 配列要素を個別にチェックして同期
+            // 既存の値を保持するため、サイズが変わる場合のみresize
+            if (var->struct_members[member.name].array_values.size() !=
+                static_cast<size_t>(array_size)) {
+                var->struct_members[member.name].array_values.resize(
+                    array_size);
+            }
+            if (var->struct_members[member.name].array_strings.size() !=
+                static_cast<size_t>(array_size)) {
+                var->struct_members[member.name].array_strings.resize(
+                    array_size);
+            }
+
+            // 多次元配列の場合は multidim_array_values
+            // も初期化（元の値をコピー）
+            if (var->struct_members[member.name].is_multidimensional) {
+                // 多次元配列のtotal sizeを計算
+                size_t total_size = 1;
+                for (int dim : direct_var->array_dimensions) {
+                    if (dim > 0) {
+                        total_size *= dim;
                     }
+                }
 
-                    // 既存の multidim_array_values
-                    // をバックアップしてからリサイズ
-                    std::vector<int64_t> backup_values =
-                        direct_var->multidim_array_values;
+                // 既存の multidim_array_values
+                // をバックアップしてからリサイズ
+                std::vector<int64_t> backup_values(
+                    direct_var->multidim_array_values);
+                var->struct_members[member.name]
+                    .multidim_array_values.resize(total_size);
+
+                // バックアップした値を復元
+                size_t copy_size =
+                    std::min(backup_values.size(), total_size);
+                for (size_t i = 0; i < copy_size; i++) {
                     var->struct_members[member.name]
-                        .multidim_array_values.resize(total_size);
-
-                    // バックアップした値を復元
-                    size_t copy_size =
-                        std::min(backup_values.size(), total_size);
-                    for (size_t i = 0; i < copy_size; i++) {
-                        var->struct_members[member.name]
-                            .multidim_array_values[i] = backup_values[i];
+                        .multidim_array_values[i] = backup_values[i];
+                }
+
+                debug_msg(
+                    DebugMsgId::GENERIC_DEBUG,
+                    "SYNC_STRUCT: Initialized multidim_array_values for ");
+            }
+
+            // 個別要素変数からデータをコピー
+            for (int i = 0; i < direct_var->array_size; i++) {
+                std::string element_name = var_name + "." + member.name +
+                                           "[" + std::to_string(i) + "]";
+                std::string element_key =
+                    member.name + "[" + std::to_string(i) + "]";
+                Variable *element_var =
+                    interpreter_->find_variable(element_name);
+
+                // まず親構造体のstruct_membersから配列要素を探す（構造体配列の場合）
+                auto element_it = var->struct_members.find(element_key);
+                bool found_in_struct_members =
+                    (element_it != var->struct_members.end());
+
+                if (element_var) {
+                    if (interpreter_->debug_mode) {
+                        debug_msg(
+                            DebugMsgId::GENERIC_DEBUG,
+                            "SYNC_STRUCT: Found element_var for %s: ");
                     }
+                    // 構造体配列の場合、配列要素も構造体として同期する
+                    if (element_var->is_struct &&
+                        !element_var->struct_members.empty()) {
+                        // 配列要素の構造体を再帰的に同期
+                        sync_struct_members_from_direct_access(
+                            element_name);
 
-                    debug_msg(
-                        DebugMsgId::GENERIC_DEBUG,
-                        "SYNC_STRUCT: Initialized multidim_array_values for ");
-                }
+                        // 親構造体のstruct_membersに配列要素を追加
+                        var->struct_members[element_key] = *element_var;
 
-                // 個別要素変数からデータをコピー
-                for (int i = 0; i < direct_var->array_size; i++) {
-                    std::string element_name = var_name + "." + member.name +
-                                               "[" + std::to_string(i) + "]";
-                    std::string element_key =
-                        member.name + "[" + std::to_string(i) + "]";
-                    Variable *element_var =
-                        interpreter_->find_variable(element_name);
-
-                    // まず親構造体のstruct_membersから配列要素を探す（構造体配列の場合）
-                    auto element_it = var->struct_members.find(element_key);
-                    bool found_in_struct_members =
-                        (element_it != var->struct_members.end());
-
-                    if (element_var) {
                         if (interpreter_->debug_mode) {
-                            debug_msg(
-                                DebugMsgId::GENERIC_DEBUG,
-                                "SYNC_STRUCT: Found element_var for %s: ");
+                            debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                      "SYNC_STRUCT: Synced struct array "
+                                      "element ");
                         }
-                        // 構造体配列の場合、配列要素も構造体として同期する
-                        if (element_var->is_struct &&
-                            !element_var->struct_members.empty()) {
-                            // 配列要素の構造体を再帰的に同期
-                            sync_struct_members_from_direct_access(
-                                element_name);
-
-                            // 親構造体のstruct_membersに配列要素を追加
-                            var->struct_members[element_key] = *element_var;
-
+                    } else {
+                        // プリミティブ型配列の場合
+                        TypeInfo element_base_type =
+                            resolve_base_type(element_var->type);
+                        if (member_base_type == TYPE_STRING ||
+                            direct_base_type == TYPE_STRING ||
+                            element_base_type == TYPE_STRING) {
+                            var->struct_members[member.name]
+                                .array_strings[i] = element_var->str_value;
                             if (interpreter_->debug_mode) {
                                 debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                          "SYNC_STRUCT: Synced struct array "
-                                          "element ");
+                                          "SYNC_STRUCT: Copied string ");
                             }
                         } else {
-                            // プリミティブ型配列の場合
-                            TypeInfo element_base_type =
-                                resolve_base_type(element_var->type);
-                            if (member_base_type == TYPE_STRING ||
-                                direct_base_type == TYPE_STRING ||
-                                element_base_type == TYPE_STRING) {
-                                var->struct_members[member.name]
-                                    .array_strings[i] = element_var->str_value;
-                                if (interpreter_->debug_mode) {
-                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                              "SYNC_STRUCT: Copied string ");
-                                }
-                            } else {
-                                var->struct_members[member.name]
-                                    .array_values[i] = element_var->value;
-                                if (interpreter_->debug_mode) {
-                                    debug_msg(
-                                        DebugMsgId::GENERIC_DEBUG,
-                                        "SYNC_STRUCT: Copied element[%d] = ");
-                                }
-                                // 多次元配列の場合は multidim_array_values
-                                // にも設定
-                                if (var->struct_members[member.name]
-                                        .is_multidimensional) {
-                                    var->struct_members[member.name]
-                                        .multidim_array_values[i] =
-                                        element_var->value;
-                                    if (interpreter_->debug_mode) {
-                                        debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                                  "SYNC_STRUCT: Copied "
-                                                  "element[%d] = ");
-                                    }
-                                }
+                            var->struct_members[member.name]
+                                .array_values[i] = element_var->value;
+                            if (interpreter_->debug_mode) {
+                                debug_msg(
+                                    DebugMsgId::GENERIC_DEBUG,
+                                    "SYNC_STRUCT: Copied element[%d] = ");
                             }
-                        }
-                    } else if (found_in_struct_members &&
-                               element_it->second.is_struct) {
-                        // 個別変数がないが、struct_membersに構造体配列要素がある場合
-                        // (これは既に同期済みの可能性がある)
-                        if (interpreter_->debug_mode) {
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "SYNC_STRUCT: Struct array element %s ");
-                        }
-                    } else {
-                        // 要素変数が見つからない場合、direct_var自体の配列データを使用
-                        if ((member_base_type == TYPE_STRING ||
-                             direct_base_type == TYPE_STRING) &&
-                            i < static_cast<int>(
-                                    direct_var->array_strings.size())) {
-                            var->struct_members[member.name].array_strings[i] =
-                                direct_var->array_strings[i];
-                        } else if (member_base_type != TYPE_STRING &&
-                                   i < static_cast<int>(
-                                           direct_var->array_values.size())) {
-                            var->struct_members[member.name].array_values[i] =
-                                direct_var->array_values[i];
+                            // 多次元配列の場合は multidim_array_values
+                            // にも設定
                             if (var->struct_members[member.name]
                                     .is_multidimensional) {
                                 var->struct_members[member.name]
                                     .multidim_array_values[i] =
-                                    direct_var->array_values[i];
+                                    element_var->value;
+                                if (interpreter_->debug_mode) {
+                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                              "SYNC_STRUCT: Copied "
+                                              "element[%d] = ");
+                                }
                             }
                         }
                     }
-                }
-
-                var->struct_members[member.name].is_assigned = true;
-                debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
-                          member.name.c_str(), direct_var->array_size);
-            } else {
-                std::string member_union_alias =
-                    member.is_pointer ? member.pointer_base_type_name
-                                      : member.type_alias;
-                bool direct_is_union =
-                    interpreter_->type_manager_->is_union_type(*direct_var);
-                bool member_is_union =
-                    (!member_union_alias.empty() &&
-                     interpreter_->type_manager_->is_union_type(
-                         member_union_alias));
-
-                Variable member_value = *direct_var;
-
-                // メンバー定義由来のメタ情報を優先度高く上書き
-                member_value.is_pointer = member.is_pointer;
-                member_value.pointer_depth = member.pointer_depth;
-                member_value.pointer_base_type_name =
-                    member.pointer_base_type_name;
-                member_value.pointer_base_type = member.pointer_base_type;
-                member_value.is_private_member = member.is_private;
-                member_value.is_reference = member.is_reference;
-                member_value.is_unsigned = member.is_unsigned;
-                member_value.is_const = member.is_const;
-
-                // unionメンバーの場合、型名とcurrent_typeを確実に保持
-                if (direct_is_union || member_is_union) {
-                    member_value.type = TYPE_UNION;
-                    if (!direct_var->type_name.empty()) {
-                        member_value.type_name = direct_var->type_name;
-                    } else if (!member_union_alias.empty()) {
-                        member_value.type_name = member_union_alias;
+                } else if (found_in_struct_members &&
+                           element_it->second.is_struct) {
+                    // 個別変数がないが、struct_membersに構造体配列要素がある場合
+                    // (これは既に同期済みの可能性がある)
+                    if (interpreter_->debug_mode) {
+                        debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                  "SYNC_STRUCT: Struct array element %s ");
                     }
-                    member_value.current_type = direct_var->current_type;
                 } else {
-                    // 通常のメンバー型を構造体定義に合わせる
-                    member_value.type = member.type;
-                }
-
-                // 数値/文字列/浮動小数などの基本値を direct_var
-                // に合わせて整合させる
-                member_value.value = direct_var->value;
-                member_value.str_value = direct_var->str_value;
-                member_value.float_value = direct_var->float_value;
-                member_value.double_value = direct_var->double_value;
-                member_value.quad_value = direct_var->quad_value;
-                member_value.big_value = direct_var->big_value;
-                member_value.is_assigned = direct_var->is_assigned;
-
-                // 構造体・配列などの複合型もコピー（=
-                // *direct_varでコピー済みだが念のため整合）
-                member_value.is_array = direct_var->is_array;
-                member_value.array_size = direct_var->array_size;
-                member_value.array_values = direct_var->array_values;
-                member_value.array_strings = direct_var->array_strings;
-                member_value.array_dimensions = direct_var->array_dimensions;
-                member_value.is_multidimensional =
-                    direct_var->is_multidimensional;
-                member_value.multidim_array_values =
-                    direct_var->multidim_array_values;
-                member_value.multidim_array_strings =
-                    direct_var->multidim_array_strings;
-                member_value.is_struct = direct_var->is_struct;
-                member_value.struct_type_name = direct_var->struct_type_name;
-                member_value.struct_members = direct_var->struct_members;
-
-                // ネストされた構造体の場合、再帰的に同期
-                if (direct_var->is_struct &&
-                    !direct_var->struct_members.empty()) {
-                    sync_struct_members_from_direct_access(direct_var_name);
-                    // 再度取得して最新の値を使用
-                    Variable *updated_direct_var =
-                        interpreter_->find_variable(direct_var_name);
-                    if (updated_direct_var) {
-                        member_value.struct_members =
-                            updated_direct_var->struct_members;
-                        if (interpreter_->debug_mode) {
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "SYNC_STRUCT: Recursively synced nested "
-                                      "struct ");
+                    // 要素変数が見つからない場合、direct_var自体の配列データを使用
+                    if ((member_base_type == TYPE_STRING ||
+                         direct_base_type == TYPE_STRING) &&
+                        i < static_cast<int>(
+                                direct_var->array_strings.size())) {
+                        var->struct_members[member.name].array_strings[i] =
+                            direct_var->array_strings[i];
+                    } else if (member_base_type != TYPE_STRING &&
+                               i < static_cast<int>(
+                                       direct_var->array_values.size())) {
+                        var->struct_members[member.name].array_values[i] =
+                            direct_var->array_values[i];
+                        if (var->struct_members[member.name]
+                                .is_multidimensional) {
+                            var->struct_members[member.name]
+                                .multidim_array_values[i] =
+                                direct_var->array_values[i];
                         }
                     }
                 }
-
-                var->struct_members[member.name] = member_value;
-                debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
-                          member.name.c_str(),
-                          member_value.struct_members.size());
             }
+
+            var->struct_members[member.name].is_assigned = true;
+            debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
+                      member.name.c_str(), direct_var->array_size);
         } else {
-            // ダイレクトアクセス変数が見つからない場合、配列メンバーかチェック
-            if (member.array_info.base_type != TYPE_UNKNOWN) {
-                int arr_size = member.array_info.dimensions.empty()
-                                   ? 0
-                                   : member.array_info.dimensions[0].size;
-                debug_msg(DebugMsgId::INTERPRETER_STRUCT_ARRAY_MEMBER_ADDED,
-                          member.name.c_str(), (int)member.type, arr_size);
+            std::string member_union_alias =
+                member.is_pointer ? member.pointer_base_type_name
+                                  : member.type_alias;
+            bool direct_is_union =
+                interpreter_->type_manager_->is_union_type(*direct_var);
+            bool member_is_union =
+                (!member_union_alias.empty() &&
+                 interpreter_->type_manager_->is_union_type(
+                     member_union_alias));
+
+            Variable member_value = *direct_var;
+
+            // メンバー定義由来のメタ情報を優先度高く上書き
+            member_value.is_pointer = member.is_pointer;
+            member_value.pointer_depth = member.pointer_depth;
+            member_value.pointer_base_type_name =
+                member.pointer_base_type_name;
+            member_value.pointer_base_type = member.pointer_base_type;
+            member_value.is_private_member = member.is_private;
+            member_value.is_reference = member.is_reference;
+            member_value.is_unsigned = member.is_unsigned;
+            member_value.is_const = member.is_const;
+
+            // unionメンバーの場合、型名とcurrent_typeを確実に保持
+            if (direct_is_union || member_is_union) {
+                member_value.type = TYPE_UNION;
+                if (!direct_var->type_name.empty()) {
+                    member_value.type_name = direct_var->type_name;
+                } else if (!member_union_alias.empty()) {
+                    member_value.type_name = member_union_alias;
+                }
+                member_value.current_type = direct_var->current_type;
+            } else {
+                // 通常のメンバー型を構造体定義に合わせる
+                member_value.type = member.type;
+            }
 
-                var->struct_members[member.name] = Variable();
-                var->struct_members[member.name].type = member.type;
-                var->struct_members[member.name].is_array = true;
-                auto resolve_base_type = [](TypeInfo type) {
-                    if (type >= TYPE_ARRAY_BASE) {
-                        return static_cast<TypeInfo>(type - TYPE_ARRAY_BASE);
-                    }
-                    return type;
-                };
-                TypeInfo member_base_type = resolve_base_type(member.type);
-
-                int array_size = (!member.array_info.dimensions.empty())
-                                     ? member.array_info.dimensions[0].size
-                                     : 1;
-                var->struct_members[member.name].array_size = array_size;
-
-                // 多次元配列情報を構造体定義から設定
-                if (member.array_info.dimensions.size() > 1) {
-                    var->struct_members[member.name].is_multidimensional = true;
-                    for (const auto &dim : member.array_info.dimensions) {
-                        var->struct_members[member.name]
-                            .array_dimensions.push_back(dim.size);
+            // 数値/文字列/浮動小数などの基本値を direct_var
+            // に合わせて整合させる
+            member_value.value = direct_var->value;
+            member_value.str_value = direct_var->str_value;
+            member_value.float_value = direct_var->float_value;
+            member_value.double_value = direct_var->double_value;
+            member_value.quad_value = direct_var->quad_value;
+            member_value.big_value = direct_var->big_value;
+            member_value.is_assigned = direct_var->is_assigned;
+
+            // 構造体・配列などの複合型もコピー（=
+            // *direct_varでコピー済みだが念のため整合）
+            member_value.is_array = direct_var->is_array;
+            member_value.array_size = direct_var->array_size;
+            member_value.array_values = direct_var->array_values;
+            member_value.array_strings = direct_var->array_strings;
+            member_value.array_dimensions = direct_var->array_dimensions;
+            member_value.is_multidimensional =
+                direct_var->is_multidimensional;
+            member_value.multidim_array_values =
+                direct_var->multidim_array_values;
+            member_value.multidim_array_strings =
+                direct_var->multidim_array_strings;
+            member_value.is_struct = direct_var->is_struct;
+            member_value.struct_type_name = direct_var->struct_type_name;
+            member_value.struct_members = direct_var->struct_members;
+
+            // ネストされた構造体の場合、再帰的に同期
+            if (direct_var->is_struct &&
+                !direct_var->struct_members.empty()) {
+                sync_struct_members_from_direct_access(direct_var_name);
+                // 再度取得して最新の値を使用
+                Variable *updated_direct_var =
+                    interpreter_->find_variable(direct_var_name);
+                if (updated_direct_var) {
+                    member_value.struct_members =
+                        updated_direct_var->struct_members;
+                    if (interpreter_->debug_mode) {
+                        debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                  "SYNC_STRUCT: Recursively synced nested "
+                                  "struct ");
                     }
-                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                              "SYNC_STRUCT: Set multidimensional info for "
-                              "%s.%s from ");
                 }
+            }
 
-                // 配列要素を個別にチェックして同期
-                var->struct_members[member.name].array_values.resize(
-                    array_size);
-                var->struct_members[member.name].array_strings.resize(
-                    array_size);
+            var->struct_members[member.name] = member_value;
+            debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
+                      member.name.c_str(),
+                      member_value.struct_members.size());
+        }
+    } else {
+        // ダイレクトアクセス変数が見つからない場合、配列メンバーかチェック
+        if (member.array_info.base_type != TYPE_UNKNOWN) {
+            int arr_size = member.array_info.dimensions.empty()
+                               ? 0
+                               : member.array_info.dimensions[0].size;
+            debug_msg(DebugMsgId::INTERPRETER_STRUCT_ARRAY_MEMBER_ADDED,
+                      member.name.c_str(), (int)member.type, arr_size);
+
+            var->struct_members[member.name] = Variable();
+            var->struct_members[member.name].type = member.type;
+            var->struct_members[member.name].is_array = true;
+            auto resolve_base_type = [](TypeInfo type) {
+                if (type >= TYPE_ARRAY_BASE) {
+                    return static_cast<TypeInfo>(type - TYPE_ARRAY_BASE);
+                }
+                return type;
+            };
+            TypeInfo member_base_type = resolve_base_type(member.type);
 
-                // 多次元配列の場合は multidim_array_values
-                // も初期化（元の値を保持）
-                if (var->struct_members[member.name].is_multidimensional) {
-                    // 既存のサイズを確認してリサイズが必要な場合のみ実行
-                    if (var->struct_members[member.name]
-                            .multidim_array_values.size() !=
-                        static_cast<size_t>(array_size)) {
-                        var->struct_members[member.name]
-                            .multidim_array_values.resize(array_size);
-                        debug_msg(
-                            DebugMsgId::GENERIC_DEBUG,
-                            "SYNC_STRUCT: Resized multidim_array_values for ");
-                    }
+            int array_size = (!member.array_info.dimensions.empty())
+                                 ? member.array_info.dimensions[0].size
+                                 : 1;
+            var->struct_members[member.name].array_size = array_size;
+
+            // 多次元配列情報を構造体定義から設定
+            if (member.array_info.dimensions.size() > 1) {
+                var->struct_members[member.name].is_multidimensional = true;
+                for (const auto &dim : member.array_info.dimensions) {
+                    var->struct_members[member.name]
+                        .array_dimensions.push_back(dim.size);
                 }
+                debug_msg(DebugMsgId::GENERIC_DEBUG,
+                          "SYNC_STRUCT: Set multidimensional info for "
+                          "%s.%s from ");
+            }
 
-                bool found_elements = false;
-                for (int i = 0; i < array_size; i++) {
-                    std::string element_name = var_name + "." + member.name +
-                                               "[" + std::to_string(i) + "]";
-                    Variable *element_var =
-                        interpreter_->find_variable(element_name);
-                    if (element_var) {
-                        found_elements = true;
-                        if (member_base_type == TYPE_STRING ||
-                            resolve_base_type(element_var->type) ==
-                                TYPE_STRING) {
-                            var->struct_members[member.name].array_strings[i] =
-                                element_var->str_value;
-                        } else {
-                            var->struct_members[member.name].array_values[i] =
+            // 配列要素を個別にチェックして同期
+            var->struct_members[member.name].array_values.resize(
+                array_size);
+            var->struct_members[member.name].array_strings.resize(
+                array_size);
+
+            // 多次元配列の場合は multidim_array_values
+            // も初期化（元の値を保持）
+            if (var->struct_members[member.name].is_multidimensional) {
+                // 既存のサイズを確認してリサイズが必要な場合のみ実行
+                if (var->struct_members[member.name]
+                        .multidim_array_values.size() !=
+                    static_cast<size_t>(array_size)) {
+                    var->struct_members[member.name]
+                        .multidim_array_values.resize(array_size);
+                    debug_msg(
+                        DebugMsgId::GENERIC_DEBUG,
+                        "SYNC_STRUCT: Resized multidim_array_values for ");
+                }
+            }
+
+            bool found_elements = false;
+            for (int i = 0; i < array_size; i++) {
+                std::string element_name = var_name + "." + member.name +
+                                           "[" + std::to_string(i) + "]";
+                Variable *element_var =
+                    interpreter_->find_variable(element_name);
+                if (element_var) {
+                    found_elements = true;
+                    if (member_base_type == TYPE_STRING ||
+                        resolve_base_type(element_var->type) ==
+                            TYPE_STRING) {
+                        var->struct_members[member.name].array_strings[i] =
+                            element_var->str_value;
+                    } else {
+                        var->struct_members[member.name].array_values[i] =
+                            element_var->value;
+                        // 多次元配列の場合は multidim_array_values にも設定
+                        if (var->struct_members[member.name]
+                                .is_multidimensional) {
+                            var->struct_members[member.name]
+                                .multidim_array_values[i] =
                                 element_var->value;
-                            // 多次元配列の場合は multidim_array_values にも設定
-                            if (var->struct_members[member.name]
-                                    .is_multidimensional) {
-                                var->struct_members[member.name]
-                                    .multidim_array_values[i] =
-                                    element_var->value;
-                                if (interpreter_->debug_mode) {
-                                    debug_msg(
-                                        DebugMsgId::GENERIC_DEBUG,
-                                        "SYNC_STRUCT: Copied element[%d] = ");
-                                }
+                            if (interpreter_->debug_mode) {
+                                debug_msg(
+                                    DebugMsgId::GENERIC_DEBUG,
+                                    "SYNC_STRUCT: Copied element[%d] = ");
                             }
                         }
                     }
                 }
+            }
 
-                if (found_elements) {
-                    var->struct_members[member.name].is_assigned = true;
-                    debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
-                              member.name.c_str(), (size_t)array_size);
-                }
+            if (found_elements) {
+                var->struct_members[member.name].is_assigned = true;
+                debug_msg(DebugMsgId::INTERPRETER_STRUCT_SYNCED,
+                          member.name.c_str(), (size_t)array_size);
             }
         }
     }
-
-    debug_msg(DebugMsgId::INTERPRETER_SYNC_STRUCT_MEMBERS_END,
-              var_name.c_str());
 }
@@ -6,6 +6,7 @@
 
 class Interpreter;
 struct Variable;
+struct StructMember;
 
 /**
  * @brief 構造体の同期操作を管理するクラス
@@ -35,6 +36,19 @@ class StructSyncManager {
      */
     void sync_struct_members_from_direct_access(const std::string &var_name);
 
+    /**
+     * @brief 直接アクセス変数から1つの構造体メンバーへの同期
+     *
+     * 構造体レイアウトのフィールド番号でメンバー定義を引き、
+     * 指定されたメンバーだけをstruct_membersに同期します。
+     * 定義にないメンバー名の場合は全メンバーを同期します。
+     *
+     * @param var_name 同期する構造体変数の名前
+     * @param member_name 同期するメンバー名
+     */
+    void sync_struct_member_from_direct_access(const std::string &var_name,
+                                               const std::string &member_name);
+
     /**
      * @brief 構造体値から直接アクセス変数への同期
      *
@@ -49,6 +63,11 @@ class StructSyncManager {
 
   private:
     Interpreter *interpreter_; ///< Interpreterインスタンスへのポインタ
+
+    // 1メンバー分の同期処理（全メンバー同期/単一メンバー同期で共有）
+    void sync_member_from_direct_access(const std::string &var_name,
+                                        Variable *var,
+                                        const StructMember &member);
 };
 
 #endif // STRUCT_SYNC_MANAGER_H
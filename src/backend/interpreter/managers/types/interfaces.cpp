@@ -70,7 +70,7 @@ void InterfaceOperations::register_impl_definition(
 
     debug_msg(DebugMsgId::GENERIC_DEBUG,
               "[REGISTER_IMPL] Copying ImplDefinition: methods.size()=%zu, ");
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[REGISTER_IMPL]   methods.data()=%p (from %p)",
@@ -78,7 +78,7 @@ void InterfaceOperations::register_impl_definition(
                  (void *)impl_def.methods.data());
         debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
     }
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[REGISTER_IMPL]   constructors.data()=%p (from %p)",
@@ -87,7 +87,7 @@ void InterfaceOperations::register_impl_definition(
         debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
     }
     for (size_t i = 0; i < stored_def.constructors.size(); ++i) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[REGISTER_IMPL]   constructors[%zu]=%p", i,
@@ -96,16 +96,18 @@ void InterfaceOperations::register_impl_definition(
         }
     }
 
-    auto existing = std::find_if(
-        impl_definitions_.begin(), impl_definitions_.end(),
-        [&](const ImplDefinition &candidate) {
-            return candidate.interface_name == stored_def.interface_name &&
-                   candidate.struct_name == stored_def.struct_name;
-        });
+    // v0.14.0: 新しいimplで既存の検索結果が変わりうるため破棄する
+    resolved_impls_.clear();
 
-    if (existing != impl_definitions_.end()) {
+    auto indexed = impl_index_.find(
+        ImplKey(stored_def.struct_name, stored_def.interface_name));
+    ImplDefinition *existing =
+        indexed != impl_index_.end() ? indexed->second : nullptr;
+
+    if (existing) {
         *existing = stored_def;
-        {
+        build_vtable(*existing);
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "IMPL_DEF_STORAGE: Updated existing impl '%s' for '%s' "
@@ -157,7 +159,8 @@ void InterfaceOperations::register_impl_definition(
         }
 
         impl_definitions_.push_back(stored_def);
-        existing = std::prev(impl_definitions_.end());
+        existing = &impl_definitions_.back();
+        index_impl(existing);
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "IMPL_DEF_STORAGE: Added new impl '%s' for '%s' (total: ");
     }
@@ -168,7 +171,7 @@ void InterfaceOperations::register_impl_definition(
             return;
         }
         interpreter_->register_function_to_global(key, method);
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "IMPL_REGISTER: Registered method key '%s'", key.c_str());
@@ -260,7 +263,7 @@ void InterfaceOperations::register_impl_definition(
 
 const std::deque<ImplDefinition> &
 InterfaceOperations::get_impl_definitions() const {
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "GET_IMPL_DEFS: Called! size=%zu, addr=%p",
@@ -270,10 +273,67 @@ InterfaceOperations::get_impl_definitions() const {
     return impl_definitions_;
 }
 
+void InterfaceOperations::index_impl(ImplDefinition *impl_def) {
+    // 同じキーは先に登録された定義を優先する（線形探索と同じ順序）
+    impl_index_.emplace(ImplKey(impl_def->struct_name, impl_def->interface_name),
+                        impl_def);
+    size_t lt_pos = impl_def->struct_name.find('<');
+    if (lt_pos != std::string::npos) {
+        generic_impls_by_base_[impl_def->struct_name.substr(0, lt_pos)]
+            .push_back(impl_def);
+    }
+    build_vtable(*impl_def);
+}
+
+void InterfaceOperations::build_vtable(const ImplDefinition &impl_def) {
+    if (impl_def.interface_name.empty()) {
+        return; // コンストラクタ/デストラクタだけのimpl
+    }
+    auto &slot = vtables_[ImplKey(impl_def.struct_name,
+                                  impl_def.interface_name)];
+    if (!slot) {
+        slot = std::make_unique<InterfaceVTable>();
+    }
+    InterfaceVTable &vtable = *slot;
+    vtable.interface_name = impl_def.interface_name;
+    vtable.struct_name = impl_def.struct_name;
+    vtable.methods.clear();
+
+    // ジェネリックinterface（例: VectorOps<int>）はベース名の定義を使う
+    std::string base_interface_name = impl_def.interface_name;
+    size_t lt_pos = base_interface_name.find('<');
+    if (lt_pos != std::string::npos) {
+        base_interface_name = base_interface_name.substr(0, lt_pos);
+    }
+    vtable.interface_def = find_interface_definition(base_interface_name);
+    if (!vtable.interface_def) {
+        return; // スロットなし（呼び出しは従来の検索で解決する）
+    }
+
+    vtable.methods.reserve(vtable.interface_def->methods.size());
+    for (const auto &member : vtable.interface_def->methods) {
+        const ASTNode *method = nullptr;
+        for (const ASTNode *candidate : impl_def.methods) {
+            if (candidate && candidate->name == member.name) {
+                method = candidate;
+                break;
+            }
+        }
+        vtable.methods.push_back(method);
+    }
+}
+
+const InterfaceVTable *
+InterfaceOperations::find_vtable(const std::string &interface_name,
+                                 const std::string &struct_name) const {
+    auto it = vtables_.find(ImplKey(struct_name, interface_name));
+    return it != vtables_.end() ? it->second.get() : nullptr;
+}
+
 const ImplDefinition *
 InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                                           const std::string &interface_name) {
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[FIND_IMPL] Searching for: struct='%s', interface='%s'",
@@ -281,17 +341,30 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
         debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
     }
 
-    // 1. 完全一致で検索（既存の動作）
-    for (const auto &impl_def : impl_definitions_) {
-        if (impl_def.struct_name == struct_name &&
-            impl_def.interface_name == interface_name) {
-            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                      "[FIND_IMPL] Found exact match");
-            return &impl_def;
-        }
+    // 1. 完全一致で検索
+    ImplKey key(struct_name, interface_name);
+    auto exact = impl_index_.find(key);
+    if (exact != impl_index_.end()) {
+        debug_msg(DebugMsgId::GENERIC_DEBUG, "[FIND_IMPL] Found exact match");
+        return exact->second;
     }
 
-    // 2. ジェネリックimplのインスタンス化を試みる
+    // 2. 以前に解決した検索（ジェネリックimplのインスタンス・見つからない）
+    auto resolved = resolved_impls_.find(key);
+    if (resolved != resolved_impls_.end()) {
+        return resolved->second;
+    }
+
+    const ImplDefinition *impl_def =
+        resolve_generic_impl(struct_name, interface_name);
+    resolved_impls_[key] = impl_def;
+    return impl_def;
+}
+
+const ImplDefinition *
+InterfaceOperations::resolve_generic_impl(const std::string &struct_name,
+                                          const std::string &interface_name) {
+    // ジェネリックimplのインスタンス化を試みる
     // 例: Vector<int>が要求された場合、impl VectorOps<T> for
     // Vector<T>を探してインスタンス化
 
@@ -332,7 +405,11 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
     }
 
     // ジェネリックimplを探す（例: impl VectorOps<T> for Vector<T>）
-    if (!type_arguments.empty()) {
+    auto candidates_it = generic_impls_by_base_.find(base_struct_name);
+    if (!type_arguments.empty() &&
+        candidates_it != generic_impls_by_base_.end()) {
+        validate_instance_bounds(base_struct_name, type_arguments,
+                                 struct_name);
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "[FIND_IMPL] Looking for generic impl: base_struct='%s', ");
 
@@ -340,7 +417,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
         std::string generic_interface_pattern =
             base_interface_name.empty() ? "" : base_interface_name + "<T>";
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[FIND_IMPL] Patterns: struct='%s', interface='%s'",
@@ -349,7 +426,10 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
 
-        for (const auto &impl_def : impl_definitions_) {
+        // 新しいインスタンスの登録で候補のリストが伸びるためコピーして回す
+        std::vector<const ImplDefinition *> candidates = candidates_it->second;
+        for (const ImplDefinition *candidate : candidates) {
+            const ImplDefinition &impl_def = *candidate;
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "[FIND_IMPL] Checking impl: struct='%s', ");
 
@@ -396,7 +476,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     if (impl_if_base == base_interface_name &&
                         impl_type_param_count == type_arguments.size()) {
                         interface_match = true;
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[FIND_IMPL] Interface match: "
@@ -436,7 +516,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     auto &inst_struct = std::get<1>(result);
                     // inst_node は nullptr（もう使わない）
 
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(
                             dbg_buf, sizeof(dbg_buf),
@@ -453,7 +533,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     for (size_t i = 0;
                          i < type_params.size() && i < type_arguments.size();
                          ++i) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[GENERIC_IMPL]   Mapping: %s -> %s",
@@ -465,76 +545,46 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     }
 
                     // 既にこのインスタンス化が存在するかチェック
-                    for (size_t cached_idx = 0;
-                         cached_idx < impl_definitions_.size(); ++cached_idx) {
-                        const auto &impl = impl_definitions_[cached_idx];
-                        if (impl.struct_name == inst_struct &&
-                            impl.interface_name == inst_interface) {
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "[GENERIC_IMPL] Found cached instance: ");
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "[GENERIC_IMPL]   impl_node=%p, ");
-                            debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                      "[GENERIC_IMPL]   ");
-                            if (!impl.type_parameter_map.empty()) {
-                                for (const auto &pair :
-                                     impl.type_parameter_map) {
-                                    {
-                                        char dbg_buf[512];
-                                        snprintf(dbg_buf, sizeof(dbg_buf),
-                                                 "[GENERIC_IMPL]     %s -> %s",
-                                                 pair.first.c_str(),
-                                                 pair.second.c_str());
-                                        debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                                  dbg_buf);
-                                    }
-                                }
-                            }
-                            if (!impl.methods.empty()) {
-                                {
+                    auto cached = impl_index_.find(
+                        ImplKey(inst_struct, inst_interface));
+                    if (cached != impl_index_.end()) {
+                        ImplDefinition &impl = *cached->second;
+                        debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                  "[GENERIC_IMPL] Found cached instance: ");
+                        if (!impl.type_parameter_map.empty()) {
+                            for (const auto &pair : impl.type_parameter_map) {
+                                if (CB_TRACE_MSG_ENABLED(
+                                        DebugMsgId::GENERIC_DEBUG)) {
                                     char dbg_buf[512];
                                     snprintf(dbg_buf, sizeof(dbg_buf),
-                                             "[GENERIC_IMPL]   First method=%p",
-                                             (void *)impl.methods[0]);
+                                             "[GENERIC_IMPL]     %s -> %s",
+                                             pair.first.c_str(),
+                                             pair.second.c_str());
                                     debug_msg(DebugMsgId::GENERIC_DEBUG,
                                               dbg_buf);
                                 }
                             }
+                        }
 
-                            // v0.13.1: constructor-only
-                            // implからconstructorを追加 interface
-                            // implにconstructorがない場合、同じstructのconstructor-only
-                            // implを探す
-                            if (impl.constructors.empty()) {
+                        // v0.13.1: constructor-only
+                        // implからconstructorを追加 interface
+                        // implにconstructorがない場合、同じstructのconstructor-only
+                        // implを探す
+                        if (impl.constructors.empty()) {
+                            auto ctor_impl = impl_index_.find(
+                                ImplKey(generic_struct_pattern, ""));
+                            if (ctor_impl != impl_index_.end() &&
+                                !ctor_impl->second->constructors.empty()) {
                                 debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                          "[GENERIC_IMPL] No constructors in ");
-                                for (const auto &ctor_impl :
-                                     impl_definitions_) {
-                                    if (ctor_impl.struct_name ==
-                                            generic_struct_pattern &&
-                                        ctor_impl.interface_name.empty() &&
-                                        !ctor_impl.constructors.empty()) {
-                                        debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                                  "[GENERIC_IMPL] Found ");
-                                        // constructorを追加（非const参照経由）
-                                        auto &mutable_impl =
-                                            impl_definitions_[cached_idx];
-                                        for (const auto *ctor :
-                                             ctor_impl.constructors) {
-                                            mutable_impl.constructors.push_back(
-                                                ctor);
-                                            debug_msg(
-                                                DebugMsgId::GENERIC_DEBUG,
-                                                "[GENERIC_IMPL]   Added ");
-                                        }
-                                        break;
-                                    }
+                                          "[GENERIC_IMPL] Found ");
+                                for (const auto *ctor :
+                                     ctor_impl->second->constructors) {
+                                    impl.constructors.push_back(ctor);
                                 }
                             }
-
-                            // インデックス経由でポインタを返す（参照の安全性向上）
-                            return &impl_definitions_[cached_idx];
                         }
+
+                        return &impl;
                     }
 
                     // 新しいImplDefinitionを作成（元のノードを参照、型マッピングを保存）
@@ -549,7 +599,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     debug_msg(DebugMsgId::GENERIC_DEBUG,
                               "[GENERIC_IMPL] Creating new instance: ");
                     for (const auto &pair : type_map) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[GENERIC_IMPL]   Setting map: %s -> %s",
@@ -611,6 +661,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                     }
 
                     impl_definitions_.push_back(new_impl);
+                    index_impl(&impl_definitions_.back());
 
                     size_t pushed_idx = impl_definitions_.size() - 1;
 
@@ -622,30 +673,17 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                         debug_msg(
                             DebugMsgId::GENERIC_DEBUG,
                             "[GENERIC_IMPL] New impl has no constructors, ");
-                        for (const auto &ctor_impl : impl_definitions_) {
-                            if (ctor_impl.struct_name ==
-                                    generic_struct_pattern &&
-                                ctor_impl.interface_name.empty() &&
-                                !ctor_impl.constructors.empty()) {
-                                debug_msg(
-                                    DebugMsgId::GENERIC_DEBUG,
-                                    "[GENERIC_IMPL] Found constructor-only ");
-                                debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                          "[GENERIC_IMPL]   "
-                                          "ctor_impl.impl_node=%p, ");
-
-                                // constructorを追加（ctor_implのimpl_nodeからではなく、直接constructorsから）
-                                for (const auto *ctor :
-                                     ctor_impl.constructors) {
-                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                              "[GENERIC_IMPL]   Constructor ");
-                                    impl_definitions_[pushed_idx]
-                                        .constructors.push_back(ctor);
-                                    debug_msg(DebugMsgId::GENERIC_DEBUG,
-                                              "[GENERIC_IMPL]   Added "
-                                              "constructor at ");
-                                }
-                                break;
+                        auto ctor_impl = impl_index_.find(
+                            ImplKey(generic_struct_pattern, ""));
+                        if (ctor_impl != impl_index_.end() &&
+                            !ctor_impl->second->constructors.empty()) {
+                            debug_msg(DebugMsgId::GENERIC_DEBUG,
+                                      "[GENERIC_IMPL] Found constructor-only ");
+                            // constructorを追加（ctor_implのimpl_nodeからではなく、直接constructorsから）
+                            for (const auto *ctor :
+                                 ctor_impl->second->constructors) {
+                                impl_definitions_[pushed_idx]
+                                    .constructors.push_back(ctor);
                             }
                         }
                     }
@@ -674,7 +712,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                         interpreter_->register_function_to_global(method_key,
                                                                   method);
 
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(dbg_buf, sizeof(dbg_buf),
                                      "[GENERIC_IMPL] Registered method: %s",
@@ -690,7 +728,7 @@ InterfaceOperations::find_impl_for_struct(const std::string &struct_name,
                         "[GENERIC_IMPL] Warning: processed impl not found");
                     return nullptr;
                 } catch (const std::exception &e) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "[GENERIC_IMPL] Failed to instantiate: %s",
@@ -782,7 +820,7 @@ void InterfaceOperations::handle_impl_declaration(const ASTNode *node) {
     struct_name = trim(struct_name);
 
     if (interpreter_->is_debug_mode()) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -836,7 +874,7 @@ void InterfaceOperations::handle_impl_declaration(const ASTNode *node) {
             interpreter_->register_destructor(struct_name, method_node.get());
 
             if (interpreter_->is_debug_mode()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[IMPL_REGISTER] Registered destructor for %s",
@@ -862,7 +900,7 @@ void InterfaceOperations::handle_impl_declaration(const ASTNode *node) {
                 method_node.get();
 
             if (interpreter_->is_debug_mode()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "[IMPL_REGISTER] Registered method: %s",
@@ -889,7 +927,7 @@ std::string InterfaceOperations::get_self_receiver_path() {
     for (auto &scope : scope_stack) {
         for (auto &[name, var] : scope.variables) {
             if (name != "self" && var.is_struct && var.is_assigned) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "SELF_RECEIVER_DEBUG: Found receiver path: %s",
@@ -905,7 +943,7 @@ std::string InterfaceOperations::get_self_receiver_path() {
     auto &global_scope = interpreter_->get_global_scope();
     for (auto &[name, var] : global_scope.variables) {
         if (name != "self" && var.is_struct && var.is_assigned) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SELF_RECEIVER_DEBUG: Found global receiver path: %s",
@@ -927,7 +965,7 @@ void InterfaceOperations::sync_self_to_receiver(
     Variable *receiver_var = interpreter_->find_variable(receiver_path);
 
     if (!self_var || !receiver_var) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -938,7 +976,7 @@ void InterfaceOperations::sync_self_to_receiver(
         return;
     }
 
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "SYNC_SELF_DEBUG: Syncing self to %s", receiver_path.c_str());
@@ -965,7 +1003,7 @@ void InterfaceOperations::sync_self_to_receiver(
                 receiver_var->struct_members[member_name] = self_member;
             }
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "SYNC_SELF_DEBUG: Synced %s to %s",
@@ -984,7 +1022,7 @@ void InterfaceOperations::sync_self_to_receiver(
 void InterfaceOperations::add_temp_variable(const std::string &name,
                                             const Variable &var) {
     interpreter_->add_variable_to_current_scope(name, var);
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "TEMP_VAR: Added temporary variable %s", name.c_str());
@@ -998,7 +1036,7 @@ void InterfaceOperations::remove_temp_variable(const std::string &name) {
     auto it = vars.find(name);
     if (it != vars.end()) {
         vars.erase(it);
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "TEMP_VAR: Removed temporary variable %s", name.c_str());
@@ -1013,7 +1051,7 @@ void InterfaceOperations::clear_temp_variables() {
     for (auto it = vars.begin(); it != vars.end();) {
         if (it->first.substr(0, 12) == "__temp_chain" ||
             it->first.substr(0, 12) == "__chain_self") {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "TEMP_VAR: Clearing temporary variable %s",
@@ -1073,6 +1111,39 @@ bool InterfaceOperations::check_interface_bound(
     return impl_def != nullptr;
 }
 
+/**
+ * @brief ジェネリックimplを使うインスタンスの境界をインスタンスごとに1回検証
+ * @param base_struct_name 構造体のベース名（例: "Vector"）
+ * @param type_arguments 型引数リスト（例: ["int", "SystemAllocator"]）
+ * @param struct_name インスタンス名（例: "Vector<int, SystemAllocator>"）
+ * @throws std::runtime_error 型引数が必要なインターフェースを実装していない場合
+ */
+void InterfaceOperations::validate_instance_bounds(
+    const std::string &base_struct_name,
+    const std::vector<std::string> &type_arguments,
+    const std::string &struct_name) {
+    // 検証中の境界チェックが同じインスタンスを検索しても再検証しない
+    if (!bound_checked_instances_.insert(struct_name).second) {
+        return;
+    }
+    const StructDefinition *struct_def =
+        interpreter_->find_struct_definition(base_struct_name);
+    if (!struct_def || struct_def->interface_bounds.empty() ||
+        struct_def->type_parameters.size() != type_arguments.size()) {
+        return;
+    }
+    // 型パラメータのままの型引数（例: Vector<T>）は検証できない
+    for (const auto &arg : type_arguments) {
+        if (std::find(struct_def->type_parameters.begin(),
+                      struct_def->type_parameters.end(),
+                      arg) != struct_def->type_parameters.end()) {
+            return;
+        }
+    }
+    validate_interface_bounds(struct_name, struct_def->type_parameters,
+                              type_arguments, struct_def->interface_bounds);
+}
+
 /**
  * @brief ジェネリック型インスタンス化時にインターフェース境界を検証
  * @param struct_name 構造体名（例: "Vector"）
@@ -1208,4 +1279,7 @@ void InterfaceOperations::validate_interface_bounds(
             }
         }
     }
+
+    // v0.14.0: 検証済みのインスタンスはimplの検索時に再検証しない
+    bound_checked_instances_.insert(struct_name);
 }
@@ -3,6 +3,9 @@
 #include <deque>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 struct ASTNode;
@@ -37,6 +40,9 @@ class InterfaceOperations {
     find_impl_for_struct(const std::string &struct_name,
                          const std::string &interface_name);
     const std::deque<ImplDefinition> &get_impl_definitions() const;
+    // v0.14.0: (interface, 構造体)のメソッド表（implがなければnullptr）
+    const InterfaceVTable *find_vtable(const std::string &interface_name,
+                                       const std::string &struct_name) const;
 
     // Interface型変数管理
     void create_interface_variable(const std::string &var_name,
@@ -75,6 +81,29 @@ class InterfaceOperations {
             &interface_bounds);
 
   private:
+    // v0.14.0: implの索引のキー（構造体名, interface名）
+    using ImplKey = std::pair<std::string, std::string>;
+    struct ImplKeyHash {
+        size_t operator()(const ImplKey &key) const {
+            size_t seed = std::hash<std::string>()(key.first);
+            return seed ^ (std::hash<std::string>()(key.second) + 0x9e3779b9 +
+                           (seed << 6) + (seed >> 2));
+        }
+    };
+
+    // 完全一致するimplがないときのジェネリックimplの検索・インスタンス化
+    const ImplDefinition *
+    resolve_generic_impl(const std::string &struct_name,
+                         const std::string &interface_name);
+    // impl_definitions_へ追加した定義を索引へ登録する
+    void index_impl(ImplDefinition *impl_def);
+    // implのメソッド表を作る（登録し直したimplは同じ表を作り直す）
+    void build_vtable(const ImplDefinition &impl_def);
+    // ジェネリック構造体のインスタンスの境界をインスタンスごとに1回だけ検証する
+    void validate_instance_bounds(const std::string &base_struct_name,
+                                  const std::vector<std::string> &type_arguments,
+                                  const std::string &struct_name);
+
     Interpreter *interpreter_; // 親Interpreterへの参照
 
     // Interface/Impl定義ストレージ
@@ -84,4 +113,21 @@ class InterfaceOperations {
 
     // v0.12.0: インスタンス化されたimplノードのキャッシュ
     std::vector<std::unique_ptr<ASTNode>> instantiated_impl_nodes_;
+
+    // v0.14.0: (構造体名, interface名) → impl定義（dequeの要素は移動しない）
+    std::unordered_map<ImplKey, ImplDefinition *, ImplKeyHash> impl_index_;
+    // v0.14.0: 型引数を持つimpl（ジェネリックimplとそのインスタンス）を
+    // 構造体のベース名ごとに登録順で保持する（例: "Vector" → [Vector<T>, ...]）
+    std::unordered_map<std::string, std::vector<const ImplDefinition *>>
+        generic_impls_by_base_;
+    // v0.14.0: 完全一致しなかった検索の結果（見つからなかった場合のnullptrも
+    // 含む）。implが登録されるたびに破棄する
+    std::unordered_map<ImplKey, const ImplDefinition *, ImplKeyHash>
+        resolved_impls_;
+    // v0.14.0: (構造体名, interface名) → メソッド表（interface型の値が指すため
+    // 作り直しても同じオブジェクトを使う）
+    std::unordered_map<ImplKey, std::unique_ptr<InterfaceVTable>, ImplKeyHash>
+        vtables_;
+    // v0.14.0: インターフェース境界を検証済みのインスタンス（例: "Vector<int>"）
+    std::unordered_set<std::string> bound_checked_instances_;
 };
@@ -212,7 +212,7 @@ void TypeManager::register_union_typedef(const std::string &name,
                                          const UnionDefinition &union_def) {
     extern bool debug_mode;
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "REGISTER_UNION_DEBUG: Registering union typedef '%s'",
@@ -229,7 +229,7 @@ void TypeManager::register_union_typedef(const std::string &name,
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "REGISTER_UNION_DEBUG: Allowed types: ");
             for (const auto &type : union_def.allowed_types) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "%d ",
                              static_cast<int>(type));
@@ -243,7 +243,7 @@ void TypeManager::register_union_typedef(const std::string &name,
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "REGISTER_UNION_DEBUG: Allowed custom types: ");
             for (const auto &custom_type : union_def.allowed_custom_types) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "%s ",
                              custom_type.c_str());
@@ -257,7 +257,7 @@ void TypeManager::register_union_typedef(const std::string &name,
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "REGISTER_UNION_DEBUG: Allowed array types: ");
             for (const auto &array_type : union_def.allowed_array_types) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "%s ",
                              array_type.c_str());
@@ -353,7 +353,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
 
     extern bool debug_mode;
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -361,7 +361,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
                 int_value, type_name.c_str());
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -376,7 +376,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "UNION_TYPE_DEBUG: Allowed types: ");
             for (const auto &type : union_def.allowed_types) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "%d ",
                              static_cast<int>(type));
@@ -453,7 +453,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
     }
 
     if (debug_mode) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "UNION_TYPE_DEBUG: Basic type check result = %d",
@@ -486,7 +486,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
         if (debug_mode) {
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "UNION_CUSTOM_TYPE_DEBUG: Checking custom types for ");
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "UNION_CUSTOM_TYPE_DEBUG: Number of custom types: %zu",
@@ -496,7 +496,7 @@ bool TypeManager::is_value_allowed_for_union(const std::string &type_name,
         }
         for (const auto &custom_type : union_def.allowed_custom_types) {
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -593,7 +593,7 @@ bool TypeManager::is_custom_type_allowed_for_union(
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "UNION_CUSTOM_TYPE_DEBUG: Allowed custom types are: ");
             for (const auto &allowed : union_def.allowed_custom_types) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf), "'%s' ",
                              allowed.c_str());
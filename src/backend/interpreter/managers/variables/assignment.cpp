@@ -580,7 +580,7 @@ void VariableManager::process_variable_assignment(const ASTNode *node) {
         element_var->is_assigned = true;
 
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "Assigned %lld to struct member array element: %s",
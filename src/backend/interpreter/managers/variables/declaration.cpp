@@ -148,7 +148,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
     }
 
     // v0.12.1: デバッグ - type_infoを確認
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf),
                  "[VAR_DECL_DEBUG] node='%s', type_info=%d, type_name='%s', "
@@ -169,7 +169,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
         var.is_struct = true; // v0.12.1: enumもstructとして扱う
         var.struct_type_name = node->type_name;
 
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -179,7 +179,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
         }
 
         // v0.12.1: 直後の状態確認
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "[ENUM_VAR_DECL_MANAGER] After setting: var.is_enum=%d, "
@@ -204,7 +204,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                 var.enum_variant = init_node->enum_member;
 
                 // 関連値を評価
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -415,7 +415,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "[ENUM_VAR_DECL_MANAGER] After manual fix: is_enum=%d, ");
 
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -427,7 +427,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
             // 確認：スコープから直接アクセス
             auto &scope_variables = interpreter_->current_scope().variables;
             if (scope_variables.find(node->name) != scope_variables.end()) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -1053,7 +1053,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                     (node->init_expr->node_type == ASTNodeType::AST_UNARY_OP &&
                      node->init_expr->is_await_expression))) {
             // v0.13.0: デバッグ - varの状態を確認
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "[VAR_DECL_AWAIT_PATH] var: is_struct=%d, is_enum=%d, "
@@ -1132,7 +1132,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                     }
 
                     if (interpreter_->debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -1181,7 +1181,8 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                             var_pair.second;
 
                         if (interpreter_->debug_mode) {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(dbg_buf, sizeof(dbg_buf),
                                          "[VAR_DECL_AWAIT] Registered %s",
@@ -1386,7 +1387,8 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                             node->name == "student1" &&
                             var_pair.first.find("scores[") !=
                                 std::string::npos) {
-                            {
+                            if (CB_TRACE_MSG_ENABLED(
+                                    DebugMsgId::GENERIC_DEBUG)) {
                                 char dbg_buf[512];
                                 snprintf(dbg_buf, sizeof(dbg_buf),
                                          "FUNC_RETURN: Registered %s = %lld",
@@ -1398,7 +1400,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                     }
 
                     if (interpreter_->debug_mode && node->name == "student1") {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -2417,7 +2419,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
             debug_msg(DebugMsgId::GENERIC_DEBUG,
                       "CONSTRUCTOR_CHECK: var=%s, has_arguments=%d, ");
             if (node->init_expr) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "  init_expr->node_type=%d, AST_VARIABLE=%d",
@@ -2426,7 +2428,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                     debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
                 }
                 if (node->init_expr->node_type == ASTNodeType::AST_VARIABLE) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "  init_expr->name=%s",
@@ -2484,7 +2486,7 @@ void VariableManager::process_variable_declaration(const ASTNode *node) {
                        source_var->struct_type_name == var_struct_type_name) {
                 // 同じ構造体型からのコピー初期化
                 if (interpreter_->debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "Detected copy initialization: %s = %s",
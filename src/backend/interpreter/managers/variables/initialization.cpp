@@ -75,7 +75,7 @@ bool VariableManager::handle_typedef_resolution(const ASTNode *node,
             interpreter_->type_manager_->resolve_typedef(declared_type_name);
 
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "TYPEDEF_DEBUG: Declared='%s' Resolved='%s'",
@@ -291,7 +291,7 @@ void VariableManager::assign_union_value(Variable &var,
             var.current_type = TYPE_STRING;
             var.is_assigned = true;
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -314,7 +314,7 @@ void VariableManager::assign_union_value(Variable &var,
             var.current_type = TYPE_INT;
             var.is_assigned = true;
             if (debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(
                         dbg_buf, sizeof(dbg_buf),
@@ -844,7 +844,7 @@ bool VariableManager::handle_array_type_info_declaration(const ASTNode *node,
                                                          Variable &var) {
     // 新しいArrayTypeInfoが設定されている場合の処理
     if (node->array_type_info.base_type != TYPE_UNKNOWN) {
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "VAR_DEBUG: Taking ArrayTypeInfo branch (base_type=%d)",
@@ -948,7 +948,7 @@ bool VariableManager::handle_union_typedef_declaration(const ASTNode *node,
     // union typedefの場合
     if (interpreter_->type_manager_->is_union_type(node->type_name)) {
         if (debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "TYPEDEF_DEBUG: Processing union typedef: %s",
@@ -1523,7 +1523,7 @@ void VariableManager::handle_struct_member_initialization(const ASTNode *node,
                     }
 
                     if (interpreter_->debug_mode) {
-                        {
+                        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                             char dbg_buf[512];
                             snprintf(
                                 dbg_buf, sizeof(dbg_buf),
@@ -72,7 +72,8 @@ Scope &VariableManager::current_scope() {
 
 Variable *VariableManager::find_variable(const std::string &name) {
     // 一時変数のデバッグ出力
-    if (name.substr(0, 12) == "__temp_chain") {
+    const bool is_temp_chain = name.compare(0, 12, "__temp_chain") == 0;
+    if (is_temp_chain) {
         std::cerr << "DEBUG: Searching for temp variable: " << name
                   << std::endl;
         std::cerr << "DEBUG: Scope stack size: "
@@ -88,7 +89,7 @@ Variable *VariableManager::find_variable(const std::string &name) {
         if (var_it != it->variables.end()) {
             // std::cerr << "DEBUG: Found " << name << " in local scope" <<
             // std::endl;
-            if (name.substr(0, 12) == "__temp_chain") {
+            if (is_temp_chain) {
                 std::cerr << "DEBUG: Found temp variable in local scope"
                           << std::endl;
             }
@@ -345,6 +346,93 @@ void VariableManager::initialize_array_from_dimensions(
     }
 }
 
+Variable *VariableManager::find_variable(const ASTNode *node) {
+    // スロットは名前で検証されるため、見つかった要素は
+    // 名前による検索と同じ結果になる
+    auto lookup = [node](VariableMap &variables) {
+        Variable *result = variables.slot(node->binding_slot, node->name);
+        return result ? result
+                      : variables.bind_slot(node->binding_slot, node->name);
+    };
+
+    Variable *result = nullptr;
+    if (node->binding == VariableBinding::LOCAL) {
+        result = lookup(interpreter_->scope_stack.back().variables);
+    } else if (node->binding == VariableBinding::GLOBAL) {
+        // グローバル変数はトップレベルのスコープ（scope_stack[0]）に
+        // 置かれる場合もあるため、そちらを先に調べる
+        result = lookup(interpreter_->scope_stack.front().variables);
+        if (!result) {
+            result = lookup(interpreter_->global_scope.variables);
+        }
+    }
+    if (result && !((result->is_reference || result->is_rvalue_reference) &&
+                    !result->reference_target.empty())) {
+        return result;
+    }
+    return find_variable(node->name);
+}
+
+Variable *VariableManager::find_struct_array_member(
+    const ASTNode *array_node, int64_t index, const std::string &member_name) {
+    // 配列変数と、それを保持する変数マップをスロットから特定する
+    VariableMap *owner = nullptr;
+    Variable *array_var = nullptr;
+    auto lookup = [&](VariableMap &variables) {
+        Variable *result =
+            variables.slot(array_node->binding_slot, array_node->name);
+        if (!result) {
+            result =
+                variables.bind_slot(array_node->binding_slot, array_node->name);
+        }
+        if (result) {
+            owner = &variables;
+            array_var = result;
+        }
+        return result != nullptr;
+    };
+
+    if (array_node->binding == VariableBinding::LOCAL) {
+        lookup(interpreter_->scope_stack.back().variables);
+    } else if (array_node->binding == VariableBinding::GLOBAL) {
+        if (!lookup(interpreter_->scope_stack.front().variables)) {
+            lookup(interpreter_->global_scope.variables);
+        }
+    }
+    if (!array_var || !array_var->is_array || array_var->is_pointer ||
+        array_var->is_reference || array_var->is_rvalue_reference ||
+        array_var->is_multidimensional || array_var->struct_type_name.empty()) {
+        return nullptr;
+    }
+    if (index < 0 || index >= array_var->array_size) {
+        return nullptr;
+    }
+
+    const StructDefinition *struct_def = interpreter_->find_struct_definition(
+        interpreter_->type_manager_->resolve_typedef(
+            array_var->struct_type_name));
+    if (!struct_def) {
+        return nullptr;
+    }
+    int field = struct_def->field_index(member_name);
+    if (field < 0 || struct_def->members[field].is_private) {
+        return nullptr;
+    }
+
+    Variable *member = owner->cached_struct_array_member(
+        array_node->name, static_cast<size_t>(index),
+        static_cast<size_t>(field), struct_def->members.size(),
+        static_cast<size_t>(array_var->array_size), member_name);
+    // スカラー/文字列のメンバーのみ対象（配列・ネストしたstructは従来経路）
+    if (!member || member->is_private_member || member->is_reference ||
+        member->is_array || member->is_struct ||
+        member->type == TYPE_STRUCT || member->type == TYPE_UNION ||
+        member->type == TYPE_INTERFACE) {
+        return nullptr;
+    }
+    return member;
+}
+
 bool VariableManager::is_global_variable(const std::string &name) {
     // グローバルスコープに存在するかチェック
     auto global_var_it = interpreter_->global_scope.variables.find(name);
@@ -441,6 +529,9 @@ void VariableManager::assign_interface_view(
     Variable &dest_var = current_scope().variables[dest_name];
     dest_var.is_assigned = true;
     dest_var.implementing_struct = source_type_name;
+    // v0.14.0: メソッド呼び出しはこの表のスロットから直接解決する
+    dest_var.vtable = interpreter_->find_interface_vtable(
+        dest_var.interface_name, source_type_name);
 
     for (const auto &member_pair : source_var.struct_members) {
         const std::string &member_name = member_pair.first;
@@ -523,6 +614,12 @@ void VariableManager::assign_interface_view(
 bool VariableManager::interface_impl_exists(
     const std::string &interface_name,
     const std::string &struct_type_name) const {
+    // v0.14.0: メソッド表があればimplは登録済み
+    if (interpreter_->find_interface_vtable(interface_name,
+                                            struct_type_name)) {
+        return true;
+    }
+
     if (interpreter_->debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "IMPL_SEARCH_BEFORE: About to call get_impl_definitions(), ");
@@ -533,7 +630,7 @@ bool VariableManager::interface_impl_exists(
     if (interpreter_->debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "IMPL_SEARCH: Looking for interface='%s', struct_type='%s' ");
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "IMPL_SEARCH: About to iterate over %zu impls",
@@ -545,7 +642,7 @@ bool VariableManager::interface_impl_exists(
     size_t idx = 0;
     for (const auto &impl_def : impls) {
         if (interpreter_->debug_mode) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "IMPL_SEARCH: Iteration %zu, about to access impl_def "
@@ -560,7 +657,7 @@ bool VariableManager::interface_impl_exists(
             std::string sname = impl_def.struct_name;
 
             if (interpreter_->debug_mode) {
-                {
+                if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                     char dbg_buf[512];
                     snprintf(dbg_buf, sizeof(dbg_buf),
                              "IMPL_SEARCH: [%zu] interface='%s', struct='%s'",
@@ -571,7 +668,7 @@ bool VariableManager::interface_impl_exists(
 
             if (iface == interface_name && sname == struct_type_name) {
                 if (interpreter_->debug_mode) {
-                    {
+                    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                         char dbg_buf[512];
                         snprintf(dbg_buf, sizeof(dbg_buf),
                                  "IMPL_SEARCH: MATCH FOUND at index %zu!", idx);
@@ -581,7 +678,7 @@ bool VariableManager::interface_impl_exists(
                 return true;
             }
         } catch (...) {
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "IMPL_SEARCH: EXCEPTION at index %zu!", idx);
@@ -1727,13 +1824,72 @@ void VariableManager::assign_array_parameter(const std::string &name,
     current_scope().variables[name] = array_ref;
 }
 
+bool VariableManager::bind_value_parameter(const ASTNode *param,
+                                           const ParamLayout &layout,
+                                           const TypedValue &value) {
+    // 文字列・構造体・ポインタ値はassign_function_parameterで変換する
+    if (!value.is_numeric() || value.is_function_pointer ||
+        value.numeric_type == TYPE_POINTER) {
+        return false;
+    }
+    auto bound = current_scope().variables.emplace_slot(layout.slot,
+                                                        param->name);
+    if (!bound.second) {
+        return false;
+    }
+
+    // assign_function_parameterが未代入の変数へ代入するのと同じ変換
+    Variable &var = *bound.first;
+    TypeInfo type = param->type_info;
+    var.type = type;
+    var.is_unsigned = param->is_unsigned;
+    if (type == TYPE_FLOAT) {
+        float f = static_cast<float>(value.as_quad());
+        var.float_value = f;
+        var.double_value = static_cast<double>(f);
+        var.quad_value = static_cast<long double>(f);
+        var.value = static_cast<int64_t>(f);
+    } else if (type == TYPE_DOUBLE) {
+        double d = static_cast<double>(value.as_quad());
+        var.float_value = static_cast<float>(d);
+        var.double_value = d;
+        var.quad_value = static_cast<long double>(d);
+        var.value = static_cast<int64_t>(d);
+    } else if (type == TYPE_QUAD) {
+        long double q = value.as_quad();
+        var.float_value = static_cast<float>(q);
+        var.double_value = static_cast<double>(q);
+        var.quad_value = q;
+        var.value = static_cast<int64_t>(q);
+    } else {
+        int64_t numeric_value = value.as_numeric();
+        if (type == TYPE_BOOL) {
+            numeric_value = (numeric_value != 0) ? 1 : 0;
+        }
+        if (var.is_unsigned && numeric_value < 0) {
+            DEBUG_WARN(VARIABLE,
+                       "Unsigned variable %s received negative assignment "
+                       "(%lld); clamping to 0",
+                       param->name.c_str(),
+                       static_cast<long long>(numeric_value));
+            numeric_value = 0;
+        }
+        interpreter_->type_manager_->check_type_range(
+            type, numeric_value, param->name, var.is_unsigned);
+        setNumericFields(var, static_cast<long double>(numeric_value));
+    }
+    var.is_assigned = true;
+    var.is_const = param->is_const;
+    return true;
+}
+
 void VariableManager::process_var_decl_or_assign(const ASTNode *node) {
     // debug_msg(DebugMsgId::VAR_MANAGER_PROCESS, (int)node->node_type,
     // node->name.c_str());
     if (interpreter_->debug_mode) {
         debug_msg(DebugMsgId::GENERIC_DEBUG,
                   "VAR_DEBUG: process_var_decl_or_assign called for %s, ");
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "VAR_DEBUG: type_info=%d, type_name='%s'",
@@ -1741,14 +1897,14 @@ void VariableManager::process_var_decl_or_assign(const ASTNode *node) {
                      node->type_name.c_str());
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "VAR_DEBUG: node->is_unsigned=%d",
                      node->is_unsigned ? 1 : 0);
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "VAR_DEBUG: node->is_reference=%d",
@@ -1758,14 +1914,14 @@ void VariableManager::process_var_decl_or_assign(const ASTNode *node) {
 
         std::string resolved =
             interpreter_->type_manager_->resolve_typedef(node->type_name);
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(dbg_buf, sizeof(dbg_buf),
                      "VAR_DEBUG: resolve_typedef('%s') = '%s'",
                      node->type_name.c_str(), resolved.c_str());
             debug_msg(DebugMsgId::GENERIC_DEBUG, dbg_buf);
         }
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
@@ -24,6 +24,14 @@ class VariableManager {
 
     // 変数検索
     Variable *find_variable(const std::string &name);
+    // v0.14.0: AST_VARIABLE/AST_IDENTIFIERのスロット情報を使った検索
+    // スロットで見つからない場合は名前による検索にフォールバックする
+    Variable *find_variable(const ASTNode *node);
+    // v0.14.0: 構造体配列の要素メンバー array[index].member を
+    // VariableMapの検索キャッシュ経由で引く（対象外・未作成ならnullptr）
+    Variable *find_struct_array_member(const ASTNode *array_node,
+                                       int64_t index,
+                                       const std::string &member_name);
     bool is_global_variable(const std::string &name);
 
     // 変数宣言
@@ -51,6 +59,8 @@ class VariableManager {
                                    bool is_unsigned);
     void assign_array_parameter(const std::string &name,
                                 const Variable &source_array, TypeInfo type);
+    bool bind_value_parameter(const ASTNode *param, const ParamLayout &layout,
+                              const TypedValue &value);
     void assign_array_element(const std::string &name, int64_t index,
                               int64_t value);
     void assign_string_element(const std::string &name, int64_t index,
@@ -35,15 +35,15 @@ class StaticVariableManager {
     std::string get_impl_static_namespace() const;
 
     // マップへのアクセス（読み取り専用、イテレーション用）
-    const std::map<std::string, Variable> &get_static_variables() const {
+    const VariableMap &get_static_variables() const {
         return static_variables_;
     }
-    const std::map<std::string, Variable> &get_impl_static_variables() const {
+    const VariableMap &get_impl_static_variables() const {
         return impl_static_variables_;
     }
 
     // マップへの書き込みアクセス（特定のケースで必要）
-    std::map<std::string, Variable> *get_static_variables_mutable() {
+    VariableMap *get_static_variables_mutable() {
         return &static_variables_;
     }
 
@@ -51,8 +51,8 @@ class StaticVariableManager {
     Interpreter *interpreter_; // 親Interpreterへの参照
 
     // Static変数ストレージ
-    std::map<std::string, Variable> static_variables_;
-    std::map<std::string, Variable> impl_static_variables_;
+    VariableMap static_variables_;
+    VariableMap impl_static_variables_;
 
     // Implコンテキスト
     struct ImplContext {
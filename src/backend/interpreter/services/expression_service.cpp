@@ -115,7 +115,7 @@ void ExpressionService::handle_evaluation_error(const std::string &error_msg,
     }
 
     // デバッグ出力（統一フォーマット）
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf), "Expression evaluation error: %s",
                  formatted_error.c_str());
@@ -156,7 +156,7 @@ void VariableAccessService::handle_access_error(const std::string &error_msg,
         formatted_error += " (Context: " + context + ")";
     }
 
-    {
+    if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
         char dbg_buf[512];
         snprintf(dbg_buf, sizeof(dbg_buf), "Variable access error: %s",
                  formatted_error.c_str());
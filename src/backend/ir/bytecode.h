@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../../common/ast.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cb {
+namespace ir {
+
+// v0.14.0: スタック型バイトコードの命令セット
+// 値はすべてint64_tのスロットとして扱う（整数系プリミティブ専用）
+enum class OpCode : uint8_t {
+    // 定数・変数
+    PUSH,         // imm をプッシュ
+    POP,          // スタックトップを破棄
+    DUP,          // スタックトップを複製
+    LOAD_LOCAL,   // locals[a] をプッシュ
+    STORE_LOCAL,  // ポップして locals[a] に格納
+    LOAD_GLOBAL,  // globals[a] をプッシュ
+    STORE_GLOBAL, // ポップして globals[a] に格納
+    CHECK_RANGE,  // スタックトップを型 a の範囲で検査（imm = 名前ID）
+
+    // 配列（a = 配列ID、インデックスは次元数ぶんスタックに積まれる）
+    ARRAY_CLEAR, // 配列領域を0で初期化
+    LOAD_ELEM,   // インデックスをポップして要素をプッシュ
+    STORE_ELEM,  // 値とインデックスをポップして要素に格納
+
+    // 二項演算
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    MOD,
+    BIT_AND,
+    BIT_OR,
+    BIT_XOR,
+    SHL,
+    SHR,
+    EQ,
+    NE,
+    LT,
+    LE,
+    GT,
+    GE,
+    LOGICAL_AND,
+    LOGICAL_OR,
+
+    // 単項演算
+    NEG,
+    NOT,
+    BIT_NOT,
+
+    // 制御
+    JUMP,          // pc = a
+    JUMP_IF_FALSE, // ポップして0なら pc = a
+    CALL,          // 関数 a を呼び出す（引数は imm 個）
+    RETURN,        // ポップした値を返す
+    RETURN_ZERO,   // 0を返す（return文のない関数・void関数）
+
+    // 出力
+    PRINT_INT,    // ポップして整数として出力
+    PRINT_STRING, // 文字列テーブル a を出力
+    PRINT_CHAR,   // 文字 a を出力（区切りの空白・改行）
+
+    HALT
+};
+
+struct Instruction {
+    OpCode op;
+    int32_t a;
+    int64_t imm;
+
+    Instruction(OpCode o = OpCode::HALT, int32_t arg = 0, int64_t value = 0)
+        : op(o), a(arg), imm(value) {}
+};
+
+// 固定長配列の配置情報（行優先で連続スロットに展開）
+struct ArrayLayout {
+    std::string name;
+    bool is_global;
+    int32_t base_slot;
+    TypeInfo element_type;
+    std::vector<int64_t> dimensions;
+    int64_t total_size;
+};
+
+struct BytecodeFunction {
+    std::string name;
+    int32_t param_count = 0;
+    int32_t local_count = 0; // 配列展開分・一時スロットを含む
+    bool returns_value = false;
+    std::vector<Instruction> code;
+};
+
+struct BytecodeProgram {
+    std::vector<BytecodeFunction> functions;
+    std::vector<ArrayLayout> arrays;
+    std::vector<std::string> strings; // エスケープ処理済みの出力文字列
+    std::vector<std::string> names;   // エラーメッセージ用の変数名
+    int32_t global_count = 0;
+    int32_t init_function = -1; // グローバル変数初期化用の関数
+    int32_t main_function = -1;
+};
+
+} // namespace ir
+} // namespace cb
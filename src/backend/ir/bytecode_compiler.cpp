@@ -0,0 +1,872 @@
+#include "bytecode_compiler.h"
+
+namespace cb {
+namespace ir {
+
+namespace {
+
+bool is_integral_type(TypeInfo type) {
+    switch (type) {
+    case TYPE_TINY:
+    case TYPE_SHORT:
+    case TYPE_INT:
+    case TYPE_LONG:
+    case TYPE_CHAR:
+    case TYPE_BOOL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// OutputManager::process_escape_sequences と同じ規則で展開する
+std::string process_escape_sequences(const std::string &input) {
+    std::string result;
+    for (size_t i = 0; i < input.length(); i++) {
+        if (input[i] == '\\' && i + 1 < input.length()) {
+            switch (input[i + 1]) {
+            case 'n':
+                result += '\n';
+                i++;
+                break;
+            case 't':
+                result += '\t';
+                i++;
+                break;
+            case 'r':
+                result += '\r';
+                i++;
+                break;
+            case '0':
+                result += '\0';
+                i++;
+                break;
+            case '\\':
+                result += '\\';
+                i++;
+                break;
+            case '"':
+                result += '"';
+                i++;
+                break;
+            case '%':
+                result += '%';
+                i++;
+                break;
+            default:
+                result += input[i];
+                break;
+            }
+        } else {
+            result += input[i];
+        }
+    }
+    return result;
+}
+
+bool is_binary_opcode(const std::string &op, OpCode &out) {
+    static const std::map<std::string, OpCode> table = {
+        {"+", OpCode::ADD},          {"-", OpCode::SUB},
+        {"*", OpCode::MUL},          {"/", OpCode::DIV},
+        {"%", OpCode::MOD},          {"&", OpCode::BIT_AND},
+        {"|", OpCode::BIT_OR},       {"^", OpCode::BIT_XOR},
+        {"<<", OpCode::SHL},         {">>", OpCode::SHR},
+        {"==", OpCode::EQ},          {"!=", OpCode::NE},
+        {"<", OpCode::LT},           {"<=", OpCode::LE},
+        {">", OpCode::GT},           {">=", OpCode::GE},
+        {"&&", OpCode::LOGICAL_AND}, {"||", OpCode::LOGICAL_OR}};
+    auto it = table.find(op);
+    if (it == table.end()) {
+        return false;
+    }
+    out = it->second;
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<BytecodeProgram>
+BytecodeCompiler::compile(const ASTNode *root) {
+    program_ = std::make_unique<BytecodeProgram>();
+    functions_.clear();
+    globals_.clear();
+    scopes_.clear();
+    loops_.clear();
+    error_.clear();
+
+    try {
+        if (!root || root->node_type != ASTNodeType::AST_STMT_LIST) {
+            unsupported("root is not a statement list");
+        }
+        collect_top_level(root);
+
+        auto main_it = functions_.find("main");
+        if (main_it == functions_.end()) {
+            unsupported("main function not found");
+        }
+        if (!main_it->second.node->parameters.empty()) {
+            unsupported("main with parameters");
+        }
+        program_->main_function = main_it->second.index;
+
+        // 関数インデックスを確定させてからポインタを保持する
+        program_->functions.resize(functions_.size() + 1);
+        program_->init_function = static_cast<int32_t>(functions_.size());
+        compile_global_initializers(root);
+        for (const auto &entry : functions_) {
+            compile_function(entry.second);
+        }
+    } catch (const Unsupported &e) {
+        error_ = e.what();
+        program_.reset();
+        return nullptr;
+    }
+
+    return std::move(program_);
+}
+
+void BytecodeCompiler::collect_top_level(const ASTNode *root) {
+    for (const auto &stmt : root->statements) {
+        if (!stmt) {
+            continue;
+        }
+        switch (stmt->node_type) {
+        case ASTNodeType::AST_FUNC_DECL: {
+            const ASTNode *func = stmt.get();
+            if (func->is_async || func->is_generic ||
+                !func->type_parameters.empty() || !func->body) {
+                unsupported("function '" + func->name + "' is not plain");
+            }
+            if (functions_.count(func->name)) {
+                unsupported("duplicate function '" + func->name + "'");
+            }
+            if (func->return_type_name != "void") {
+                scalar_type_of(func->return_type_name);
+            }
+            FunctionEntry entry;
+            entry.index = static_cast<int32_t>(functions_.size());
+            entry.node = func;
+            for (const auto &param : func->parameters) {
+                if (param->is_array || param->is_pointer ||
+                    param->is_reference || param->is_unsigned ||
+                    param->has_default_value) {
+                    unsupported("parameter '" + param->name + "'");
+                }
+                entry.param_types.push_back(scalar_type_of(param->type_name));
+            }
+            functions_.emplace(func->name, entry);
+            break;
+        }
+        case ASTNodeType::AST_VAR_DECL:
+        case ASTNodeType::AST_ARRAY_DECL:
+            // グローバル変数は compile_global_initializers で処理する
+            break;
+        default:
+            unsupported("top-level node type " +
+                        std::to_string(static_cast<int>(stmt->node_type)));
+        }
+    }
+}
+
+void BytecodeCompiler::compile_global_initializers(const ASTNode *root) {
+    current_ = &program_->functions[program_->init_function];
+    current_->name = "<global-init>";
+    current_returns_value_ = false;
+
+    for (const auto &stmt : root->statements) {
+        if (stmt->node_type == ASTNodeType::AST_VAR_DECL) {
+            compile_var_decl(stmt.get(), true);
+        } else if (stmt->node_type == ASTNodeType::AST_ARRAY_DECL) {
+            compile_array_decl(stmt.get(), true);
+        }
+    }
+    emit(OpCode::RETURN_ZERO);
+}
+
+void BytecodeCompiler::compile_function(const FunctionEntry &entry) {
+    const ASTNode *func = entry.node;
+    current_ = &program_->functions[entry.index];
+    current_->name = func->name;
+    current_->param_count = static_cast<int32_t>(func->parameters.size());
+    current_->returns_value = func->return_type_name != "void";
+    current_returns_value_ = current_->returns_value;
+
+    scopes_.clear();
+    scopes_.emplace_back();
+    for (size_t i = 0; i < func->parameters.size(); ++i) {
+        const ASTNode *param = func->parameters[i].get();
+        Symbol &symbol =
+            declare_local(param->name, entry.param_types[i], false, 1);
+        // 引数束縛時の型範囲チェック（ツリーウォーカーと同じ挙動）
+        emit_load(symbol);
+        emit_range_check(symbol.type, symbol.name_id);
+        emit(OpCode::POP);
+    }
+
+    compile_block(func->body.get());
+    emit(OpCode::RETURN_ZERO);
+    scopes_.clear();
+}
+
+void BytecodeCompiler::compile_var_decl(const ASTNode *node, bool is_global) {
+    if (node->is_static || node->is_pointer || node->is_reference ||
+        node->is_unsigned || node->is_array) {
+        unsupported("variable '" + node->name + "' has unsupported storage");
+    }
+    TypeInfo type = scalar_type_of(node->type_name);
+
+    if (node->init_expr) {
+        compile_expression(node->init_expr.get());
+    } else if (node->right) {
+        compile_expression(node->right.get());
+    } else {
+        emit(OpCode::PUSH, 0, 0);
+    }
+
+    Symbol *symbol = nullptr;
+    if (is_global) {
+        if (globals_.count(node->name) || functions_.count(node->name)) {
+            unsupported("duplicate global '" + node->name + "'");
+        }
+        Symbol global;
+        global.is_global = true;
+        global.slot = program_->global_count++;
+        global.type = type;
+        global.is_const = node->is_const;
+        global.name_id = intern_name(node->name);
+        symbol = &(globals_[node->name] = global);
+    } else {
+        symbol = &declare_local(node->name, type, node->is_const, 1);
+    }
+    emit_range_check(symbol->type, symbol->name_id);
+    emit_store(*symbol);
+}
+
+void BytecodeCompiler::compile_array_decl(const ASTNode *node,
+                                          bool is_global) {
+    if (node->is_static || node->is_pointer || node->is_reference ||
+        node->is_unsigned || node->array_dimensions.empty()) {
+        unsupported("array '" + node->name + "' has unsupported storage");
+    }
+    std::string base_name = node->type_name.substr(0, node->type_name.find('['));
+    TypeInfo element_type = scalar_type_of(base_name);
+
+    ArrayLayout layout;
+    layout.name = node->name;
+    layout.is_global = is_global;
+    layout.element_type = element_type;
+    layout.total_size = 1;
+    for (const auto &dim : node->array_dimensions) {
+        if (!dim || dim->node_type != ASTNodeType::AST_NUMBER ||
+            dim->int_value <= 0) {
+            unsupported("array '" + node->name + "' has non-constant size");
+        }
+        layout.dimensions.push_back(dim->int_value);
+        layout.total_size *= dim->int_value;
+    }
+    if (layout.total_size > (1 << 24)) {
+        unsupported("array '" + node->name + "' is too large");
+    }
+
+    // 初期化リテラルは定数のみ受け付け、行優先で平坦化する
+    std::vector<int64_t> initial_values;
+    if (node->init_expr) {
+        std::vector<const ASTNode *> pending = {node->init_expr.get()};
+        std::vector<size_t> depths = {0};
+        while (!pending.empty()) {
+            const ASTNode *item = pending.back();
+            size_t depth = depths.back();
+            pending.pop_back();
+            depths.pop_back();
+            if (item->node_type == ASTNodeType::AST_ARRAY_LITERAL) {
+                if (depth >= layout.dimensions.size() ||
+                    static_cast<int64_t>(item->arguments.size()) !=
+                        layout.dimensions[depth]) {
+                    unsupported("array literal shape of '" + node->name +
+                                "'");
+                }
+                for (size_t i = item->arguments.size(); i-- > 0;) {
+                    pending.push_back(item->arguments[i].get());
+                    depths.push_back(depth + 1);
+                }
+                continue;
+            }
+            int64_t value = 0;
+            if (depth != layout.dimensions.size()) {
+                unsupported("array literal shape of '" + node->name + "'");
+            }
+            if (item->node_type == ASTNodeType::AST_NUMBER &&
+                !item->is_float_literal) {
+                value = item->int_value;
+            } else if (item->node_type == ASTNodeType::AST_UNARY_OP &&
+                       item->op == "-" && item->left &&
+                       item->left->node_type == ASTNodeType::AST_NUMBER &&
+                       !item->left->is_float_literal) {
+                value = -item->left->int_value;
+            } else {
+                unsupported("non-constant element in '" + node->name + "'");
+            }
+            initial_values.push_back(value);
+        }
+    }
+
+    int32_t array_id = static_cast<int32_t>(program_->arrays.size());
+    int32_t slot_count = static_cast<int32_t>(layout.total_size);
+    Symbol *symbol = nullptr;
+    if (is_global) {
+        if (globals_.count(node->name) || functions_.count(node->name)) {
+            unsupported("duplicate global '" + node->name + "'");
+        }
+        Symbol global;
+        global.is_global = true;
+        global.slot = program_->global_count;
+        global.type = element_type;
+        global.is_const = node->is_const;
+        global.name_id = intern_name(node->name);
+        program_->global_count += slot_count;
+        symbol = &(globals_[node->name] = global);
+    } else {
+        symbol =
+            &declare_local(node->name, element_type, node->is_const, slot_count);
+    }
+    symbol->array_id = array_id;
+    layout.base_slot = symbol->slot;
+    program_->arrays.push_back(layout);
+
+    emit(OpCode::ARRAY_CLEAR, array_id);
+    for (size_t i = 0; i < initial_values.size(); ++i) {
+        if (initial_values[i] == 0) {
+            continue;
+        }
+        emit(OpCode::PUSH, 0, initial_values[i]);
+        emit_range_check(element_type, symbol->name_id);
+        emit(is_global ? OpCode::STORE_GLOBAL : OpCode::STORE_LOCAL,
+             symbol->slot + static_cast<int32_t>(i));
+    }
+}
+
+void BytecodeCompiler::compile_statement(const ASTNode *node) {
+    if (!node) {
+        return;
+    }
+    switch (node->node_type) {
+    case ASTNodeType::AST_STMT_LIST:
+    case ASTNodeType::AST_COMPOUND_STMT:
+        compile_block(node);
+        break;
+    case ASTNodeType::AST_VAR_DECL:
+        compile_var_decl(node, false);
+        break;
+    case ASTNodeType::AST_ARRAY_DECL:
+        compile_array_decl(node, false);
+        break;
+    case ASTNodeType::AST_ASSIGN:
+        compile_assign(node);
+        break;
+    case ASTNodeType::AST_PRE_INCDEC:
+    case ASTNodeType::AST_POST_INCDEC:
+        compile_incdec(node, false);
+        break;
+    case ASTNodeType::AST_FUNC_CALL:
+        compile_call(node, false);
+        emit(OpCode::POP);
+        break;
+    case ASTNodeType::AST_IF_STMT:
+        compile_if(node);
+        break;
+    case ASTNodeType::AST_WHILE_STMT:
+        compile_while(node);
+        break;
+    case ASTNodeType::AST_FOR_STMT:
+        compile_for(node);
+        break;
+    case ASTNodeType::AST_BREAK_STMT:
+        if (loops_.empty()) {
+            unsupported("break outside of loop");
+        }
+        loops_.back().break_jumps.push_back(emit(OpCode::JUMP));
+        break;
+    case ASTNodeType::AST_CONTINUE_STMT:
+        if (loops_.empty()) {
+            unsupported("continue outside of loop");
+        }
+        loops_.back().continue_jumps.push_back(emit(OpCode::JUMP));
+        break;
+    case ASTNodeType::AST_RETURN_STMT:
+        compile_return(node);
+        break;
+    case ASTNodeType::AST_PRINT_STMT:
+        compile_print(node, false);
+        break;
+    case ASTNodeType::AST_PRINTLN_STMT:
+        compile_print(node, true);
+        break;
+    case ASTNodeType::AST_PRINTLN_EMPTY:
+        emit(OpCode::PRINT_CHAR, '\n');
+        break;
+    default:
+        unsupported("statement node type " +
+                    std::to_string(static_cast<int>(node->node_type)));
+    }
+}
+
+void BytecodeCompiler::compile_block(const ASTNode *node) {
+    if (node->node_type != ASTNodeType::AST_STMT_LIST &&
+        node->node_type != ASTNodeType::AST_COMPOUND_STMT) {
+        compile_statement(node);
+        return;
+    }
+    scopes_.emplace_back();
+    for (const auto &stmt : node->statements) {
+        compile_statement(stmt.get());
+    }
+    scopes_.pop_back();
+}
+
+void BytecodeCompiler::compile_assign(const ASTNode *node) {
+    if (!node->right) {
+        unsupported("assignment without right-hand side");
+    }
+    if (node->left && node->left->node_type == ASTNodeType::AST_ARRAY_REF) {
+        const Symbol &symbol = compile_array_indices(node->left.get());
+        if (symbol.is_const) {
+            unsupported("assignment to const array");
+        }
+        compile_expression(node->right.get());
+        emit_range_check(symbol.type, symbol.name_id);
+        emit(OpCode::STORE_ELEM, symbol.array_id);
+        return;
+    }
+
+    std::string name = node->name;
+    if (node->left) {
+        if (node->left->node_type != ASTNodeType::AST_VARIABLE &&
+            node->left->node_type != ASTNodeType::AST_IDENTIFIER) {
+            unsupported("assignment target");
+        }
+        name = node->left->name;
+    }
+    const Symbol &symbol = lookup(name);
+    if (symbol.array_id >= 0 || symbol.is_const) {
+        unsupported("assignment to '" + name + "'");
+    }
+    compile_expression(node->right.get());
+    emit_range_check(symbol.type, symbol.name_id);
+    emit_store(symbol);
+}
+
+void BytecodeCompiler::compile_if(const ASTNode *node) {
+    compile_expression(node->condition.get());
+    size_t to_else = emit(OpCode::JUMP_IF_FALSE);
+    compile_block(node->left.get());
+    if (node->right) {
+        size_t to_end = emit(OpCode::JUMP);
+        patch(to_else, here());
+        compile_block(node->right.get());
+        patch(to_end, here());
+    } else {
+        patch(to_else, here());
+    }
+}
+
+void BytecodeCompiler::compile_while(const ASTNode *node) {
+    size_t loop_start = here();
+    compile_expression(node->condition.get());
+    size_t to_end = emit(OpCode::JUMP_IF_FALSE);
+
+    loops_.emplace_back();
+    compile_block(node->body.get());
+    emit(OpCode::JUMP, static_cast<int32_t>(loop_start));
+
+    LoopContext loop = std::move(loops_.back());
+    loops_.pop_back();
+    patch(to_end, here());
+    for (size_t at : loop.break_jumps) {
+        patch(at, here());
+    }
+    for (size_t at : loop.continue_jumps) {
+        patch(at, loop_start);
+    }
+}
+
+void BytecodeCompiler::compile_for(const ASTNode *node) {
+    // for文の初期化変数はループ内スコープに閉じる
+    scopes_.emplace_back();
+    compile_statement(node->init_expr.get());
+
+    size_t loop_start = here();
+    size_t to_end = 0;
+    bool has_condition = node->condition != nullptr;
+    if (has_condition) {
+        compile_expression(node->condition.get());
+        to_end = emit(OpCode::JUMP_IF_FALSE);
+    }
+
+    loops_.emplace_back();
+    compile_block(node->body.get());
+    size_t continue_target = here();
+    compile_statement(node->update_expr.get());
+    emit(OpCode::JUMP, static_cast<int32_t>(loop_start));
+
+    LoopContext loop = std::move(loops_.back());
+    loops_.pop_back();
+    if (has_condition) {
+        patch(to_end, here());
+    }
+    for (size_t at : loop.break_jumps) {
+        patch(at, here());
+    }
+    for (size_t at : loop.continue_jumps) {
+        patch(at, continue_target);
+    }
+    scopes_.pop_back();
+}
+
+void BytecodeCompiler::compile_return(const ASTNode *node) {
+    const ASTNode *value = node->left ? node->left.get() : node->right.get();
+    if (!value) {
+        emit(OpCode::RETURN_ZERO);
+        return;
+    }
+    if (!current_returns_value_) {
+        unsupported("return value in void function");
+    }
+    compile_expression(value);
+    emit(OpCode::RETURN);
+}
+
+void BytecodeCompiler::compile_print(const ASTNode *node, bool newline) {
+    // 単一引数（left）の経路は print_value を通るため整数式のみ扱う
+    if (node->left) {
+        if (!node->arguments.empty()) {
+            unsupported("print with both left and arguments");
+        }
+        compile_expression(node->left.get());
+        emit(OpCode::PRINT_INT);
+    } else if (node->arguments.size() == 1) {
+        const ASTNode *arg = node->arguments[0].get();
+        if (arg->node_type == ASTNodeType::AST_STRING_LITERAL) {
+            // 引数1つの文字列はフォーマット指定子を含んでもそのまま出力される
+            emit(OpCode::PRINT_STRING,
+                 intern_string(process_escape_sequences(arg->str_value)));
+        } else {
+            compile_expression(arg);
+            emit(OpCode::PRINT_INT);
+        }
+    } else {
+        for (size_t i = 0; i < node->arguments.size(); ++i) {
+            const ASTNode *arg = node->arguments[i].get();
+            if (i > 0) {
+                emit(OpCode::PRINT_CHAR, ' ');
+            }
+            if (arg->node_type == ASTNodeType::AST_STRING_LITERAL) {
+                // printf形式の判定はツリーウォーカーに任せる
+                if (arg->str_value.find('%') != std::string::npos) {
+                    unsupported("printf-style format string");
+                }
+                // 複数引数の文字列はエスケープ処理されずに出力される
+                emit(OpCode::PRINT_STRING, intern_string(arg->str_value));
+            } else {
+                compile_expression(arg);
+                emit(OpCode::PRINT_INT);
+            }
+        }
+    }
+    if (newline) {
+        emit(OpCode::PRINT_CHAR, '\n');
+    }
+}
+
+void BytecodeCompiler::compile_expression(const ASTNode *node) {
+    if (!node) {
+        unsupported("missing expression");
+    }
+    switch (node->node_type) {
+    case ASTNodeType::AST_NUMBER:
+        if (node->is_float_literal) {
+            unsupported("floating point literal");
+        }
+        emit(OpCode::PUSH, 0, node->int_value);
+        break;
+    case ASTNodeType::AST_VARIABLE:
+    case ASTNodeType::AST_IDENTIFIER: {
+        const Symbol &symbol = lookup(node->name);
+        if (symbol.array_id >= 0) {
+            unsupported("array '" + node->name + "' used as a value");
+        }
+        emit_load(symbol);
+        break;
+    }
+    case ASTNodeType::AST_ARRAY_REF: {
+        const Symbol &symbol = compile_array_indices(node);
+        emit(OpCode::LOAD_ELEM, symbol.array_id);
+        break;
+    }
+    case ASTNodeType::AST_BINARY_OP: {
+        OpCode op;
+        if (!is_binary_opcode(node->op, op)) {
+            unsupported("binary operator '" + node->op + "'");
+        }
+        // ツリーウォーカーと同様に && / || も両辺を評価する
+        compile_expression(node->left.get());
+        compile_expression(node->right.get());
+        emit(op);
+        break;
+    }
+    case ASTNodeType::AST_UNARY_OP:
+        compile_expression(node->left.get());
+        if (node->op == "-") {
+            emit(OpCode::NEG);
+        } else if (node->op == "!") {
+            emit(OpCode::NOT);
+        } else if (node->op == "~") {
+            emit(OpCode::BIT_NOT);
+        } else {
+            unsupported("unary operator '" + node->op + "'");
+        }
+        break;
+    case ASTNodeType::AST_TERNARY_OP: {
+        compile_expression(node->left.get());
+        size_t to_false = emit(OpCode::JUMP_IF_FALSE);
+        compile_expression(node->right.get());
+        size_t to_end = emit(OpCode::JUMP);
+        patch(to_false, here());
+        compile_expression(node->third.get());
+        patch(to_end, here());
+        break;
+    }
+    case ASTNodeType::AST_FUNC_CALL:
+        compile_call(node, true);
+        break;
+    case ASTNodeType::AST_PRE_INCDEC:
+    case ASTNodeType::AST_POST_INCDEC:
+        compile_incdec(node, true);
+        break;
+    default:
+        unsupported("expression node type " +
+                    std::to_string(static_cast<int>(node->node_type)));
+    }
+}
+
+void BytecodeCompiler::compile_call(const ASTNode *node, bool want_value) {
+    if (node->is_qualified_call || node->is_arrow_call || node->left ||
+        node->is_lambda_call) {
+        unsupported("call form of '" + node->name + "'");
+    }
+    auto it = functions_.find(node->name);
+    if (it == functions_.end()) {
+        unsupported("call to unknown function '" + node->name + "'");
+    }
+    const FunctionEntry &entry = it->second;
+    if (entry.node->parameters.size() != node->arguments.size()) {
+        unsupported("argument count mismatch for '" + node->name + "'");
+    }
+    if (want_value && entry.node->return_type_name == "void") {
+        unsupported("void function '" + node->name + "' used as a value");
+    }
+    for (const auto &arg : node->arguments) {
+        compile_expression(arg.get());
+    }
+    emit(OpCode::CALL, entry.index,
+         static_cast<int64_t>(node->arguments.size()));
+}
+
+void BytecodeCompiler::compile_incdec(const ASTNode *node, bool want_value) {
+    const ASTNode *target = node->left.get();
+    if (!target) {
+        unsupported("increment without target");
+    }
+    OpCode step = node->op == "++" ? OpCode::ADD : OpCode::SUB;
+    if (node->op != "++" && node->op != "--") {
+        unsupported("increment operator '" + node->op + "'");
+    }
+    bool is_post = node->node_type == ASTNodeType::AST_POST_INCDEC;
+    // ツリーウォーカーは ++/-- の結果を型範囲チェックしない
+
+    if (target->node_type == ASTNodeType::AST_ARRAY_REF) {
+        // インデックスを一時スロットに退避して読み書きで再利用する
+        const Symbol &symbol = compile_array_indices(target);
+        if (symbol.is_const) {
+            unsupported("increment of const array");
+        }
+        const ArrayLayout &layout = program_->arrays[symbol.array_id];
+        int32_t rank = static_cast<int32_t>(layout.dimensions.size());
+        int32_t temp_base = current_->local_count;
+        current_->local_count += rank;
+        for (int32_t i = rank - 1; i >= 0; --i) {
+            emit(OpCode::STORE_LOCAL, temp_base + i);
+        }
+        for (int32_t i = 0; i < rank; ++i) {
+            emit(OpCode::LOAD_LOCAL, temp_base + i);
+        }
+        emit(OpCode::LOAD_ELEM, symbol.array_id);
+        if (want_value && is_post) {
+            emit(OpCode::DUP);
+        }
+        emit(OpCode::PUSH, 0, 1);
+        emit(step);
+        if (want_value && !is_post) {
+            emit(OpCode::DUP);
+        }
+        int32_t value_slot = current_->local_count++;
+        emit(OpCode::STORE_LOCAL, value_slot);
+        for (int32_t i = 0; i < rank; ++i) {
+            emit(OpCode::LOAD_LOCAL, temp_base + i);
+        }
+        emit(OpCode::LOAD_LOCAL, value_slot);
+        emit(OpCode::STORE_ELEM, symbol.array_id);
+        return;
+    }
+
+    if (target->node_type != ASTNodeType::AST_VARIABLE &&
+        target->node_type != ASTNodeType::AST_IDENTIFIER) {
+        unsupported("increment target");
+    }
+    const Symbol &symbol = lookup(target->name);
+    if (symbol.array_id >= 0 || symbol.is_const) {
+        unsupported("increment of '" + target->name + "'");
+    }
+    emit_load(symbol);
+    if (want_value && is_post) {
+        emit(OpCode::DUP);
+    }
+    emit(OpCode::PUSH, 0, 1);
+    emit(step);
+    if (want_value && !is_post) {
+        emit(OpCode::DUP);
+    }
+    emit_store(symbol);
+}
+
+const BytecodeCompiler::Symbol &
+BytecodeCompiler::compile_array_indices(const ASTNode *node) {
+    // a[i][j] は ARRAY_REF(ARRAY_REF(a, i), j) の形で表現される
+    std::vector<const ASTNode *> indices;
+    const ASTNode *cursor = node;
+    while (cursor && cursor->node_type == ASTNodeType::AST_ARRAY_REF) {
+        if (!cursor->array_indices.empty() || !cursor->array_index) {
+            unsupported("array access form");
+        }
+        indices.push_back(cursor->array_index.get());
+        cursor = cursor->left.get();
+    }
+    if (!cursor || cursor->node_type != ASTNodeType::AST_VARIABLE) {
+        unsupported("array access base");
+    }
+    const Symbol &symbol = lookup(cursor->name);
+    if (symbol.array_id < 0 ||
+        program_->arrays[symbol.array_id].dimensions.size() !=
+            indices.size()) {
+        unsupported("array access rank of '" + cursor->name + "'");
+    }
+    for (size_t i = indices.size(); i-- > 0;) {
+        compile_expression(indices[i]);
+    }
+    return symbol;
+}
+
+TypeInfo BytecodeCompiler::scalar_type_of(const std::string &type_name) const {
+    static const std::map<std::string, TypeInfo> table = {
+        {"tiny", TYPE_TINY}, {"short", TYPE_SHORT}, {"int", TYPE_INT},
+        {"long", TYPE_LONG}, {"char", TYPE_CHAR},   {"bool", TYPE_BOOL}};
+    auto it = table.find(type_name);
+    if (it == table.end() || !is_integral_type(it->second)) {
+        unsupported("type '" + type_name + "'");
+    }
+    return it->second;
+}
+
+const BytecodeCompiler::Symbol &
+BytecodeCompiler::lookup(const std::string &name) const {
+    for (auto scope = scopes_.rbegin(); scope != scopes_.rend(); ++scope) {
+        auto it = scope->find(name);
+        if (it != scope->end()) {
+            return it->second;
+        }
+    }
+    auto it = globals_.find(name);
+    if (it == globals_.end()) {
+        unsupported("unknown variable '" + name + "'");
+    }
+    return it->second;
+}
+
+BytecodeCompiler::Symbol &
+BytecodeCompiler::declare_local(const std::string &name, TypeInfo type,
+                                bool is_const, int32_t slot_count) {
+    if (scopes_.empty()) {
+        unsupported("local declaration outside of function");
+    }
+    // シャドーイングの扱いはツリーウォーカーと食い違う可能性があるため対象外
+    for (const auto &scope : scopes_) {
+        if (scope.count(name)) {
+            unsupported("redeclaration of '" + name + "'");
+        }
+    }
+    if (globals_.count(name) || functions_.count(name)) {
+        unsupported("local '" + name + "' shadows a global");
+    }
+    Symbol symbol;
+    symbol.slot = current_->local_count;
+    symbol.type = type;
+    symbol.is_const = is_const;
+    symbol.name_id = intern_name(name);
+    current_->local_count += slot_count;
+    return scopes_.back()[name] = symbol;
+}
+
+void BytecodeCompiler::emit_load(const Symbol &symbol) {
+    emit(symbol.is_global ? OpCode::LOAD_GLOBAL : OpCode::LOAD_LOCAL,
+         symbol.slot);
+}
+
+void BytecodeCompiler::emit_store(const Symbol &symbol) {
+    emit(symbol.is_global ? OpCode::STORE_GLOBAL : OpCode::STORE_LOCAL,
+         symbol.slot);
+}
+
+void BytecodeCompiler::emit_range_check(TypeInfo type, int32_t name_id) {
+    // long は int64_t 全域、bool は範囲チェック対象外
+    if (type == TYPE_LONG || type == TYPE_BOOL) {
+        return;
+    }
+    emit(OpCode::CHECK_RANGE, static_cast<int32_t>(type), name_id);
+}
+
+int32_t BytecodeCompiler::intern_name(const std::string &name) {
+    auto &names = program_->names;
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (names[i] == name) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    names.push_back(name);
+    return static_cast<int32_t>(names.size() - 1);
+}
+
+int32_t BytecodeCompiler::intern_string(const std::string &value) {
+    auto &strings = program_->strings;
+    for (size_t i = 0; i < strings.size(); ++i) {
+        if (strings[i] == value) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    strings.push_back(value);
+    return static_cast<int32_t>(strings.size() - 1);
+}
+
+size_t BytecodeCompiler::emit(OpCode op, int32_t a, int64_t imm) {
+    current_->code.emplace_back(op, a, imm);
+    return current_->code.size() - 1;
+}
+
+void BytecodeCompiler::patch(size_t at, size_t target) {
+    current_->code[at].a = static_cast<int32_t>(target);
+}
+
+void BytecodeCompiler::unsupported(const std::string &reason) const {
+    throw Unsupported(reason);
+}
+
+} // namespace ir
+} // namespace cb
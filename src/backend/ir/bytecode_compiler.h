@@ -0,0 +1,101 @@
+#pragma once
+
+#include "bytecode.h"
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cb {
+namespace ir {
+
+// v0.14.0: AST → バイトコードコンパイラ
+// 整数系プリミティブ・固定長配列・関数・制御構文からなるサブセットのみを扱う。
+// サブセット外の構文を含むプログラムはコンパイルせず（nullptrを返し）、
+// 呼び出し側がツリーウォーカーにフォールバックする。
+class BytecodeCompiler {
+  public:
+    std::unique_ptr<BytecodeProgram> compile(const ASTNode *root);
+
+    // コンパイルできなかった理由（フォールバック時のデバッグ用）
+    const std::string &error() const { return error_; }
+
+  private:
+    // サブセット外の構文を検出したときに投げる内部例外
+    class Unsupported : public std::runtime_error {
+      public:
+        explicit Unsupported(const std::string &what)
+            : std::runtime_error(what) {}
+    };
+
+    struct Symbol {
+        bool is_global = false;
+        int32_t slot = 0;
+        TypeInfo type = TYPE_INT;
+        bool is_const = false;
+        int32_t array_id = -1; // 配列の場合は ArrayLayout のID
+        int32_t name_id = 0;
+    };
+
+    struct LoopContext {
+        std::vector<size_t> break_jumps;
+        std::vector<size_t> continue_jumps;
+    };
+
+    struct FunctionEntry {
+        int32_t index;
+        const ASTNode *node;
+        std::vector<TypeInfo> param_types;
+    };
+
+    // 宣言
+    void collect_top_level(const ASTNode *root);
+    void compile_function(const FunctionEntry &entry);
+    void compile_global_initializers(const ASTNode *root);
+    void compile_var_decl(const ASTNode *node, bool is_global);
+    void compile_array_decl(const ASTNode *node, bool is_global);
+
+    // 文
+    void compile_statement(const ASTNode *node);
+    void compile_block(const ASTNode *node);
+    void compile_assign(const ASTNode *node);
+    void compile_if(const ASTNode *node);
+    void compile_while(const ASTNode *node);
+    void compile_for(const ASTNode *node);
+    void compile_return(const ASTNode *node);
+    void compile_print(const ASTNode *node, bool newline);
+
+    // 式（必ず1つの値をスタックに積む）
+    void compile_expression(const ASTNode *node);
+    void compile_call(const ASTNode *node, bool want_value);
+    void compile_incdec(const ASTNode *node, bool want_value);
+    const Symbol &compile_array_indices(const ASTNode *node);
+
+    // ヘルパー
+    TypeInfo scalar_type_of(const std::string &type_name) const;
+    const Symbol &lookup(const std::string &name) const;
+    Symbol &declare_local(const std::string &name, TypeInfo type,
+                          bool is_const, int32_t slot_count);
+    void emit_load(const Symbol &symbol);
+    void emit_store(const Symbol &symbol);
+    void emit_range_check(TypeInfo type, int32_t name_id);
+    int32_t intern_name(const std::string &name);
+    int32_t intern_string(const std::string &value);
+    size_t emit(OpCode op, int32_t a = 0, int64_t imm = 0);
+    void patch(size_t at, size_t target);
+    size_t here() const { return current_->code.size(); }
+    [[noreturn]] void unsupported(const std::string &reason) const;
+
+    std::unique_ptr<BytecodeProgram> program_;
+    std::map<std::string, FunctionEntry> functions_;
+    std::map<std::string, Symbol> globals_;
+    std::vector<std::map<std::string, Symbol>> scopes_;
+    std::vector<LoopContext> loops_;
+    BytecodeFunction *current_ = nullptr;
+    bool current_returns_value_ = false;
+    std::string error_;
+};
+
+} // namespace ir
+} // namespace cb
@@ -0,0 +1,274 @@
+#include "vm.h"
+#include "../../common/debug.h"
+#include "../../common/io_interface.h"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace cb {
+namespace ir {
+
+namespace {
+
+// 再帰の暴走でメモリを使い切らないための上限
+constexpr size_t MAX_CALL_DEPTH = 1 << 20;
+
+} // namespace
+
+VirtualMachine::VirtualMachine(const BytecodeProgram &program)
+    : program_(program), io_(IOFactory::get_instance()),
+      globals_(program.global_count, 0) {
+    stack_.reserve(256);
+    locals_.reserve(1024);
+    frames_.reserve(64);
+}
+
+void VirtualMachine::run() {
+    execute(program_.init_function);
+    execute(program_.main_function);
+}
+
+int64_t *VirtualMachine::element_address(const ArrayLayout &layout,
+                                         int64_t *base) {
+    size_t rank = layout.dimensions.size();
+    const int64_t *indices = stack_.data() + stack_.size() - rank;
+    int64_t flat = 0;
+    for (size_t d = 0; d < rank; ++d) {
+        int64_t index = indices[d];
+        int64_t size = layout.dimensions[d];
+        if (index < 0 || index >= size) {
+            throw std::runtime_error(
+                "Array index out of bounds for '" + layout.name +
+                "': " + std::to_string(index) +
+                " (valid range: 0-" + std::to_string(size - 1) + ")");
+        }
+        flat = flat * size + index;
+    }
+    stack_.resize(stack_.size() - rank);
+    return base + layout.base_slot + flat;
+}
+
+void VirtualMachine::check_range(TypeInfo type, int64_t value,
+                                 int32_t name_id) const {
+    int64_t min_allowed = 0;
+    int64_t max_allowed = 0;
+    switch (type) {
+    case TYPE_TINY:
+    case TYPE_CHAR:
+        min_allowed = -128;
+        max_allowed = 127;
+        break;
+    case TYPE_SHORT:
+        min_allowed = -32768;
+        max_allowed = 32767;
+        break;
+    case TYPE_INT:
+        min_allowed = INT32_MIN;
+        max_allowed = INT32_MAX;
+        break;
+    default:
+        return;
+    }
+    if (value < min_allowed || value > max_allowed) {
+        error_msg(DebugMsgId::TYPE_RANGE_ERROR,
+                  program_.names[name_id].c_str());
+        throw std::runtime_error("Value out of range for type");
+    }
+}
+
+void VirtualMachine::execute(int32_t function_index) {
+    const BytecodeFunction *function = &program_.functions[function_index];
+    size_t entry_depth = frames_.size();
+    size_t base = locals_.size();
+    locals_.resize(base + function->local_count, 0);
+    frames_.push_back({function, 0, base});
+
+    const Instruction *code = function->code.data();
+    size_t pc = 0;
+    int64_t *locals = locals_.data() + base;
+    int64_t *globals = globals_.data();
+
+    auto pop = [this]() {
+        int64_t value = stack_.back();
+        stack_.pop_back();
+        return value;
+    };
+
+    while (true) {
+        const Instruction &ins = code[pc++];
+        switch (ins.op) {
+        case OpCode::PUSH:
+            stack_.push_back(ins.imm);
+            break;
+        case OpCode::POP:
+            stack_.pop_back();
+            break;
+        case OpCode::DUP:
+            stack_.push_back(stack_.back());
+            break;
+        case OpCode::LOAD_LOCAL:
+            stack_.push_back(locals[ins.a]);
+            break;
+        case OpCode::STORE_LOCAL:
+            locals[ins.a] = pop();
+            break;
+        case OpCode::LOAD_GLOBAL:
+            stack_.push_back(globals[ins.a]);
+            break;
+        case OpCode::STORE_GLOBAL:
+            globals[ins.a] = pop();
+            break;
+        case OpCode::CHECK_RANGE:
+            check_range(static_cast<TypeInfo>(ins.a), stack_.back(),
+                        static_cast<int32_t>(ins.imm));
+            break;
+
+        case OpCode::ARRAY_CLEAR: {
+            const ArrayLayout &layout = program_.arrays[ins.a];
+            int64_t *storage =
+                (layout.is_global ? globals : locals) + layout.base_slot;
+            std::fill(storage, storage + layout.total_size, 0);
+            break;
+        }
+        case OpCode::LOAD_ELEM: {
+            const ArrayLayout &layout = program_.arrays[ins.a];
+            int64_t *address =
+                element_address(layout, layout.is_global ? globals : locals);
+            stack_.push_back(*address);
+            break;
+        }
+        case OpCode::STORE_ELEM: {
+            const ArrayLayout &layout = program_.arrays[ins.a];
+            int64_t value = pop();
+            int64_t *address =
+                element_address(layout, layout.is_global ? globals : locals);
+            *address = value;
+            break;
+        }
+
+#define CB_VM_BINARY(OPCODE, EXPR)                                             \
+    case OpCode::OPCODE: {                                                     \
+        int64_t rhs = pop();                                                   \
+        int64_t lhs = stack_.back();                                           \
+        stack_.back() = (EXPR);                                                \
+        break;                                                                 \
+    }
+            CB_VM_BINARY(ADD, static_cast<int64_t>(static_cast<uint64_t>(lhs) +
+                                                   static_cast<uint64_t>(rhs)))
+            CB_VM_BINARY(SUB, static_cast<int64_t>(static_cast<uint64_t>(lhs) -
+                                                   static_cast<uint64_t>(rhs)))
+            CB_VM_BINARY(MUL, static_cast<int64_t>(static_cast<uint64_t>(lhs) *
+                                                   static_cast<uint64_t>(rhs)))
+            CB_VM_BINARY(BIT_AND, lhs & rhs)
+            CB_VM_BINARY(BIT_OR, lhs | rhs)
+            CB_VM_BINARY(BIT_XOR, lhs ^ rhs)
+            CB_VM_BINARY(SHL, static_cast<int64_t>(static_cast<uint64_t>(lhs)
+                                                   << (rhs & 63)))
+            CB_VM_BINARY(SHR, lhs >> (rhs & 63))
+            CB_VM_BINARY(EQ, lhs == rhs)
+            CB_VM_BINARY(NE, lhs != rhs)
+            CB_VM_BINARY(LT, lhs < rhs)
+            CB_VM_BINARY(LE, lhs <= rhs)
+            CB_VM_BINARY(GT, lhs > rhs)
+            CB_VM_BINARY(GE, lhs >= rhs)
+            CB_VM_BINARY(LOGICAL_AND, lhs && rhs)
+            CB_VM_BINARY(LOGICAL_OR, lhs || rhs)
+#undef CB_VM_BINARY
+
+        case OpCode::DIV:
+        case OpCode::MOD: {
+            int64_t rhs = pop();
+            int64_t lhs = stack_.back();
+            if (rhs == 0) {
+                error_msg(DebugMsgId::ZERO_DIVISION_ERROR);
+                throw std::runtime_error(ins.op == OpCode::DIV
+                                             ? "Division by zero"
+                                             : "Modulo by zero");
+            }
+            if (rhs == -1) {
+                // INT64_MIN / -1 のオーバーフローを回避
+                stack_.back() =
+                    ins.op == OpCode::DIV
+                        ? static_cast<int64_t>(0 - static_cast<uint64_t>(lhs))
+                        : 0;
+            } else {
+                stack_.back() = ins.op == OpCode::DIV ? lhs / rhs : lhs % rhs;
+            }
+            break;
+        }
+
+        case OpCode::NEG:
+            stack_.back() =
+                static_cast<int64_t>(0 - static_cast<uint64_t>(stack_.back()));
+            break;
+        case OpCode::NOT:
+            stack_.back() = !stack_.back();
+            break;
+        case OpCode::BIT_NOT:
+            stack_.back() = ~stack_.back();
+            break;
+
+        case OpCode::JUMP:
+            pc = ins.a;
+            break;
+        case OpCode::JUMP_IF_FALSE:
+            if (!pop()) {
+                pc = ins.a;
+            }
+            break;
+        case OpCode::CALL: {
+            if (frames_.size() >= MAX_CALL_DEPTH) {
+                throw std::runtime_error("Stack overflow");
+            }
+            const BytecodeFunction *callee = &program_.functions[ins.a];
+            size_t argc = static_cast<size_t>(ins.imm);
+            frames_.back().pc = pc;
+            size_t callee_base = locals_.size();
+            locals_.resize(callee_base + callee->local_count, 0);
+            int64_t *args = stack_.data() + stack_.size() - argc;
+            std::copy(args, args + argc, locals_.data() + callee_base);
+            stack_.resize(stack_.size() - argc);
+            frames_.push_back({callee, 0, callee_base});
+
+            function = callee;
+            code = function->code.data();
+            pc = 0;
+            locals = locals_.data() + callee_base;
+            break;
+        }
+        case OpCode::RETURN:
+        case OpCode::RETURN_ZERO: {
+            int64_t result = ins.op == OpCode::RETURN ? pop() : 0;
+            locals_.resize(frames_.back().base);
+            frames_.pop_back();
+            if (frames_.size() == entry_depth) {
+                return;
+            }
+            stack_.push_back(result);
+            const Frame &caller = frames_.back();
+            function = caller.function;
+            code = function->code.data();
+            pc = caller.pc;
+            locals = locals_.data() + caller.base;
+            break;
+        }
+
+        case OpCode::PRINT_INT:
+            io_->write_number(pop());
+            break;
+        case OpCode::PRINT_STRING:
+            io_->write_string(program_.strings[ins.a].c_str());
+            break;
+        case OpCode::PRINT_CHAR:
+            io_->write_char(static_cast<char>(ins.a));
+            break;
+
+        case OpCode::HALT:
+            return;
+        }
+    }
+}
+
+} // namespace ir
+} // namespace cb
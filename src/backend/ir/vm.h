@@ -0,0 +1,42 @@
+#pragma once
+
+#include "bytecode.h"
+#include <cstdint>
+#include <vector>
+
+class IOInterface;
+
+namespace cb {
+namespace ir {
+
+// v0.14.0: バイトコード仮想マシン
+// 単一のディスパッチループで BytecodeProgram を実行する。
+// 実行時エラーはツリーウォーカーと同じメッセージの std::runtime_error を投げる。
+class VirtualMachine {
+  public:
+    explicit VirtualMachine(const BytecodeProgram &program);
+
+    // グローバル変数を初期化してから main を実行する
+    void run();
+
+  private:
+    struct Frame {
+        const BytecodeFunction *function;
+        size_t pc;
+        size_t base; // locals_ 上の先頭スロット
+    };
+
+    void execute(int32_t function_index);
+    int64_t *element_address(const ArrayLayout &layout, int64_t *base);
+    void check_range(TypeInfo type, int64_t value, int32_t name_id) const;
+
+    const BytecodeProgram &program_;
+    IOInterface *io_;
+    std::vector<int64_t> globals_;
+    std::vector<int64_t> locals_;
+    std::vector<int64_t> stack_;
+    std::vector<Frame> frames_;
+};
+
+} // namespace ir
+} // namespace cb
@@ -13,3 +13,39 @@ std::string generate_discard_name() {
 std::string generate_lambda_name() {
     return "__lambda_" + std::to_string(++ASTNode::lambda_counter);
 }
+
+// v0.14.0: 二項演算子の文字列をOperatorKindに変換
+OperatorKind decode_binary_operator(const std::string &op) {
+    static const std::unordered_map<std::string, OperatorKind> table = {
+        {"+", OperatorKind::ADD},          {"-", OperatorKind::SUB},
+        {"*", OperatorKind::MUL},          {"/", OperatorKind::DIV},
+        {"%", OperatorKind::MOD},          {"==", OperatorKind::EQ},
+        {"!=", OperatorKind::NE},          {"<", OperatorKind::LT},
+        {">", OperatorKind::GT},           {"<=", OperatorKind::LE},
+        {">=", OperatorKind::GE},          {"&&", OperatorKind::LOGICAL_AND},
+        {"||", OperatorKind::LOGICAL_OR},  {"&", OperatorKind::BIT_AND},
+        {"|", OperatorKind::BIT_OR},       {"^", OperatorKind::BIT_XOR},
+        {"<<", OperatorKind::SHL},         {">>", OperatorKind::SHR},
+    };
+    auto it = table.find(op);
+    return it != table.end() ? it->second : OperatorKind::UNKNOWN;
+}
+
+// v0.14.0: 単項演算子の文字列をOperatorKindに変換
+OperatorKind decode_unary_operator(const std::string &op) {
+    static const std::unordered_map<std::string, OperatorKind> table = {
+        {"!", OperatorKind::LOGICAL_NOT},
+        {"-", OperatorKind::NEGATE},
+        {"+", OperatorKind::PLUS},
+        {"~", OperatorKind::BIT_NOT},
+        {"++", OperatorKind::PRE_INC},
+        {"--", OperatorKind::PRE_DEC},
+        {"++_post", OperatorKind::POST_INC},
+        {"--_post", OperatorKind::POST_DEC},
+        {"ADDRESS_OF", OperatorKind::ADDRESS_OF},
+        {"DEREFERENCE", OperatorKind::DEREFERENCE},
+        {"await", OperatorKind::AWAIT},
+    };
+    auto it = table.find(op);
+    return it != table.end() ? it->second : OperatorKind::UNKNOWN;
+}
@@ -619,15 +619,41 @@ struct StructDefinition {
         members.emplace_back(std::move(member));
     }
 
+    // v0.14.0: メンバ名 → フィールド番号（membersの添字）
+    // membersは直接push_backや書き換えをされることもあるため、索引の結果は
+    // 必ずこの定義のmembersと照合する。一致しない・見つからない場合は
+    // membersを走査し、見つかれば索引を作り直す
+    int field_index(const std::string &member_name) const {
+        auto it = field_index_.find(member_name);
+        if (it != field_index_.end() &&
+            static_cast<size_t>(it->second) < members.size() &&
+            members[it->second].name == member_name) {
+            return it->second;
+        }
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (members[i].name == member_name) {
+                rebuild_field_index();
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
     // メンバを名前で検索
     const StructMember *find_member(const std::string &member_name) const {
-        for (const auto &member : members) {
-            if (member.name == member_name) {
-                return &member;
-            }
+        int index = field_index(member_name);
+        return index >= 0 ? &members[index] : nullptr;
+    }
+
+  private:
+    void rebuild_field_index() const {
+        field_index_.clear();
+        for (size_t i = 0; i < members.size(); ++i) {
+            field_index_.emplace(members[i].name, static_cast<int>(i));
         }
-        return nullptr;
     }
+
+    mutable std::unordered_map<std::string, int> field_index_;
 };
 
 // 前方宣言
@@ -1119,6 +1145,121 @@ struct SourceLocation {
     bool isValid() const { return !filename.empty() && line > 0; }
 };
 
+// v0.14.0: VariableResolverによる変数束縛の種類
+enum class VariableBinding : uint8_t {
+    UNRESOLVED, // 名前による検索が必要
+    LOCAL,      // 関数フレーム内のスロット
+    GLOBAL,     // グローバル変数のインデックス
+};
+
+// v0.14.0: パース時にopからデコードされる演算子の種類
+// （評価時の文字列比較を避けるため。opは診断用に残す）
+enum class OperatorKind : uint8_t {
+    NONE,
+    // 算術演算
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    MOD,
+    // 比較演算（EQ〜GEは連続している必要がある）
+    EQ,
+    NE,
+    LT,
+    GT,
+    LE,
+    GE,
+    // 論理演算
+    LOGICAL_AND,
+    LOGICAL_OR,
+    // ビット演算
+    BIT_AND,
+    BIT_OR,
+    BIT_XOR,
+    SHL,
+    SHR,
+    // 単項演算
+    LOGICAL_NOT,
+    NEGATE,
+    PLUS,
+    BIT_NOT,
+    PRE_INC,
+    PRE_DEC,
+    POST_INC,
+    POST_DEC,
+    ADDRESS_OF,
+    DEREFERENCE,
+    AWAIT,
+    UNKNOWN,
+};
+
+OperatorKind decode_binary_operator(const std::string &op);
+OperatorKind decode_unary_operator(const std::string &op);
+
+inline bool is_comparison_operator(OperatorKind kind) {
+    return kind >= OperatorKind::EQ && kind <= OperatorKind::GE;
+}
+
+// v0.14.0: 比較演算のオペランド型による高速パス
+// （初回評価時に決定し、型が合わなくなったらGENERICに落とす）
+enum class OperandFastPath : uint8_t {
+    UNDECIDED,
+    INT,
+    DOUBLE,
+    STRING,
+    GENERIC,
+};
+
+// v0.14.0: メソッド呼び出し箇所のインラインキャッシュ
+// レシーバーの型名ごとに、解決したメソッドとimplの情報を覚えておく。
+// 関数・implが登録されるとInterpreterのエポックが進み、古いキャッシュは
+// 次の呼び出しで捨てる
+struct MethodCacheEntry {
+    std::string receiver_type;     // レシーバーの型名（キー）
+    const ASTNode *func = nullptr; // 解決したメソッド
+    // 型パラメータの束縛を持つimpl（nullptrはなし）
+    const ImplDefinition *type_context_impl = nullptr;
+    bool type_context_resolved = false;
+    // 型コンテキストをpushするジェネリックimpl（nullptrはなし）
+    const ImplDefinition *generic_impl = nullptr;
+    bool generic_impl_resolved = false;
+};
+
+struct MethodInlineCache {
+    // これより多くの型を観測した呼び出し箇所（メガモーフィック）は
+    // キャッシュせず、毎回従来どおり解決する
+    static constexpr size_t kMaxEntries = 4;
+    MethodCacheEntry entries[kMaxEntries];
+    uint8_t size = 0;
+    bool megamorphic = false;
+    uint64_t epoch = 0;
+    // interface型の値のメソッド表のスロット（vtable_interfaceのメソッドの位置）
+    const InterfaceDefinition *vtable_interface = nullptr;
+    int vtable_slot = -1;
+};
+
+// v0.14.0: 関数宣言ごとの引数の渡し方（呼び出しレイアウト）
+// 初回の呼び出しで引数宣言から作り、呼び出しのたびに型名の解析や
+// interface定義の検索をしない
+enum class ParamPassing : uint8_t {
+    GENERIC,   // 従来の判定（文字列・構造体・ポインタ・関数ポインタなど）
+    VALUE,     // 数値型の値渡し（呼び出し先のフレームのスロットへ直接書く）
+    REFERENCE, // T& / T&&（呼び出し元の変数を指す）
+    ARRAY,     // 配列（呼び出し元の配列を指す）
+    INTERFACE, // interface型（実装構造体のビューを作る）
+};
+
+struct ParamLayout {
+    ParamPassing passing = ParamPassing::GENERIC;
+    int slot = -1; // VariableResolverが割り当てたフレームのスロット
+};
+
+struct CallLayout {
+    std::vector<ParamLayout> params;
+    size_t required_args = 0; // デフォルト値を持たない先頭の引数の数
+    uint64_t epoch = 0; // 作ったときのInterpreterのエポック
+};
+
 // ASTノードの基底クラス
 struct ASTNode {
     ASTNodeType node_type;
@@ -1161,6 +1302,43 @@ struct ASTNode {
     std::string return_type_name; // 戻り値型の文字列表現（配列型対応）
     std::string op;
 
+    // v0.14.0: VariableResolverが割り当てたスロット
+    // （AST_VARIABLE/AST_IDENTIFIERのみ。解析済みのconst ASTに書き込む）
+    mutable VariableBinding binding = VariableBinding::UNRESOLVED;
+    mutable int binding_slot = -1;
+
+    // v0.14.0: opをデコードした演算子と比較演算の高速パス
+    // （合成・複製されたノードはoperator_kind()で遅延デコードされる）
+    mutable OperatorKind op_kind = OperatorKind::NONE;
+    mutable OperandFastPath operand_fast_path = OperandFastPath::UNDECIDED;
+
+    // v0.14.0: AST_FUNC_CALLの組み込み関数ID（BuiltinRegistryが初回呼び出し時に
+    // 解決する。-1は未解決）
+    mutable int16_t builtin_id = -1;
+
+    // v0.14.0: AST_FUNC_CALLが直前に呼び出したジェネリック関数のインスタンス
+    // （InterpreterのInstanceCacheが所有する。記録したキャッシュの世代と
+    // 呼び出し先の関数generic_sourceが一致するときだけ使う）
+    mutable const ASTNode *generic_source = nullptr;
+    mutable const ASTNode *generic_instance = nullptr;
+    mutable uint64_t generic_cache_generation = 0;
+
+    // v0.14.0: メソッド呼び出し（AST_FUNC_CALL）のインラインキャッシュ
+    // （初回のメソッド呼び出しで作る）
+    mutable std::unique_ptr<MethodInlineCache> method_cache;
+    // v0.14.0: 関数宣言（AST_FUNC_DECL）の呼び出しレイアウト
+    // （初回の呼び出しで作る）
+    mutable std::unique_ptr<CallLayout> call_layout;
+
+    OperatorKind operator_kind() const {
+        if (op_kind == OperatorKind::NONE && !op.empty()) {
+            op_kind = node_type == ASTNodeType::AST_UNARY_OP
+                          ? decode_unary_operator(op)
+                          : decode_binary_operator(op);
+        }
+        return op_kind;
+    }
+
     // 子ノード
     std::unique_ptr<ASTNode> left;
     std::unique_ptr<ASTNode> right;
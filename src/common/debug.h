@@ -1,6 +1,7 @@
 #ifndef DEBUG_H
 #define DEBUG_H
 
+#include <cstdio>
 #include <string>
 
 // デバッグ言語設定
@@ -557,6 +558,7 @@ enum class DebugMsgId {
     EVENT_LOOP_SET_VALUE,      // タスクの戻り値を設定
     EVENT_LOOP_GET_TASK,       // get_task でタスク取得
     EVENT_LOOP_RUN_UNTIL_COMPLETE, // run_until_complete 実行
+    EVENT_LOOP_TASK_CANCELLED,     // タスク取り消し（race/concurrent_await）
     SLEEP_TASK_REGISTER,           // sleep タスク登録
     SLEEP_RETURN_FUTURE,           // sleep から Future を返す
     SLEEP_TASK_SLEEPING,           // タスクがまだsleep中
@@ -568,12 +570,75 @@ enum class DebugMsgId {
     MAX_DEBUG_MSG_ID // 最大値マーカー
 };
 
+// v0.14.0: トレースカテゴリ（--trace=parser,struct などで個別に有効化）
+enum class TraceCategory : unsigned {
+    PARSER,      // 構文解析
+    INTERPRETER, // 文の実行・初期化
+    EXPRESSION,  // 式評価
+    VARIABLE,    // 変数宣言・代入
+    ARRAY,       // 配列
+    STRUCT,      // struct/メンバーアクセス
+    CALL,        // 関数/メソッド/impl呼び出し
+    ASYNC,       // async/await・イベントループ
+    GENERIC,     // 汎用デバッグ（GENERIC_DEBUG等）
+    COUNT
+};
+
 // デバッグモードフラグ（外部宣言）
 extern bool debug_mode;
 extern DebugLanguage debug_language;
+// 有効なトレースカテゴリのビットマスク（既定は全カテゴリ）
+extern unsigned trace_category_mask;
+
+// メッセージIDの属するカテゴリ（メッセージのタグから分類）
+TraceCategory trace_category_of(DebugMsgId msg_id);
+
+// "parser,struct" / "all" 形式でカテゴリを設定（不明な名前はfalse）
+bool set_trace_categories(const std::string &spec);
+
+inline bool trace_category_enabled(TraceCategory category) {
+    return debug_mode &&
+           (trace_category_mask & (1u << static_cast<unsigned>(category)));
+}
+
+inline bool trace_message_enabled(DebugMsgId msg_id) {
+    return debug_mode && trace_category_enabled(trace_category_of(msg_id));
+}
 
-// 多言語対応デバッグ出力関数
-void debug_msg(DebugMsgId msg_id, ...);
+// 多言語対応デバッグ出力関数（debug_msgマクロから呼ばれる）
+void debug_msg_emit(DebugMsgId msg_id, ...);
+
+// v0.14.0: トレースマクロ
+// debug_msg(...) は引数を評価する前にカテゴリの有効判定を行う。
+// 無効時は引数の文字列化（std::to_string等）も実行されない。
+// CB_DISABLE_TRACE を定義してビルドするとトレースは完全に除去される。
+#define CB_TRACE_FIRST_ARG(first, ...) first
+
+#ifdef CB_DISABLE_TRACE
+#define CB_TRACE_ENABLED(category) false
+#define CB_TRACE_MSG_ENABLED(msg_id) false
+#else
+#define CB_TRACE_ENABLED(category)                                             \
+    trace_category_enabled(TraceCategory::category)
+#define CB_TRACE_MSG_ENABLED(msg_id) trace_message_enabled(msg_id)
+#endif
+
+#define debug_msg(...)                                                         \
+    do {                                                                       \
+        if (CB_TRACE_MSG_ENABLED(CB_TRACE_FIRST_ARG(__VA_ARGS__, 0))) {        \
+            debug_msg_emit(__VA_ARGS__);                                       \
+        }                                                                      \
+    } while (0)
+
+// 書式付きの汎用トレース（有効時のみsnprintfで整形してGENERIC_DEBUGへ出力）
+#define CB_TRACEF(category, ...)                                               \
+    do {                                                                       \
+        if (CB_TRACE_ENABLED(category)) {                                      \
+            char cb_trace_buf_[512];                                           \
+            snprintf(cb_trace_buf_, sizeof(cb_trace_buf_), __VA_ARGS__);       \
+            debug_msg_emit(DebugMsgId::GENERIC_DEBUG, cb_trace_buf_);          \
+        }                                                                      \
+    } while (0)
 
 // 多言語対応エラー出力関数
 void error_msg(DebugMsgId msg_id, ...);
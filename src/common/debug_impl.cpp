@@ -2,16 +2,123 @@
 #include "debug_messages.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
+#include <vector>
 
 // デバッグモードフラグ（実装）
 bool debug_mode = false;
 DebugLanguage debug_language = DebugLanguage::ENGLISH;
+unsigned trace_category_mask = ~0u;
 
-// debug_msg関数
-void debug_msg(DebugMsgId msg_id, ...) {
-    if (!debug_mode)
-        return;
+namespace {
 
+const char *const trace_category_names[] = {
+    "parser", "interpreter", "expr",  "var",     "array",
+    "struct", "call",        "async", "generic",
+};
+static_assert(sizeof(trace_category_names) / sizeof(trace_category_names[0]) ==
+                  static_cast<size_t>(TraceCategory::COUNT),
+              "trace_category_names must match TraceCategory");
+
+bool tag_contains(const std::string &tag, const char *word) {
+    return tag.find(word) != std::string::npos;
+}
+
+// メッセージ先頭の "[TAG]" からカテゴリを決める
+TraceCategory classify_message(DebugMsgId msg_id) {
+    if (msg_id == DebugMsgId::GENERIC_DEBUG) {
+        return TraceCategory::GENERIC;
+    }
+    const char *en = get_debug_message(msg_id).en;
+    if (!en || en[0] != '[') {
+        return TraceCategory::GENERIC;
+    }
+    const char *end = std::strchr(en, ']');
+    std::string tag(en + 1, end ? end : en + std::strlen(en));
+
+    if (tag.compare(0, 5, "PARSE") == 0) {
+        return TraceCategory::PARSER;
+    }
+    if (tag_contains(tag, "ASYNC") || tag_contains(tag, "AWAIT") ||
+        tag_contains(tag, "EVENT_LOOP") || tag_contains(tag, "SLEEP")) {
+        return TraceCategory::ASYNC;
+    }
+    if (tag_contains(tag, "ARRAY") || tag_contains(tag, "MULTIDIM")) {
+        return TraceCategory::ARRAY;
+    }
+    if (tag_contains(tag, "STRUCT") || tag_contains(tag, "MEMBER") ||
+        tag_contains(tag, "ARROW") || tag_contains(tag, "SELF")) {
+        return TraceCategory::STRUCT;
+    }
+    if (tag_contains(tag, "FUNC") || tag_contains(tag, "METHOD") ||
+        tag_contains(tag, "CALL") || tag_contains(tag, "IMPL") ||
+        tag_contains(tag, "INTERFACE") || tag_contains(tag, "RETURN")) {
+        return TraceCategory::CALL;
+    }
+    if (tag_contains(tag, "VAR") || tag_contains(tag, "ASSIGN")) {
+        return TraceCategory::VARIABLE;
+    }
+    if (tag_contains(tag, "EXPR") || tag_contains(tag, "EVAL") ||
+        tag_contains(tag, "TERNARY") || tag_contains(tag, "INCDEC")) {
+        return TraceCategory::EXPRESSION;
+    }
+    if (tag_contains(tag, "INTERPRETER") || tag_contains(tag, "STMT")) {
+        return TraceCategory::INTERPRETER;
+    }
+    return TraceCategory::GENERIC;
+}
+
+std::vector<TraceCategory> build_category_table() {
+    int count = static_cast<int>(DebugMsgId::MAX_DEBUG_MSG_ID);
+    std::vector<TraceCategory> table(count);
+    for (int i = 0; i < count; ++i) {
+        table[i] = classify_message(static_cast<DebugMsgId>(i));
+    }
+    return table;
+}
+
+} // namespace
+
+TraceCategory trace_category_of(DebugMsgId msg_id) {
+    static const std::vector<TraceCategory> table = build_category_table();
+    size_t index = static_cast<size_t>(msg_id);
+    return index < table.size() ? table[index] : TraceCategory::GENERIC;
+}
+
+bool set_trace_categories(const std::string &spec) {
+    unsigned mask = 0;
+    size_t start = 0;
+    while (start <= spec.size()) {
+        size_t comma = spec.find(',', start);
+        std::string name = spec.substr(
+            start, comma == std::string::npos ? std::string::npos
+                                              : comma - start);
+        if (name == "all") {
+            mask = ~0u;
+        } else if (!name.empty()) {
+            bool found = false;
+            for (unsigned i = 0;
+                 i < static_cast<unsigned>(TraceCategory::COUNT); ++i) {
+                if (name == trace_category_names[i]) {
+                    mask |= 1u << i;
+                    found = true;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        start = comma + 1;
+    }
+    trace_category_mask = mask;
+    return true;
+}
+
+// debug_msgマクロの出力本体
+void debug_msg_emit(DebugMsgId msg_id, ...) {
     const DebugMessageTemplate &msg = get_debug_message(msg_id);
     const char *format =
         (debug_language == DebugLanguage::JAPANESE) ? msg.ja : msg.en;
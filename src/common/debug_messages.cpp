@@ -1442,6 +1442,9 @@ static std::vector<DebugMessageTemplate> init_debug_messages() {
     messages[static_cast<int>(DebugMsgId::EVENT_LOOP_RUN_UNTIL_COMPLETE)] = {
         "[SIMPLE_EVENT_LOOP] run_until_complete: task %d, status: %s",
         "[SIMPLE_EVENT_LOOP] run_until_complete: タスク %d、ステータス: %s"};
+    messages[static_cast<int>(DebugMsgId::EVENT_LOOP_TASK_CANCELLED)] = {
+        "[EVENT_LOOP] Task %d cancelled (task group %d resolved)",
+        "[EVENT_LOOP] タスク %d を取り消し（タスクグループ %d 決着）"};
     messages[static_cast<int>(DebugMsgId::SLEEP_TASK_REGISTER)] = {
         "[SLEEP] Registered sleep task %d for %lldms (wake_up_time=%lld)",
         "[SLEEP] sleepタスク %d を登録、%lldミリ秒（wake_up_time=%lld）"};
@@ -1,5 +1,8 @@
 #include "../backend/interpreter/core/error_handler.h"
 #include "../backend/interpreter/core/interpreter.h"
+#include "../backend/interpreter/event_loop/simple_event_loop.h"
+#include "../backend/ir/bytecode_compiler.h"
+#include "../backend/ir/vm.h"
 #include "../common/ast.h"
 #include "../common/debug.h"
 
@@ -11,6 +14,7 @@
 
 #include <cstdarg>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -26,7 +30,10 @@ std::vector<std::string> file_lines;
 int main(int argc, char **argv) {
     if (argc < 2) {
         std::cerr << "使用法: " << argv[0]
-                  << " <ファイル名> [-d|--debug] [--debug-ja]" << std::endl;
+                  << " <ファイル名> [-d|--debug] [--debug-ja] [--engine=vm|tree]"
+                  << " [--trace=<カテゴリ,...>] [--async-quantum=<文の数>]"
+                  << " [--async-time-slice=<マイクロ秒>] [--async-stats]"
+                  << " [--dispatch-stats]" << std::endl;
         return 1;
     }
 
@@ -35,6 +42,12 @@ int main(int argc, char **argv) {
     debug_mode = false;
     debug_language = DebugLanguage::ENGLISH;
     bool enable_preprocessor = true;
+    bool use_vm = false; // v0.14.0: --engine=vm でバイトコードVMを使用
+    // v0.14.0: asyncタスクのタイムスライス（0なら既定値のまま）
+    long long async_quantum = 0;
+    long long async_time_slice_us = -1;
+    bool async_stats = false;
+    bool dispatch_stats = false; // v0.14.0: メソッド呼び出しのキャッシュ統計
     PreprocessorNS::Preprocessor preprocessor;
 
     for (int i = 1; i < argc; ++i) {
@@ -44,6 +57,50 @@ int main(int argc, char **argv) {
         } else if (std::string(argv[i]) == "--debug-ja") {
             debug_mode = true;
             debug_language = DebugLanguage::JAPANESE;
+        } else if (std::string(argv[i]).rfind("--trace=", 0) == 0) {
+            // v0.14.0: 指定カテゴリのみトレース（例: --trace=struct,call）
+            if (!set_trace_categories(std::string(argv[i]).substr(8))) {
+                std::fprintf(stderr,
+                             "Error: unknown trace category in '%s' "
+                             "(parser, interpreter, expr, var, array, "
+                             "struct, call, async, generic, all)\n",
+                             argv[i]);
+                return 1;
+            }
+            debug_mode = true;
+        } else if (std::string(argv[i]) == "--engine=vm") {
+            use_vm = true;
+        } else if (std::string(argv[i]) == "--engine=tree") {
+            use_vm = false;
+        } else if (std::string(argv[i]).rfind("--async-quantum=", 0) == 0 ||
+                   std::string(argv[i]).rfind("--async-time-slice=", 0) ==
+                       0) {
+            // v0.14.0: --async-quantum=N（文の数） /
+            // --async-time-slice=T（マイクロ秒、0で無効）
+            bool is_quantum =
+                std::string(argv[i]).rfind("--async-quantum=", 0) == 0;
+            const char *value = std::strchr(argv[i], '=') + 1;
+            char *end = nullptr;
+            long long parsed = std::strtoll(value, &end, 10);
+            if (*value == '\0' || *end != '\0' ||
+                parsed < (is_quantum ? 1 : 0)) {
+                std::fprintf(stderr,
+                             "Error: invalid value in '%s' (expected %s)\n",
+                             argv[i],
+                             is_quantum ? "a positive number of statements"
+                                        : "a non-negative number of "
+                                          "microseconds");
+                return 1;
+            }
+            if (is_quantum) {
+                async_quantum = parsed;
+            } else {
+                async_time_slice_us = parsed;
+            }
+        } else if (std::string(argv[i]) == "--async-stats") {
+            async_stats = true;
+        } else if (std::string(argv[i]) == "--dispatch-stats") {
+            dispatch_stats = true;
         } else if (std::string(argv[i]) == "--no-preprocess") {
             enable_preprocessor = false;
         } else if (std::string(argv[i]).substr(0, 2) == "-D") {
@@ -118,6 +175,21 @@ int main(int argc, char **argv) {
             return 1;
         }
 
+        // v0.14.0: バイトコードVMで実行（サブセット外ならツリーウォーカーへ）
+        if (use_vm) {
+            cb::ir::BytecodeCompiler compiler;
+            auto program = compiler.compile(root);
+            if (program) {
+                cb::ir::VirtualMachine vm(*program);
+                vm.run();
+                std::fflush(stdout);
+                std::fflush(stderr);
+                std::_Exit(0);
+            }
+            debug_log_line("[VM] falling back to tree-walker: " +
+                           compiler.error());
+        }
+
         // インタープリターでASTを実行
         if (debug_mode) {
             std::fprintf(stderr, "Debug mode is enabled\n");
@@ -125,6 +197,13 @@ int main(int argc, char **argv) {
         debug_msg(DebugMsgId::INTERPRETER_START);
 
         Interpreter interpreter(debug_mode);
+        if (async_quantum > 0) {
+            interpreter.set_async_quantum(async_quantum);
+        }
+        if (async_time_slice_us >= 0) {
+            interpreter.set_async_time_slice_us(async_time_slice_us);
+        }
+        interpreter.get_simple_event_loop().set_stats_enabled(async_stats);
 
         // Parserからenum定義を同期
         interpreter.sync_enum_definitions_from_parser(&parser);
@@ -152,6 +231,12 @@ int main(int argc, char **argv) {
         */
 
         interpreter.process(root);
+        if (async_stats) {
+            interpreter.get_simple_event_loop().print_stats(stderr);
+        }
+        if (dispatch_stats) {
+            interpreter.print_method_cache_stats(stderr);
+        }
 
         // 正常終了：デストラクタをスキップして即座に終了
         // （メモリはOSが自動的に回収し、tagged pointer値の誤解放を回避）
@@ -337,6 +337,7 @@ ASTNode *DeclarationParser::parseFunctionDeclarationAfterName(
             param->pointer_base_type_name = param_parsed.base_type;
             param->pointer_base_type = param_parsed.base_type_info;
             param->is_reference = param_parsed.is_reference;
+            param->is_rvalue_reference = param_parsed.is_rvalue_reference;
             param->is_unsigned = param_parsed.is_unsigned;
             param->is_const = param_parsed.is_const;
             // ポインタのconst修飾を設定
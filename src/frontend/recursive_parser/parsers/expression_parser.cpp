@@ -127,6 +127,7 @@ ASTNode *ExpressionParser::parseAssignment() {
 
                 ASTNode *binop = new ASTNode(ASTNodeType::AST_BINARY_OP);
                 binop->op = binary_op;
+                binop->op_kind = decode_binary_operator(binary_op);
                 binop->left = std::unique_ptr<ASTNode>(var_ref);
                 binop->right = std::unique_ptr<ASTNode>(right);
 
@@ -169,6 +170,7 @@ ASTNode *ExpressionParser::parseAssignment() {
 
                 ASTNode *binop = new ASTNode(ASTNodeType::AST_BINARY_OP);
                 binop->op = binary_op;
+                binop->op_kind = decode_binary_operator(binary_op);
                 binop->left = std::unique_ptr<ASTNode>(array_ref_copy);
                 binop->right = std::unique_ptr<ASTNode>(right);
 
@@ -187,6 +189,7 @@ ASTNode *ExpressionParser::parseAssignment() {
 
                 ASTNode *binop = new ASTNode(ASTNodeType::AST_BINARY_OP);
                 binop->op = binary_op;
+                binop->op_kind = decode_binary_operator(binary_op);
                 binop->left = std::unique_ptr<ASTNode>(left_copy);
                 binop->right = std::unique_ptr<ASTNode>(right);
 
@@ -204,6 +207,7 @@ ASTNode *ExpressionParser::parseAssignment() {
 
                 ASTNode *binop = new ASTNode(ASTNodeType::AST_BINARY_OP);
                 binop->op = binary_op;
+                binop->op_kind = decode_binary_operator(binary_op);
                 binop->left = std::unique_ptr<ASTNode>(left_copy);
                 binop->right = std::unique_ptr<ASTNode>(right);
 
@@ -265,6 +269,7 @@ ASTNode *ExpressionParser::parseLogicalOr() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -289,6 +294,7 @@ ASTNode *ExpressionParser::parseLogicalAnd() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -315,6 +321,7 @@ ASTNode *ExpressionParser::parseBitwiseOr() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -337,6 +344,7 @@ ASTNode *ExpressionParser::parseBitwiseXor() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -361,6 +369,7 @@ ASTNode *ExpressionParser::parseBitwiseAnd() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -396,6 +405,7 @@ ASTNode *ExpressionParser::parseComparison() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         if (parser_->debug_mode_) {
             std::fprintf(stderr,
                          "[EXPR_DEBUG] comparison op=%s left=%p right=%p\n",
@@ -434,6 +444,7 @@ ASTNode *ExpressionParser::parseShift() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -466,6 +477,7 @@ ASTNode *ExpressionParser::parseAdditive() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -499,6 +511,7 @@ ASTNode *ExpressionParser::parseMultiplicative() {
 
         ASTNode *binary = new ASTNode(ASTNodeType::AST_BINARY_OP);
         binary->op = op.value;
+        binary->op_kind = decode_binary_operator(op.value);
         binary->left = std::unique_ptr<ASTNode>(left);
         binary->right = std::unique_ptr<ASTNode>(right);
 
@@ -532,6 +545,7 @@ ASTNode *ExpressionParser::parseUnary() {
 
         ASTNode *await_node = new ASTNode(ASTNodeType::AST_UNARY_OP);
         await_node->op = "await";
+        await_node->op_kind = OperatorKind::AWAIT;
         await_node->is_await_expression = true;
         await_node->left = std::unique_ptr<ASTNode>(operand);
 
@@ -569,6 +583,7 @@ ASTNode *ExpressionParser::parseUnary() {
         // & はアドレス演算子、* は間接参照演算子として扱う
         if (op.type == TokenType::TOK_BIT_AND) {
             unary->op = "ADDRESS_OF"; // アドレス演算子
+            unary->op_kind = OperatorKind::ADDRESS_OF;
 
             // operandから識別子名を取得して is_function_address フラグを設定
             // インタプリタ側で関数か変数かを判断する
@@ -588,8 +603,10 @@ ASTNode *ExpressionParser::parseUnary() {
             }
         } else if (op.type == TokenType::TOK_MUL) {
             unary->op = "DEREFERENCE"; // 間接参照演算子
+            unary->op_kind = OperatorKind::DEREFERENCE;
         } else {
             unary->op = op.value;
+            unary->op_kind = decode_unary_operator(op.value);
         }
         unary->left = std::unique_ptr<ASTNode>(operand);
 
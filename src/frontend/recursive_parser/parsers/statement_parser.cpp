@@ -1390,6 +1390,7 @@ ASTNode *StatementParser::parseArrayDeclaration(
 
                     ASTNode *add_expr = new ASTNode(ASTNodeType::AST_BINARY_OP);
                     add_expr->op = "+";
+                    add_expr->op_kind = OperatorKind::ADD;
 
                     ASTNode *var_node = new ASTNode(ASTNodeType::AST_VARIABLE);
                     var_node->name = var_name_str;
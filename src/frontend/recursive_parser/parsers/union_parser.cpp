@@ -204,7 +204,7 @@ bool UnionParser::parseUnionValue(UnionDefinition &union_def) {
             parser_->typedef_map_.end()) {
             // This is a typedef - add as custom type
             union_def.add_allowed_custom_type(type_name);
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(dbg_buf, sizeof(dbg_buf),
                          "UNION_PARSE_DEBUG: Added typedef custom type '%s' to "
@@ -219,7 +219,7 @@ bool UnionParser::parseUnionValue(UnionDefinition &union_def) {
             parser_->struct_definitions_.end()) {
             // This is a struct - add as custom type
             union_def.add_allowed_custom_type(type_name);
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -234,7 +234,7 @@ bool UnionParser::parseUnionValue(UnionDefinition &union_def) {
             parser_->enum_definitions_.end()) {
             // This is an enum - add as custom type
             union_def.add_allowed_custom_type(type_name);
-            {
+            if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
                 char dbg_buf[512];
                 snprintf(
                     dbg_buf, sizeof(dbg_buf),
@@ -247,7 +247,7 @@ bool UnionParser::parseUnionValue(UnionDefinition &union_def) {
 
         // Unknown custom type - still add it (might be defined later)
         union_def.add_allowed_custom_type(type_name);
-        {
+        if (CB_TRACE_MSG_ENABLED(DebugMsgId::GENERIC_DEBUG)) {
             char dbg_buf[512];
             snprintf(
                 dbg_buf, sizeof(dbg_buf),
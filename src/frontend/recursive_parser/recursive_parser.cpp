@@ -238,6 +238,7 @@ ASTNode *RecursiveParser::cloneAstNode(const ASTNode *node) {
     clone->original_type_name = node->original_type_name;
     clone->return_type_name = node->return_type_name;
     clone->op = node->op;
+    clone->op_kind = node->op_kind;
     clone->module_name = node->module_name;
     clone->import_items = node->import_items;
     clone->is_exported = node->is_exported;
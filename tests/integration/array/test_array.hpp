@@ -7,6 +7,7 @@ inline void test_integration_array() {
     const std::string test_file_assign = "../../tests/cases/array/assign.cb";
     const std::string test_file_boundary = "../../tests/cases/array/boundary.cb";
     const std::string test_file_literal = "../../tests/cases/array/literal.cb";
+    const std::string test_file_packed = "../../tests/cases/array/packed_storage.cb";
     
     // 基本的な配列テスト
     double execution_time_basic;
@@ -60,4 +61,22 @@ inline void test_integration_array() {
             INTEGRATION_ASSERT_EQ(0, exit_code, "Expected successful exit code for array literal test");
         }, execution_time_literal);
     integration_test_passed_with_time("array literal test", test_file_literal, execution_time_literal);
+    
+    // 要素幅での格納テスト (with timing)
+    double execution_time_packed;
+    run_cb_test_with_output_and_time(test_file_packed, 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Expected successful exit code for packed storage test");
+            INTEGRATION_ASSERT_CONTAINS(output, "tiny: 127 -128 25 31 39", "Expected tiny boundary values and compound updates");
+            INTEGRATION_ASSERT_CONTAINS(output, "tiny sum: 274", "Expected tiny array passed to function");
+            INTEGRATION_ASSERT_CONTAINS(output, "short: 32767 -32768", "Expected short boundary values");
+            INTEGRATION_ASSERT_CONTAINS(output, "int: 2147483647 -2147483648 7", "Expected int boundary values");
+            INTEGRATION_ASSERT_CONTAINS(output, "bool: 1 0 1", "Expected bool values");
+            INTEGRATION_ASSERT_CONTAINS(output, "char: Cb!", "Expected char values");
+            INTEGRATION_ASSERT_CONTAINS(output, "long: 5000000000 -5000000000", "Expected long values");
+            INTEGRATION_ASSERT_CONTAINS(output, "pointer: 99 99", "Expected pointer arithmetic over packed elements");
+            INTEGRATION_ASSERT_CONTAINS(output, "tiny pointer: -128 77 -1", "Expected pointers into a tiny array to stay valid");
+            INTEGRATION_ASSERT_CONTAINS(output, "Packed storage test passed", "Expected success message in output");
+        }, execution_time_packed);
+    integration_test_passed_with_time("array packed storage test", test_file_packed, execution_time_packed);
 }
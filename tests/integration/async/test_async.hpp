@@ -852,5 +852,268 @@ void test_integration_async() {
         }, execution_time);
     integration_test_passed_with_time("v0.13.2 async function type edge cases", "test_async_function_type_edge_cases.cb", execution_time);
 
-    std::cout << "[integration-test] Async/await tests completed (60 tests)" << std::endl;
+    // Test 61: Synchronous blocks mixed with yielding tasks
+    run_cb_test_with_output_and_time("../cases/async/test_sync_fast_path.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_sync_fast_path.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "sync: -1 1 2", "Early returns from nested blocks should work");
+            INTEGRATION_ASSERT_CONTAINS(output, "sync sum: 45", "Break inside a loop body should work");
+            INTEGRATION_ASSERT_CONTAINS(output, "worker 1: classify=1", "Task should resume after yield");
+            INTEGRATION_ASSERT_CONTAINS(output, "worker 2: classify=2", "Task should resume after yield");
+            INTEGRATION_ASSERT_CONTAINS(output, "worker 1: end", "Task should run to completion");
+            INTEGRATION_ASSERT_CONTAINS(output, "worker 2: end", "Task should run to completion");
+            INTEGRATION_ASSERT_CONTAINS(output, "main local: 4", "Main loop should not be affected by tasks");
+            INTEGRATION_ASSERT_CONTAINS(output, "sync after tasks: 2 6", "Sync code after await should work");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 sync blocks mixed with yielding tasks", "test_sync_fast_path.cb", execution_time);
+
+    // Test 62: Task frames persist across yields
+    run_cb_test_with_output_and_time("../cases/async/test_task_frame_persistence.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_task_frame_persistence.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "pointer: x=7", "Pointer to a task local should stay valid across yields");
+            INTEGRATION_ASSERT_CONTAINS(output, "array 1: 1 10", "Task local array should persist across yields");
+            INTEGRATION_ASSERT_CONTAINS(output, "array 2: 2 20", "Each task should own its frame");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 task frames persist across yields", "test_task_frame_persistence.cb", execution_time);
+
+    // Test 63: Idle wait while every task sleeps
+    run_cb_test_with_output_and_time("../cases/async/test_sleep_idle_wait.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_sleep_idle_wait.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "woke: 1", "First sleeper should wake");
+            INTEGRATION_ASSERT_CONTAINS(output, "woke: 2", "Second sleeper should wake");
+            INTEGRATION_ASSERT_CONTAINS(output, "results: 10 20", "Sleepers should return their values");
+            INTEGRATION_ASSERT_CONTAINS(output, "elapsed ok", "Sleep should last until the deadline");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 idle wait while every task sleeps", "test_sleep_idle_wait.cb", execution_time);
+
+    // Test 64: Awaiting tasks resume after the awaited task completes
+    run_cb_test_with_output_and_time("../cases/async/test_await_waiters.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_await_waiters.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "tick 2", "Background task should keep running");
+            INTEGRATION_ASSERT_CONTAINS(output, "middle 1 resumed: 1", "First awaiting task should resume");
+            INTEGRATION_ASSERT_CONTAINS(output, "middle 2 resumed: 2", "Second awaiting task should resume");
+            INTEGRATION_ASSERT_CONTAINS(output, "results: 2 4", "Awaiting tasks should return their values");
+            INTEGRATION_ASSERT_CONTAINS(output, "sum: 1225", "Sequential awaits should all complete");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 awaiting tasks parked on waiter list", "test_await_waiters.cb", execution_time);
+
+    // Test 65: concurrent_await / race
+    run_cb_test_with_output_and_time("../cases/async/test_concurrent_await.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_concurrent_await.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "results: 10 20 30", "concurrent_await should return results in argument order");
+            INTEGRATION_ASSERT_CONTAINS(output, "concurrent ok", "Sleeps should overlap");
+            INTEGRATION_ASSERT_CONTAINS(output, "await after concurrent_await: 20", "Futures should stay readable after concurrent_await");
+            INTEGRATION_ASSERT_CONTAINS(output, "labels: alpha beta", "String results should be returned in order");
+            INTEGRATION_ASSERT_CONTAINS(output, "race: 50", "race should return the first completion");
+            INTEGRATION_ASSERT_CONTAINS(output, "race ok", "race should not wait for the slow future");
+            INTEGRATION_ASSERT_CONTAINS(output, "spinner cancelled", "Losing task should stop running");
+            INTEGRATION_ASSERT_CONTAINS(output, "winner2: 9 cancelled value: 0", "Awaiting loser should be cancelled");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "should not continue", "Cancelled task should not resume");
+            INTEGRATION_ASSERT_CONTAINS(output, "short-circuit ok", "First Err should cancel the remaining tasks");
+            INTEGRATION_ASSERT_CONTAINS(output, "j2 err: job failed", "Failed future should keep its Err value");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 concurrent_await and race", "test_concurrent_await.cb", execution_time);
+
+    // Test 66: 完了したタスクのスロット再利用
+    run_cb_test_with_output_and_time("../cases/async/test_task_recycling.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_task_recycling.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "reawait: 10 20 10", "Re-awaiting a consumed future should return its own value");
+            INTEGRATION_ASSERT_CONTAINS(output, "labels: task-7 task-7", "String results should survive re-await");
+            INTEGRATION_ASSERT_CONTAINS(output, "sequential sum: 448500", "Sequential awaits should reuse task slots correctly");
+            INTEGRATION_ASSERT_CONTAINS(output, "detached total: 19900 last: 30", "Detached tasks should run to completion");
+            INTEGRATION_ASSERT_CONTAINS(output, "method: 9", "Async methods should see self after it moves into the task scope");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 task slot recycling", "test_task_recycling.cb", execution_time);
+
+    // Test 67: タイムスライス（量子）によるタスク切り替え
+    run_cb_test_with_output_and_time("../cases/async/test_time_slice.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_time_slice.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "default: a0 a1 b0 a2 b1 b2", "The default quantum should switch tasks every iteration");
+            INTEGRATION_ASSERT_CONTAINS(output, "previous quantum: 0", "set_async_quantum should return the previous setting");
+            INTEGRATION_ASSERT_CONTAINS(output, "global quantum: c0 c1 c2 d0 d1 d2", "A large global quantum should run each loop without switching");
+            INTEGRATION_ASSERT_CONTAINS(output, "task quantum: e0 e1 e2 f0 f1 f2", "A per-task quantum should apply from the next step");
+            INTEGRATION_ASSERT_CONTAINS(output, "time slice: g0 g1 g2 h0 h1 h2", "A time slice alone should not cut steps by statement count");
+            INTEGRATION_ASSERT_CONTAINS(output, "sums: 3 3 3 3 3 3 3 3", "Every task should complete with its result");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 time slice scheduling", "test_time_slice.cb", execution_time);
+
+    // Test 68: タスクの優先度・デッドラインとネイティブ優先度キュー
+    run_cb_test_with_output_and_time("../cases/async/test_task_priority.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_task_priority.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "priority: l0 h0 h1 h2 n0 n1 l1 n2 l2", "Higher priority tasks should run first");
+            INTEGRATION_ASSERT_CONTAINS(output, "aging: s0 b0 b1 b2 b3 b4 b5 b6 b7 s1 b8 b9 b10 b11 s2", "Aging should let a low priority task run while a higher one is busy");
+            INTEGRATION_ASSERT_CONTAINS(output, "deadline: p0 q0 q1 d0 q2 d1 p1 d2 p2", "An overdue task should run at the highest waiting priority");
+            INTEGRATION_ASSERT_CONTAINS(output, "full: 0 size: 3", "priority_queue_push should return false on a full queue");
+            INTEGRATION_ASSERT_CONTAINS(output, "popped: 0 50 51", "priority_queue_pop should return values in priority then FIFO order");
+            INTEGRATION_ASSERT_CONTAINS(output, "unbounded: 1 199 0", "A queue created with capacity 0 should not fill up");
+            INTEGRATION_ASSERT_CONTAINS(output, "sums: 3 3 3 12 12 3 3 3", "Every task should complete with its result");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 task priority scheduling", "test_task_priority.cb", execution_time);
+
+    // Test 69: Channel<T>（容量固定のチャネル）
+    run_cb_test_with_output_and_time("../cases/async/test_channel.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_channel.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "points: 110", "Struct values should pass between tasks with backpressure");
+            INTEGRATION_ASSERT_CONTAINS(output, "merged: 520", "A for loop recv should receive from several senders");
+            INTEGRATION_ASSERT_CONTAINS(output, "letters: abc", "main should receive while running the sending task");
+            INTEGRATION_ASSERT_CONTAINS(output, "backpressure: 15 len 0", "main send should wait until the value is received");
+            INTEGRATION_ASSERT_CONTAINS(output, "drained: 10", "Several receivers should share the values");
+            INTEGRATION_ASSERT_CONTAINS(output, "race: -1 len 1 value 42", "A cancelled receiver should not take a value");
+            INTEGRATION_ASSERT_CONTAINS(output, "closed: 1 2 0", "Buffered values should be receivable after close");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 channels", "test_channel.cb", execution_time);
+
+    // Test 70: 受信待ちで再実行される文の副作用
+    run_cb_test_with_output_and_time("../cases/async/test_channel_retry.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_channel_retry.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "split: 105 bumps 1", "Side effects before a recv statement should run once");
+            INTEGRATION_ASSERT_CONTAINS(output, "helper: 105 bumps 2", "A recv in a called function without earlier side effects should be allowed");
+            INTEGRATION_ASSERT_CONTAINS(output, "block: 5", "A recv in a block under a side-effect-free condition should be allowed");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 channel recv retry", "test_channel_retry.cb", execution_time);
+
+    // Test 71: 受信待ちの文に他の副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_channel_retry_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_channel_retry_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "A recv mixed with other calls should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "mixed:", "The task should not finish with a doubled side effect");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 channel recv retry error", "test_channel_retry_error.cb", execution_time);
+
+    // Test 72: 構造体引数が呼び出し元の同名変数に隠されない
+    run_cb_test_with_output_and_time("../cases/async/test_async_struct_param_shadow.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_async_struct_param_shadow.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "point: 30", "A struct parameter should not read the caller's same-named variable");
+            INTEGRATION_ASSERT_CONTAINS(output, "line: 45", "Nested struct members of a parameter should be the argument's");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 async struct parameter members", "test_async_struct_param_shadow.cb", execution_time);
+
+    // Test 73: タスク内のFuture変数のawaitは待機先のwaitersに停止する
+    run_cb_test_with_output_and_time("../cases/async/test_await_park.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_await_park.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "fan_in: 60", "A task should await futures in a loop");
+            INTEGRATION_ASSERT_CONTAINS(output, "chain: 70", "A task should receive the awaited value after resuming");
+            INTEGRATION_ASSERT_CONTAINS(output, "bumps: 4", "Statements before the await should not run again");
+            INTEGRATION_ASSERT_CONTAINS(output, "depth: 3000", "A deep chain of awaiting tasks should not nest on the C++ stack");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 parked await", "test_await_park.cb", execution_time);
+
+    // Test 74: 停止したタスクの待機先が終わらなければデッドロック
+    run_cb_test_with_output_and_time("../cases/async/test_await_park_deadlock.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_await_park_deadlock.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "await deadlock: the awaited task is waiting for a task that cannot finish", "main should report a task parked on a blocked await");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "relayed:", "main should not continue with a default value");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 parked await deadlock", "test_await_park_deadlock.cb", execution_time);
+
+#ifdef __linux__
+    // 非同期I/OはepollのあるLinuxでのみ使える
+    // Test 75: 非同期I/O（パイプ・UNIXドメインソケット・ループバックTCP）
+    run_cb_test_with_output_and_time("../cases/async/test_async_io.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_async_io.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "pipe: one\npipe: two\nchunks: 2", "A pipe reader should wait for each write and stop at EOF");
+            INTEGRATION_ASSERT_CONTAINS(output, "tcp: echo:ping ping", "A loopback TCP server task should accept and reply");
+            INTEGRATION_ASSERT_CONTAINS(output, "unix: echo:hello", "main should wait for a UNIX socket reply");
+            INTEGRATION_ASSERT_CONTAINS(output, "socketpair: L R", "A socketpair should be bidirectional");
+            INTEGRATION_ASSERT_CONTAINS(output, "waiter 2: b\nwaiter 1: a\nwaiters: 3", "Parked readers should resume in the order their fds become ready");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 async I/O", "test_async_io.cb", execution_time);
+
+    // Test 76: タスク内のtcp_connect/unix_connect（非ブロッキングの接続待ち）
+    run_cb_test_with_output_and_time("../cases/async/test_async_io_connect.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_async_io_connect.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "tcp: echo:tcp tcp", "A task should connect over TCP while the server task accepts");
+            INTEGRATION_ASSERT_CONTAINS(output, "unix: echo:unix bumps 1", "A task should connect over a UNIX socket without repeating earlier statements");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 async connect", "test_async_io_connect.cb", execution_time);
+
+    // Test 77: I/O待ちの文に他の副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_async_io_retry_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_async_io_retry_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "A read mixed with other calls should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "mixed:", "The task should not finish with a doubled side effect");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 async I/O retry error", "test_async_io_retry_error.cb", execution_time);
+#endif
+
+    // Test 78: TaskQueueの容量指定（満杯ならtask_queue_pushがfalse）
+    run_cb_test_with_output_and_time("../cases/async/test_task_queue_capacity.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_task_queue_capacity.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "bounded push: 1 1 0", "task_queue_push should return false on a full queue");
+            INTEGRATION_ASSERT_CONTAINS(output, "bounded pop: 2 1 4 push after pop: 1", "A popped slot should be reusable");
+            INTEGRATION_ASSERT_CONTAINS(output, "empty pop: -1", "task_queue_pop should return the empty task on an empty queue");
+            INTEGRATION_ASSERT_CONTAINS(output, "unbounded push: 1 top: 0 0", "task_queue_init should create an unbounded queue");
+            INTEGRATION_ASSERT_CONTAINS(output, "done", "Should complete test");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 task queue capacity", "test_task_queue_capacity.cb", execution_time);
+
+    // Test 79: 呼び出した関数の中の受信待ちの前に副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_channel_retry_helper_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_channel_retry_helper_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "A side effect before a recv in a called function should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "helper:", "The task should not finish with a doubled counter");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 channel recv retry in helper", "test_channel_retry_helper_error.cb", execution_time);
+
+    // Test 80: 受信待ちを囲む条件式に副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_channel_retry_condition_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_channel_retry_condition_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "A side effect in an enclosing condition should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "condition:", "The task should not finish with a doubled side effect");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 channel recv retry under condition", "test_channel_retry_condition_error.cb", execution_time);
+
+#ifdef __linux__
+    // Test 81: 呼び出した関数の中のI/O待ちの前に副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_async_io_retry_helper_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_async_io_retry_helper_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "A side effect before a read in a called function should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "helper:", "The task should not finish with a doubled counter");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 async I/O retry in helper", "test_async_io_retry_helper_error.cb", execution_time);
+#endif
+
+    // Test 82: Future変数のawaitと同じ文に他の副作用があるとエラー
+    run_cb_test_with_output_and_time("../cases/async/test_await_park_mixed_error.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "test_await_park_mixed_error.cb should fail");
+            INTEGRATION_ASSERT_CONTAINS(output, "is re-run when the task resumes", "An await mixed with other calls should be rejected");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "mixed:", "The task should not finish with a doubled side effect");
+        }, execution_time);
+    integration_test_passed_with_time("v0.14.0 parked await retry error", "test_await_park_mixed_error.cb", execution_time);
+
+    std::cout << "[integration-test] Async/await tests completed" << std::endl;
 }
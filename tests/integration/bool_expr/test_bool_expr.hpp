@@ -20,6 +20,28 @@ inline void test_bool_expr_basic() {
             INTEGRATION_ASSERT_CONTAINS(output, "Boolean expression test passed", "Expected success message in output");
         }, execution_time);
     integration_test_passed_with_time("bool_expr basic test", "basic.cb", execution_time);
+
+    // v0.14.0: int/double/string同士の比較高速パスと混在時のtyped評価
+    run_cb_test_with_output_and_time("../../tests/cases/bool_expr/typed_compare.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "typed_compare.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "int < long: 1", "Expected int/long comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "tiny > int: 1", "Expected tiny/int comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "less_int: 1 0", "Expected repeated int comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "count_below: 8", "Expected arithmetic operand comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "long overflow: 0 1", "Expected wrapped add in comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "mul overflow: 1", "Expected wrapped mul in comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "float == double: 1", "Expected float/double comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "less_double: 1 0", "Expected repeated double comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "string < string: 1", "Expected string ordering");
+            INTEGRATION_ASSERT_CONTAINS(output, "string != literal: 0", "Expected string literal comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "same_string: 1 0", "Expected repeated string comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "int < double: 1", "Expected mixed int/double comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "double > int: 1", "Expected mixed double/int comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "pointer != nullptr: 1", "Expected pointer comparison");
+            INTEGRATION_ASSERT_CONTAINS(output, "Typed compare test passed", "Expected success message in output");
+        }, execution_time);
+    integration_test_passed_with_time("bool_expr typed compare test", "typed_compare.cb", execution_time);
     
     std::cout << "[integration-test] Bool expr tests completed" << std::endl;
 }
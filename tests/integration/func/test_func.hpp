@@ -11,6 +11,7 @@ inline void test_integration_func() {
     const std::string test_file_type_safety_error1 = "../../tests/cases/func/array_type_safety_error1.cb";
     const std::string test_file_type_safety_error2 = "../../tests/cases/func/array_type_safety_error2.cb";
     const std::string test_file_function_call_count = "../../tests/cases/func/function_call_count.cb";
+    const std::string test_file_parameter_binding = "../../tests/cases/func/parameter_binding.cb";
     
     // 基本的な関数テスト (with timing)
     double execution_time_basic;
@@ -96,4 +97,19 @@ inline void test_integration_func() {
             INTEGRATION_ASSERT_CONTAINS(output, "✓ Test 2 passed: Function in compound assignment called exactly once", "Should show test 2 success");
         });
     integration_test_passed_with_time_auto("func function call count test", test_file_function_call_count);
+    
+    // 引数の束縛テスト（呼び出しレイアウト）
+    run_cb_test_with_output_and_time_auto(test_file_parameter_binding, 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Expected successful exit code for parameter binding test");
+            INTEGRATION_ASSERT_CONTAINS(output, "fib: 610", "Recursive calls should bind their own parameters");
+            INTEGRATION_ASSERT_CONTAINS(output, "mix: 2.500000", "Mixed numeric parameters should be converted");
+            INTEGRATION_ASSERT_CONTAINS(output, "clamp_add: 1", "Negative value should be clamped for unsigned parameter");
+            INTEGRATION_ASSERT_CONTAINS(output, "defaults: 13 11", "Default arguments should be bound");
+            INTEGRATION_ASSERT_CONTAINS(output, "narrow: 100", "tiny parameter should keep its value");
+            INTEGRATION_ASSERT_CONTAINS(output, "by_value: 21 42", "Value parameters should not alias the caller");
+            INTEGRATION_ASSERT_CONTAINS(output, "loop: 5250", "Repeated calls should bind parameters each time");
+            INTEGRATION_ASSERT_CONTAINS(output, "Parameter binding test passed!", "Should show success message");
+        });
+    integration_test_passed_with_time_auto("func parameter binding test", test_file_parameter_binding);
 }
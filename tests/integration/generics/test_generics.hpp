@@ -410,7 +410,30 @@ void run_all_generics_tests() {
         }, execution_time);
     integration_test_passed_with_time("Generic Functions with Arrays", "test_generic_functions_with_arrays.cb", execution_time);
     
-    std::cout << "[integration-test] Generics tests completed (27 tests)" << std::endl;
+    // Test 28: Generic Function Instantiation Cache
+    run_cb_test_with_output_and_time("../../tests/cases/generics/function_instantiation_cache.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "function_instantiation_cache.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "sum_to: 55 210", "Recursive calls should share one instance");
+            INTEGRATION_ASSERT_CONTAINS(output, "quadruple: 0 4 8 12 ", "Nested generic calls should keep locals separate");
+            INTEGRATION_ASSERT_CONTAINS(output, "repeated: 999000", "Repeated calls should reuse the cached instance");
+            INTEGRATION_ASSERT_CONTAINS(output, "Instantiation cache test passed!", "Should pass all tests");
+        }, execution_time);
+    integration_test_passed_with_time("Generic Function Instantiation Cache", "function_instantiation_cache.cb", execution_time);
+    
+    // Test 29: Generic Impl Instance Cache
+    run_cb_test_with_output_and_time("../../tests/cases/generics/impl_instance_cache.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "impl_instance_cache.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "int box: 4950", "Repeated calls should use the indexed instance");
+            INTEGRATION_ASSERT_CONTAINS(output, "string box: xyyy", "Each type argument should get its own instance");
+            INTEGRATION_ASSERT_CONTAINS(output, "long box: 7 int box: 4950", "Instances should stay independent");
+            INTEGRATION_ASSERT_CONTAINS(output, "labeled: 5 tag", "Bounded type arguments should be accepted");
+            INTEGRATION_ASSERT_CONTAINS(output, "Impl instance cache test passed!", "Should pass all tests");
+        }, execution_time);
+    integration_test_passed_with_time("Generic Impl Instance Cache", "impl_instance_cache.cb", execution_time);
+    
+    std::cout << "[integration-test] Generics tests completed (29 tests)" << std::endl;
 }
 
 } // namespace GenericsTests
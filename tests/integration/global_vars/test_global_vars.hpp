@@ -34,5 +34,16 @@ inline void test_integration_global_vars() {
         });
     integration_test_passed_with_error_and_time_auto("global vars redeclare test", "redeclare.cb");
     
+    // v0.14.0: スロット解決された変数と動的スコープの混在
+    run_cb_test_with_output_and_time_auto("../../tests/cases/global_vars/slot_resolution.cb", 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "slot_resolution.cb should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "counter: 10", "Expected global updated through slots");
+            INTEGRATION_ASSERT_CONTAINS(output, "read_shared: 100", "Expected global value without shadowing");
+            INTEGRATION_ASSERT_CONTAINS(output, "shadow: 7", "Expected caller local to shadow global");
+            INTEGRATION_ASSERT_CONTAINS(output, "fib: 610", "Expected recursive locals to stay per frame");
+        });
+    integration_test_passed_with_time_auto("global vars slot resolution test", "slot_resolution.cb");
+    
     std::cout << "[integration-test] Global vars tests completed" << std::endl;
 }
@@ -432,6 +432,49 @@ inline void test_self_pointer_comprehensive() {
         }, execution_time);
 }
 
+// v0.14.0: メソッド呼び出し箇所のインラインキャッシュ（--dispatch-stats）
+inline void test_method_inline_cache() {
+    std::cout << "[integration-test] Running test_method_inline_cache..." << std::endl;
+    
+    double execution_time;
+    run_cb_test_with_output_and_time("--dispatch-stats ../../tests/cases/interface/method_inline_cache.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Method inline cache test should exit with code 0");
+            INTEGRATION_ASSERT_CONTAINS(output, "mono: 450",
+                "Monomorphic call site should call Square::area");
+            INTEGRATION_ASSERT_CONTAINS(output, "poly: 1980",
+                "Polymorphic call site should dispatch on the receiver type");
+            INTEGRATION_ASSERT_CONTAINS(output, "mega: 786",
+                "Megamorphic call site should fall back to full resolution");
+            INTEGRATION_ASSERT_CONTAINS(output, "[dispatch-stats] vtable_calls=70 method_calls=50 hits=49 misses=1",
+                "Interface receivers should dispatch through the vtable and struct receivers through the cache");
+            INTEGRATION_ASSERT_CONTAINS(output, "invalidations=0",
+                "Should report cache invalidations");
+            INTEGRATION_ASSERT_CONTAINS(output, "Method inline cache test passed!",
+                "Should contain success message");
+        }, execution_time);
+}
+
+inline void test_interface_vtable() {
+    std::cout << "[integration-test] Running test_interface_vtable..." << std::endl;
+    
+    double execution_time;
+    run_cb_test_with_output_and_time("--dispatch-stats ../../tests/cases/interface/interface_vtable.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Interface vtable test should exit with code 0");
+            INTEGRATION_ASSERT_CONTAINS(output, "total: 6872",
+                "Vtable slots should follow the interface order, not the impl order");
+            INTEGRATION_ASSERT_CONTAINS(output, "reassign: 4 -> 2",
+                "Reassigning an interface value should switch its vtable");
+            INTEGRATION_ASSERT_CONTAINS(output, "named: 3",
+                "A struct should have a separate vtable per interface");
+            INTEGRATION_ASSERT_CONTAINS(output, "[dispatch-stats] vtable_calls=75 method_calls=0",
+                "Interface method calls should dispatch through the vtable");
+            INTEGRATION_ASSERT_CONTAINS(output, "Interface vtable test passed!",
+                "Should contain success message");
+        }, execution_time);
+}
+
 // 全てのinterfaceテストを実行する統合関数
 inline void run_all_interface_tests() {
     std::cout << "[integration-test] === Interface/Impl System Tests ===" << std::endl;
@@ -455,6 +498,8 @@ inline void run_all_interface_tests() {
     test_self_member_arrow_field();
     test_self_pointer_simple();
     test_self_pointer_comprehensive();
+    test_method_inline_cache();
+    test_interface_vtable();
     
     std::cout << "[integration-test] Interface tests completed" << std::endl;
 }
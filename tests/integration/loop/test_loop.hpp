@@ -34,10 +34,28 @@ void test_while_loop_continue() {
     integration_test_passed_with_time("test_while_loop_continue", "while_continue.cb", execution_time);
 }
 
+void test_return_in_loop() {
+    double execution_time;
+    run_cb_test_with_output_and_time("../../tests/cases/loop/return_in_loop.cb", 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Return in loop test should execute successfully");
+            INTEGRATION_ASSERT_CONTAINS(output, "find_first_multiple: 7", "Should return from inside for loop");
+            INTEGRATION_ASSERT_CONTAINS(output, "not_found: -1", "Should fall through after loop");
+            INTEGRATION_ASSERT_CONTAINS(output, "nested_search: 407", "Should return from nested while loops");
+            INTEGRATION_ASSERT_CONTAINS(output, "sum_odd: 64", "Should handle continue and break");
+            INTEGRATION_ASSERT_CONTAINS(output, "total: 15", "Caller loop should not be affected by callee return");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "early_exit: 2", "Void return should leave the loop");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "unreachable", "Void return should leave the function");
+            INTEGRATION_ASSERT_CONTAINS(output, "Loop completed", "Should complete main");
+        }, execution_time);
+    integration_test_passed_with_time("test_return_in_loop", "return_in_loop.cb", execution_time);
+}
+
 inline void test_integration_loop() {
     std::cout << "[integration-test] Running loop tests..." << std::endl;
     test_break_continue();
     test_nested_loop_break();
     test_while_loop_continue();
+    test_return_in_loop();
     std::cout << "[integration-test] Loop tests completed" << std::endl;
 }
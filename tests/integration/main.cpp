@@ -106,6 +106,7 @@
 #include "typedef/typedef_struct_tests.hpp"
 #include "union/test_union.hpp"
 #include "unsigned/test_unsigned.hpp"
+#include "vm/test_vm.hpp"
 
 // 失敗継続対応のテスト実行関数（マクロをリファクタリング）
 void run_test_with_continue(void (*test_function)(), const char *test_name,
@@ -439,6 +440,8 @@ int main() {
     CategoryTimingStats::set_current_category("Performance Tests");
     run_test_with_continue(test_integration_performance, "Performance Tests",
                            failed_tests);
+    run_test_with_continue(test_integration_vm, "Bytecode VM Tests (v0.14.0)",
+                           failed_tests);
     CategoryTimingStats::print_category_summary("Performance Tests");
 
     // サンプルシナリオテスト群
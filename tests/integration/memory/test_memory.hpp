@@ -187,6 +187,23 @@ inline void test_integration_memory() {
         }, execution_time_memcpy_basic);
     integration_test_passed_with_time("memcpy basic operations", "test_memcpy_basic.cb", execution_time_memcpy_basic);
     
+    // Test 5-2: 格納幅の異なる整数配列間のmemcpy
+    double execution_time_memcpy_packed;
+    run_cb_test_with_output_and_time("../../tests/cases/memory/test_memcpy_packed.cb", 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "test_memcpy_packed.cb should execute successfully");
+            
+            INTEGRATION_ASSERT_CONTAINS(output, "wide: 1 2 3 4", 
+                "int[] should be copied into long[]");
+            INTEGRATION_ASSERT_CONTAINS(output, "narrow: 10 99 30 40", 
+                "long[] should be copied into int[]");
+            INTEGRATION_ASSERT_CONTAINS(output, "right: 0 6 7 0", 
+                "Element addresses should be copied");
+            INTEGRATION_ASSERT_CONTAINS(output, "All packed memcpy tests passed!", 
+                "All packed memcpy tests should complete");
+        }, execution_time_memcpy_packed);
+    integration_test_passed_with_time("memcpy between int[] and long[]", "test_memcpy_packed.cb", execution_time_memcpy_packed);
+    
     // Test 6: 配列アクセス関数
     double execution_time_array_access;
     run_cb_test_with_output_and_time("../../tests/cases/memory/test_array_access.cb", 
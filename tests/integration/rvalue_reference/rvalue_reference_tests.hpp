@@ -126,6 +126,26 @@ inline void test_aliasing_known_issue() {
     integration_test_passed_with_time("T&& aliasing", "aliasing.cb", execution_time);
 }
 
+inline void test_function_parameter() {
+    double execution_time = 0.0;
+    run_cb_test_with_output_and_time(
+        "../../tests/cases/rvalue_reference/function_parameter.cb",
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Should execute without crash");
+            
+            // v0.14.0: T&& parameters bind to the caller's variable
+            INTEGRATION_ASSERT_CONTAINS(output, "After scale: p1.x = 30", 
+                "p1.x should be modified through the T&& parameter");
+            INTEGRATION_ASSERT_CONTAINS(output, "After scale: p1.y = 40", 
+                "p1.y should be modified through the T&& parameter");
+            INTEGRATION_ASSERT_CONTAINS(output, "sum = 70", 
+                "T&& parameter should read the caller's members");
+        },
+        execution_time
+    );
+    integration_test_passed_with_time("T&& function parameter", "function_parameter.cb", execution_time);
+}
+
 // ============================================================================
 // All Rvalue Reference Tests
 // ============================================================================
@@ -144,8 +164,9 @@ inline void run_all_rvalue_reference_tests() {
     test_member_access_known_issue();
     test_member_assignment_known_issue();
     test_aliasing_known_issue();
+    test_function_parameter();
     
-    std::cout << "\n✅ PASS: Rvalue Reference Tests (6 tests)" << std::endl;
+    std::cout << "\n✅ PASS: Rvalue Reference Tests (7 tests)" << std::endl;
     std::cout << "   - All reference semantics now working correctly" << std::endl;
 }
 
@@ -564,6 +564,54 @@ inline void test_nested_member_assignment() {
         }, execution_time);
 }
 
+// v0.14.0: メンバー単位の同期テスト
+inline void test_field_indexed_access() {
+    std::cout << "[integration-test] Running test_field_indexed_access..." << std::endl;
+    
+    double execution_time;
+    run_cb_test_with_output_and_time("../../tests/cases/struct/field_indexed_access.cb", 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Field indexed access test should exit with code 0");
+            INTEGRATION_ASSERT(output.find("id: 1") != std::string::npos, 
+                              "Output should contain id");
+            INTEGRATION_ASSERT(output.find("name: first") != std::string::npos, 
+                              "Output should contain name");
+            INTEGRATION_ASSERT(output.find("copy: 42 200 1") != std::string::npos, 
+                              "Copy should see all member writes");
+            INTEGRATION_ASSERT(output.find("total: 348") != std::string::npos, 
+                              "Struct parameter should see all member writes");
+            INTEGRATION_ASSERT(output.find("bumped: 142 first") != std::string::npos, 
+                              "Returned struct should see all member writes");
+            INTEGRATION_ASSERT(output.find("loop: 465 9") != std::string::npos, 
+                              "Loop reads should see latest member writes");
+            INTEGRATION_ASSERT(output.find("Field indexed access test passed") != std::string::npos, 
+                              "Output should indicate test passed");
+        }, execution_time);
+}
+
+// 構造体配列の要素メンバーアクセステスト
+inline void test_struct_array_indexed_access() {
+    std::cout << "[integration-test] Running test_struct_array_indexed_access..." << std::endl;
+    
+    double execution_time;
+    run_cb_test_with_output_and_time("../../tests/cases/struct/struct_array_indexed_access.cb", 
+        [](const std::string& output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Struct array indexed access test should exit with code 0");
+            INTEGRATION_ASSERT(output.find("total: 40") != std::string::npos, 
+                              "Reads should see member writes");
+            INTEGRATION_ASSERT(output.find("index expr: 100 4") != std::string::npos, 
+                              "Index expressions should address the right element");
+            INTEGRATION_ASSERT(output.find("assigned: 7 8 q") != std::string::npos, 
+                              "Whole element assignment should be visible");
+            INTEGRATION_ASSERT(output.find("global: 4 5 3") != std::string::npos, 
+                              "Global struct arrays should be supported");
+            INTEGRATION_ASSERT(output.find("local: 80 80") != std::string::npos, 
+                              "Local struct arrays should be rebuilt per call");
+            INTEGRATION_ASSERT(output.find("Struct array indexed access test passed") != std::string::npos, 
+                              "Output should indicate test passed");
+        }, execution_time);
+}
+
 // 自己再帰構造体のOKケーステスト
 inline void test_self_recursive_ok() {
     std::cout << "[integration-test] Running test_self_recursive_ok..." << std::endl;
@@ -667,6 +715,8 @@ inline void run_all_struct_tests() {
         test_mixed_type_members();
         test_same_type_multiple_members();
         test_nested_member_assignment(); // ネストメンバ直接代入テスト
+        test_field_indexed_access(); // メンバー単位の同期
+        test_struct_array_indexed_access(); // 構造体配列の要素メンバー
         test_self_recursive_ok(); // 自己再帰構造体（OK）
         test_self_recursive_error(); // 自己再帰構造体（エラー）
         test_typedef_self_recursive_ok(); // typedef自己再帰（OK）
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../framework/integration_test_framework.hpp"
+
+// v0.14.0: --engine=vm（バイトコードVM）のテスト
+// ツリーウォーカーと同じ出力・終了コードになることを確認する
+inline void test_integration_vm() {
+    std::cout << "[integration-test] Running bytecode VM tests..." << std::endl;
+
+    const std::string vm = "--engine=vm ";
+
+    // サブセット内のプログラムはVMで実行される
+    const std::string test_file_basic =
+        "../../tests/cases/vm/basic_subset.cb";
+    run_cb_test_with_output_and_time_auto(
+        vm + test_file_basic, [](const std::string &output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Expected successful exit");
+            INTEGRATION_ASSERT_CONTAINS(output, "610\n",
+                                        "Expected recursive fib(15)");
+            INTEGRATION_ASSERT_CONTAINS(output, "10 16 10000000000",
+                                        "Expected globals and long values");
+            INTEGRATION_ASSERT_CONTAINS(output, "sum: 625",
+                                        "Expected break/continue in for");
+            INTEGRATION_ASSERT_CONTAINS(output, "2 2\n",
+                                        "Expected pre/post increment");
+            INTEGRATION_ASSERT_CONTAINS(output, "5 12\n",
+                                        "Expected array increment and gcd");
+            INTEGRATION_ASSERT_CONTAINS(output, "0 1 0 -1 -3 1024",
+                                        "Expected operator results");
+            INTEGRATION_ASSERT_CONTAINS(output, "total: 11",
+                                        "Expected 2D array literal sum");
+            INTEGRATION_ASSERT_CONTAINS(output, "tab\there",
+                                        "Expected escape processing");
+        });
+    integration_test_passed_with_time_auto("vm basic subset", test_file_basic);
+
+    // サブセット外のプログラムはツリーウォーカーにフォールバックする
+    const std::string test_file_fallback =
+        "../../tests/cases/vm/fallback_struct.cb";
+    run_cb_test_with_output_and_time_auto(
+        vm + test_file_fallback, [](const std::string &output, int exit_code) {
+            INTEGRATION_ASSERT_EQ(0, exit_code, "Expected successful exit");
+            INTEGRATION_ASSERT_CONTAINS(output, "point: 7",
+                                        "Expected tree-walker fallback");
+        });
+    integration_test_passed_with_time_auto("vm fallback", test_file_fallback);
+
+    // 実行時エラーはツリーウォーカーと同じメッセージになる
+    const std::string test_file_range = "../../tests/cases/vm/range_error.cb";
+    run_cb_test_with_output_and_time_auto(
+        vm + test_file_range, [](const std::string &output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "Expected error exit");
+            INTEGRATION_ASSERT_CONTAINS(output, "before",
+                                        "Expected output before error");
+            INTEGRATION_ASSERT_CONTAINS(output,
+                                        "Error: Value out of range for type",
+                                        "Expected range error message");
+            INTEGRATION_ASSERT_NOT_CONTAINS(output, "after",
+                                            "Expected execution to stop");
+        });
+    integration_test_passed_with_error_and_time_auto("vm range error",
+                                                     test_file_range);
+
+    const std::string test_file_zero = "../../tests/cases/vm/zero_division.cb";
+    run_cb_test_with_output_and_time_auto(
+        vm + test_file_zero, [](const std::string &output, int exit_code) {
+            INTEGRATION_ASSERT_NE(0, exit_code, "Expected error exit");
+            INTEGRATION_ASSERT_CONTAINS(output, "Error: Division by zero",
+                                        "Expected zero division message");
+        });
+    integration_test_passed_with_error_and_time_auto("vm zero division",
+                                                     test_file_zero);
+}
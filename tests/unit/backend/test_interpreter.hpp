@@ -1,6 +1,9 @@
 #pragma once
 #include "../framework/test_framework.hpp"
+#include "../../../src/backend/interpreter/core/builtin_registry.h"
 #include "../../../src/backend/interpreter/core/interpreter.h"
+#include "../../../src/backend/interpreter/evaluator/functions/generic_instantiation.h"
+#include "../../../src/backend/interpreter/event_loop/event_loop.h"
 #include <memory>
 
 inline void test_interpreter_creation() {
@@ -58,9 +61,204 @@ inline void test_simple_ast_evaluation() {
     ASSERT_EQ(30, result);
 }
 
+inline void test_native_builtin_registration() {
+    Interpreter interpreter(false);
+
+    // 埋め込み側からネイティブ組み込み関数を登録
+    BuiltinId id = interpreter.get_builtin_registry().register_native(
+        "triple", [](Interpreter &, const std::vector<TypedValue> &args) {
+            return TypedValue(args[0].as_numeric() * 3,
+                              InferredType(TYPE_INT, "int"));
+        });
+    ASSERT_TRUE(BuiltinRegistry::is_native(id));
+
+    // triple(14) を評価
+    auto call = std::make_unique<ASTNode>(ASTNodeType::AST_FUNC_CALL);
+    call->name = "triple";
+    auto arg = std::make_unique<ASTNode>(ASTNodeType::AST_NUMBER);
+    arg->int_value = 14;
+    call->arguments.push_back(std::move(arg));
+
+    ASSERT_EQ(42, interpreter.evaluate(call.get()));
+    // 解決結果はノードにキャッシュされる
+    ASSERT_EQ(static_cast<int>(id), static_cast<int>(call->builtin_id));
+    ASSERT_EQ(42, interpreter.evaluate(call.get()));
+}
+
+inline void test_tagged_value_roundtrip() {
+    // スカラーはインラインで保持される
+    Value i = Value::integer(-7, TYPE_LONG);
+    ASSERT_TRUE(i.is_inline());
+    ASSERT_EQ(-7, i.as_int());
+    ASSERT_EQ(static_cast<int>(TYPE_LONG), static_cast<int>(i.type()));
+
+    Value d = Value::floating(2.5);
+    ASSERT_EQ(2, d.as_int());
+
+    // 文字列はボックス化され、コピーはボックスを共有する
+    Value s = Value::string("hello");
+    Value copy = s;
+    ASSERT_TRUE(copy.is_boxed());
+    ASSERT_TRUE(&s.as_string() == &copy.as_string());
+
+    // ReturnExceptionへの復元
+    ReturnException ret = i.to_return_exception();
+    ASSERT_EQ(-7, ret.value);
+    ASSERT_EQ(static_cast<int>(TYPE_LONG), static_cast<int>(ret.type));
+    ASSERT_STREQ("hello", copy.to_return_exception().str_value);
+}
+
+inline void test_struct_field_index() {
+    StructDefinition def("Point");
+    def.add_member("x", TYPE_INT);
+    def.add_member("y", TYPE_INT);
+    ASSERT_EQ(0, def.field_index("x"));
+    ASSERT_EQ(1, def.field_index("y"));
+    ASSERT_EQ(-1, def.field_index("z"));
+
+    // 件数を変えずにmembersを直接書き換えても古い索引を返さない
+    def.members[0].name = "z";
+    ASSERT_EQ(-1, def.field_index("x"));
+    ASSERT_EQ(0, def.field_index("z"));
+    std::swap(def.members[0], def.members[1]);
+    ASSERT_EQ(0, def.field_index("y"));
+    ASSERT_EQ(1, def.field_index("z"));
+    ASSERT_TRUE(def.find_member("y") == &def.members[0]);
+}
+
+inline void test_generic_instance_cache() {
+    // identity<T>(T x)
+    auto func = std::make_unique<ASTNode>(ASTNodeType::AST_FUNC_DECL);
+    func->name = "identity";
+    func->is_generic = true;
+    func->type_parameters = {"T"};
+    auto call = std::make_unique<ASTNode>(ASTNodeType::AST_FUNC_CALL);
+
+    // (関数, 型引数)ごとに1つのインスタンスを共有する
+    GenericInstantiation::InstanceCache cache;
+    const ASTNode *instance = cache.get_or_instantiate(func.get(), {"int"});
+    ASSERT_TRUE(instance == cache.get_or_instantiate(func.get(), {"int"}));
+    ASSERT_TRUE(instance != cache.get_or_instantiate(func.get(), {"long"}));
+    ASSERT_EQ(2, static_cast<int>(cache.size()));
+
+    cache.remember_call_site(call.get(), func.get(), instance);
+    ASSERT_TRUE(cache.call_site_instance(call.get(), func.get()) == instance);
+
+    // 別のキャッシュの記録は使わない
+    GenericInstantiation::InstanceCache other;
+    ASSERT_TRUE(other.call_site_instance(call.get(), func.get()) == nullptr);
+
+    // clear_cache()後は呼び出し箇所の記録も無効になる
+    cache.clear_cache();
+    ASSERT_EQ(0, static_cast<int>(cache.size()));
+    ASSERT_TRUE(cache.call_site_instance(call.get(), func.get()) == nullptr);
+}
+
+inline void test_packed_int_array() {
+    // tiny配列は1要素1バイトで格納される
+    PackedIntArray tiny_values;
+    tiny_values.set_element_type(TYPE_TINY, false);
+    tiny_values.assign(1000, 0);
+    ASSERT_EQ(1, static_cast<int>(tiny_values.element_size()));
+    ASSERT_TRUE(tiny_values.byte_size() < 1100);
+
+    tiny_values[3] = -128;
+    tiny_values[4] = 127;
+    tiny_values[4] -= 1;
+    ASSERT_EQ(-128, static_cast<int64_t>(tiny_values[3]));
+    ASSERT_EQ(126, tiny_values.get(4));
+
+    // 幅に収まらない値は64ビット幅に詰め直して保持する
+    tiny_values[5] = 1000;
+    ASSERT_EQ(8, static_cast<int>(tiny_values.element_size()));
+    ASSERT_EQ(1000, tiny_values.get(5));
+    ASSERT_EQ(-128, tiny_values.get(3));
+
+    // std::vector<int64_t> との相互変換では幅を保つ
+    PackedIntArray shorts;
+    shorts.set_element_type(TYPE_SHORT, true);
+    shorts = std::vector<int64_t>{1, 65535, 3};
+    ASSERT_EQ(2, static_cast<int>(shorts.element_size()));
+    std::vector<int64_t> values(shorts);
+    ASSERT_EQ(3, static_cast<int>(values.size()));
+    ASSERT_EQ(65535, values[1]);
+
+    // アドレスを取られた配列は64ビット幅に固定され、以後は詰め直さない
+    PackedIntArray pinned;
+    pinned.set_element_type(TYPE_TINY, false);
+    pinned.assign(4, 1);
+    pinned.make_addressable();
+    void *address = pinned.address_of(2);
+    pinned.set_element_type(TYPE_TINY, false);
+    pinned[1] = 1000;
+    ASSERT_TRUE(pinned.addressable());
+    ASSERT_EQ(8, static_cast<int>(pinned.element_size()));
+    ASSERT_TRUE(pinned.address_of(2) == address);
+    ASSERT_EQ(1000, pinned.get(1));
+}
+
+inline void test_trace_categories() {
+    // 無効時はメッセージ引数を評価しない
+    bool saved_debug_mode = debug_mode;
+    int evaluated = 0;
+    auto expensive_arg = [&evaluated]() {
+        ++evaluated;
+        return "value";
+    };
+    debug_mode = false;
+    debug_msg(DebugMsgId::GENERIC_DEBUG, expensive_arg());
+    ASSERT_EQ(0, evaluated);
+
+    // カテゴリ単位で有効化できる
+    debug_mode = true;
+    ASSERT_TRUE(set_trace_categories("struct,call"));
+    ASSERT_TRUE(trace_category_enabled(TraceCategory::STRUCT));
+    ASSERT_TRUE(trace_category_enabled(TraceCategory::CALL));
+    ASSERT_FALSE(trace_category_enabled(TraceCategory::PARSER));
+    ASSERT_FALSE(trace_message_enabled(DebugMsgId::GENERIC_DEBUG));
+    ASSERT_TRUE(trace_category_of(DebugMsgId::PARSE_STRUCT_DEF) ==
+                TraceCategory::PARSER);
+    ASSERT_FALSE(set_trace_categories("no_such_category"));
+
+    ASSERT_TRUE(set_trace_categories("all"));
+    debug_mode = saved_debug_mode;
+}
+
+inline void test_event_loop_timer_order() {
+    // タイマーは登録順ではなく実行時刻順に実行される
+    cb::EventLoop loop;
+    std::vector<int> order;
+    loop.schedule_delayed_task([&order]() { order.push_back(30); },
+                               std::chrono::milliseconds(30));
+    loop.schedule_delayed_task([&order]() { order.push_back(10); },
+                               std::chrono::milliseconds(10));
+    loop.schedule_delayed_task([&order]() { order.push_back(20); },
+                               std::chrono::milliseconds(20));
+    loop.schedule_task([&order]() { order.push_back(0); });
+
+    auto start = std::chrono::steady_clock::now();
+    loop.run();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(4, static_cast<int>(order.size()));
+    ASSERT_EQ(0, order[0]);
+    ASSERT_EQ(10, order[1]);
+    ASSERT_EQ(20, order[2]);
+    ASSERT_EQ(30, order[3]);
+    ASSERT_TRUE(elapsed >= std::chrono::milliseconds(30));
+    ASSERT_FALSE(loop.has_pending_tasks());
+}
+
 inline void register_interpreter_tests() {
     RUN_TEST("interpreter_creation", test_interpreter_creation);
     RUN_TEST("simple_number_evaluation", test_simple_number_evaluation);
     RUN_TEST("string_literal_evaluation", test_string_literal_evaluation);
     RUN_TEST("simple_ast_evaluation", test_simple_ast_evaluation);
+    RUN_TEST("native_builtin_registration", test_native_builtin_registration);
+    RUN_TEST("tagged_value_roundtrip", test_tagged_value_roundtrip);
+    RUN_TEST("struct_field_index", test_struct_field_index);
+    RUN_TEST("generic_instance_cache", test_generic_instance_cache);
+    RUN_TEST("packed_int_array", test_packed_int_array);
+    RUN_TEST("trace_categories", test_trace_categories);
+    RUN_TEST("event_loop_timer_order", test_event_loop_timer_order);
 }